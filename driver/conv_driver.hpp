@@ -56,7 +56,7 @@
 #include <miopen/convolution.hpp>
 #include <miopen/solver.hpp>
 #include <miopen/find_controls.hpp>
-#include "random.hpp"
+#include <miopen/philox.hpp>
 #include <numeric>
 #include <sstream>
 #include <vector>
@@ -845,18 +845,29 @@ std::vector<int> ConvDriver<Tgpu, Tref>::GetOutputTensorLengths()
 
 namespace detail {
 
+// Streams of the random generator used for the buffers of the driver.
+enum RandomStream : std::uint64_t
+{
+    Input,
+    Weights,
+    Output,
+    Bias,
+    BiasGrad,
+};
+
+// Maps u from [0, 1) to the range of the weights.
 template <typename T>
-T RanGenWeights()
+T RanGenWeights(float u)
 {
-    return RAN_GEN<T>(static_cast<T>(-0.5), static_cast<T>(0.5));
+    return static_cast<T>(u - 0.5f);
 }
 
 // Shift FP16 distribution towards positive numbers,
 // otherwise Winograd FP16 validation fails.
 template <>
-float16 RanGenWeights()
+float16 RanGenWeights(float u)
 {
-    return RAN_GEN<float16>(static_cast<float16>(-1.0 / 3.0), static_cast<float16>(0.5));
+    return static_cast<float16>(u * (0.5f + 1.0f / 3.0f) - 1.0f / 3.0f);
 }
 
 } // namespace detail
@@ -1073,8 +1084,13 @@ int ConvDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
     std::string doutFileName = inflags.GetValueStr("dout_data");
 
     /* Unless seed is persistent between runs validation using cache stored in file is impossible.
+     * Every buffer is filled from its own stream of a counter based generator, so it gets the same
+     * values regardless of which kinds of convolutions are selected for testing (see the "-F"
+     * option). Verification cache would be broken otherwise.
      */
-    srand(0);
+    const auto fill = [](detail::RandomStream stream, auto* data, std::size_t n, auto f) {
+        miopen::ParRandomFill(miopen::Philox4x32{0, stream}, data, n, f);
+    };
 
     bool dataRead = false;
     if(is_fwd || is_wrw)
@@ -1090,21 +1106,11 @@ int ConvDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
     {
         float Data_scale = 127.0;
 
-        if(!dataRead)
+        if(!dataRead && (is_fwd || is_wrw))
         {
-            for(int i = 0; i < in_sz; i++)
-            {
-                if(is_fwd || is_wrw)
-                    in.data[i] =
-                        static_cast<Tgpu>(Data_scale * RAN_GEN<float>(static_cast<float>(0.0),
-                                                                      static_cast<float>(1.0)));
-                else /// \anchor move_rand
-                    /// Move rand() forward, even if buffer is unused. This provides the same
-                    /// initialization of input buffers regardless of which kinds of
-                    /// convolutions are currently selectedfor testing (see the "-F" option).
-                    /// Verification cache would be broken otherwise.
-                    rand();
-            }
+            fill(detail::RandomStream::Input, in.data.data(), in_sz, [=](float u) {
+                return static_cast<Tgpu>(Data_scale * u);
+            });
         }
 
         if(inflags.GetValueInt("bias") != 0)
@@ -1112,10 +1118,10 @@ int ConvDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
             size_t b_sz = GetTensorSize(biasTensor);
             b_dev       = std::unique_ptr<GPUMem>(new GPUMem(ctx, b_sz, sizeof(float)));
             b_int8      = std::vector<float>(b_sz, static_cast<float>(0));
+            fill(detail::RandomStream::Bias, b_int8.data(), b_sz, [](float u) { return u; });
             for(int i = 0; i < b_sz; i++)
             {
-                b_int8[i] = static_cast<float>(i % 8) +
-                            RAN_GEN<float>(static_cast<float>(0.0), static_cast<float>(1.0));
+                b_int8[i] += static_cast<float>(i % 8);
             }
 
             if(!biasFileName.empty())
@@ -1126,14 +1132,11 @@ int ConvDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
             b_dev->ToGPU(q, b_int8.data());
         }
 
-        if(!weiRead)
+        if(!weiRead && (is_fwd || is_bwd))
         {
-            for(int i = 0; i < wei_sz; i++)
-                if(is_fwd || is_bwd)
-                    wei.data[i] =
-                        static_cast<Tgpu>(Data_scale * 2 * detail::RanGenWeights<float>());
-                else /// \ref move_rand
-                    rand();
+            fill(detail::RandomStream::Weights, wei.data.data(), wei_sz, [=](float u) {
+                return static_cast<Tgpu>(Data_scale * 2 * detail::RanGenWeights<float>(u));
+            });
         }
     }
     else
@@ -1145,26 +1148,18 @@ int ConvDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
             if(!doutFileName.empty())
                 doutRead = readBufferFromFile<Tgpu>(dout.data.data(), out_sz, doutFileName.c_str());
 
-        if(!dataRead)
+        if(!dataRead && (is_fwd || is_wrw))
         {
-            for(int i = 0; i < in_sz; i++)
-            {
-                if(is_fwd || is_wrw)
-                    in.data[i] =
-                        Data_scale * RAN_GEN<Tgpu>(static_cast<Tgpu>(0.0), static_cast<Tgpu>(1.0));
-                else /// \ref move_rand
-                    rand();
-            }
+            fill(detail::RandomStream::Input, in.data.data(), in_sz, [=](float u) {
+                return static_cast<Tgpu>(Data_scale * static_cast<Tgpu>(u));
+            });
         }
 
-        if(!doutRead)
+        if(!doutRead && (is_bwd || is_wrw))
         {
-            for(int i = 0; i < out_sz; i++)
-                if(is_bwd || is_wrw)
-                    dout.data[i] =
-                        Data_scale * RAN_GEN<Tgpu>(static_cast<Tgpu>(0.0), static_cast<Tgpu>(1.0));
-                else /// \ref move_rand
-                    rand();
+            fill(detail::RandomStream::Output, dout.data.data(), out_sz, [=](float u) {
+                return static_cast<Tgpu>(Data_scale * static_cast<Tgpu>(u));
+            });
         }
 
         if(inflags.GetValueInt("bias") != 0)
@@ -1175,12 +1170,14 @@ int ConvDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
             b           = tensor<Tgpu>(miopen::deref(biasTensor).GetLengths());
             db          = std::vector<Tgpu>(b_sz, static_cast<Tgpu>(0));
             db_host     = tensor<Tref>(miopen::deref(biasTensor).GetLengths());
+
+            const auto uniform = [](float u) { return static_cast<Tgpu>(u); };
+            fill(detail::RandomStream::Bias, b.data.data(), b_sz, uniform);
+            fill(detail::RandomStream::BiasGrad, db.data(), b_sz, uniform);
             for(int i = 0; i < b_sz; i++)
             {
-                b.data[i] = static_cast<Tgpu>(i % 8) +
-                            RAN_GEN<Tgpu>(static_cast<Tgpu>(0.0), static_cast<Tgpu>(1.0));
-                db[i] = static_cast<Tgpu>(i % 8) +
-                        RAN_GEN<Tgpu>(static_cast<Tgpu>(0.0), static_cast<Tgpu>(1.0));
+                b.data[i] = static_cast<Tgpu>(i % 8) + b.data[i];
+                db[i]     = static_cast<Tgpu>(i % 8) + db[i];
             }
 
             if(!biasFileName.empty())
@@ -1192,13 +1189,11 @@ int ConvDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
             db_dev->ToGPU(q, db.data());
         }
 
-        if(!weiRead)
+        if(!weiRead && (is_fwd || is_bwd))
         {
-            for(int i = 0; i < wei_sz; i++)
-                if(is_fwd || is_bwd)
-                    wei.data[i] = Data_scale * detail::RanGenWeights<Tgpu>();
-                else /// \ref move_rand
-                    rand();
+            fill(detail::RandomStream::Weights, wei.data.data(), wei_sz, [=](float u) {
+                return static_cast<Tgpu>(Data_scale * detail::RanGenWeights<Tgpu>(u));
+            });
         }
     }
 
@@ -2836,6 +2831,9 @@ std::string ConvDriver<Tgpu, Tref>::GetVerificationCacheFileName() const
        << "GPU" << get_datatype_string(Tgpu{});
     ss << "_"
        << "REF" << get_datatype_string(Tref{});
+    // Buffers are initialized by the counter based generator.
+    ss << "_"
+       << "philox";
 
     return ss.str();
 }
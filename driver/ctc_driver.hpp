@@ -166,7 +166,8 @@ int CTCDriver<Tgpu, Tref>::AddCmdLineArgs()
     inflags.AddInputFlag("verify_path",
                          'v',
                          "1",
-                         "Verify Path for CTC losses and gradients: fast 1, regular 0 (Default=1)",
+                         "Verify Path for CTC losses and gradients: fast 1, regular 0, "
+                         "GPU emulator 2 (Default=1)",
                          "int");
     inflags.AddInputFlag("time", 't', "0", "Time Each Layer (Default=0)", "int");
     inflags.AddInputFlag(
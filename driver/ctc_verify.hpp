@@ -38,6 +38,7 @@
 #include <vector>
 #include <array>
 #include "ctc_gpu_emulator.hpp"
+#include "../test/cpu_ctc.hpp"
 
 #define NEGATIVE_CUTOFF_VAL (-1e20)
 
@@ -374,8 +375,27 @@ void RunCTCLossCPUVerify(const int num_class,
         return;
     }
 
-    std::vector<Tref> beta_loss(batch_size, 0);
     if(verify_path == 1)
+    {
+        cpu_ctc_loss(max_time_step,
+                     batch_size,
+                     class_sz,
+                     ctc_strides{probsStride[0], probsStride[1], probsStride[2]},
+                     probs.data(),
+                     labels.data(),
+                     labelLengths.data(),
+                     inputLengths.data(),
+                     losses_host.data(),
+                     ctc_strides{gradientsStride[0], gradientsStride[1], gradientsStride[2]},
+                     gradients_host.data(),
+                     blank_lb,
+                     is_softmax_applied);
+        (void)workspace_host;
+        return;
+    }
+
+    std::vector<Tref> beta_loss(batch_size, 0);
+    if(verify_path == 2)
     {
         std::vector<int> probsDesc = {max_time_step,
                                       batch_size,
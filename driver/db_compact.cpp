@@ -0,0 +1,170 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Compacts perf-db and find-db files. User dbs given with --merge are merged into the db, entries
+// of unregistered solvers and values that do not parse are dropped, duplicate and shadowed
+// records are removed and the records are sorted by key. With --target the perf-db configs are
+// also checked by their solvers for the device. Reports the size and the lookup time of the db
+// before and after.
+//
+//   MIOpenDbCompact [--merge <db>]... [--output <db>] [--target <device>:<CUs>] [--find-db]
+//                   [--dry-run] <db>
+//
+// Files named like find-dbs (*.fdb.txt, *.ufdb.txt) are treated as find-dbs, SQLite files as
+// SQLite perf-dbs. The db is replaced unless --output is given.
+
+#include <miopen/db_compact.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/kernel_cache_builder.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+int Usage(const char* name)
+{
+    std::cerr << "Usage: " << name
+              << " [--merge <db>]... [--output <db>] [--target <device>:<CUs>] [--find-db]"
+                 " [--dry-run] <db>"
+              << std::endl;
+    return EXIT_FAILURE;
+}
+
+// Lookups are timed with up to this many keys of the db.
+constexpr std::size_t max_timed_lookups = 1000;
+
+std::vector<std::string> SampleKeys(const std::string& path)
+{
+    auto keys = miopen::GetTextDbKeys(path);
+    if(keys.size() <= max_timed_lookups)
+        return keys;
+    std::vector<std::string> sample;
+    for(std::size_t i = 0; i < max_timed_lookups; i++)
+        sample.push_back(keys[i * keys.size() / max_timed_lookups]);
+    return sample;
+}
+
+void Report(const miopen::DbCompactResult& result)
+{
+    std::cout << result.records << " records, " << result.entries << " entries, "
+              << result.merged << " merged" << std::endl;
+    std::cout << "Dropped: " << result.shadowed << " shadowed, " << result.unknown_solvers
+              << " of unknown solvers, " << result.invalid_values << " invalid, "
+              << result.malformed << " malformed" << std::endl;
+    std::cout << "Size: " << result.size_before << " -> " << result.size_after << " bytes";
+    if(result.size_before != 0)
+        std::cout << " (" << 100.0 * result.size_after / result.size_before << "%)";
+    std::cout << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> merge;
+    std::string output;
+    std::string target;
+    bool find_db = false;
+    bool dry_run = false;
+    std::string input;
+    for(int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const bool has_value  = i + 1 < argc;
+        if(arg == "--merge" && has_value)
+            merge.push_back(argv[++i]);
+        else if(arg == "--output" && has_value)
+            output = argv[++i];
+        else if(arg == "--target" && has_value)
+            target = argv[++i];
+        else if(arg == "--find-db")
+            find_db = true;
+        else if(arg == "--dry-run")
+            dry_run = true;
+        else if(input.empty())
+            input = arg;
+        else
+            return Usage(argv[0]);
+    }
+    if(input.empty())
+        return Usage(argv[0]);
+    if(output.empty())
+        output = input;
+
+    try
+    {
+        const auto name = boost::filesystem::path{input}.filename().string();
+        find_db = find_db || name.find(".fdb.") != std::string::npos ||
+                  name.find(".ufdb.") != std::string::npos;
+
+        std::unique_ptr<miopen::Handle> handle;
+        if(!target.empty())
+        {
+            const auto device = miopen::ParseKernelCacheTarget(target);
+            handle = std::make_unique<miopen::Handle>(device.device, device.num_cu);
+        }
+        const auto check =
+            find_db ? miopen::MakeFindDbChecker() : miopen::MakePerfDbChecker(handle.get());
+
+        if(miopen::IsSQLiteDb(input))
+        {
+#if MIOPEN_ENABLE_SQLITE
+            if(find_db)
+                MIOPEN_THROW("Find-dbs are text files: " + input);
+            Report(miopen::CompactSQLitePerfDb(input, merge, output, check, dry_run));
+            return EXIT_SUCCESS;
+#else
+            MIOPEN_THROW("SQLite dbs require MIOPEN_ENABLE_SQLITE: " + input);
+#endif
+        }
+
+        const bool exists = boost::filesystem::exists(input);
+        const auto keys   = exists ? SampleKeys(input) : std::vector<std::string>{};
+        const auto before = miopen::MeasureTextDbLookups(input, keys);
+
+        const auto result = miopen::CompactTextDb(input, merge, output, !find_db, check, dry_run);
+        Report(result);
+        if(!dry_run && exists)
+        {
+            const auto after = miopen::MeasureTextDbLookups(output, keys);
+            std::cout << "Lookup: " << before << " -> " << after << " us" << std::endl;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
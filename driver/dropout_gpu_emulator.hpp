@@ -40,64 +40,14 @@
 #include <array>
 #include <miopen/dropout.hpp>
 #include <miopen/float_equal.hpp>
-#include <miopen/precalc_xorwow_skipahead_matrices.hpp>
-#include <miopen/precalc_xorwow_skipahead_sequence_matrices.hpp>
+#include <miopen/par_for.hpp>
+#include <miopen/xorwow_skipahead.hpp>
 #include "xorwow_skipahead_generator.hpp"
 
 #define ROCRAND_2POW32_INV (2.3283064e-10f)
 
 float uniform_distribution_emu(size_t v) { return ROCRAND_2POW32_INV + (v * ROCRAND_2POW32_INV); }
 
-void xorwow_skipahead_emu(unsigned long long skp,
-                          prngStates* state,
-                          const unsigned int skipahead_mat[XORWOW_PRECALC_MATRICES_NUM]
-                                                          [XORWOW_PRECALC_MATRICES_SZ])
-{
-    unsigned int xor_vec[XORWOW_DIM];
-    unsigned int* p = &(state->x);
-    std::copy(p, p + XORWOW_DIM, std::begin(xor_vec));
-
-    unsigned int mat_idx = 0;
-    while(bool(skp)
-#if(XORWOW_PRECALC_MATRICES_NUM * XORWOW_JUMP_LOG2) < 64
-          &&
-          mat_idx < XORWOW_PRECALC_MATRICES_NUM
-#endif
-          )
-    {
-        for(unsigned int i = 0; i < static_cast<unsigned int>(skp & XORWOW_JUMP_LOG2_MASK); i++)
-        {
-            mat_vec(skipahead_mat[mat_idx], xor_vec);
-        }
-        skp >>= XORWOW_JUMP_LOG2;
-        mat_idx++;
-    }
-
-#if(XORWOW_PRECALC_MATRICES_NUM * XORWOW_JUMP_LOG2) < 64
-    if(skp)
-    {
-        unsigned int matrixA[XORWOW_PRECALC_MATRICES_SZ], matrixB[XORWOW_PRECALC_MATRICES_SZ];
-        std::copy(&(skipahead_mat[XORWOW_PRECALC_MATRICES_NUM - 1][0]),
-                  &(skipahead_mat[XORWOW_PRECALC_MATRICES_NUM - 1][0]) + XORWOW_PRECALC_MATRICES_SZ,
-                  std::begin(matrixA));
-
-        while(skp)
-        {
-            mat_pow(matrixB, matrixA, 1ULL << XORWOW_JUMP_LOG2);
-            std::copy(std::begin(matrixB), std::end(matrixB), std::begin(matrixA));
-
-            for(unsigned int i = 0; i < static_cast<unsigned int>(skp & XORWOW_JUMP_LOG2_MASK); i++)
-            {
-                mat_vec(matrixA, xor_vec);
-            }
-            skp >>= XORWOW_JUMP_LOG2;
-        }
-    }
-#endif
-
-    std::copy(std::begin(xor_vec), std::end(xor_vec), p);
-}
-
 void xorwow_lite_init_emu(prngStates* cur_state,
                           const unsigned long long seed,
                           const unsigned long long subsequence,
@@ -123,36 +73,29 @@ void xorwow_lite_init_emu(prngStates* cur_state,
     cur_state->v += t0;
     cur_state->d += t1 + t0;
 
-    xorwow_skipahead_emu(subsequence, cur_state, precalc_xorwow_skipahead_sequence_matrices);
+    miopen::XorwowSkipAhead::Sequence().Apply(subsequence, *cur_state);
 
-    xorwow_skipahead_emu(offset, cur_state, precalc_xorwow_skipahead_matrices);
+    miopen::XorwowSkipAhead::Offset().Apply(offset, *cur_state);
     cur_state->d += static_cast<unsigned int>(offset) * 362437;
 }
 
 void InitKernelStateEmulator(std::vector<prngStates>& states,
                              const miopenDropoutDescriptor_t dropoutDesc)
 {
-    size_t states_num = miopen::deref(dropoutDesc).stateSizeInBytes / sizeof(prngStates);
-    size_t wk_grp_num = std::min(size_t(MAX_PRNG_STATE / 256), (states_num + 255) / 256);
-    size_t glb_sz     = wk_grp_num * 256;
+    const size_t states_num = miopen::deref(dropoutDesc).stateSizeInBytes / sizeof(prngStates);
+    const auto seed         = miopen::deref(dropoutDesc).seed;
 
-    for(size_t j = 0; j < (states_num + glb_sz - 1) / glb_sz; j++)
-    {
-        for(size_t i = 0; i < glb_sz; i++)
-        {
-            size_t gid                = i + j * glb_sz;
-            unsigned long long seq    = gid;
-            unsigned long long offset = 0;
-            xorwow_lite_init_emu(&states[gid], miopen::deref(dropoutDesc).seed, seq, offset);
-        }
-    }
+    // State gid starts at subsequence gid, the states are independent of each other.
+    miopen::par_for(std::min(states_num, states.size()), [&](size_t gid) {
+        xorwow_lite_init_emu(&states[gid], seed, gid, 0);
+    });
 }
 
 template <typename T>
-inline void ExpandTensorDim(std::vector<T> x_len,
-                            std::vector<T> x_str,
-                            std::vector<T> y_len,
-                            std::vector<T> y_str,
+inline void ExpandTensorDim(const miopen::TensorDims& x_len,
+                            const miopen::TensorDims& x_str,
+                            const miopen::TensorDims& y_len,
+                            const miopen::TensorDims& y_str,
                             std::vector<T>& in_len,
                             std::vector<T>& in_str,
                             std::vector<T>& out_len,
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Tunes the convolutions of a whole network ahead of time. The problems are read from a file,
+// one MIOpenDriver command line or find-db key per line, every unique problem is measured once
+// and the results go to the user find-db and perf-db (see MIOPEN_USER_DB_PATH).
+//
+//   MIOpenFindPlanner [--search] [--dry-run] <problems file or - for stdin>
+
+#include <miopen/convolution.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/find_planner.hpp>
+#include <miopen/handle.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using miopen::conv::Direction;
+
+// Runs the Find() of the problem, which stores the results in the user find-db.
+std::vector<miopenConvAlgoPerf_t>
+Find(miopen::Handle& handle, const miopen::conv::ProblemDescription& problem, bool search)
+{
+    const auto direction = problem.GetDirection();
+    const auto& conv     = problem.GetConv();
+    const bool forward   = direction == Direction::Forward;
+    const auto& x        = forward ? problem.GetIn() : problem.GetOut();
+    const auto& w        = problem.GetWeights();
+    const auto& y        = forward ? problem.GetOut() : problem.GetIn();
+
+    std::size_t workspace_size = 0;
+    switch(direction)
+    {
+    case Direction::Forward: workspace_size = conv.ForwardGetWorkSpaceSize(handle, w, x, y); break;
+    case Direction::BackwardData:
+        workspace_size = conv.BackwardDataGetWorkSpaceSize(handle, w, y, x);
+        break;
+    case Direction::BackwardWeights:
+        workspace_size = conv.BackwardWeightsGetWorkSpaceSize(handle, y, x, w);
+        break;
+    }
+
+    auto x_buf     = handle.Create(x.GetNumBytes());
+    auto w_buf     = handle.Create(w.GetNumBytes());
+    auto y_buf     = handle.Create(y.GetNumBytes());
+    auto workspace = handle.Create(workspace_size);
+
+    int count = 0;
+    std::vector<miopenConvAlgoPerf_t> perf(8);
+    const auto request = static_cast<int>(perf.size());
+    switch(direction)
+    {
+    case Direction::Forward:
+        conv.FindConvFwdAlgorithm(handle,
+                                  x,
+                                  x_buf.get(),
+                                  w,
+                                  w_buf.get(),
+                                  y,
+                                  y_buf.get(),
+                                  request,
+                                  &count,
+                                  perf.data(),
+                                  workspace.get(),
+                                  workspace_size,
+                                  search);
+        break;
+    case Direction::BackwardData:
+        conv.FindConvBwdDataAlgorithm(handle,
+                                      y,
+                                      y_buf.get(),
+                                      w,
+                                      w_buf.get(),
+                                      x,
+                                      x_buf.get(),
+                                      request,
+                                      &count,
+                                      perf.data(),
+                                      workspace.get(),
+                                      workspace_size,
+                                      search);
+        break;
+    case Direction::BackwardWeights:
+        conv.FindConvBwdWeightsAlgorithm(handle,
+                                         y,
+                                         y_buf.get(),
+                                         x,
+                                         x_buf.get(),
+                                         w,
+                                         w_buf.get(),
+                                         request,
+                                         &count,
+                                         perf.data(),
+                                         workspace.get(),
+                                         workspace_size,
+                                         search);
+        break;
+    }
+    perf.resize(count);
+    return perf;
+}
+
+int Usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [--search] [--dry-run] <problems file or ->" << std::endl;
+    return EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    bool search  = false;
+    bool dry_run = false;
+    std::string input;
+    for(int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        if(arg == "--search")
+            search = true;
+        else if(arg == "--dry-run")
+            dry_run = true;
+        else if(input.empty())
+            input = arg;
+        else
+            return Usage(argv[0]);
+    }
+    if(input.empty())
+        return Usage(argv[0]);
+
+    try
+    {
+        std::ifstream file;
+        if(input != "-")
+        {
+            file.open(input);
+            if(!file)
+                MIOPEN_THROW("Cannot open " + input);
+        }
+        const auto plan = miopen::ReadFindPlan(input == "-" ? std::cin : file);
+        std::cout << plan.total << " problems, " << plan.problems.size() << " unique"
+                  << std::endl;
+
+        miopen::Handle handle;
+        const auto jobs = miopen::MakeFindPlanJobs(plan, [&](const auto& problem) {
+            return miopen::FindPlanSolutions(handle, problem);
+        });
+        std::cout << jobs.programs.size() << " programs to build" << std::endl;
+
+        if(dry_run)
+        {
+            for(const auto& program : jobs.programs)
+                std::cout << program.kernel.kernel_file << " '" << program.kernel.comp_options
+                          << "' used by " << program.problems.size() << " problems" << std::endl;
+            for(const auto& item : plan.problems)
+                std::cout << item.problem << " x" << item.uses << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+        // Build everything in parallel up front, the measurements then find the programs in
+        // the cache of the handle.
+        miopen::solver::PrecompileSolutions(handle, jobs.GetAllSolutions());
+
+        for(const auto& item : plan.problems)
+        {
+            const auto perf = Find(handle, item.problem, search);
+            std::cout << item.problem << " x" << item.uses;
+            if(!perf.empty())
+                std::cout << ": " << perf.front().time << " ms";
+            std::cout << std::endl;
+        }
+    }
+    catch(const miopen::Exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -7,6 +7,7 @@
 #include <cassert>
 #include <algorithm>
 #include "dropout_gpu_emulator.hpp"
+#include "rnn_cpu_gemm.hpp"
 
 template <typename Tgpu, typename Tref>
 void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
@@ -175,23 +176,23 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
             }
             else
             {
-                ADNN_mm_cpu<Tref>(const_cast<Tref*>(in_state),
-                                  in_h,
-                                  batch_n,
-                                  in_stride,
-                                  0,
-                                  const_cast<Tref*>(wei_state),
-                                  in_h,
-                                  hy_h * bi * 3,
-                                  in_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  &hid_state[hid_shift],
-                                  hy_h * bi * 3,
-                                  batch_n,
-                                  hy_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(const_cast<Tref*>(in_state),
+                                 in_h,
+                                 batch_n,
+                                 in_stride,
+                                 0,
+                                 const_cast<Tref*>(wei_state),
+                                 in_h,
+                                 hy_h * bi * 3,
+                                 in_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 &hid_state[hid_shift],
+                                 hy_h * bi * 3,
+                                 batch_n,
+                                 hy_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 // from bias
                 if(biased)
@@ -231,24 +232,24 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
                 prelayer_shift = drop_out_offset;
             }
 
-            ADNN_mm_cpu<Tref>(use_dropout ? &dropout_hid_state[prelayer_shift]
-                                          : &hid_state[prelayer_shift],
-                              hy_h * bi,
-                              batch_n,
-                              use_dropout ? hy_h * bi : hy_stride,
-                              0,
-                              const_cast<Tref*>(&wei_state[wei_shift]),
-                              hy_h * bi,
-                              hy_h * bi * 3,
-                              bi_stride,
-                              ADNN_MM_TRANSPOSE,
-                              &hid_state[hid_shift],
-                              hy_h * bi * 3,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(use_dropout ? &dropout_hid_state[prelayer_shift]
+                                         : &hid_state[prelayer_shift],
+                             hy_h * bi,
+                             batch_n,
+                             use_dropout ? hy_h * bi : hy_stride,
+                             0,
+                             const_cast<Tref*>(&wei_state[wei_shift]),
+                             hy_h * bi,
+                             hy_h * bi * 3,
+                             bi_stride,
+                             ADNN_MM_TRANSPOSE,
+                             &hid_state[hid_shift],
+                             hy_h * bi * 3,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             1,
+                             1);
 
             // from bias
             if(biased)
@@ -276,23 +277,23 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
             {
                 if(!hx_is_null)
                 {
-                    ADNN_mm_cpu<Tref>(const_cast<Tref*>(&hx_state[hx_shift]),
-                                      hy_h,
-                                      in_n[ti],
-                                      uni_stride,
-                                      0,
-                                      const_cast<Tref*>(&wei_state[wei_shift]),
-                                      hy_h,
-                                      hy_h * 2,
-                                      uni_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      &hid_state[hid_shift + bacc * hy_stride],
-                                      hy_h * 2,
-                                      in_n[ti],
-                                      hy_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(const_cast<Tref*>(&hx_state[hx_shift]),
+                                     hy_h,
+                                     in_n[ti],
+                                     uni_stride,
+                                     0,
+                                     const_cast<Tref*>(&wei_state[wei_shift]),
+                                     hy_h,
+                                     hy_h * 2,
+                                     uni_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     &hid_state[hid_shift + bacc * hy_stride],
+                                     hy_h * 2,
+                                     in_n[ti],
+                                     hy_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     if(biased)
                     {
@@ -310,24 +311,24 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
                         }
                     }
 
-                    ADNN_mm_cpu<Tref>(
-                        const_cast<Tref*>(&hx_state[hx_shift]),
-                        hy_h,
-                        in_n[ti],
-                        uni_stride,
-                        0,
-                        const_cast<Tref*>(&wei_state[wei_shift + 2 * hy_h * uni_stride]),
-                        hy_h,
-                        hy_h,
-                        uni_stride,
-                        ADNN_MM_TRANSPOSE,
-                        &hid_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
-                        hy_h,
-                        in_n[ti],
-                        hy_stride,
-                        0,
-                        1,
-                        1);
+                    RNN_mm_cpu<Tref>(
+                       const_cast<Tref*>(&hx_state[hx_shift]),
+                       hy_h,
+                       in_n[ti],
+                       uni_stride,
+                       0,
+                       const_cast<Tref*>(&wei_state[wei_shift + 2 * hy_h * uni_stride]),
+                       hy_h,
+                       hy_h,
+                       uni_stride,
+                       ADNN_MM_TRANSPOSE,
+                       &hid_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
+                       hy_h,
+                       in_n[ti],
+                       hy_stride,
+                       0,
+                       1,
+                       1);
 
                     if(biased)
                     {
@@ -344,24 +345,24 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
 
                     if(bidirection)
                     {
-                        ADNN_mm_cpu<Tref>(
-                            const_cast<Tref*>(&hx_state[hx_shift + hy_n * hy_h]),
-                            hy_h,
-                            in_n[seqLength - 1 - ti],
-                            uni_stride,
-                            0,
-                            const_cast<Tref*>(&wei_state[wei_shift + 3 * hy_h * uni_stride]),
-                            hy_h,
-                            hy_h * 2,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + baccbi * hy_stride + 3 * hy_h],
-                            hy_h * 2,
-                            in_n[seqLength - 1 - ti],
-                            hy_stride,
-                            0,
-                            1,
-                            1);
+                        RNN_mm_cpu<Tref>(
+                           const_cast<Tref*>(&hx_state[hx_shift + hy_n * hy_h]),
+                           hy_h,
+                           in_n[seqLength - 1 - ti],
+                           uni_stride,
+                           0,
+                           const_cast<Tref*>(&wei_state[wei_shift + 3 * hy_h * uni_stride]),
+                           hy_h,
+                           hy_h * 2,
+                           uni_stride,
+                           ADNN_MM_TRANSPOSE,
+                           &hid_state[hid_shift + baccbi * hy_stride + 3 * hy_h],
+                           hy_h * 2,
+                           in_n[seqLength - 1 - ti],
+                           hy_stride,
+                           0,
+                           1,
+                           1);
 
                         if(biased)
                         {
@@ -380,24 +381,24 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
                             }
                         }
 
-                        ADNN_mm_cpu<Tref>(
-                            const_cast<Tref*>(&hx_state[hx_shift + hy_n * hy_h]),
-                            hy_h,
-                            in_n[seqLength - 1 - ti],
-                            uni_stride,
-                            0,
-                            const_cast<Tref*>(&wei_state[wei_shift + 5 * hy_h * uni_stride]),
-                            hy_h,
-                            hy_h,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
-                            hy_h,
-                            in_n[seqLength - 1 - ti],
-                            hy_stride,
-                            0,
-                            1,
-                            1);
+                        RNN_mm_cpu<Tref>(
+                           const_cast<Tref*>(&hx_state[hx_shift + hy_n * hy_h]),
+                           hy_h,
+                           in_n[seqLength - 1 - ti],
+                           uni_stride,
+                           0,
+                           const_cast<Tref*>(&wei_state[wei_shift + 5 * hy_h * uni_stride]),
+                           hy_h,
+                           hy_h,
+                           uni_stride,
+                           ADNN_MM_TRANSPOSE,
+                           &hid_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
+                           hy_h,
+                           in_n[seqLength - 1 - ti],
+                           hy_stride,
+                           0,
+                           1,
+                           1);
 
                         if(biased)
                         {
@@ -416,23 +417,23 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
             }
             else
             {
-                ADNN_mm_cpu<Tref>(const_cast<Tref*>(&hy_state[hx_shift]),
-                                  hy_h,
-                                  in_n[ti],
-                                  uni_stride,
-                                  0,
-                                  const_cast<Tref*>(&wei_state[wei_shift]),
-                                  hy_h,
-                                  hy_h * 2,
-                                  uni_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  &hid_state[hid_shift + bacc * hy_stride],
-                                  hy_h * 2,
-                                  in_n[ti],
-                                  hy_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(const_cast<Tref*>(&hy_state[hx_shift]),
+                                 hy_h,
+                                 in_n[ti],
+                                 uni_stride,
+                                 0,
+                                 const_cast<Tref*>(&wei_state[wei_shift]),
+                                 hy_h,
+                                 hy_h * 2,
+                                 uni_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 &hid_state[hid_shift + bacc * hy_stride],
+                                 hy_h * 2,
+                                 in_n[ti],
+                                 hy_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 if(biased)
                 {
@@ -449,23 +450,23 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
                     }
                 }
 
-                ADNN_mm_cpu<Tref>(const_cast<Tref*>(&hy_state[hx_shift]),
-                                  hy_h,
-                                  in_n[ti],
-                                  uni_stride,
-                                  0,
-                                  const_cast<Tref*>(&wei_state[wei_shift + 2 * hy_h * uni_stride]),
-                                  hy_h,
-                                  hy_h,
-                                  uni_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  &hid_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
-                                  hy_h,
-                                  in_n[ti],
-                                  hy_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(const_cast<Tref*>(&hy_state[hx_shift]),
+                                 hy_h,
+                                 in_n[ti],
+                                 uni_stride,
+                                 0,
+                                 const_cast<Tref*>(&wei_state[wei_shift + 2 * hy_h * uni_stride]),
+                                 hy_h,
+                                 hy_h,
+                                 uni_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 &hid_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
+                                 hy_h,
+                                 in_n[ti],
+                                 hy_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 if(biased)
                 {
@@ -484,26 +485,26 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
 
                     if(!hx_is_null && in_n.at(seqLength - 1 - ti) > in_n.at(seqLength - ti))
                     {
-                        ADNN_mm_cpu<Tref>(
-                            const_cast<Tref*>(
-                                &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h]),
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            uni_stride,
-                            0,
-                            const_cast<Tref*>(&wei_state[wei_shift + 3 * hy_h * uni_stride]),
-                            hy_h,
-                            hy_h * 2,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
-                                       3 * hy_h],
-                            hy_h * 2,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            hy_stride,
-                            0,
-                            1,
-                            1);
+                        RNN_mm_cpu<Tref>(
+                           const_cast<Tref*>(
+                               &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h]),
+                           hy_h,
+                           (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
+                           uni_stride,
+                           0,
+                           const_cast<Tref*>(&wei_state[wei_shift + 3 * hy_h * uni_stride]),
+                           hy_h,
+                           hy_h * 2,
+                           uni_stride,
+                           ADNN_MM_TRANSPOSE,
+                           &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
+                                      3 * hy_h],
+                           hy_h * 2,
+                           (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
+                           hy_stride,
+                           0,
+                           1,
+                           1);
 
                         if(biased)
                         {
@@ -523,26 +524,26 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
                             }
                         }
 
-                        ADNN_mm_cpu<Tref>(
-                            const_cast<Tref*>(
-                                &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h]),
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            uni_stride,
-                            0,
-                            const_cast<Tref*>(&wei_state[wei_shift + 5 * hy_h * uni_stride]),
-                            hy_h,
-                            hy_h,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
-                                       bi * 3 * hy_h + hy_h],
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            hy_stride,
-                            0,
-                            1,
-                            1);
+                        RNN_mm_cpu<Tref>(
+                           const_cast<Tref*>(
+                               &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h]),
+                           hy_h,
+                           (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
+                           uni_stride,
+                           0,
+                           const_cast<Tref*>(&wei_state[wei_shift + 5 * hy_h * uni_stride]),
+                           hy_h,
+                           hy_h,
+                           uni_stride,
+                           ADNN_MM_TRANSPOSE,
+                           &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
+                                      bi * 3 * hy_h + hy_h],
+                           hy_h,
+                           (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
+                           hy_stride,
+                           0,
+                           1,
+                           1);
 
                         if(biased)
                         {
@@ -559,24 +560,24 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
                         }
                     }
 
-                    ADNN_mm_cpu<Tref>(
-                        const_cast<Tref*>(&hy_state[hx_shift + hy_n * hy_h]),
-                        hy_h,
-                        in_n[seqLength - ti],
-                        uni_stride,
-                        0,
-                        const_cast<Tref*>(&wei_state[wei_shift + 3 * hy_h * uni_stride]),
-                        hy_h,
-                        hy_h * 2,
-                        uni_stride,
-                        ADNN_MM_TRANSPOSE,
-                        &hid_state[hid_shift + baccbi * hy_stride + 3 * hy_h],
-                        hy_h * 2,
-                        in_n[seqLength - ti],
-                        hy_stride,
-                        0,
-                        1,
-                        1);
+                    RNN_mm_cpu<Tref>(
+                       const_cast<Tref*>(&hy_state[hx_shift + hy_n * hy_h]),
+                       hy_h,
+                       in_n[seqLength - ti],
+                       uni_stride,
+                       0,
+                       const_cast<Tref*>(&wei_state[wei_shift + 3 * hy_h * uni_stride]),
+                       hy_h,
+                       hy_h * 2,
+                       uni_stride,
+                       ADNN_MM_TRANSPOSE,
+                       &hid_state[hid_shift + baccbi * hy_stride + 3 * hy_h],
+                       hy_h * 2,
+                       in_n[seqLength - ti],
+                       hy_stride,
+                       0,
+                       1,
+                       1);
 
                     if(biased)
                     {
@@ -594,24 +595,24 @@ void RunGRUForwardGEMMCPUVerify(miopenHandle_t handle,
                         }
                     }
 
-                    ADNN_mm_cpu<Tref>(
-                        const_cast<Tref*>(&hy_state[hx_shift + hy_n * hy_h]),
-                        hy_h,
-                        in_n[seqLength - ti],
-                        uni_stride,
-                        0,
-                        const_cast<Tref*>(&wei_state[wei_shift + 5 * hy_h * uni_stride]),
-                        hy_h,
-                        hy_h,
-                        uni_stride,
-                        ADNN_MM_TRANSPOSE,
-                        &hid_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
-                        hy_h,
-                        in_n[seqLength - ti],
-                        hy_stride,
-                        0,
-                        1,
-                        1);
+                    RNN_mm_cpu<Tref>(
+                       const_cast<Tref*>(&hy_state[hx_shift + hy_n * hy_h]),
+                       hy_h,
+                       in_n[seqLength - ti],
+                       uni_stride,
+                       0,
+                       const_cast<Tref*>(&wei_state[wei_shift + 5 * hy_h * uni_stride]),
+                       hy_h,
+                       hy_h,
+                       uni_stride,
+                       ADNN_MM_TRANSPOSE,
+                       &hid_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
+                       hy_h,
+                       in_n[seqLength - ti],
+                       hy_stride,
+                       0,
+                       1,
+                       1);
 
                     if(biased)
                     {
@@ -1001,23 +1002,23 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
         {
             int prelayer_shift = (li + 1) * batch_n * hy_stride;
 
-            ADNN_mm_cpu<Tref>(&dh_state[prelayer_shift],
-                              hy_h * bi * 3,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              const_cast<Tref*>(&wei_state[wei_shift]),
-                              hy_h * bi,
-                              hy_h * bi * 3,
-                              bi_stride,
-                              0,
-                              &dh_state[hid_shift + bi * 3 * hy_h],
-                              hy_h * bi,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(&dh_state[prelayer_shift],
+                             hy_h * bi * 3,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             const_cast<Tref*>(&wei_state[wei_shift]),
+                             hy_h * bi,
+                             hy_h * bi * 3,
+                             bi_stride,
+                             0,
+                             &dh_state[hid_shift + bi * 3 * hy_h],
+                             hy_h * bi,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             1,
+                             1);
 
             if(use_dropout)
             {
@@ -1083,23 +1084,23 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
 
                 int pretime_shift = li * batch_n * hy_stride + (bacc + in_n[ti]) * hy_stride;
 
-                ADNN_mm_cpu<Tref>(&dh_state[pretime_shift],
-                                  hy_h * 2,
-                                  in_n[ti + 1],
-                                  hy_stride,
-                                  0,
-                                  const_cast<Tref*>(&wei_state[weitime_shift]),
-                                  hy_h,
-                                  hy_h * 2,
-                                  uni_stride,
-                                  0,
-                                  &dh_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
-                                  hy_h,
-                                  in_n[ti + 1],
-                                  hy_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(&dh_state[pretime_shift],
+                                 hy_h * 2,
+                                 in_n[ti + 1],
+                                 hy_stride,
+                                 0,
+                                 const_cast<Tref*>(&wei_state[weitime_shift]),
+                                 hy_h,
+                                 hy_h * 2,
+                                 uni_stride,
+                                 0,
+                                 &dh_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
+                                 hy_h,
+                                 in_n[ti + 1],
+                                 hy_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 for(int bs = 0; bs < in_n[ti + 1]; bs++)
                 {
@@ -1115,24 +1116,24 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
                     }
                 }
 
-                ADNN_mm_cpu<Tref>(
-                    &dh_state[hid_shift + bacc * hy_stride + 2 * hy_h],
-                    hy_h,
-                    in_n[ti + 1],
-                    hy_stride,
-                    0,
-                    const_cast<Tref*>(&wei_state[weitime_shift + 2 * hy_h * uni_stride]),
-                    hy_h,
-                    hy_h,
-                    uni_stride,
-                    0,
-                    &dh_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
-                    hy_h,
-                    in_n[ti + 1],
-                    hy_stride,
-                    0,
-                    1,
-                    1);
+                RNN_mm_cpu<Tref>(
+                   &dh_state[hid_shift + bacc * hy_stride + 2 * hy_h],
+                   hy_h,
+                   in_n[ti + 1],
+                   hy_stride,
+                   0,
+                   const_cast<Tref*>(&wei_state[weitime_shift + 2 * hy_h * uni_stride]),
+                   hy_h,
+                   hy_h,
+                   uni_stride,
+                   0,
+                   &dh_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
+                   hy_h,
+                   in_n[ti + 1],
+                   hy_stride,
+                   0,
+                   1,
+                   1);
 
                 for(int bs = 0; bs < in_n[ti + 1]; bs++)
                 {
@@ -1147,24 +1148,24 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
                     pretime_shift = li * batch_n * hy_stride +
                                     (baccbi - in_n[seqLength - 2 - ti]) * hy_stride + hy_h * 3;
 
-                    ADNN_mm_cpu<Tref>(
-                        &dh_state[pretime_shift],
-                        hy_h * 2,
-                        in_n[seqLength - 1 - ti],
-                        hy_stride,
-                        0,
-                        const_cast<Tref*>(&wei_state[weitime_shift + hy_h * 3 * uni_stride]),
-                        hy_h,
-                        hy_h * 2,
-                        uni_stride,
-                        0,
-                        &dh_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
-                        hy_h,
-                        in_n[seqLength - 1 - ti],
-                        hy_stride,
-                        0,
-                        1,
-                        1);
+                    RNN_mm_cpu<Tref>(
+                       &dh_state[pretime_shift],
+                       hy_h * 2,
+                       in_n[seqLength - 1 - ti],
+                       hy_stride,
+                       0,
+                       const_cast<Tref*>(&wei_state[weitime_shift + hy_h * 3 * uni_stride]),
+                       hy_h,
+                       hy_h * 2,
+                       uni_stride,
+                       0,
+                       &dh_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
+                       hy_h,
+                       in_n[seqLength - 1 - ti],
+                       hy_stride,
+                       0,
+                       1,
+                       1);
 
                     for(int bs = 0; bs < in_n[seqLength - 1 - ti]; bs++)
                     {
@@ -1182,24 +1183,24 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
                         }
                     }
 
-                    ADNN_mm_cpu<Tref>(
-                        &dh_state[hid_shift + baccbi * hy_stride + 5 * hy_h],
-                        hy_h,
-                        in_n[seqLength - 1 - ti],
-                        hy_stride,
-                        0,
-                        const_cast<Tref*>(&wei_state[weitime_shift + 5 * hy_h * uni_stride]),
-                        hy_h,
-                        hy_h,
-                        uni_stride,
-                        0,
-                        &dh_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
-                        hy_h,
-                        in_n[seqLength - 1 - ti],
-                        hy_stride,
-                        0,
-                        1,
-                        1);
+                    RNN_mm_cpu<Tref>(
+                       &dh_state[hid_shift + baccbi * hy_stride + 5 * hy_h],
+                       hy_h,
+                       in_n[seqLength - 1 - ti],
+                       hy_stride,
+                       0,
+                       const_cast<Tref*>(&wei_state[weitime_shift + 5 * hy_h * uni_stride]),
+                       hy_h,
+                       hy_h,
+                       uni_stride,
+                       0,
+                       &dh_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
+                       hy_h,
+                       in_n[seqLength - 1 - ti],
+                       hy_stride,
+                       0,
+                       1,
+                       1);
 
                     for(int bs = 0; bs < in_n[seqLength - 1 - ti]; bs++)
                     {
@@ -1354,23 +1355,23 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
         // dhx
         int pretime_shift = li * batch_n * hy_stride;
 
-        ADNN_mm_cpu<Tref>(&dh_state[pretime_shift],
-                          hy_h * 2,
-                          in_n[0],
-                          hy_stride,
-                          0,
-                          const_cast<Tref*>(&wei_state[weitime_shift]),
-                          hy_h,
-                          hy_h * 2,
-                          uni_stride,
-                          0,
-                          &dhx_state[hx_shift],
-                          hy_h,
-                          in_n[0],
-                          uni_stride,
-                          0,
-                          1,
-                          1);
+        RNN_mm_cpu<Tref>(&dh_state[pretime_shift],
+                         hy_h * 2,
+                         in_n[0],
+                         hy_stride,
+                         0,
+                         const_cast<Tref*>(&wei_state[weitime_shift]),
+                         hy_h,
+                         hy_h * 2,
+                         uni_stride,
+                         0,
+                         &dhx_state[hx_shift],
+                         hy_h,
+                         in_n[0],
+                         uni_stride,
+                         0,
+                         1,
+                         1);
 
         for(int bs = 0; bs < in_n[0]; bs++)
         {
@@ -1386,23 +1387,23 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
             }
         }
 
-        ADNN_mm_cpu<Tref>(const_cast<Tref*>(&dcx_state[hx_shift]),
-                          hy_h,
-                          in_n[0],
-                          uni_stride,
-                          0,
-                          const_cast<Tref*>(&wei_state[weitime_shift + 2 * hy_h * uni_stride]),
-                          hy_h,
-                          hy_h,
-                          uni_stride,
-                          0,
-                          &dhx_state[hx_shift],
-                          hy_h,
-                          in_n[0],
-                          uni_stride,
-                          0,
-                          1,
-                          1);
+        RNN_mm_cpu<Tref>(const_cast<Tref*>(&dcx_state[hx_shift]),
+                         hy_h,
+                         in_n[0],
+                         uni_stride,
+                         0,
+                         const_cast<Tref*>(&wei_state[weitime_shift + 2 * hy_h * uni_stride]),
+                         hy_h,
+                         hy_h,
+                         uni_stride,
+                         0,
+                         &dhx_state[hx_shift],
+                         hy_h,
+                         in_n[0],
+                         uni_stride,
+                         0,
+                         1,
+                         1);
 
         if(bidirection)
         {
@@ -1415,24 +1416,24 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
                 {
                     pretime_shift = li * batch_n * hy_stride + (pre_bat + cur_bat) * hy_stride;
 
-                    ADNN_mm_cpu<Tref>(
-                        &dh_state[pretime_shift + 3 * hy_h],
-                        hy_h * 2,
-                        (in_n.at(ti) - cur_bat),
-                        hy_stride,
-                        0,
-                        const_cast<Tref*>(&wei_state[weitime_shift + 3 * hy_h * uni_stride]),
-                        hy_h,
-                        hy_h * 2,
-                        uni_stride,
-                        0,
-                        &dhx_state[hx_shift + hy_n * hy_h + cur_bat * hy_h],
-                        hy_h,
-                        (in_n.at(ti) - cur_bat),
-                        uni_stride,
-                        0,
-                        1,
-                        1);
+                    RNN_mm_cpu<Tref>(
+                       &dh_state[pretime_shift + 3 * hy_h],
+                       hy_h * 2,
+                       (in_n.at(ti) - cur_bat),
+                       hy_stride,
+                       0,
+                       const_cast<Tref*>(&wei_state[weitime_shift + 3 * hy_h * uni_stride]),
+                       hy_h,
+                       hy_h * 2,
+                       uni_stride,
+                       0,
+                       &dhx_state[hx_shift + hy_n * hy_h + cur_bat * hy_h],
+                       hy_h,
+                       (in_n.at(ti) - cur_bat),
+                       uni_stride,
+                       0,
+                       1,
+                       1);
 
                     for(int bs = cur_bat; bs < in_n.at(ti); bs++)
                     {
@@ -1454,24 +1455,24 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
                         }
                     }
 
-                    ADNN_mm_cpu<Tref>(
-                        const_cast<Tref*>(&dcx_state[hx_shift + hy_n * hy_h + cur_bat * hy_h]),
-                        hy_h,
-                        (in_n.at(ti) - cur_bat),
-                        uni_stride,
-                        0,
-                        const_cast<Tref*>(&wei_state[weitime_shift + 5 * hy_h * uni_stride]),
-                        hy_h,
-                        hy_h,
-                        uni_stride,
-                        0,
-                        &dhx_state[hx_shift + hy_n * hy_h + cur_bat * hy_h],
-                        hy_h,
-                        (in_n.at(ti) - cur_bat),
-                        uni_stride,
-                        0,
-                        1,
-                        1);
+                    RNN_mm_cpu<Tref>(
+                       const_cast<Tref*>(&dcx_state[hx_shift + hy_n * hy_h + cur_bat * hy_h]),
+                       hy_h,
+                       (in_n.at(ti) - cur_bat),
+                       uni_stride,
+                       0,
+                       const_cast<Tref*>(&wei_state[weitime_shift + 5 * hy_h * uni_stride]),
+                       hy_h,
+                       hy_h,
+                       uni_stride,
+                       0,
+                       &dhx_state[hx_shift + hy_n * hy_h + cur_bat * hy_h],
+                       hy_h,
+                       (in_n.at(ti) - cur_bat),
+                       uni_stride,
+                       0,
+                       1,
+                       1);
                 }
                 cur_bat = in_n.at(ti--);
             }
@@ -1499,23 +1500,23 @@ void RunGRUBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
     }
     else
     {
-        ADNN_mm_cpu<Tref>(&dh_state[0],
-                          hy_h * bi * 3,
-                          batch_n,
-                          hy_stride,
-                          0,
-                          const_cast<Tref*>(wei_state),
-                          in_h,
-                          hy_h * bi * 3,
-                          in_stride,
-                          0,
-                          &din_state[0],
-                          in_h,
-                          batch_n,
-                          in_stride,
-                          0,
-                          1,
-                          1);
+        RNN_mm_cpu<Tref>(&dh_state[0],
+                         hy_h * bi * 3,
+                         batch_n,
+                         hy_stride,
+                         0,
+                         const_cast<Tref*>(wei_state),
+                         in_h,
+                         hy_h * bi * 3,
+                         in_stride,
+                         0,
+                         &din_state[0],
+                         in_h,
+                         batch_n,
+                         in_stride,
+                         0,
+                         1,
+                         1);
     }
 
     for(int i = 0; i < numlayer * batch_n * hy_stride; i++)
@@ -1655,23 +1656,23 @@ void RunGRUBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
         {
             if(inputMode == 0)
             {
-                ADNN_mm_cpu<Tref>(const_cast<Tref*>(wkspace_state),
-                                  hy_h * bi * 3,
-                                  batch_n,
-                                  hy_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  const_cast<Tref*>(in_state),
-                                  in_h,
-                                  batch_n,
-                                  in_stride,
-                                  0,
-                                  &dwei_state[0],
-                                  in_h,
-                                  hy_h * bi * 3,
-                                  in_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(const_cast<Tref*>(wkspace_state),
+                                 hy_h * bi * 3,
+                                 batch_n,
+                                 hy_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 const_cast<Tref*>(in_state),
+                                 in_h,
+                                 batch_n,
+                                 in_stride,
+                                 0,
+                                 &dwei_state[0],
+                                 in_h,
+                                 hy_h * bi * 3,
+                                 in_stride,
+                                 0,
+                                 1,
+                                 1);
             }
 
             if(biased)
@@ -1693,23 +1694,23 @@ void RunGRUBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
             int hid_shift = li * batch_n * hy_stride;
             int wei_shift = (in_h + hy_h) * wei_stride + (li - 1) * (bi * hy_h + hy_h) * wei_stride;
 
-            ADNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift]),
-                              hy_h * bi * 3,
-                              batch_n,
-                              hy_stride,
-                              ADNN_MM_TRANSPOSE,
-                              const_cast<Tref*>(&rsvspace_state[prelayer_shift]),
-                              hy_h * bi,
-                              batch_n,
-                              use_dropout ? hy_h * bi : hy_stride,
-                              0,
-                              &dwei_state[wei_shift],
-                              hy_h * bi,
-                              hy_h * bi * 3,
-                              bi_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift]),
+                             hy_h * bi * 3,
+                             batch_n,
+                             hy_stride,
+                             ADNN_MM_TRANSPOSE,
+                             const_cast<Tref*>(&rsvspace_state[prelayer_shift]),
+                             hy_h * bi,
+                             batch_n,
+                             use_dropout ? hy_h * bi : hy_stride,
+                             0,
+                             &dwei_state[wei_shift],
+                             hy_h * bi,
+                             hy_h * bi * 3,
+                             bi_stride,
+                             0,
+                             1,
+                             1);
 
             if(biased)
             {
@@ -1748,23 +1749,23 @@ void RunGRUBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
             {
                 if(!hx_is_null)
                 {
-                    ADNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift]),
-                                      hy_h * 3,
-                                      in_n[ti],
-                                      hy_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      const_cast<Tref*>(&hx_state[hx_shift]),
-                                      hy_h,
-                                      in_n[ti],
-                                      uni_stride,
-                                      0,
-                                      &dwei_state[wei_shift],
-                                      hy_h,
-                                      hy_h * 3,
-                                      uni_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift]),
+                                     hy_h * 3,
+                                     in_n[ti],
+                                     hy_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     const_cast<Tref*>(&hx_state[hx_shift]),
+                                     hy_h,
+                                     in_n[ti],
+                                     uni_stride,
+                                     0,
+                                     &dwei_state[wei_shift],
+                                     hy_h,
+                                     hy_h * 3,
+                                     uni_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     if(biased)
                     {
@@ -1786,23 +1787,23 @@ void RunGRUBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                 pretime_shift =
                     li * batch_n * hy_stride + (bacc - in_n[ti - 1]) * hy_stride + bi * 3 * hy_h;
 
-                ADNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift]),
-                                  hy_h * 3,
-                                  in_n[ti],
-                                  hy_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  const_cast<Tref*>(&rsvspace_state[pretime_shift]),
-                                  hy_h,
-                                  in_n[ti],
-                                  hy_stride,
-                                  0,
-                                  &dwei_state[wei_shift],
-                                  hy_h,
-                                  hy_h * 3,
-                                  uni_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift]),
+                                 hy_h * 3,
+                                 in_n[ti],
+                                 hy_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 const_cast<Tref*>(&rsvspace_state[pretime_shift]),
+                                 hy_h,
+                                 in_n[ti],
+                                 hy_stride,
+                                 0,
+                                 &dwei_state[wei_shift],
+                                 hy_h,
+                                 hy_h * 3,
+                                 uni_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 if(biased)
                 {
@@ -1834,23 +1835,23 @@ void RunGRUBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                 {
                     if(!hx_is_null)
                     {
-                        ADNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift + 3 * hy_h]),
-                                          hy_h * 3,
-                                          in_n[ti],
-                                          hy_stride,
-                                          ADNN_MM_TRANSPOSE,
-                                          const_cast<Tref*>(&hx_state[hx_shift + hy_n * hy_h]),
-                                          hy_h,
-                                          in_n[ti],
-                                          uni_stride,
-                                          0,
-                                          &dwei_state[wei_shift + 3 * hy_h * uni_stride],
-                                          hy_h,
-                                          hy_h * 3,
-                                          uni_stride,
-                                          0,
-                                          1,
-                                          1);
+                        RNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift + 3 * hy_h]),
+                                         hy_h * 3,
+                                         in_n[ti],
+                                         hy_stride,
+                                         ADNN_MM_TRANSPOSE,
+                                         const_cast<Tref*>(&hx_state[hx_shift + hy_n * hy_h]),
+                                         hy_h,
+                                         in_n[ti],
+                                         uni_stride,
+                                         0,
+                                         &dwei_state[wei_shift + 3 * hy_h * uni_stride],
+                                         hy_h,
+                                         hy_h * 3,
+                                         uni_stride,
+                                         0,
+                                         1,
+                                         1);
 
                         if(biased)
                         {
@@ -1871,26 +1872,26 @@ void RunGRUBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                 {
                     if(!hx_is_null && in_n.at(ti) > in_n.at(ti + 1))
                     {
-                        ADNN_mm_cpu<Tref>(
-                            const_cast<Tref*>(
-                                &wkspace_state[hid_shift + 3 * hy_h + in_n.at(ti + 1) * hy_stride]),
-                            hy_h * 3,
-                            (in_n.at(ti) - in_n.at(ti + 1)),
-                            hy_stride,
-                            ADNN_MM_TRANSPOSE,
-                            const_cast<Tref*>(
-                                &hx_state[hx_shift + hy_n * hy_h + in_n.at(ti + 1) * hy_h]),
-                            hy_h,
-                            (in_n.at(ti) - in_n.at(ti + 1)),
-                            uni_stride,
-                            0,
-                            &dwei_state[wei_shift + 3 * hy_h * uni_stride],
-                            hy_h,
-                            hy_h * 3,
-                            uni_stride,
-                            0,
-                            1,
-                            1);
+                        RNN_mm_cpu<Tref>(
+                           const_cast<Tref*>(
+                               &wkspace_state[hid_shift + 3 * hy_h + in_n.at(ti + 1) * hy_stride]),
+                           hy_h * 3,
+                           (in_n.at(ti) - in_n.at(ti + 1)),
+                           hy_stride,
+                           ADNN_MM_TRANSPOSE,
+                           const_cast<Tref*>(
+                               &hx_state[hx_shift + hy_n * hy_h + in_n.at(ti + 1) * hy_h]),
+                           hy_h,
+                           (in_n.at(ti) - in_n.at(ti + 1)),
+                           uni_stride,
+                           0,
+                           &dwei_state[wei_shift + 3 * hy_h * uni_stride],
+                           hy_h,
+                           hy_h * 3,
+                           uni_stride,
+                           0,
+                           1,
+                           1);
 
                         if(biased)
                         {
@@ -1910,23 +1911,23 @@ void RunGRUBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                     pretime_shift =
                         li * batch_n * hy_stride + (bacc + in_n[ti]) * hy_stride + bi * 3 * hy_h;
 
-                    ADNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift + 3 * hy_h]),
-                                      hy_h * 3,
-                                      in_n[ti + 1],
-                                      hy_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      const_cast<Tref*>(&rsvspace_state[pretime_shift + hy_h]),
-                                      hy_h,
-                                      in_n[ti + 1],
-                                      hy_stride,
-                                      0,
-                                      &dwei_state[wei_shift + 3 * hy_h * uni_stride],
-                                      hy_h,
-                                      hy_h * 3,
-                                      uni_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift + 3 * hy_h]),
+                                     hy_h * 3,
+                                     in_n[ti + 1],
+                                     hy_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     const_cast<Tref*>(&rsvspace_state[pretime_shift + hy_h]),
+                                     hy_h,
+                                     in_n[ti + 1],
+                                     hy_stride,
+                                     0,
+                                     &dwei_state[wei_shift + 3 * hy_h * uni_stride],
+                                     hy_h,
+                                     hy_h * 3,
+                                     uni_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     if(biased)
                     {
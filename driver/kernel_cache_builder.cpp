@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Builds the kernels a network needs into kernel databases ahead of time, no GPU is needed.
+// The problems are read like by MIOpenFindPlanner, the kernels come from the solutions Find()
+// would build for them without a search. One database is written per target, they are used
+// from the system database directory by builds with MIOPEN_ENABLE_SQLITE_KERN_CACHE.
+//
+//   MIOpenKernelCacheBuilder --target gfx906:60 [--target ...] [--jobs N] [--output DIR]
+//                            [--dry-run] <problems file or - for stdin>
+
+#include <miopen/errors.hpp>
+#include <miopen/find_planner.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/kernel_cache_builder.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int Usage(const char* name)
+{
+    std::cerr << "Usage: " << name
+              << " --target <device>:<CUs> [--target ...] [--jobs N] [--output DIR] [--dry-run]"
+                 " <problems file or ->"
+              << std::endl;
+    return EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> targets;
+    std::size_t jobs   = std::max(std::thread::hardware_concurrency(), 1u);
+    std::string output = ".";
+    bool dry_run       = false;
+    std::string input;
+    for(int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const bool has_value  = i + 1 < argc;
+        if(arg == "--target" && has_value)
+            targets.push_back(argv[++i]);
+        else if(arg == "--jobs" && has_value)
+            jobs = std::strtoul(argv[++i], nullptr, 10);
+        else if(arg == "--output" && has_value)
+            output = argv[++i];
+        else if(arg == "--dry-run")
+            dry_run = true;
+        else if(input.empty())
+            input = arg;
+        else
+            return Usage(argv[0]);
+    }
+    if(input.empty() || targets.empty() || jobs == 0)
+        return Usage(argv[0]);
+
+    try
+    {
+        std::ifstream file;
+        if(input != "-")
+        {
+            file.open(input);
+            if(!file)
+                MIOPEN_THROW("Cannot open " + input);
+        }
+        const auto plan = miopen::ReadFindPlan(input == "-" ? std::cin : file);
+        std::cout << plan.total << " problems, " << plan.problems.size() << " unique"
+                  << std::endl;
+
+        bool failed = false;
+        for(const auto& spec : targets)
+        {
+            const auto target = miopen::ParseKernelCacheTarget(spec);
+            miopen::Handle handle{target.device, target.num_cu};
+            const auto plan_jobs = miopen::MakeFindPlanJobs(plan, [&](const auto& problem) {
+                return miopen::FindPlanSolutions(handle, problem);
+            });
+
+            std::vector<miopen::solver::KernelInfo> kernels;
+            for(const auto& program : plan_jobs.programs)
+                kernels.push_back(program.kernel);
+            const auto programs = miopen::GetKernelCachePrograms(kernels, target.device);
+
+            const auto path =
+                (boost::filesystem::path{output} / miopen::GetKernelCacheFileName(target)).string();
+            std::cout << path << ": " << programs.size() << " programs" << std::endl;
+            if(dry_run)
+            {
+                for(const auto& program : programs)
+                    std::cout << program.name << " '" << program.args << "'" << std::endl;
+                continue;
+            }
+
+            const auto result = miopen::BuildKernelCache(
+                path, target, programs, miopen::CompileKernelCacheProgram, jobs);
+            std::cout << result.built << " built, " << result.present << " already present, "
+                      << result.failed.size() << " failed" << std::endl;
+            for(const auto& program : result.failed)
+                std::cerr << "Failed: " << program.name << " '" << program.args << "'"
+                          << std::endl;
+            failed = failed || !result.failed.empty();
+        }
+        return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+    catch(const miopen::Exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
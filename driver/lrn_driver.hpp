@@ -26,10 +26,10 @@
 #ifndef GUARD_MIOPEN_LRN_DRIVER_HPP
 #define GUARD_MIOPEN_LRN_DRIVER_HPP
 
+#include "../test/cpu_lrn.hpp"
 #include "../test/verify.hpp"
 #include "InputFlags.hpp"
 #include "driver.hpp"
-#include "mloNormHost.hpp"
 #include "tensor_driver.hpp"
 #include "timer.hpp"
 #include <algorithm>
@@ -408,20 +408,6 @@ int LRNDriver<Tgpu, Tref>::RunBackwardGPU()
 template <typename Tgpu, typename Tref>
 int LRNDriver<Tgpu, Tref>::VerifyForward()
 {
-
-    int nInStride, cInStride, hInStride, wInStride;
-    miopenGet4dTensorDescriptorStrides(inputTensor, &nInStride, &cInStride, &hInStride, &wInStride);
-
-    int nIn, cIn, hIn, wIn;
-    miopenGet4dTensorDescriptorLengths(inputTensor, &nIn, &cIn, &hIn, &wIn);
-
-    int nOutStride, cOutStride, hOutStride, wOutStride;
-    miopenGet4dTensorDescriptorStrides(
-        outputTensor, &nOutStride, &cOutStride, &hOutStride, &wOutStride);
-
-    int nOut, cOut, hOut, wOut;
-    miopenGet4dTensorDescriptorLengths(outputTensor, &nOut, &cOut, &hOut, &wOut);
-
     miopenLRNMode_t v_mode;
     unsigned int v_lrnN;
     double v_lrnAlpha;
@@ -430,39 +416,16 @@ int LRNDriver<Tgpu, Tref>::VerifyForward()
 
     miopenGetLRNDescriptor(lrnDesc, &v_mode, &v_lrnN, &v_lrnAlpha, &v_lrnBeta, &v_lrnK);
 
-    Tref alphaoverarea =
-        (v_mode == miopenLRNCrossChannel) ? v_lrnAlpha / v_lrnN : v_lrnAlpha / (v_lrnN * v_lrnN);
-
-    int pre_pad = (v_lrnN - 1) / 2;
-    int pad     = v_lrnN - pre_pad - 1;
-
-    mloLRNForwardRunHost<Tgpu, Tref>(do_backward,
-                                     v_mode,
-                                     pad,
-                                     v_lrnN,
-                                     alphaoverarea,
-                                     v_lrnAlpha,
-                                     v_lrnBeta,
-                                     v_lrnK,
-                                     nIn,        // batch_sz,
-                                     cOut,       // n_outputs,
-                                     cIn,        // n_inputs,
-                                     hIn,        // bot_height,
-                                     wIn,        // bot_width,
-                                     hInStride,  // bot_stride,
-                                     cInStride,  // bot_channel_stride,
-                                     nInStride,  // bot_batch_stride,
-                                     hOut,       // top_height,
-                                     wOut,       // top_width,
-                                     hOutStride, // top_v_stride,
-                                     cOutStride, // top_v_channel_stride,
-                                     nOutStride, // top_v_batch_stride,
-                                     hOutStride, // scale_v_stride,
-                                     cOutStride, // scale_v_channel_stride,
-                                     nOutStride, // scale_v_batch_stride,
-                                     in.data(),
-                                     scalehost.data(),
-                                     outhost.data());
+    cpu_lrn_forward(v_mode,
+                    v_lrnN,
+                    v_lrnAlpha,
+                    v_lrnBeta,
+                    v_lrnK,
+                    nc_view(miopen::deref(inputTensor)),
+                    in.data(),
+                    nc_view(miopen::deref(outputTensor)),
+                    outhost.data(),
+                    do_backward ? scalehost.data() : nullptr);
 
     auto error           = miopen::rms_range(outhost, out);
     const Tref tolerance = 1.5e-4; // 1e-6;
@@ -488,28 +451,6 @@ int LRNDriver<Tgpu, Tref>::RunBackwardCPU()
 template <typename Tgpu, typename Tref>
 int LRNDriver<Tgpu, Tref>::VerifyBackward()
 {
-
-    int nInStride, cInStride, hInStride, wInStride;
-    miopenGet4dTensorDescriptorStrides(inputTensor, &nInStride, &cInStride, &hInStride, &wInStride);
-    int nIn, cIn, hIn, wIn;
-    miopenGet4dTensorDescriptorLengths(inputTensor, &nIn, &cIn, &hIn, &wIn);
-    int nOutStride, cOutStride, hOutStride, wOutStride;
-    miopenGet4dTensorDescriptorStrides(
-        outputTensor, &nOutStride, &cOutStride, &hOutStride, &wOutStride);
-    int nOut, cOut, hOut, wOut;
-    miopenGet4dTensorDescriptorLengths(outputTensor, &nOut, &cOut, &hOut, &wOut);
-
-    int ndInStride, cdInStride, hdInStride, wdInStride;
-    miopenGet4dTensorDescriptorStrides(
-        dInputTensor, &ndInStride, &cdInStride, &hdInStride, &wdInStride);
-    int ndIn, cdIn, hdIn, wdIn;
-    miopenGet4dTensorDescriptorLengths(dInputTensor, &ndIn, &cdIn, &hdIn, &wdIn);
-    int ndOutStride, cdOutStride, hdOutStride, wdOutStride;
-    miopenGet4dTensorDescriptorStrides(
-        dOutputTensor, &ndOutStride, &cdOutStride, &hdOutStride, &wdOutStride);
-    int ndOut, cdOut, hdOut, wdOut;
-    miopenGet4dTensorDescriptorLengths(dOutputTensor, &ndOut, &cdOut, &hdOut, &wdOut);
-
     miopenLRNMode_t v_mode;
     unsigned int v_lrnN;
     double v_lrnAlpha;
@@ -518,46 +459,20 @@ int LRNDriver<Tgpu, Tref>::VerifyBackward()
 
     miopenGetLRNDescriptor(lrnDesc, &v_mode, &v_lrnN, &v_lrnAlpha, &v_lrnBeta, &v_lrnK);
 
-    Tref alphaoverarea =
-        (v_mode == miopenLRNCrossChannel) ? v_lrnAlpha / v_lrnN : v_lrnAlpha / (v_lrnN * v_lrnN);
-
-    int pre_pad = (v_lrnN - 1) / 2;
-    int pad     = v_lrnN - pre_pad - 1;
-
-    mloLRNBackwardRunHost<Tgpu, Tref>(static_cast<int>(v_mode),
-                                      pad,
-                                      v_lrnN,
-                                      alphaoverarea,
-                                      v_lrnAlpha,
-                                      v_lrnBeta,
-                                      v_lrnK,
-                                      nIn,         // batch_sz,
-                                      cOut,        // n_outputs,
-                                      cIn,         // n_inputs,
-                                      hIn,         // bot_height,
-                                      wIn,         // bot_width,
-                                      hInStride,   // bot_stride,
-                                      cInStride,   // bot_channel_stride,
-                                      nInStride,   // bot_batch_stride,
-                                      hdInStride,  // bot_df_v_stride,
-                                      cdInStride,  // bot_df_v_channel_stride,
-                                      ndInStride,  // bot_df_v_batch_stride,
-                                      hOut,        // top_height,
-                                      wOut,        // top_width,
-                                      hOutStride,  // top_stride,
-                                      cOutStride,  // top_channel_stride,
-                                      nOutStride,  // top_batch_stride,
-                                      hdOutStride, // top_df_stride,
-                                      cdOutStride, // top_df_channel_stride,
-                                      ndOutStride, // top_df_batch_stride,
-                                      hdOutStride, // scale_stride,
-                                      cdOutStride, // scale_channel_stride,
-                                      ndOutStride, // scale_batch_stride,
-                                      out.data(),
-                                      dout.data(),
-                                      scale.data(),
-                                      in.data(),
-                                      dinhost.data());
+    // The scale computed by the forward kernel has the layout of the output gradient.
+    cpu_lrn_backward(v_mode,
+                     v_lrnN,
+                     v_lrnAlpha,
+                     v_lrnBeta,
+                     nc_view(miopen::deref(outputTensor)),
+                     out.data(),
+                     nc_view(miopen::deref(dOutputTensor)),
+                     dout.data(),
+                     nc_view(miopen::deref(inputTensor)),
+                     in.data(),
+                     scale.data(),
+                     nc_view(miopen::deref(dInputTensor)),
+                     dinhost.data());
 
     auto error           = miopen::rms_range(dinhost, din);
     const Tref tolerance = 6.0e-5;
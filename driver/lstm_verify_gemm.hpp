@@ -7,6 +7,7 @@
 #include <cassert>
 #include <algorithm>
 #include "dropout_gpu_emulator.hpp"
+#include "rnn_cpu_gemm.hpp"
 
 template <typename Tgpu, typename Tref>
 void RunLSTMForwardGEMMCPUVerify(
@@ -182,23 +183,23 @@ void RunLSTMForwardGEMMCPUVerify(
             }
             else
             {
-                ADNN_mm_cpu<Tref>(in_state.data(),
-                                  in_h,
-                                  batch_n,
-                                  in_stride,
-                                  0,
-                                  wei_state.data(),
-                                  in_h,
-                                  hy_h * bi * 4,
-                                  in_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  &hid_state[hid_shift],
-                                  hy_h * bi * 4,
-                                  batch_n,
-                                  hy_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(in_state.data(),
+                                 in_h,
+                                 batch_n,
+                                 in_stride,
+                                 0,
+                                 wei_state.data(),
+                                 in_h,
+                                 hy_h * bi * 4,
+                                 in_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 &hid_state[hid_shift],
+                                 hy_h * bi * 4,
+                                 batch_n,
+                                 hy_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 // from bias
                 if(biased)
@@ -239,24 +240,24 @@ void RunLSTMForwardGEMMCPUVerify(
                 prelayer_shift = drop_out_offset;
             }
 
-            ADNN_mm_cpu<Tref>(use_dropout ? &dropout_hid_state[prelayer_shift]
-                                          : &hid_state[prelayer_shift],
-                              hy_h * bi,
-                              batch_n,
-                              use_dropout ? hy_h * bi : hy_stride,
-                              0,
-                              &wei_state[wei_shift],
-                              hy_h * bi,
-                              hy_h * bi * 4,
-                              bi_stride,
-                              ADNN_MM_TRANSPOSE,
-                              &hid_state[hid_shift],
-                              hy_h * bi * 4,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(use_dropout ? &dropout_hid_state[prelayer_shift]
+                                         : &hid_state[prelayer_shift],
+                             hy_h * bi,
+                             batch_n,
+                             use_dropout ? hy_h * bi : hy_stride,
+                             0,
+                             &wei_state[wei_shift],
+                             hy_h * bi,
+                             hy_h * bi * 4,
+                             bi_stride,
+                             ADNN_MM_TRANSPOSE,
+                             &hid_state[hid_shift],
+                             hy_h * bi * 4,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             1,
+                             1);
 
             // from bias
             if(biased)
@@ -286,23 +287,23 @@ void RunLSTMForwardGEMMCPUVerify(
             {
                 if(!hx_is_null)
                 {
-                    ADNN_mm_cpu<Tref>(&hx_state[hx_shift],
-                                      hy_h,
-                                      in_n.at(ti),
-                                      uni_stride,
-                                      0,
-                                      &wei_state[wei_shift],
-                                      hy_h,
-                                      hy_h * 4,
-                                      uni_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      &hid_state[hid_shift + bacc * hy_stride],
-                                      hy_h * 4,
-                                      in_n.at(ti),
-                                      hy_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(&hx_state[hx_shift],
+                                     hy_h,
+                                     in_n.at(ti),
+                                     uni_stride,
+                                     0,
+                                     &wei_state[wei_shift],
+                                     hy_h,
+                                     hy_h * 4,
+                                     uni_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     &hid_state[hid_shift + bacc * hy_stride],
+                                     hy_h * 4,
+                                     in_n.at(ti),
+                                     hy_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     // from bias
                     if(biased)
@@ -321,23 +322,23 @@ void RunLSTMForwardGEMMCPUVerify(
 
                     if(bidirection)
                     {
-                        ADNN_mm_cpu<Tref>(&hx_state[hx_shift + hy_n * hy_h],
-                                          hy_h,
-                                          in_n.at(seqLength - 1 - ti),
-                                          uni_stride,
-                                          0,
-                                          &wei_state[wei_shift + 4 * hy_h * uni_stride],
-                                          hy_h,
-                                          hy_h * 4,
-                                          uni_stride,
-                                          ADNN_MM_TRANSPOSE,
-                                          &hid_state[hid_shift + baccbi * hy_stride + 4 * hy_h],
-                                          hy_h * 4,
-                                          in_n.at(seqLength - 1 - ti),
-                                          hy_stride,
-                                          0,
-                                          1,
-                                          1);
+                        RNN_mm_cpu<Tref>(&hx_state[hx_shift + hy_n * hy_h],
+                                         hy_h,
+                                         in_n.at(seqLength - 1 - ti),
+                                         uni_stride,
+                                         0,
+                                         &wei_state[wei_shift + 4 * hy_h * uni_stride],
+                                         hy_h,
+                                         hy_h * 4,
+                                         uni_stride,
+                                         ADNN_MM_TRANSPOSE,
+                                         &hid_state[hid_shift + baccbi * hy_stride + 4 * hy_h],
+                                         hy_h * 4,
+                                         in_n.at(seqLength - 1 - ti),
+                                         hy_stride,
+                                         0,
+                                         1,
+                                         1);
 
                         // from bias
                         if(biased)
@@ -359,23 +360,23 @@ void RunLSTMForwardGEMMCPUVerify(
             }
             else
             {
-                ADNN_mm_cpu<Tref>(&hy_state[hx_shift],
-                                  hy_h,
-                                  in_n.at(ti),
-                                  uni_stride,
-                                  0,
-                                  &wei_state[wei_shift],
-                                  hy_h,
-                                  hy_h * 4,
-                                  uni_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  &hid_state[hid_shift + bacc * hy_stride],
-                                  hy_h * 4,
-                                  in_n.at(ti),
-                                  hy_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(&hy_state[hx_shift],
+                                 hy_h,
+                                 in_n.at(ti),
+                                 uni_stride,
+                                 0,
+                                 &wei_state[wei_shift],
+                                 hy_h,
+                                 hy_h * 4,
+                                 uni_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 &hid_state[hid_shift + bacc * hy_stride],
+                                 hy_h * 4,
+                                 in_n.at(ti),
+                                 hy_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 // from bias
                 if(biased)
@@ -397,25 +398,25 @@ void RunLSTMForwardGEMMCPUVerify(
 
                     if(!hx_is_null && in_n.at(seqLength - 1 - ti) > in_n.at(seqLength - ti))
                     {
-                        ADNN_mm_cpu<Tref>(
-                            &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h],
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            uni_stride,
-                            0,
-                            &wei_state[wei_shift + 4 * hy_h * uni_stride],
-                            hy_h,
-                            hy_h * 4,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
-                                       4 * hy_h],
-                            hy_h * 4,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            hy_stride,
-                            0,
-                            1,
-                            1);
+                        RNN_mm_cpu<Tref>(
+                           &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h],
+                           hy_h,
+                           (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
+                           uni_stride,
+                           0,
+                           &wei_state[wei_shift + 4 * hy_h * uni_stride],
+                           hy_h,
+                           hy_h * 4,
+                           uni_stride,
+                           ADNN_MM_TRANSPOSE,
+                           &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
+                                      4 * hy_h],
+                           hy_h * 4,
+                           (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
+                           hy_stride,
+                           0,
+                           1,
+                           1);
 
                         // from bias
                         if(biased)
@@ -435,23 +436,23 @@ void RunLSTMForwardGEMMCPUVerify(
                         }
                     }
 
-                    ADNN_mm_cpu<Tref>(&hy_state[hx_shift + hy_n * hy_h],
-                                      hy_h,
-                                      in_n.at(seqLength - ti),
-                                      uni_stride,
-                                      0,
-                                      &wei_state[wei_shift + 4 * hy_h * uni_stride],
-                                      hy_h,
-                                      hy_h * 4,
-                                      uni_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      &hid_state[hid_shift + baccbi * hy_stride + 4 * hy_h],
-                                      hy_h * 4,
-                                      in_n.at(seqLength - ti),
-                                      hy_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(&hy_state[hx_shift + hy_n * hy_h],
+                                     hy_h,
+                                     in_n.at(seqLength - ti),
+                                     uni_stride,
+                                     0,
+                                     &wei_state[wei_shift + 4 * hy_h * uni_stride],
+                                     hy_h,
+                                     hy_h * 4,
+                                     uni_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     &hid_state[hid_shift + baccbi * hy_stride + 4 * hy_h],
+                                     hy_h * 4,
+                                     in_n.at(seqLength - ti),
+                                     hy_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     // from bias
                     if(biased)
@@ -838,23 +839,23 @@ void RunLSTMBackwardDataGEMMCPUVerify(
         {
             int prelayer_shift = (li + 1) * batch_n * hy_stride;
 
-            ADNN_mm_cpu<Tref>(&dh_state[prelayer_shift],
-                              hy_h * bi * 4,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              &wei_state[wei_shift],
-                              hy_h * bi,
-                              hy_h * bi * 4,
-                              bi_stride,
-                              0,
-                              &dh_state[hid_shift + bi * 5 * hy_h],
-                              hy_h * bi,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(&dh_state[prelayer_shift],
+                             hy_h * bi * 4,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             &wei_state[wei_shift],
+                             hy_h * bi,
+                             hy_h * bi * 4,
+                             bi_stride,
+                             0,
+                             &dh_state[hid_shift + bi * 5 * hy_h],
+                             hy_h * bi,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             1,
+                             1);
 
             if(use_dropout)
             {
@@ -948,23 +949,23 @@ void RunLSTMBackwardDataGEMMCPUVerify(
                 int pretime_shift = li * batch_n * hy_stride + (bacc + in_n[ti]) * hy_stride;
                 int weitime_shift = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
 
-                ADNN_mm_cpu<Tref>(&dh_state[pretime_shift],
-                                  hy_h * 4,
-                                  in_n[ti + 1],
-                                  hy_stride,
-                                  0,
-                                  &wei_state[weitime_shift],
-                                  hy_h,
-                                  hy_h * 4,
-                                  uni_stride,
-                                  0,
-                                  &dh_state[hid_shift + bacc * hy_stride + bi * 5 * hy_h],
-                                  hy_h,
-                                  in_n[ti + 1],
-                                  hy_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(&dh_state[pretime_shift],
+                                 hy_h * 4,
+                                 in_n[ti + 1],
+                                 hy_stride,
+                                 0,
+                                 &wei_state[weitime_shift],
+                                 hy_h,
+                                 hy_h * 4,
+                                 uni_stride,
+                                 0,
+                                 &dh_state[hid_shift + bacc * hy_stride + bi * 5 * hy_h],
+                                 hy_h,
+                                 in_n[ti + 1],
+                                 hy_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 if(bidirection)
                 {
@@ -973,24 +974,24 @@ void RunLSTMBackwardDataGEMMCPUVerify(
                     weitime_shift = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride +
                                     hy_h * 4 * uni_stride;
 
-                    ADNN_mm_cpu<Tref>(
-                        &dh_state[pretime_shift],
-                        hy_h * 4,
-                        in_n[seqLength - 1 - ti],
-                        hy_stride,
-                        0,
-                        &wei_state[weitime_shift],
-                        hy_h,
-                        hy_h * 4,
-                        uni_stride,
-                        0,
-                        &dh_state[hid_shift + baccbi * hy_stride + bi * 5 * hy_h + hy_h],
-                        hy_h,
-                        in_n[seqLength - 1 - ti],
-                        hy_stride,
-                        0,
-                        1,
-                        1);
+                    RNN_mm_cpu<Tref>(
+                       &dh_state[pretime_shift],
+                       hy_h * 4,
+                       in_n[seqLength - 1 - ti],
+                       hy_stride,
+                       0,
+                       &wei_state[weitime_shift],
+                       hy_h,
+                       hy_h * 4,
+                       uni_stride,
+                       0,
+                       &dh_state[hid_shift + baccbi * hy_stride + bi * 5 * hy_h + hy_h],
+                       hy_h,
+                       in_n[seqLength - 1 - ti],
+                       hy_stride,
+                       0,
+                       1,
+                       1);
                 }
             }
 
@@ -1176,23 +1177,23 @@ void RunLSTMBackwardDataGEMMCPUVerify(
         int pretime_shift = li * batch_n * hy_stride;
         int weitime_shift = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
 
-        ADNN_mm_cpu<Tref>(&dh_state[pretime_shift],
-                          hy_h * 4,
-                          in_n[0],
-                          hy_stride,
-                          0,
-                          &wei_state[weitime_shift],
-                          hy_h,
-                          hy_h * 4,
-                          uni_stride,
-                          0,
-                          &dhx_state[hx_shift],
-                          hy_h,
-                          in_n[0],
-                          uni_stride,
-                          0,
-                          1,
-                          1);
+        RNN_mm_cpu<Tref>(&dh_state[pretime_shift],
+                         hy_h * 4,
+                         in_n[0],
+                         hy_stride,
+                         0,
+                         &wei_state[weitime_shift],
+                         hy_h,
+                         hy_h * 4,
+                         uni_stride,
+                         0,
+                         &dhx_state[hx_shift],
+                         hy_h,
+                         in_n[0],
+                         uni_stride,
+                         0,
+                         1,
+                         1);
 
         for(int bs = 0; bs < in_n.at(0); bs++)
         {
@@ -1215,23 +1216,23 @@ void RunLSTMBackwardDataGEMMCPUVerify(
                 {
                     pretime_shift = li * batch_n * hy_stride + (pre_bat + cur_bat) * hy_stride;
 
-                    ADNN_mm_cpu<Tref>(&dh_state[pretime_shift + 4 * hy_h],
-                                      hy_h * 4,
-                                      (in_n.at(ti) - cur_bat),
-                                      hy_stride,
-                                      0,
-                                      &wei_state[weitime_shift + 4 * hy_h * uni_stride],
-                                      hy_h,
-                                      hy_h * 4,
-                                      uni_stride,
-                                      0,
-                                      &dhx_state[hx_shift + hy_n * hy_h + cur_bat * hy_h],
-                                      hy_h,
-                                      (in_n.at(ti) - cur_bat),
-                                      uni_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(&dh_state[pretime_shift + 4 * hy_h],
+                                     hy_h * 4,
+                                     (in_n.at(ti) - cur_bat),
+                                     hy_stride,
+                                     0,
+                                     &wei_state[weitime_shift + 4 * hy_h * uni_stride],
+                                     hy_h,
+                                     hy_h * 4,
+                                     uni_stride,
+                                     0,
+                                     &dhx_state[hx_shift + hy_n * hy_h + cur_bat * hy_h],
+                                     hy_h,
+                                     (in_n.at(ti) - cur_bat),
+                                     uni_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     for(int bs = cur_bat; bs < in_n.at(ti); bs++)
                     {
@@ -1272,23 +1273,23 @@ void RunLSTMBackwardDataGEMMCPUVerify(
     }
     else
     {
-        ADNN_mm_cpu<Tref>(dh_state.data(),
-                          hy_h * bi * 4,
-                          batch_n,
-                          hy_stride,
-                          0,
-                          wei_state.data(),
-                          in_h,
-                          hy_h * bi * 4,
-                          in_stride,
-                          0,
-                          din_state.data(),
-                          in_h,
-                          batch_n,
-                          in_stride,
-                          0,
-                          1,
-                          1);
+        RNN_mm_cpu<Tref>(dh_state.data(),
+                         hy_h * bi * 4,
+                         batch_n,
+                         hy_stride,
+                         0,
+                         wei_state.data(),
+                         in_h,
+                         hy_h * bi * 4,
+                         in_stride,
+                         0,
+                         din_state.data(),
+                         in_h,
+                         batch_n,
+                         in_stride,
+                         0,
+                         1,
+                         1);
     }
 
     for(int i = 0; i < numlayer * batch_n * hy_stride; i++)
@@ -1420,23 +1421,23 @@ void RunLSTMBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
         {
             if(inputMode != 1)
             {
-                ADNN_mm_cpu<Tref>(wkspace_state.data(),
-                                  hy_h * bi * 4,
-                                  batch_n,
-                                  hy_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  in_state.data(),
-                                  in_h,
-                                  batch_n,
-                                  in_stride,
-                                  0,
-                                  dwei_state.data(),
-                                  in_h,
-                                  hy_h * bi * 4,
-                                  in_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(wkspace_state.data(),
+                                 hy_h * bi * 4,
+                                 batch_n,
+                                 hy_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 in_state.data(),
+                                 in_h,
+                                 batch_n,
+                                 in_stride,
+                                 0,
+                                 dwei_state.data(),
+                                 in_h,
+                                 hy_h * bi * 4,
+                                 in_stride,
+                                 0,
+                                 1,
+                                 1);
             }
 
             if(biased)
@@ -1458,23 +1459,23 @@ void RunLSTMBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
             int hid_shift = li * batch_n * hy_stride;
             int wei_shift = (in_h + hy_h) * wei_stride + (li - 1) * (bi * hy_h + hy_h) * wei_stride;
 
-            ADNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
-                              hy_h * bi * 4,
-                              batch_n,
-                              hy_stride,
-                              ADNN_MM_TRANSPOSE,
-                              &rsvspace_state[prelayer_shift],
-                              hy_h * bi,
-                              batch_n,
-                              use_dropout ? hy_h * bi : hy_stride,
-                              0,
-                              &dwei_state[wei_shift],
-                              hy_h * bi,
-                              hy_h * bi * 4,
-                              bi_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
+                             hy_h * bi * 4,
+                             batch_n,
+                             hy_stride,
+                             ADNN_MM_TRANSPOSE,
+                             &rsvspace_state[prelayer_shift],
+                             hy_h * bi,
+                             batch_n,
+                             use_dropout ? hy_h * bi : hy_stride,
+                             0,
+                             &dwei_state[wei_shift],
+                             hy_h * bi,
+                             hy_h * bi * 4,
+                             bi_stride,
+                             0,
+                             1,
+                             1);
 
             if(biased)
             {
@@ -1504,23 +1505,23 @@ void RunLSTMBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
             {
                 if(!hx_is_null)
                 {
-                    ADNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
-                                      hy_h * 4,
-                                      in_n[ti],
-                                      hy_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      &hx_state[hx_shift],
-                                      hy_h,
-                                      in_n[ti],
-                                      uni_stride,
-                                      0,
-                                      &dwei_state[wei_shift],
-                                      hy_h,
-                                      hy_h * 4,
-                                      uni_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
+                                     hy_h * 4,
+                                     in_n[ti],
+                                     hy_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     &hx_state[hx_shift],
+                                     hy_h,
+                                     in_n[ti],
+                                     uni_stride,
+                                     0,
+                                     &dwei_state[wei_shift],
+                                     hy_h,
+                                     hy_h * 4,
+                                     uni_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     if(biased)
                     {
@@ -1542,23 +1543,23 @@ void RunLSTMBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                 pretime_shift =
                     li * batch_n * hy_stride + (bacc - in_n[ti - 1]) * hy_stride + bi * 5 * hy_h;
 
-                ADNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
-                                  hy_h * 4,
-                                  in_n[ti],
-                                  hy_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  &rsvspace_state[pretime_shift],
-                                  hy_h,
-                                  in_n[ti],
-                                  hy_stride,
-                                  0,
-                                  &dwei_state[wei_shift],
-                                  hy_h,
-                                  hy_h * 4,
-                                  uni_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
+                                 hy_h * 4,
+                                 in_n[ti],
+                                 hy_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 &rsvspace_state[pretime_shift],
+                                 hy_h,
+                                 in_n[ti],
+                                 hy_stride,
+                                 0,
+                                 &dwei_state[wei_shift],
+                                 hy_h,
+                                 hy_h * 4,
+                                 uni_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 if(biased)
                 {
@@ -1581,23 +1582,23 @@ void RunLSTMBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                 {
                     if(!hx_is_null)
                     {
-                        ADNN_mm_cpu<Tref>(&wkspace_state[hid_shift + 4 * hy_h],
-                                          hy_h * 4,
-                                          in_n[ti],
-                                          hy_stride,
-                                          ADNN_MM_TRANSPOSE,
-                                          &hx_state[hx_shift + hy_n * hy_h],
-                                          hy_h,
-                                          in_n[ti],
-                                          uni_stride,
-                                          0,
-                                          &dwei_state[wei_shift + 4 * hy_h * uni_stride],
-                                          hy_h,
-                                          hy_h * 4,
-                                          uni_stride,
-                                          0,
-                                          1,
-                                          1);
+                        RNN_mm_cpu<Tref>(&wkspace_state[hid_shift + 4 * hy_h],
+                                         hy_h * 4,
+                                         in_n[ti],
+                                         hy_stride,
+                                         ADNN_MM_TRANSPOSE,
+                                         &hx_state[hx_shift + hy_n * hy_h],
+                                         hy_h,
+                                         in_n[ti],
+                                         uni_stride,
+                                         0,
+                                         &dwei_state[wei_shift + 4 * hy_h * uni_stride],
+                                         hy_h,
+                                         hy_h * 4,
+                                         uni_stride,
+                                         0,
+                                         1,
+                                         1);
 
                         if(biased)
                         {
@@ -1618,24 +1619,24 @@ void RunLSTMBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                 {
                     if(!hx_is_null && in_n.at(ti) > in_n.at(ti + 1))
                     {
-                        ADNN_mm_cpu<Tref>(
-                            &wkspace_state[hid_shift + 4 * hy_h + in_n.at(ti + 1) * hy_stride],
-                            hy_h * 4,
-                            (in_n.at(ti) - in_n.at(ti + 1)),
-                            hy_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hx_state[hx_shift + hy_n * hy_h + in_n.at(ti + 1) * hy_h],
-                            hy_h,
-                            (in_n.at(ti) - in_n.at(ti + 1)),
-                            uni_stride,
-                            0,
-                            &dwei_state[wei_shift + 4 * hy_h * uni_stride],
-                            hy_h,
-                            hy_h * 4,
-                            uni_stride,
-                            0,
-                            1,
-                            1);
+                        RNN_mm_cpu<Tref>(
+                           &wkspace_state[hid_shift + 4 * hy_h + in_n.at(ti + 1) * hy_stride],
+                           hy_h * 4,
+                           (in_n.at(ti) - in_n.at(ti + 1)),
+                           hy_stride,
+                           ADNN_MM_TRANSPOSE,
+                           &hx_state[hx_shift + hy_n * hy_h + in_n.at(ti + 1) * hy_h],
+                           hy_h,
+                           (in_n.at(ti) - in_n.at(ti + 1)),
+                           uni_stride,
+                           0,
+                           &dwei_state[wei_shift + 4 * hy_h * uni_stride],
+                           hy_h,
+                           hy_h * 4,
+                           uni_stride,
+                           0,
+                           1,
+                           1);
 
                         if(biased)
                         {
@@ -1655,23 +1656,23 @@ void RunLSTMBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                     pretime_shift =
                         li * batch_n * hy_stride + (bacc + in_n[ti]) * hy_stride + bi * 5 * hy_h;
 
-                    ADNN_mm_cpu<Tref>(&wkspace_state[hid_shift + 4 * hy_h],
-                                      hy_h * 4,
-                                      in_n[ti + 1],
-                                      hy_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      &rsvspace_state[pretime_shift + hy_h],
-                                      hy_h,
-                                      in_n[ti + 1],
-                                      hy_stride,
-                                      0,
-                                      &dwei_state[wei_shift + 4 * hy_h * uni_stride],
-                                      hy_h,
-                                      hy_h * 4,
-                                      uni_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(&wkspace_state[hid_shift + 4 * hy_h],
+                                     hy_h * 4,
+                                     in_n[ti + 1],
+                                     hy_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     &rsvspace_state[pretime_shift + hy_h],
+                                     hy_h,
+                                     in_n[ti + 1],
+                                     hy_stride,
+                                     0,
+                                     &dwei_state[wei_shift + 4 * hy_h * uni_stride],
+                                     hy_h,
+                                     hy_h * 4,
+                                     uni_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     if(biased)
                     {
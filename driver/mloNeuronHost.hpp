@@ -35,8 +35,10 @@
 #include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 #include "miopen/float_equal.hpp"
+#include "../test/cpu_activation.hpp"
 
 ////////////////////////////////////////////////////////////
 //
@@ -56,8 +58,6 @@
 #define MIOPEN_NEURON_TOTAL 10
 #endif
 
-const float kBNLL_THRESHOLD = 50.;
-
 template <typename T>
 T calculate_relative_error(T uref, T u)
 {
@@ -76,56 +76,17 @@ int mloNeuronForwardRunHostAndVerify(int neuron_type,
                                      _Tcheck allowedEps)
 {
 
-    int match      = 1;
-    _Tcheck* c_res = new _Tcheck[size];
-    _Tcheck* data  = new _Tcheck[size];
-    for(size_t k = 0; k < size; k++)
-        data[k]  = static_cast<_Tcheck>(bot_ptr[k]);
-
-    std::function<_Tcheck(_Tcheck)> f;
-
-    switch(neuron_type)
-    {
-    case MIOPEN_NEURON_PASTHRU: //	x
-        f = [=](_Tcheck x) { return x; };
-        break;
-    case MIOPEN_NEURON_LOGISTIC: //	1 / (1 + e^-x)	//Sigmoid
-        f = [=](_Tcheck x) { return 1 / (1 + std::exp(-x)); };
-        break;
-    case MIOPEN_NEURON_TANH: //	beta * tanh(alpha * x)
-        f = [=](_Tcheck x) { return beta * std::tanh(alpha * x); };
-        break;
-    case MIOPEN_NEURON_RELU: //	max(0, x)
-        f = [=](_Tcheck x) { return (x > 0) ? x : 0; };
-        break;
-    case MIOPEN_NEURON_SOFTRELU: //	log(1 + e^x)   // bonomial normal log likelihood
-        f = [=](_Tcheck x) {
-            return (x > 0.) ? (x + std::log1p(std::exp(-x))) : (std::log1p(std::exp(x)));
-        };
-        break;
-    case MIOPEN_NEURON_ABS: //	abs(x)
-        f = [=](_Tcheck x) { return std::abs(x); };
-        break;
-    case MIOPEN_NEURON_POWER: // (alpha + beta * x) ^ gamma
-        f = [=](_Tcheck x) {
-            _Tcheck v = alpha + beta * x;
-            return v <= std::numeric_limits<_Tcheck>::epsilon() ? 0 : pow(v, gamma);
-        };
-        break;
-    case MIOPEN_NEURON_CLIPPED_RELU: // min(alpha, max(0, x))
-        f = [=](_Tcheck x) { return std::min(alpha, std::max(_Tcheck(0), x)); };
-        break;
-    case MIOPEN_NEURON_LEAKY_RELU: // alpha * x | x<=0; x | x>0
-        f = [=](_Tcheck x) { return (x > 0) ? x : x * alpha; };
-        break;
-    case MIOPEN_NEURON_ELU: // alpah * (exp(x)-1) | x<=0; x | x>0
-        f = [=](_Tcheck x) { return (x > 0) ? x : alpha * std::expm1(x); };
-        break;
-    default: printf("ERROR: unknown neuron type: %d\n", neuron_type); break;
-    }
-
-    for(size_t i = 0; i < size; i++)
-        c_res[i] = f(data[i]);
+    int match = 1;
+    std::vector<_Tcheck> c_res(size);
+    const nc_view view(1, 1, 1, 1, size);
+    cpu_activation_forward(static_cast<miopenActivationMode_t>(neuron_type),
+                           alpha,
+                           beta,
+                           gamma,
+                           view,
+                           bot_ptr,
+                           view,
+                           c_res.data());
 
     for(size_t i = 0; i < size && match; i++)
     {
@@ -138,22 +99,13 @@ int mloNeuronForwardRunHostAndVerify(int neuron_type,
            !std::isfinite(c_val) || !std::isfinite(g_val))
         {
             std::cout << "Difference in neuron layer: " << err << " too large at " << i
-                      << " x = " << data[i] << " "
+                      << " x = " << static_cast<_Tcheck>(bot_ptr[i]) << " "
                       << " c_v = " << c_val << " vs g_val = " << g_val
                       << " tolerance = " << allowedEps << std::endl;
             match = 0;
         }
     }
 
-    if(c_res)
-    {
-        delete[] c_res;
-    }
-    if(data)
-    {
-        delete[] data;
-    }
-
     return (match);
 }
 
@@ -171,65 +123,21 @@ int mloNeuronBackwardRunHostAndVerify(int neuron_type,
                                       _Tcheck allowedEps)
 {
 
-    int match           = 1;
-    _Tcheck* bot_cpu    = new _Tcheck[size];
-    _Tcheck* top_cpu    = new _Tcheck[size];
-    _Tcheck* bot_df_cpu = new _Tcheck[size];
-    _Tcheck* top_df_cpu = new _Tcheck[size];
-
-    for(size_t k = 0; k < size; k++)
-    {
-        bot_cpu[k]    = static_cast<_Tcheck>(bot_ptr[k]);
-        top_cpu[k]    = static_cast<_Tcheck>(top_ptr[k]);
-        top_df_cpu[k] = static_cast<_Tcheck>(top_df_ptr[k]);
-    }
-
-    std::function<_Tcheck(_Tcheck, _Tcheck, _Tcheck)> f;
-
-    switch(neuron_type)
-    {
-    case MIOPEN_NEURON_PASTHRU: //	x
-        f = [=](_Tcheck dy, _Tcheck, _Tcheck) { return dy; };
-        break;
-    case MIOPEN_NEURON_LOGISTIC: //	1 / (1 + e^-x)	//Sigmoid
-        f = [=](_Tcheck dy, _Tcheck, _Tcheck y) { return dy * y * (1 - y); };
-        break;
-    case MIOPEN_NEURON_TANH: //	beta * tanh(alpha * x)
-        f = [=](_Tcheck dy, _Tcheck, _Tcheck y) { return dy * alpha * (beta - y * y / beta); };
-        break;
-    case MIOPEN_NEURON_RELU: //	max(0, x)
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) { return (x > 0) ? dy : 0; };
-        break;
-    case MIOPEN_NEURON_SOFTRELU: //	log(1 + e^x)   // bonomial normal log likelihood
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) {
-            _Tcheck threshold = kBNLL_THRESHOLD;
-            _Tcheck expval    = std::exp(std::min(x, threshold));
-            return dy * expval / (expval + 1.0);
-        };
-        break;
-    case MIOPEN_NEURON_ABS: //	abs(x)
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) { return dy * ((x > 0) ? 1 : -1); };
-        break;
-    case MIOPEN_NEURON_POWER: // (alpha + beta * x) ^ gamma
-        f = [=](_Tcheck, _Tcheck x, _Tcheck y) {
-            _Tcheck v = alpha + beta * x;
-            return v <= std::numeric_limits<_Tcheck>::epsilon() ? 0 : gamma * beta * y / v;
-        };
-        break;
-    case MIOPEN_NEURON_CLIPPED_RELU: // min(alpha, max(0, x))
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) { return (x > 0 && x < alpha) ? dy : 0; };
-        break;
-    case MIOPEN_NEURON_LEAKY_RELU: // alpha * x | x<=0; x | x>0
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) { return dy * ((x > 0) ? 1 : alpha); };
-        break;
-    case MIOPEN_NEURON_ELU: // alpah * (exp(x)-1) | x<=0; x | x>0
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck y) { return dy * ((x > 0) ? 1 : y + alpha); };
-        break;
-    default: printf("ERROR: unknown neuron type: %d\n", neuron_type); break;
-    }
-
-    for(size_t i      = 0; i < size; i++)
-        bot_df_cpu[i] = f(top_df_cpu[i], bot_cpu[i], top_cpu[i]);
+    int match = 1;
+    std::vector<_Tcheck> bot_df_cpu(size);
+    const nc_view view(1, 1, 1, 1, size);
+    cpu_activation_backward(static_cast<miopenActivationMode_t>(neuron_type),
+                            alpha,
+                            beta,
+                            gamma,
+                            view,
+                            top_ptr,
+                            view,
+                            top_df_ptr,
+                            view,
+                            bot_ptr,
+                            view,
+                            bot_df_cpu.data());
 
     for(size_t i = 0; i < size && match; ++i)
     {
@@ -242,21 +150,15 @@ int mloNeuronBackwardRunHostAndVerify(int neuron_type,
            !std::isfinite(c_val) || !std::isfinite(g_val))
         {
             std::cout << "Difference in neuron back-propagation: " << err << " too large at " << i
-                      << " dy = " << top_df_cpu[i] << " x = " << bot_cpu[i] << " y = " << top_cpu[i]
-                      << " "
+                      << " dy = " << static_cast<_Tcheck>(top_df_ptr[i])
+                      << " x = " << static_cast<_Tcheck>(bot_ptr[i])
+                      << " y = " << static_cast<_Tcheck>(top_ptr[i]) << " "
                       << " c_v = " << c_val << " vs g_val = " << g_val
                       << " tolerance = " << allowedEps << std::endl;
             match = 0;
         }
     }
 
-    if(bot_df_cpu)
-    {
-        delete[] bot_cpu;
-        delete[] top_cpu;
-        delete[] bot_df_cpu;
-        delete[] top_df_cpu;
-    }
     return (match);
 }
 
@@ -37,6 +37,7 @@
 #include <iomanip>
 
 #include "calcerr.hpp"
+#include "../test/cpu_pooling.hpp"
 
 #if 0
 template<typename _T>
@@ -75,6 +76,35 @@ double CalcErr( _T c_val, _T g_val)
 #define MLO_POOLING_OP_AVE_INCLUSIVE 3
 #endif
 
+inline miopenPoolingMode_t mloPoolingMode(int pooling_method)
+{
+    switch(pooling_method)
+    {
+    case MLO_POOLING_OP_MAX: return miopenPoolingMax;
+    case MLO_POOLING_OP_AVE: return miopenPoolingAverage;
+    case MLO_POOLING_OP_AVE_INCLUSIVE: return miopenPoolingAverageInclusive;
+    default: MIOPEN_THROW("Unknown pooling operator: " + std::to_string(pooling_method));
+    }
+}
+
+inline nc_view mloPoolingView(int n,
+                              int c,
+                              int depth,
+                              int height,
+                              int width,
+                              int batch_stride,
+                              int channel_stride,
+                              int depth_stride,
+                              int stride)
+{
+    nc_view view(n, c, depth, height, width);
+    view.n_stride = batch_stride;
+    view.c_stride = channel_stride;
+    view.d_stride = depth_stride;
+    view.h_stride = stride;
+    return view;
+}
+
 template <typename _Tgpu /* the data type used in GPU computations (usually half) */,
           typename _Tcheck /* the data type used in CPU checkings (usually double) */,
           typename Index>
@@ -107,20 +137,43 @@ bool mloPoolingForwardRunHostAndVerify(int pooling_method,
                                        const _Tgpu* bot_ptr,
                                        const _Tgpu* top_ptr,
                                        bool do_backward,
-                                       size_t* mask_ptr,
+                                       size_t* mask_ptr, // image index of each maximum
                                        Index* mask_gpu,
                                        _Tcheck allowedEps,
                                        int index_position = 1)
 {
+    const cpu_pooling_params params{mloPoolingMode(pooling_method),
+                                    {filter_size_d, filter_size_h, filter_size_w},
+                                    {pool_stride_d, pool_stride_h, pool_stride_w},
+                                    {pad_d, pad_h, pad_w}};
+    const auto bot = mloPoolingView(n_batchs,
+                                    n_outputs,
+                                    bot_depth,
+                                    bot_height,
+                                    bot_width,
+                                    bot_batch_stride,
+                                    bot_channel_stride,
+                                    bot_depth_stride,
+                                    bot_stride);
+    const auto top = mloPoolingView(n_batchs,
+                                    n_outputs,
+                                    top_depth,
+                                    top_height,
+                                    top_width,
+                                    top_batch_stride,
+                                    top_channel_stride,
+                                    top_depth_stride,
+                                    top_stride);
+
+    const bool max_mode = pooling_method == MLO_POOLING_OP_MAX;
+    std::vector<_Tcheck> c_res(static_cast<std::size_t>(n_batchs) * top_batch_stride);
+    cpu_pooling_forward(params, bot, bot_ptr, top, c_res.data(), max_mode ? mask_ptr : nullptr);
+
+    const _Tgpu G_MAX_VAL = (sizeof(_Tgpu) == 4 || sizeof(_Tgpu) == 8)
+                                ? static_cast<_Tgpu>(3.402823466e+38)
+                                : static_cast<_Tgpu>(65504);
 
     bool match = true;
-    _Tcheck MAX_VAL(3.402823466e+38);
-    _Tgpu G_MAX_VAL = (sizeof(_Tgpu) == 4 || sizeof(_Tgpu) == 8)
-                          ? static_cast<_Tgpu>(3.402823466e+38)
-                          : static_cast<_Tgpu>(65504);
-    // c-emulator
-    _Tcheck res = static_cast<_Tcheck>(0);
-
     for(int b = 0; b < n_batchs && match; b++)
     {
         for(int o = 0; o < n_outputs && match; o++)
@@ -131,120 +184,43 @@ bool mloPoolingForwardRunHostAndVerify(int pooling_method,
                 {
                     for(int i = 0; i < top_width && match; i++)
                     {
-                        // c-emulator
-                        if(pooling_method == MLO_POOLING_OP_MAX)
-                        {
-                            res = -MAX_VAL;
-                        }
-                        else if(pooling_method == MLO_POOLING_OP_AVE ||
-                                pooling_method == MLO_POOLING_OP_AVE_INCLUSIVE)
-                        {
-                            res = static_cast<_Tcheck>(0);
-                        }
-
-                        int dstart = k * pool_stride_d - pad_d;
-                        int hstart = j * pool_stride_h - pad_h;
-                        int wstart = i * pool_stride_w - pad_w;
-                        int dend   = std::min(dstart + filter_size_d, bot_depth);
-                        int hend   = std::min(hstart + filter_size_h, bot_height);
-                        int wend   = std::min(wstart + filter_size_w, bot_width);
-                        dstart     = std::max(dstart, 0);
-                        hstart     = std::max(hstart, 0);
-                        wstart     = std::max(wstart, 0);
+                        const size_t top_index = top.index(b, o, k, j, i);
+                        // top points which have no associated bottom points compare as 0
+                        const bool found = !max_mode || mask_ptr[top_index] != cpu_pooling_no_index;
 
-                        int pool_size;
-                        if(pooling_method == MLO_POOLING_OP_AVE)
-                            pool_size = (dend - dstart) * (hend - hstart) * (wend - wstart);
-                        else
-                            pool_size        = filter_size_w * filter_size_h * filter_size_d;
-                        pool_size            = (pool_size == 0) ? 1 : pool_size;
-                        size_t res_index     = 0;
-                        size_t res_index_gpu = 0;
-                        bool found           = false;
-                        for(int d = dstart; d < dend; ++d)
+                        if(max_mode && do_backward)
                         {
-                            for(int h = hstart; h < hend; ++h)
+                            const size_t res_index = mask_ptr[top_index];
+                            size_t res_index_gpu   = std::numeric_limits<uint8_t>::max();
+                            if(found && index_position == 1)
                             {
-                                for(int w = wstart; w < wend; ++w)
-                                {
-                                    size_t bot_index = b * bot_batch_stride +
-                                                       o * bot_channel_stride +
-                                                       d * bot_depth_stride + h * bot_stride + w;
-                                    if(pooling_method == MLO_POOLING_OP_MAX)
-                                    {
-                                        if(static_cast<_Tcheck>(bot_ptr[bot_index]) > res)
-                                        {
-                                            res       = static_cast<_Tcheck>(bot_ptr[bot_index]);
-                                            res_index = bot_index;
-                                            res_index_gpu =
-                                                index_position == 1
-                                                    ? (d * bot_height * bot_width + h * bot_width +
-                                                       w)
-                                                    : ((d - k * pool_stride_d + pad_d) *
-                                                       filter_size_w * filter_size_h) +
-                                                          ((h - j * pool_stride_h + pad_h) *
-                                                           filter_size_w) +
-                                                          (w - i * pool_stride_w + pad_w);
-                                            found = true;
-                                        }
-                                    }
-                                    else if(pooling_method == MLO_POOLING_OP_AVE ||
-                                            pooling_method == MLO_POOLING_OP_AVE_INCLUSIVE)
-                                    {
-
-                                        res += static_cast<_Tcheck>(bot_ptr[bot_index]);
-                                    }
-                                    else
-                                    {
-                                        std::cout << "ERROR: unknown operator : layer: pooling."
-                                                  << std::endl;
-                                        match = false;
-                                        continue;
-                                    }
-                                }
+                                res_index_gpu = res_index;
                             }
-                        }
-                        // special index value is used to mark top points which has no associated
-                        // bottom
-                        // points
-                        if(!found)
-                        {
-                            res_index     = std::numeric_limits<size_t>::max();
-                            res_index_gpu = std::numeric_limits<uint8_t>::max();
-                        }
-
-                        size_t top_index = b * top_batch_stride + o * top_channel_stride +
-                                           k * top_depth_stride + j * top_stride + i;
-                        if(pooling_method == MLO_POOLING_OP_MAX)
-                        {
-                            // the case with the odd input, the even kernel size and 2*pad == kernel
-                            // size
-                            mask_ptr[top_index] = res_index;
-                            if(do_backward)
+                            else if(found)
                             {
-                                size_t mg = mask_gpu[top_index];
-                                if(mg != res_index_gpu)
-                                {
-                                    std::cout << "Mask mismatch, gpu " << mg << " cpu "
-                                              << res_index_gpu << "(" << res_index << ")"
-                                              << std::endl;
-                                    match = false;
-                                }
+                                const int d   = res_index / (bot_height * bot_width);
+                                const int h   = res_index / bot_width % bot_height;
+                                const int w   = res_index % bot_width;
+                                res_index_gpu = (d - k * pool_stride_d + pad_d) * filter_size_w *
+                                                    filter_size_h +
+                                                (h - j * pool_stride_h + pad_h) * filter_size_w +
+                                                (w - i * pool_stride_w + pad_w);
+                            }
+                            size_t mg = mask_gpu[top_index];
+                            if(mg != res_index_gpu)
+                            {
+                                std::cout << "Mask mismatch, gpu " << mg << " cpu " << res_index_gpu
+                                          << "(" << res_index << ")" << std::endl;
+                                match = false;
                             }
                         }
-                        if(pooling_method == MLO_POOLING_OP_AVE ||
-                           pooling_method == MLO_POOLING_OP_AVE_INCLUSIVE)
-                        {
-                            res /= pool_size;
-                        }
-                        _Tcheck c_val = res;
+
+                        _Tcheck c_val = found ? c_res[top_index] : _Tcheck(0);
 
                         _Tgpu gg_val = (top_ptr[top_index]);
 
                         gg_val = (_Tgpu(gg_val) == _Tgpu(-G_MAX_VAL)) ? _Tgpu(0) : _Tgpu(gg_val);
 
-                        c_val = (c_val == -MAX_VAL) ? 0 : c_val;
-
                         _Tcheck g_val(gg_val);
 
                         double err = std::abs(c_val - g_val);
@@ -280,7 +256,7 @@ int mloPoolingBackwardRunHost(
     int pad_w,
     int pool_stride_w,
 
-    _Tcheck* bot_df_v_ptr, // the code assumes that bot_df_v_ptr was zeroed
+    _Tcheck* bot_df_v_ptr,
     const _Tgpu* top_df_ptr,
     const size_t* mask_ptr,
 
@@ -302,114 +278,33 @@ int mloPoolingBackwardRunHost(
     int top_height,
     int top_depth)
 {
-
-    int ret = 0;
-
-    for(int b = 0; b < n_batchs; b++)
-    {
-        for(int o = 0; o < n_outputs; o++)
-        {
-            int bot_df_v_off = b * bot_df_v_batch_stride + o * bot_df_v_channel_stride;
-            int top_df_off   = b * top_df_batch_stride + o * top_df_channel_stride;
-
-            if(pooling_method == MLO_POOLING_OP_MAX)
-            {
-                for(int k = 0; k < top_depth; k++)
-                {
-                    for(int j = 0; j < top_height; j++)
-                    {
-                        for(int i = 0; i < top_width; i++)
-                        {
-                            size_t top_idx =
-                                top_df_off + k * top_df_depth_stride + j * top_df_stride + i;
-                            size_t bot_idx = mask_ptr[top_idx];
-                            // skip top points that don't have associated bottom points
-                            if(bot_idx == std::numeric_limits<size_t>::max())
-                                continue;
-                            bot_df_v_ptr[bot_idx] += static_cast<_Tcheck>(top_df_ptr[top_idx]);
-                        }
-                    }
-                }
-            }
-            else if(pooling_method == MLO_POOLING_OP_AVE ||
-                    pooling_method == MLO_POOLING_OP_AVE_INCLUSIVE)
-            {
-
-                for(int k = 0; k < bot_depth; k++)
-                {
-                    for(int j = 0; j < bot_height; j++)
-                    {
-                        for(int i = 0; i < bot_width; i++)
-                        {
-                            // c-emulator
-                            bot_df_v_ptr[bot_df_v_off + k * bot_df_v_depth_stride +
-                                         j * bot_df_v_stride + i] = static_cast<_Tcheck>(0);
-                            int d                                 = k + pad_d;
-                            int h                                 = j + pad_h;
-                            int w                                 = i + pad_w;
-                            int pdstart =
-                                (d < filter_size_d) ? 0 : (d - filter_size_d) / pool_stride_d + 1;
-                            int pdend = std::min(d / pool_stride_d + 1, top_depth);
-                            int phstart =
-                                (h < filter_size_h) ? 0 : (h - filter_size_h) / pool_stride_h + 1;
-                            int phend = std::min(h / pool_stride_h + 1, top_height);
-                            int pwstart =
-                                (w < filter_size_w) ? 0 : (w - filter_size_w) / pool_stride_w + 1;
-                            int pwend        = std::min(w / pool_stride_w + 1, top_width);
-                            _Tcheck gradient = static_cast<_Tcheck>(0);
-                            for(int pd = pdstart; pd < pdend; ++pd)
-                            {
-                                for(int ph = phstart; ph < phend; ++ph)
-                                {
-                                    for(int pw = pwstart; pw < pwend; ++pw)
-                                    {
-                                        // figure out the pooling size
-                                        int dstart = pd * pool_stride_d - pad_d;
-                                        int hstart = ph * pool_stride_h - pad_h;
-                                        int wstart = pw * pool_stride_w - pad_w;
-                                        int dend   = std::min(dstart + filter_size_d, bot_depth);
-                                        int hend   = std::min(hstart + filter_size_h, bot_height);
-                                        int wend   = std::min(wstart + filter_size_w, bot_width);
-                                        dstart     = std::max(dstart, 0);
-                                        hstart     = std::max(hstart, 0);
-                                        wstart     = std::max(wstart, 0);
-
-                                        int pool_size;
-                                        if(pooling_method == MLO_POOLING_OP_AVE)
-                                            pool_size = ((dend - dstart) * (hend - hstart) *
-                                                             (wend - wstart) ==
-                                                         0)
-                                                            ? 1
-                                                            : (dend - dstart) * (hend - hstart) *
-                                                                  (wend - wstart);
-                                        else
-                                            pool_size =
-                                                (filter_size_w * filter_size_h * filter_size_d == 0)
-                                                    ? 1
-                                                    : filter_size_w * filter_size_h * filter_size_d;
-                                        gradient +=
-                                            static_cast<_Tcheck>(
-                                                top_df_ptr[top_df_off + pd * top_df_depth_stride +
-                                                           ph * top_df_stride + pw]) /
-                                            static_cast<_Tcheck>(pool_size);
-                                    }
-                                }
-                            }
-                            bot_df_v_ptr[bot_df_v_off + k * bot_df_v_depth_stride +
-                                         j * bot_df_v_stride + i] = gradient;
-                        }
-                    }
-                }
-            }
-            else
-            {
-                std::cout << "ERROR: unknown operator : layer: pooling back-propagation."
-                          << std::endl;
-                continue;
-            }
-        }
-    }
-    return (ret);
+    const cpu_pooling_params params{mloPoolingMode(pooling_method),
+                                    {filter_size_d, filter_size_h, filter_size_w},
+                                    {pool_stride_d, pool_stride_h, pool_stride_w},
+                                    {pad_d, pad_h, pad_w}};
+    cpu_pooling_backward(params,
+                         mloPoolingView(n_batchs,
+                                        n_outputs,
+                                        top_depth,
+                                        top_height,
+                                        top_width,
+                                        top_df_batch_stride,
+                                        top_df_channel_stride,
+                                        top_df_depth_stride,
+                                        top_df_stride),
+                         top_df_ptr,
+                         mloPoolingView(n_batchs,
+                                        n_outputs,
+                                        bot_depth,
+                                        bot_height,
+                                        bot_width,
+                                        bot_df_v_batch_stride,
+                                        bot_df_v_channel_stride,
+                                        bot_df_v_depth_stride,
+                                        bot_df_v_stride),
+                         bot_df_v_ptr,
+                         mask_ptr);
+    return 0;
 }
 
 #ifdef __clang__
@@ -0,0 +1,195 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_RNN_CPU_GEMM_HPP
+#define GUARD_MIOPEN_RNN_CPU_GEMM_HPP
+
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+#ifndef ADNN_MM_TRANSPOSE
+#define ADNN_MM_TRANSPOSE 1
+#endif
+
+/// Blocked, multithreaded replacement for ADNN_mm_cpu used by the RNN/LSTM/GRU
+/// host references. Takes exactly the same arguments.
+///
+/// C is split into tiles of RNN_MM_ROW_BLOCK rows by RNN_MM_COL_BLOCK columns which
+/// are computed independently on the host threads. Within a tile every element is
+/// still accumulated from m = 0 upwards into a zero-initialized accumulator and then
+/// combined as beta * C + alpha * acc, i.e. in the same order as ADNN_mm_cpu does,
+/// so the results are reproducible against the scalar implementation.
+#define RNN_MM_ROW_BLOCK 16
+#define RNN_MM_COL_BLOCK 256
+// GEMMs smaller than that (in multiply-adds) are not worth spawning threads for.
+#define RNN_MM_PARALLEL_THRESHOLD (std::size_t{1} << 18)
+
+namespace rnn_cpu_gemm_detail {
+
+template <typename Dtype, class FA, class FB>
+void mm_tile_rank1(FA a_at,
+                   FB b_row,
+                   std::size_t inner_loop,
+                   Dtype* c_ptr,
+                   std::size_t c_stride,
+                   std::size_t n_begin,
+                   std::size_t n_end,
+                   std::size_t k_begin,
+                   std::size_t k_end,
+                   Dtype alpha,
+                   Dtype beta)
+{
+    const std::size_t tile_w = k_end - k_begin;
+    std::vector<Dtype> acc((n_end - n_begin) * tile_w, static_cast<Dtype>(0));
+
+    for(std::size_t m = 0; m < inner_loop; ++m)
+    {
+        const Dtype* b_m = b_row(m);
+        for(std::size_t n = n_begin; n < n_end; ++n)
+        {
+            const Dtype a_nm = a_at(n, m);
+            Dtype* acc_n     = &acc[(n - n_begin) * tile_w];
+            for(std::size_t k = 0; k < tile_w; ++k)
+                acc_n[k] += a_nm * b_m[k];
+        }
+    }
+
+    for(std::size_t n = n_begin; n < n_end; ++n)
+    {
+        const Dtype* acc_n = &acc[(n - n_begin) * tile_w];
+        Dtype* c_n         = &c_ptr[n * c_stride + k_begin];
+        for(std::size_t k = 0; k < tile_w; ++k)
+            c_n[k] = beta * c_n[k] + alpha * acc_n[k];
+    }
+}
+
+} // namespace rnn_cpu_gemm_detail
+
+template <typename Dtype>
+void RNN_mm_cpu(const Dtype* a_ptr,
+                size_t a_cols,
+                size_t a_rows,
+                size_t a_stride,
+                int a_flags,
+                const Dtype* b_ptr,
+                size_t b_cols,
+                size_t b_rows,
+                size_t b_stride,
+                int b_flags,
+                Dtype* c_ptr,
+                size_t c_cols,
+                size_t c_rows,
+                size_t c_stride,
+                int /*c_flags*/,
+                double d_alpha,
+                double d_beta)
+{
+    const bool a_trans = (a_flags & ADNN_MM_TRANSPOSE) != 0;
+    const bool b_trans = (b_flags & ADNN_MM_TRANSPOSE) != 0;
+
+    if((!a_trans && !b_trans && ((a_cols != b_rows) || (a_rows != c_rows) || (b_cols != c_cols))) ||
+       (a_trans && b_trans && ((a_rows != b_cols) || (a_cols != c_rows) || (b_rows != c_cols))) ||
+       (a_trans && !b_trans && ((a_rows != b_rows) || (a_cols != c_rows) || (b_cols != c_cols))) ||
+       (!a_trans && b_trans && ((a_cols != b_cols) || (a_rows != c_rows) || (b_rows != c_cols))))
+    {
+        printf("MM_CPU ERROR; %zd %zd   %zd %zd   %zd %zd\n",
+               a_cols,
+               a_rows,
+               b_cols,
+               b_rows,
+               c_rows,
+               c_cols);
+        return;
+    }
+
+    const Dtype alpha            = Dtype(d_alpha);
+    const Dtype beta             = Dtype(d_beta);
+    const std::size_t inner_loop = !a_trans ? a_cols : a_rows;
+
+    const std::size_t row_blocks = (c_rows + RNN_MM_ROW_BLOCK - 1) / RNN_MM_ROW_BLOCK;
+    const std::size_t col_blocks = (c_cols + RNN_MM_COL_BLOCK - 1) / RNN_MM_COL_BLOCK;
+
+    const auto a_at = [&](std::size_t n, std::size_t m) {
+        return a_trans ? a_ptr[m * a_stride + n] : a_ptr[n * a_stride + m];
+    };
+
+    // A transposed B is repacked once, so that every tile can use the same rank-1
+    // update loop (and thus the same accumulation order) with contiguous B rows.
+    std::vector<Dtype> b_packed;
+    if(b_trans)
+    {
+        b_packed.resize(inner_loop * c_cols);
+        for(std::size_t k0 = 0; k0 < c_cols; k0 += RNN_MM_ROW_BLOCK)
+        {
+            const std::size_t k1 = std::min<std::size_t>(k0 + RNN_MM_ROW_BLOCK, c_cols);
+            for(std::size_t m0 = 0; m0 < inner_loop; m0 += RNN_MM_ROW_BLOCK)
+            {
+                const std::size_t m1 = std::min<std::size_t>(m0 + RNN_MM_ROW_BLOCK, inner_loop);
+                for(std::size_t k = k0; k < k1; ++k)
+                    for(std::size_t m = m0; m < m1; ++m)
+                        b_packed[m * c_cols + k] = b_ptr[k * b_stride + m];
+            }
+        }
+    }
+    const Dtype* b_rows_ptr       = b_trans ? b_packed.data() : b_ptr;
+    const std::size_t b_rows_step = b_trans ? c_cols : b_stride;
+
+    const auto tile = [&](std::size_t id) {
+        const std::size_t n_begin = (id / col_blocks) * RNN_MM_ROW_BLOCK;
+        const std::size_t k_begin = (id % col_blocks) * RNN_MM_COL_BLOCK;
+        const std::size_t n_end   = std::min<std::size_t>(n_begin + RNN_MM_ROW_BLOCK, c_rows);
+        const std::size_t k_end   = std::min<std::size_t>(k_begin + RNN_MM_COL_BLOCK, c_cols);
+
+        rnn_cpu_gemm_detail::mm_tile_rank1<Dtype>(
+            a_at,
+            [&](std::size_t m) { return &b_rows_ptr[m * b_rows_step + k_begin]; },
+            inner_loop,
+            c_ptr,
+            c_stride,
+            n_begin,
+            n_end,
+            k_begin,
+            k_end,
+            alpha,
+            beta);
+    };
+
+    const std::size_t tiles = row_blocks * col_blocks;
+    if(c_rows * c_cols * inner_loop < RNN_MM_PARALLEL_THRESHOLD)
+    {
+        for(std::size_t id = 0; id < tiles; ++id)
+            tile(id);
+    }
+    else
+    {
+        miopen::par_for(tiles, miopen::min_grain{1}, tile);
+    }
+}
+
+#endif // GUARD_MIOPEN_RNN_CPU_GEMM_HPP
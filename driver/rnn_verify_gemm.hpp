@@ -7,6 +7,7 @@
 #include <cassert>
 #include <algorithm>
 #include "dropout_gpu_emulator.hpp"
+#include "rnn_cpu_gemm.hpp"
 
 int sumvc(std::vector<int>& x)
 {
@@ -220,23 +221,23 @@ void RunRNNForwardGEMMCPUVerify(miopenHandle_t handle,
             }
             else
             {
-                ADNN_mm_cpu<Tref>(in_state.data(),
-                                  in_h,
-                                  batch_n,
-                                  in_stride,
-                                  0,
-                                  wei_state.data(),
-                                  in_h,
-                                  hy_h * bi,
-                                  in_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  &hid_state[hid_shift],
-                                  hy_h * bi,
-                                  batch_n,
-                                  hy_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(in_state.data(),
+                                 in_h,
+                                 batch_n,
+                                 in_stride,
+                                 0,
+                                 wei_state.data(),
+                                 in_h,
+                                 hy_h * bi,
+                                 in_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 &hid_state[hid_shift],
+                                 hy_h * bi,
+                                 batch_n,
+                                 hy_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 // from bias
                 if(biased)
@@ -277,24 +278,24 @@ void RunRNNForwardGEMMCPUVerify(miopenHandle_t handle,
                 prelayer_shift = drop_out_offset;
             }
 
-            ADNN_mm_cpu<Tref>(use_dropout ? &dropout_hid_state[prelayer_shift]
-                                          : &wk_state[prelayer_shift],
-                              hy_h * bi,
-                              batch_n,
-                              use_dropout ? hy_h * bi : hy_stride,
-                              0,
-                              &wei_state[wei_shift],
-                              hy_h * bi,
-                              hy_h * bi,
-                              bi_stride,
-                              ADNN_MM_TRANSPOSE,
-                              &hid_state[hid_shift],
-                              hy_h * bi,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(use_dropout ? &dropout_hid_state[prelayer_shift]
+                                         : &wk_state[prelayer_shift],
+                             hy_h * bi,
+                             batch_n,
+                             use_dropout ? hy_h * bi : hy_stride,
+                             0,
+                             &wei_state[wei_shift],
+                             hy_h * bi,
+                             hy_h * bi,
+                             bi_stride,
+                             ADNN_MM_TRANSPOSE,
+                             &hid_state[hid_shift],
+                             hy_h * bi,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             1,
+                             1);
 
             // from bias
             if(biased)
@@ -328,23 +329,23 @@ void RunRNNForwardGEMMCPUVerify(miopenHandle_t handle,
             {
                 if(!hx_is_null)
                 {
-                    ADNN_mm_cpu<Tref>(&hx_state[hx_shift],
-                                      hy_h,
-                                      in_n[ti],
-                                      uni_stride,
-                                      0,
-                                      &wei_state[wei_shift],
-                                      hy_h,
-                                      hy_h,
-                                      uni_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      &hid_state[hid_shift + bacc * hy_stride],
-                                      hy_h,
-                                      in_n[ti],
-                                      hy_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(&hx_state[hx_shift],
+                                     hy_h,
+                                     in_n[ti],
+                                     uni_stride,
+                                     0,
+                                     &wei_state[wei_shift],
+                                     hy_h,
+                                     hy_h,
+                                     uni_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     &hid_state[hid_shift + bacc * hy_stride],
+                                     hy_h,
+                                     in_n[ti],
+                                     hy_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     // from bias
                     if(biased)
@@ -363,23 +364,23 @@ void RunRNNForwardGEMMCPUVerify(miopenHandle_t handle,
 
                     if(bidirection)
                     {
-                        ADNN_mm_cpu<Tref>(&hx_state[hx_shift + hy_n * hy_h],
-                                          hy_h,
-                                          in_n[seqLength - 1 - ti],
-                                          uni_stride,
-                                          0,
-                                          &wei_state[wei_shift + hy_h * uni_stride],
-                                          hy_h,
-                                          hy_h,
-                                          uni_stride,
-                                          ADNN_MM_TRANSPOSE,
-                                          &hid_state[hid_shift + baccbi * hy_stride + hy_h],
-                                          hy_h,
-                                          in_n[seqLength - 1 - ti],
-                                          hy_stride,
-                                          0,
-                                          1,
-                                          1);
+                        RNN_mm_cpu<Tref>(&hx_state[hx_shift + hy_n * hy_h],
+                                         hy_h,
+                                         in_n[seqLength - 1 - ti],
+                                         uni_stride,
+                                         0,
+                                         &wei_state[wei_shift + hy_h * uni_stride],
+                                         hy_h,
+                                         hy_h,
+                                         uni_stride,
+                                         ADNN_MM_TRANSPOSE,
+                                         &hid_state[hid_shift + baccbi * hy_stride + hy_h],
+                                         hy_h,
+                                         in_n[seqLength - 1 - ti],
+                                         hy_stride,
+                                         0,
+                                         1,
+                                         1);
 
                         // from bias
                         if(biased)
@@ -401,23 +402,23 @@ void RunRNNForwardGEMMCPUVerify(miopenHandle_t handle,
             }
             else
             {
-                ADNN_mm_cpu<Tref>(&hy_state[hx_shift],
-                                  hy_h,
-                                  in_n[ti],
-                                  uni_stride,
-                                  0,
-                                  &wei_state[wei_shift],
-                                  hy_h,
-                                  hy_h,
-                                  uni_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  &hid_state[hid_shift + bacc * hy_stride],
-                                  hy_h,
-                                  in_n[ti],
-                                  hy_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(&hy_state[hx_shift],
+                                 hy_h,
+                                 in_n[ti],
+                                 uni_stride,
+                                 0,
+                                 &wei_state[wei_shift],
+                                 hy_h,
+                                 hy_h,
+                                 uni_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 &hid_state[hid_shift + bacc * hy_stride],
+                                 hy_h,
+                                 in_n[ti],
+                                 hy_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 // from bias
                 if(biased)
@@ -439,25 +440,25 @@ void RunRNNForwardGEMMCPUVerify(miopenHandle_t handle,
 
                     if(!hx_is_null && in_n.at(seqLength - 1 - ti) > in_n.at(seqLength - ti))
                     {
-                        ADNN_mm_cpu<Tref>(
-                            &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h],
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            uni_stride,
-                            0,
-                            &wei_state[wei_shift + hy_h * uni_stride],
-                            hy_h,
-                            hy_h,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
-                                       hy_h],
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            hy_stride,
-                            0,
-                            1,
-                            1);
+                        RNN_mm_cpu<Tref>(
+                           &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h],
+                           hy_h,
+                           (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
+                           uni_stride,
+                           0,
+                           &wei_state[wei_shift + hy_h * uni_stride],
+                           hy_h,
+                           hy_h,
+                           uni_stride,
+                           ADNN_MM_TRANSPOSE,
+                           &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
+                                      hy_h],
+                           hy_h,
+                           (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
+                           hy_stride,
+                           0,
+                           1,
+                           1);
 
                         // from bias
                         if(biased)
@@ -477,23 +478,23 @@ void RunRNNForwardGEMMCPUVerify(miopenHandle_t handle,
                         }
                     }
 
-                    ADNN_mm_cpu<Tref>(&hy_state[hx_shift + hy_n * hy_h],
-                                      hy_h,
-                                      in_n[seqLength - ti],
-                                      uni_stride,
-                                      0,
-                                      &wei_state[wei_shift + hy_h * uni_stride],
-                                      hy_h,
-                                      hy_h,
-                                      uni_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      &hid_state[hid_shift + baccbi * hy_stride + hy_h],
-                                      hy_h,
-                                      in_n[seqLength - ti],
-                                      hy_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(&hy_state[hx_shift + hy_n * hy_h],
+                                     hy_h,
+                                     in_n[seqLength - ti],
+                                     uni_stride,
+                                     0,
+                                     &wei_state[wei_shift + hy_h * uni_stride],
+                                     hy_h,
+                                     hy_h,
+                                     uni_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     &hid_state[hid_shift + baccbi * hy_stride + hy_h],
+                                     hy_h,
+                                     in_n[seqLength - ti],
+                                     hy_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     // from bias
                     if(biased)
@@ -745,23 +746,23 @@ void RunRNNBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
         {
             int prelayer_shift = (li + 1) * batch_n * hy_h * bi;
 
-            ADNN_mm_cpu<Tref>(&dh_state[prelayer_shift],
-                              hy_h * bi,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              &wei_state[wei_shift],
-                              hy_h * bi,
-                              hy_h * bi,
-                              bi_stride,
-                              0,
-                              &dh_state[hid_shift],
-                              hy_h * bi,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(&dh_state[prelayer_shift],
+                             hy_h * bi,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             &wei_state[wei_shift],
+                             hy_h * bi,
+                             hy_h * bi,
+                             bi_stride,
+                             0,
+                             &dh_state[hid_shift],
+                             hy_h * bi,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             1,
+                             1);
 
             if(use_dropout)
             {
@@ -846,23 +847,23 @@ void RunRNNBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
                                                         (li - 1) * bi * (bi * hy_h + hy_h) * hy_h +
                                                         bi * hy_h * hy_stride);
 
-            ADNN_mm_cpu<Tref>(&dh_state[hid_shift + bacc * hy_stride],
-                              hy_h,
-                              in_n.at(ti),
-                              hy_stride,
-                              0,
-                              &wei_state[wei_shift],
-                              hy_h,
-                              hy_h,
-                              uni_stride,
-                              0,
-                              &dhx_state[hx_shift],
-                              hy_h,
-                              in_n.at(ti),
-                              uni_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(&dh_state[hid_shift + bacc * hy_stride],
+                             hy_h,
+                             in_n.at(ti),
+                             hy_stride,
+                             0,
+                             &wei_state[wei_shift],
+                             hy_h,
+                             hy_h,
+                             uni_stride,
+                             0,
+                             &dhx_state[hx_shift],
+                             hy_h,
+                             in_n.at(ti),
+                             uni_stride,
+                             0,
+                             1,
+                             1);
 
             if(bidirection)
             {
@@ -907,23 +908,23 @@ void RunRNNBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
                     }
                 }
 
-                ADNN_mm_cpu<Tref>(&dh_state[hid_shift + baccbi * hy_stride + hy_h],
-                                  hy_h,
-                                  in_n.at(seqLength - 1 - ti),
-                                  hy_stride,
-                                  0,
-                                  &wei_state[wei_shift + hy_h * uni_stride],
-                                  hy_h,
-                                  hy_h,
-                                  uni_stride,
-                                  0,
-                                  &dhx_state[hx_shift + hy_n * hy_h],
-                                  hy_h,
-                                  in_n.at(seqLength - 1 - ti),
-                                  uni_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(&dh_state[hid_shift + baccbi * hy_stride + hy_h],
+                                 hy_h,
+                                 in_n.at(seqLength - 1 - ti),
+                                 hy_stride,
+                                 0,
+                                 &wei_state[wei_shift + hy_h * uni_stride],
+                                 hy_h,
+                                 hy_h,
+                                 uni_stride,
+                                 0,
+                                 &dhx_state[hx_shift + hy_n * hy_h],
+                                 hy_h,
+                                 in_n.at(seqLength - 1 - ti),
+                                 uni_stride,
+                                 0,
+                                 1,
+                                 1);
             }
 
             baccbi += in_n.at(seqLength - 1 - ti);
@@ -947,23 +948,23 @@ void RunRNNBackwardDataGEMMCPUVerify(std::vector<Tref>& din_host,
     }
     else
     {
-        ADNN_mm_cpu<Tref>(dh_state.data(),
-                          hy_h * bi,
-                          batch_n,
-                          hy_stride,
-                          0,
-                          wei_state.data(),
-                          in_h,
-                          hy_h * bi,
-                          in_stride,
-                          0,
-                          din_state.data(),
-                          in_h,
-                          batch_n,
-                          in_stride,
-                          0,
-                          1,
-                          1);
+        RNN_mm_cpu<Tref>(dh_state.data(),
+                         hy_h * bi,
+                         batch_n,
+                         hy_stride,
+                         0,
+                         wei_state.data(),
+                         in_h,
+                         hy_h * bi,
+                         in_stride,
+                         0,
+                         din_state.data(),
+                         in_h,
+                         batch_n,
+                         in_stride,
+                         0,
+                         1,
+                         1);
     }
 
     for(int bs = 0; bs < batch_n; bs++)
@@ -1101,23 +1102,23 @@ void RunRNNBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
         {
             if(inputMode != 1)
             {
-                ADNN_mm_cpu<Tref>(wkspace_state.data(),
-                                  hy_h * bi,
-                                  batch_n,
-                                  hy_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  in_state.data(),
-                                  in_h,
-                                  batch_n,
-                                  in_stride,
-                                  0,
-                                  dwei_state.data(),
-                                  in_h,
-                                  hy_h * bi,
-                                  in_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(wkspace_state.data(),
+                                 hy_h * bi,
+                                 batch_n,
+                                 hy_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 in_state.data(),
+                                 in_h,
+                                 batch_n,
+                                 in_stride,
+                                 0,
+                                 dwei_state.data(),
+                                 in_h,
+                                 hy_h * bi,
+                                 in_stride,
+                                 0,
+                                 1,
+                                 1);
             }
             if(biased)
             {
@@ -1137,23 +1138,23 @@ void RunRNNBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
             int hid_shift = li * bi * batch_n * hy_h;
             int wei_shift = bi * (in_h + hy_h) * hy_h + (li - 1) * bi * (bi * hy_h + hy_h) * hy_h;
 
-            ADNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
-                              hy_h * bi,
-                              batch_n,
-                              hy_stride,
-                              ADNN_MM_TRANSPOSE,
-                              &rsvspace_state[prelayer_shift],
-                              hy_h * bi,
-                              batch_n,
-                              hy_stride,
-                              0,
-                              &dwei_state[wei_shift],
-                              hy_h * bi,
-                              hy_h * bi,
-                              bi_stride,
-                              0,
-                              1,
-                              1);
+            RNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
+                             hy_h * bi,
+                             batch_n,
+                             hy_stride,
+                             ADNN_MM_TRANSPOSE,
+                             &rsvspace_state[prelayer_shift],
+                             hy_h * bi,
+                             batch_n,
+                             hy_stride,
+                             0,
+                             &dwei_state[wei_shift],
+                             hy_h * bi,
+                             hy_h * bi,
+                             bi_stride,
+                             0,
+                             1,
+                             1);
 
             if(biased)
             {
@@ -1187,23 +1188,23 @@ void RunRNNBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
             {
                 if(!hx_is_null)
                 {
-                    ADNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
-                                      hy_h,
-                                      in_n.at(ti),
-                                      hy_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      &hx_state[hx_shift],
-                                      hy_h,
-                                      in_n.at(ti),
-                                      uni_stride,
-                                      0,
-                                      &dwei_state[wei_shift],
-                                      hy_h,
-                                      hy_h,
-                                      uni_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
+                                     hy_h,
+                                     in_n.at(ti),
+                                     hy_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     &hx_state[hx_shift],
+                                     hy_h,
+                                     in_n.at(ti),
+                                     uni_stride,
+                                     0,
+                                     &dwei_state[wei_shift],
+                                     hy_h,
+                                     hy_h,
+                                     uni_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     if(biased)
                     {
@@ -1224,23 +1225,23 @@ void RunRNNBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
             {
                 pretime_shift = li * bi * batch_n * hy_h + (bacc - in_n.at(ti - 1)) * hy_stride;
 
-                ADNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
-                                  hy_h,
-                                  in_n.at(ti),
-                                  hy_stride,
-                                  ADNN_MM_TRANSPOSE,
-                                  &rsvspace_state[pretime_shift],
-                                  hy_h,
-                                  in_n.at(ti),
-                                  hy_stride,
-                                  0,
-                                  &dwei_state[wei_shift],
-                                  hy_h,
-                                  hy_h,
-                                  uni_stride,
-                                  0,
-                                  1,
-                                  1);
+                RNN_mm_cpu<Tref>(&wkspace_state[hid_shift],
+                                 hy_h,
+                                 in_n.at(ti),
+                                 hy_stride,
+                                 ADNN_MM_TRANSPOSE,
+                                 &rsvspace_state[pretime_shift],
+                                 hy_h,
+                                 in_n.at(ti),
+                                 hy_stride,
+                                 0,
+                                 &dwei_state[wei_shift],
+                                 hy_h,
+                                 hy_h,
+                                 uni_stride,
+                                 0,
+                                 1,
+                                 1);
 
                 if(biased)
                 {
@@ -1263,23 +1264,23 @@ void RunRNNBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                 {
                     if(!hx_is_null)
                     {
-                        ADNN_mm_cpu<Tref>(&wkspace_state[hid_shift + hy_h],
-                                          hy_h,
-                                          in_n.at(ti),
-                                          hy_stride,
-                                          ADNN_MM_TRANSPOSE,
-                                          &hx_state[hx_shift + hy_n * hy_h],
-                                          hy_h,
-                                          in_n.at(ti),
-                                          uni_stride,
-                                          0,
-                                          &dwei_state[wei_shift + hy_h * uni_stride],
-                                          hy_h,
-                                          hy_h,
-                                          uni_stride,
-                                          0,
-                                          1,
-                                          1);
+                        RNN_mm_cpu<Tref>(&wkspace_state[hid_shift + hy_h],
+                                         hy_h,
+                                         in_n.at(ti),
+                                         hy_stride,
+                                         ADNN_MM_TRANSPOSE,
+                                         &hx_state[hx_shift + hy_n * hy_h],
+                                         hy_h,
+                                         in_n.at(ti),
+                                         uni_stride,
+                                         0,
+                                         &dwei_state[wei_shift + hy_h * uni_stride],
+                                         hy_h,
+                                         hy_h,
+                                         uni_stride,
+                                         0,
+                                         1,
+                                         1);
 
                         if(biased)
                         {
@@ -1300,24 +1301,24 @@ void RunRNNBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
                 {
                     if(!hx_is_null && in_n.at(ti) > in_n.at(ti + 1))
                     {
-                        ADNN_mm_cpu<Tref>(
-                            &wkspace_state[hid_shift + hy_h + in_n.at(ti + 1) * hy_stride],
-                            hy_h,
-                            (in_n.at(ti) - in_n.at(ti + 1)),
-                            hy_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hx_state[hx_shift + hy_n * hy_h + in_n.at(ti + 1) * hy_h],
-                            hy_h,
-                            (in_n.at(ti) - in_n.at(ti + 1)),
-                            uni_stride,
-                            0,
-                            &dwei_state[wei_shift + hy_h * uni_stride],
-                            hy_h,
-                            hy_h,
-                            uni_stride,
-                            0,
-                            1,
-                            1);
+                        RNN_mm_cpu<Tref>(
+                           &wkspace_state[hid_shift + hy_h + in_n.at(ti + 1) * hy_stride],
+                           hy_h,
+                           (in_n.at(ti) - in_n.at(ti + 1)),
+                           hy_stride,
+                           ADNN_MM_TRANSPOSE,
+                           &hx_state[hx_shift + hy_n * hy_h + in_n.at(ti + 1) * hy_h],
+                           hy_h,
+                           (in_n.at(ti) - in_n.at(ti + 1)),
+                           uni_stride,
+                           0,
+                           &dwei_state[wei_shift + hy_h * uni_stride],
+                           hy_h,
+                           hy_h,
+                           uni_stride,
+                           0,
+                           1,
+                           1);
 
                         if(biased)
                         {
@@ -1336,23 +1337,23 @@ void RunRNNBackwardWeightGEMMCPUVerify(std::vector<Tgpu>& in,
 
                     pretime_shift = li * bi * batch_n * hy_h + (bacc + in_n.at(ti)) * hy_stride;
 
-                    ADNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift + hy_h]),
-                                      hy_h,
-                                      in_n.at(ti + 1),
-                                      hy_stride,
-                                      ADNN_MM_TRANSPOSE,
-                                      &rsvspace_state[pretime_shift + hy_h],
-                                      hy_h,
-                                      in_n.at(ti + 1),
-                                      hy_stride,
-                                      0,
-                                      &dwei_state[wei_shift + hy_h * uni_stride],
-                                      hy_h,
-                                      hy_h,
-                                      uni_stride,
-                                      0,
-                                      1,
-                                      1);
+                    RNN_mm_cpu<Tref>(const_cast<Tref*>(&wkspace_state[hid_shift + hy_h]),
+                                     hy_h,
+                                     in_n.at(ti + 1),
+                                     hy_stride,
+                                     ADNN_MM_TRANSPOSE,
+                                     &rsvspace_state[pretime_shift + hy_h],
+                                     hy_h,
+                                     in_n.at(ti + 1),
+                                     hy_stride,
+                                     0,
+                                     &dwei_state[wei_shift + hy_h * uni_stride],
+                                     hy_h,
+                                     hy_h,
+                                     uni_stride,
+                                     0,
+                                     1,
+                                     1);
 
                     if(biased)
                     {
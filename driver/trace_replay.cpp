@@ -0,0 +1,428 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Replays an API trace recorded with MIOPEN_TRACE_FILE on the device and reports the latency of
+// the calls per signature next to their recorded host time. Data is not recorded, every tensor
+// position of the calls gets one uninitialized buffer that fits all of them.
+//
+//   MIOpenTraceReplay [--iterations <n>] [--speed <factor>] [--warmup <n>] <trace>
+//
+// By default the calls are issued back to back. With --speed the recorded gaps between the calls
+// are kept, divided by the factor, to replay the load of the traced application.
+
+#include <miopen/activ.hpp>
+#include <miopen/api_trace.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/miopen.h>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int Usage(const char* name)
+{
+    std::cerr << "Usage: " << name
+              << " [--iterations <n>] [--speed <factor>] [--warmup <n>] <trace>" << std::endl;
+    return EXIT_FAILURE;
+}
+
+// Device buffers and descriptors of one replay.
+class Replayer
+{
+    public:
+    Replayer(miopen::Handle& handle_, const std::vector<miopen::TraceRecord>& records)
+        : handle(handle_)
+    {
+        const auto sizes = miopen::GetTraceReplayBuffers(records);
+        for(const auto size : sizes.tensors)
+            buffers.push_back(handle.Create(std::max<std::size_t>(size, 1)));
+        workspace_size = sizes.workspace;
+        workspace      = handle.Create(std::max<std::size_t>(workspace_size, 1));
+    }
+
+    /// Issues the call of the record, false if it cannot be replayed.
+    bool Issue(const miopen::TraceRecord& record)
+    {
+        if(!CanReplay(record))
+            return false;
+
+        std::vector<miopen::TensorDescriptor> descs;
+        for(const auto& tensor : record.tensors)
+            descs.emplace_back(tensor.type, tensor.lengths, tensor.strides);
+        const auto t = [&](std::size_t i) { return &descs[i]; };
+        const auto d = [&](std::size_t i) { return static_cast<void*>(buffers[i].get()); };
+        const auto ws      = static_cast<void*>(workspace.get());
+        const auto ws_size = std::min<std::size_t>(record.workspace, workspace_size);
+        const float alpha  = 1;
+        const float beta   = 0;
+
+        auto conv = MakeConvolution(record);
+
+        std::size_t size = 0;
+        int returned     = 0;
+        const int requested =
+            record.ints.empty() ? 1 : static_cast<int>(std::max<std::int64_t>(record.ints[0], 1));
+        std::vector<miopenConvAlgoPerf_t> perf(requested);
+        const bool exhaustive = record.ints.size() > 1 && record.ints[1] != 0;
+
+        miopenStatus_t status = miopenStatusSuccess;
+        switch(record.call)
+        {
+        case miopen::TraceCall::ConvolutionForwardGetWorkSpaceSize:
+            status = miopenConvolutionForwardGetWorkSpaceSize(
+                &handle, t(1), t(0), &conv, t(2), &size);
+            break;
+        case miopen::TraceCall::ConvolutionBackwardDataGetWorkSpaceSize:
+            status = miopenConvolutionBackwardDataGetWorkSpaceSize(
+                &handle, t(0), t(1), &conv, t(2), &size);
+            break;
+        case miopen::TraceCall::ConvolutionBackwardWeightsGetWorkSpaceSize:
+            status = miopenConvolutionBackwardWeightsGetWorkSpaceSize(
+                &handle, t(0), t(1), &conv, t(2), &size);
+            break;
+        case miopen::TraceCall::FindConvolutionForwardAlgorithm:
+            status = miopenFindConvolutionForwardAlgorithm(&handle,
+                                                           t(0),
+                                                           d(0),
+                                                           t(1),
+                                                           d(1),
+                                                           &conv,
+                                                           t(2),
+                                                           d(2),
+                                                           requested,
+                                                           &returned,
+                                                           perf.data(),
+                                                           ws,
+                                                           ws_size,
+                                                           exhaustive);
+            break;
+        case miopen::TraceCall::FindConvolutionBackwardDataAlgorithm:
+            status = miopenFindConvolutionBackwardDataAlgorithm(&handle,
+                                                                t(0),
+                                                                d(0),
+                                                                t(1),
+                                                                d(1),
+                                                                &conv,
+                                                                t(2),
+                                                                d(2),
+                                                                requested,
+                                                                &returned,
+                                                                perf.data(),
+                                                                ws,
+                                                                ws_size,
+                                                                exhaustive);
+            break;
+        case miopen::TraceCall::FindConvolutionBackwardWeightsAlgorithm:
+            status = miopenFindConvolutionBackwardWeightsAlgorithm(&handle,
+                                                                   t(0),
+                                                                   d(0),
+                                                                   t(1),
+                                                                   d(1),
+                                                                   &conv,
+                                                                   t(2),
+                                                                   d(2),
+                                                                   requested,
+                                                                   &returned,
+                                                                   perf.data(),
+                                                                   ws,
+                                                                   ws_size,
+                                                                   exhaustive);
+            break;
+        case miopen::TraceCall::ConvolutionForward:
+            status = miopenConvolutionForward(&handle,
+                                              &alpha,
+                                              t(0),
+                                              d(0),
+                                              t(1),
+                                              d(1),
+                                              &conv,
+                                              static_cast<miopenConvFwdAlgorithm_t>(record.ints[0]),
+                                              &beta,
+                                              t(2),
+                                              d(2),
+                                              ws,
+                                              ws_size);
+            break;
+        case miopen::TraceCall::ConvolutionBackwardData:
+            status = miopenConvolutionBackwardData(
+                &handle,
+                &alpha,
+                t(0),
+                d(0),
+                t(1),
+                d(1),
+                &conv,
+                static_cast<miopenConvBwdDataAlgorithm_t>(record.ints[0]),
+                &beta,
+                t(2),
+                d(2),
+                ws,
+                ws_size);
+            break;
+        case miopen::TraceCall::ConvolutionBackwardWeights:
+            status = miopenConvolutionBackwardWeights(
+                &handle,
+                &alpha,
+                t(0),
+                d(0),
+                t(1),
+                d(1),
+                &conv,
+                static_cast<miopenConvBwdWeightsAlgorithm_t>(record.ints[0]),
+                &beta,
+                t(2),
+                d(2),
+                ws,
+                ws_size);
+            break;
+        case miopen::TraceCall::ConvolutionForwardImmediate:
+            status = miopenConvolutionForwardImmediate(
+                &handle, t(1), d(1), t(0), d(0), &conv, t(2), d(2), ws, ws_size, record.ints[0]);
+            break;
+        case miopen::TraceCall::ConvolutionBackwardDataImmediate:
+            status = miopenConvolutionBackwardDataImmediate(
+                &handle, t(0), d(0), t(1), d(1), &conv, t(2), d(2), ws, ws_size, record.ints[0]);
+            break;
+        case miopen::TraceCall::ConvolutionBackwardWeightsImmediate:
+            status = miopenConvolutionBackwardWeightsImmediate(
+                &handle, t(0), d(0), t(1), d(1), &conv, t(2), d(2), ws, ws_size, record.ints[0]);
+            break;
+        case miopen::TraceCall::ActivationForward:
+        case miopen::TraceCall::ActivationBackward:
+        {
+            const auto& r = record.reals;
+            miopen::ActivationDescriptor activ{
+                static_cast<miopenActivationMode_t>(record.ints[0]), r[0], r[1], r[2]};
+            const float scale_alpha = r[3];
+            const float scale_beta  = r[4];
+            if(record.call == miopen::TraceCall::ActivationForward)
+                status = miopenActivationForward(
+                    &handle, &activ, &scale_alpha, t(0), d(0), &scale_beta, t(1), d(1));
+            else
+                status = miopenActivationBackward(&handle,
+                                                  &activ,
+                                                  &scale_alpha,
+                                                  t(0),
+                                                  d(0),
+                                                  t(1),
+                                                  d(1),
+                                                  t(2),
+                                                  d(2),
+                                                  &scale_beta,
+                                                  t(3),
+                                                  d(3));
+            break;
+        }
+        case miopen::TraceCall::SoftmaxForward:
+        case miopen::TraceCall::SoftmaxBackward:
+        {
+            const auto algorithm    = static_cast<miopenSoftmaxAlgorithm_t>(record.ints[0]);
+            const auto mode         = static_cast<miopenSoftmaxMode_t>(record.ints[1]);
+            const float scale_alpha = record.reals[0];
+            const float scale_beta  = record.reals[1];
+            if(record.call == miopen::TraceCall::SoftmaxForward)
+                status = miopenSoftmaxForward_V2(&handle,
+                                                 &scale_alpha,
+                                                 t(0),
+                                                 d(0),
+                                                 &scale_beta,
+                                                 t(1),
+                                                 d(1),
+                                                 algorithm,
+                                                 mode);
+            else
+                status = miopenSoftmaxBackward_V2(&handle,
+                                                  &scale_alpha,
+                                                  t(0),
+                                                  d(0),
+                                                  t(1),
+                                                  d(1),
+                                                  &scale_beta,
+                                                  t(2),
+                                                  d(2),
+                                                  algorithm,
+                                                  mode);
+            break;
+        }
+        }
+        return status == miopenStatusSuccess;
+    }
+
+    private:
+    miopen::Handle& handle;
+    std::vector<miopen::Allocator::ManageDataPtr> buffers;
+    miopen::Allocator::ManageDataPtr workspace;
+    std::size_t workspace_size = 0;
+
+    static miopen::ConvolutionDescriptor MakeConvolution(const miopen::TraceRecord& record)
+    {
+        if(!record.convolution)
+            return {};
+        const auto& c = *record.convolution;
+        return {c.pads.size(),
+                c.mode,
+                c.padding_mode,
+                c.pads,
+                c.strides,
+                c.dilations,
+                c.trans_output_pads,
+                c.group_count};
+    }
+
+    // Fields the call of the record needs.
+    static bool CanReplay(const miopen::TraceRecord& record)
+    {
+        std::size_t tensors = 3;
+        std::size_t ints    = 0;
+        std::size_t reals   = 0;
+        switch(record.call)
+        {
+        case miopen::TraceCall::ConvolutionForwardGetWorkSpaceSize:
+        case miopen::TraceCall::ConvolutionBackwardDataGetWorkSpaceSize:
+        case miopen::TraceCall::ConvolutionBackwardWeightsGetWorkSpaceSize: break;
+        case miopen::TraceCall::FindConvolutionForwardAlgorithm:
+        case miopen::TraceCall::FindConvolutionBackwardDataAlgorithm:
+        case miopen::TraceCall::FindConvolutionBackwardWeightsAlgorithm: ints = 2; break;
+        case miopen::TraceCall::ConvolutionForward:
+        case miopen::TraceCall::ConvolutionBackwardData:
+        case miopen::TraceCall::ConvolutionBackwardWeights:
+        case miopen::TraceCall::ConvolutionForwardImmediate:
+        case miopen::TraceCall::ConvolutionBackwardDataImmediate:
+        case miopen::TraceCall::ConvolutionBackwardWeightsImmediate: ints = 1; break;
+        case miopen::TraceCall::ActivationForward:
+            tensors = 2;
+            ints    = 1;
+            reals   = 5;
+            break;
+        case miopen::TraceCall::ActivationBackward:
+            tensors = 4;
+            ints    = 1;
+            reals   = 5;
+            break;
+        case miopen::TraceCall::SoftmaxForward:
+            tensors = 2;
+            ints    = 2;
+            reals   = 2;
+            break;
+        case miopen::TraceCall::SoftmaxBackward:
+            ints  = 2;
+            reals = 2;
+            break;
+        default: return false;
+        }
+        const bool convolution = static_cast<std::uint32_t>(record.call) <=
+                                 static_cast<std::uint32_t>(
+                                     miopen::TraceCall::ConvolutionBackwardWeightsImmediate);
+        return record.tensors.size() >= tensors && record.ints.size() >= ints &&
+               record.reals.size() >= reals && (!convolution || record.convolution) &&
+               std::none_of(record.tensors.begin(), record.tensors.end(), [](auto&& tensor) {
+                   return tensor.lengths.empty();
+               });
+    }
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    miopen::TraceReplayOptions options;
+    std::size_t warmup = 0;
+    std::string input;
+    for(int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const bool has_value  = i + 1 < argc;
+        if(arg == "--iterations" && has_value)
+            options.iterations = std::stoul(argv[++i]);
+        else if(arg == "--speed" && has_value)
+            options.speed = std::stod(argv[++i]);
+        else if(arg == "--warmup" && has_value)
+            warmup = std::stoul(argv[++i]);
+        else if(input.empty())
+            input = arg;
+        else
+            return Usage(argv[0]);
+    }
+    if(input.empty())
+        return Usage(argv[0]);
+
+    try
+    {
+        const auto records = miopen::ReadTrace(input);
+        miopen::Handle handle;
+        Replayer replayer{handle, records};
+
+        // Compiles the kernels and fills the caches outside of the measurement.
+        for(std::size_t i = 0; i < warmup; i++)
+            for(const auto& record : records)
+                replayer.Issue(record);
+        handle.Finish();
+
+        miopen::TraceReplayReport report;
+        std::size_t skipped = 0;
+        const auto start    = std::chrono::steady_clock::now();
+        for(const auto& step : miopen::ScheduleTraceReplay(records, options))
+        {
+            std::this_thread::sleep_until(start + std::chrono::nanoseconds(step.issue_at));
+            const auto& record = records[step.record];
+            const auto issued  = std::chrono::steady_clock::now();
+            if(!replayer.Issue(record))
+            {
+                skipped++;
+                continue;
+            }
+            handle.Finish();
+            const auto latency = std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - issued);
+            report.Add(record, latency.count());
+        }
+
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "count\trecorded us\tmean us\tmin us\tmax us\tcall" << std::endl;
+        for(const auto& stats : report.GetStats())
+            std::cout << stats.count << '\t' << stats.recorded << '\t' << stats.mean << '\t'
+                      << stats.min << '\t' << stats.max << '\t' << stats.signature << std::endl;
+        if(skipped != 0)
+            std::cout << skipped << " calls could not be replayed" << std::endl;
+        return EXIT_SUCCESS;
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
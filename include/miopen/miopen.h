@@ -997,6 +997,36 @@ miopenConvolutionForwardGetSolution(miopenHandle_t handle,
                                     size_t* solutionCount,
                                     miopenConvSolution_t* solutions);
 
+/*! @brief Query the applicable solutions for a forward convolution which need at most
+ * workSpaceLimit bytes of workspace.
+ *
+ *  Same as miopenConvolutionForwardGetSolution, except that solutions which need more
+ *  workspace than the limit are skipped, so the first returned solution is the fastest known one
+ *  that fits. solutionCount is 0 if there is none.
+ *
+ * @param handle           MIOpen handle (input)
+ * @param wDesc            Tensor descriptor for weight tensor w (input)
+ * @param xDesc            Tensor descriptor for input data tensor x (input)
+ * @param convDesc         Convolution layer descriptor (input)
+ * @param yDesc            Tensor descriptor for output data tensor y (input)
+ * @param workSpaceLimit   Largest workspace in bytes the solutions may need (input)
+ * @param maxSolutionCount The size of the solutions array passed in below (input)
+ * @param solutionCount    The size of the solutions array returned (output)
+ * @param solutions        A pointer to an array of type miopenConvSolution_t allocated by the user,
+ *                         filled in by MIOpen with applicable solutions. (output)
+ * @return                 miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenConvolutionForwardGetSolutionWithinWorkspace(miopenHandle_t handle,
+                                                   const miopenTensorDescriptor_t wDesc,
+                                                   const miopenTensorDescriptor_t xDesc,
+                                                   const miopenConvolutionDescriptor_t convDesc,
+                                                   const miopenTensorDescriptor_t yDesc,
+                                                   const size_t workSpaceLimit,
+                                                   const size_t maxSolutionCount,
+                                                   size_t* solutionCount,
+                                                   miopenConvSolution_t* solutions);
+
 /*! @brief Returns the workspace size required for a particular solution id.
  *
  * This is an optional call for users who may have serialized the solution id and just need the
@@ -1137,6 +1167,36 @@ miopenConvolutionBackwardDataGetSolution(miopenHandle_t handle,
                                          size_t* solutionCount,
                                          miopenConvSolution_t* solutions);
 
+/*! @brief Query the applicable solutions for a backward convolution w-r-t data which need at most
+ * workSpaceLimit bytes of workspace.
+ *
+ *  Same as miopenConvolutionBackwardDataGetSolution, except that solutions which need more
+ *  workspace than the limit are skipped, so the first returned solution is the fastest known one
+ *  that fits. solutionCount is 0 if there is none.
+ *
+ * @param handle           MIOpen handle (input)
+ * @param dyDesc           Tensor descriptor for data input tensor dy (input)
+ * @param wDesc            Tensor descriptor for weight tensor w (input)
+ * @param convDesc         Convolution layer descriptor (input)
+ * @param dxDesc           Tensor descriptor for output data tensor dx (input)
+ * @param workSpaceLimit   Largest workspace in bytes the solutions may need (input)
+ * @param maxSolutionCount The size of the solutions array passed in below (input)
+ * @param solutionCount    The size of the solutions array returned (output)
+ * @param solutions        A pointer to an array of type miopenConvSolution_t allocated by the user,
+ *                         filled in by MIOpen with applicable solutions. (output)
+ * @return                 miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenConvolutionBackwardDataGetSolutionWithinWorkspace(
+    miopenHandle_t handle,
+    const miopenTensorDescriptor_t dyDesc,
+    const miopenTensorDescriptor_t wDesc,
+    const miopenConvolutionDescriptor_t convDesc,
+    const miopenTensorDescriptor_t dxDesc,
+    const size_t workSpaceLimit,
+    const size_t maxSolutionCount,
+    size_t* solutionCount,
+    miopenConvSolution_t* solutions);
+
 /*! @brief Returns the workspace size required for a particular solution id.
  *
  * This is an optional call for users who may have serialized the solution id and just need the
@@ -1277,6 +1337,36 @@ miopenConvolutionBackwardWeightsGetSolution(miopenHandle_t handle,
                                             size_t* solutionCount,
                                             miopenConvSolution_t* solutions);
 
+/*! @brief Query the applicable solutions for a backward convolution w-r-t weights which need at
+ * most workSpaceLimit bytes of workspace.
+ *
+ *  Same as miopenConvolutionBackwardWeightsGetSolution, except that solutions which need more
+ *  workspace than the limit are skipped, so the first returned solution is the fastest known one
+ *  that fits. solutionCount is 0 if there is none.
+ *
+ * @param handle           MIOpen handle (input)
+ * @param dyDesc           Tensor descriptor for data tensor dy (input)
+ * @param xDesc            Tensor descriptor for data tensor x (input)
+ * @param convDesc         Convolution layer descriptor (input)
+ * @param dwDesc           Tensor descriptor for weight tensor dw (input)
+ * @param workSpaceLimit   Largest workspace in bytes the solutions may need (input)
+ * @param maxSolutionCount The size of the solutions array passed in below (input)
+ * @param solutionCount    The size of the solutions array returned (output)
+ * @param solutions        A pointer to an array of type miopenConvSolution_t allocated by the user,
+ *                         filled in by MIOpen with applicable solutions. (output)
+ * @return                 miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenConvolutionBackwardWeightsGetSolutionWithinWorkspace(
+    miopenHandle_t handle,
+    const miopenTensorDescriptor_t dyDesc,
+    const miopenTensorDescriptor_t xDesc,
+    const miopenConvolutionDescriptor_t convDesc,
+    const miopenTensorDescriptor_t dwDesc,
+    const size_t workSpaceLimit,
+    const size_t maxSolutionCount,
+    size_t* solutionCount,
+    miopenConvSolution_t* solutions);
+
 /*! @brief Returns the workspace size required for a particular solution id.
  *
  * This is an optional call for users who may have serialized the solution id and just need the
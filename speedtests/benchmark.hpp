@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SPEEDTESTS_BENCHMARK_HPP_
+#define GUARD_MIOPEN_SPEEDTESTS_BENCHMARK_HPP_
+
+#include <driver.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct BenchmarkResult
+{
+    std::string name;
+    std::size_t iterations = 0; // per repetition
+    std::size_t bytes      = 0; // processed by an iteration, 0 if it does not apply
+    std::vector<double> ns;     // time per iteration of every repetition
+    double allocations = -1;    // heap allocations per iteration, negative if not counted
+
+    double Mean() const { return std::accumulate(ns.begin(), ns.end(), 0.0) / ns.size(); }
+    double Min() const { return *std::min_element(ns.begin(), ns.end()); }
+    double Max() const { return *std::max_element(ns.begin(), ns.end()); }
+
+    double Median() const
+    {
+        auto sorted = ns;
+        std::sort(sorted.begin(), sorted.end());
+        const auto mid = sorted.size() / 2;
+        return sorted.size() % 2 != 0 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2;
+    }
+
+    double StdDev() const
+    {
+        if(ns.size() < 2)
+            return 0;
+        const auto mean = Mean();
+        double sum      = 0;
+        for(const auto x : ns)
+            sum += (x - mean) * (x - mean);
+        return std::sqrt(sum / (ns.size() - 1));
+    }
+};
+
+/// Base of the host speed tests. Measure() runs a function in repetitions of the same number of
+/// iterations and Report() prints the statistics of the time per iteration, and writes them as
+/// JSON with --json <file>, so regressions of the host code can be tracked without a GPU.
+struct BenchmarkDriver : test_driver
+{
+    BenchmarkDriver()
+    {
+        add(repetitions, "repetitions");
+        add(iterations, "iterations");
+        add(min_time, "min-time");
+        add(filter, "filter");
+        add(json, "json");
+    }
+
+    /// Skipped unless the name contains --filter.
+    template <class F>
+    void Measure(const std::string& name, F f, std::size_t bytes = 0)
+    {
+        if(repetitions < 1)
+            throw std::runtime_error("--repetitions should be at least 1");
+        if(name.find(filter) == std::string::npos)
+            return;
+
+        BenchmarkResult result;
+        result.name  = name;
+        result.bytes = bytes;
+
+        // The calibration runs are the warm-up.
+        std::size_t count = iterations > 0 ? iterations : 1;
+        for(;;)
+        {
+            const auto time = Run(f, count);
+            if(iterations > 0 || time >= min_time * 1e6 || count >= (std::size_t{1} << 30))
+                break;
+            count *= 2;
+        }
+        result.iterations = count;
+
+        const auto allocations_start = allocation_counter ? allocation_counter() : 0;
+        for(auto i = 0; i < repetitions; i++)
+            result.ns.push_back(Run(f, count) / count);
+        if(allocation_counter)
+            result.allocations = static_cast<double>(allocation_counter() - allocations_start) /
+                                 (count * repetitions);
+
+        Print(result);
+        results.push_back(std::move(result));
+    }
+
+    void Report(const std::string& suite) const
+    {
+        if(json.empty())
+            return;
+        std::ofstream file{json};
+        file << std::setprecision(9) << "{\n  \"suite\": \"" << suite << "\",\n  \"benchmarks\": [";
+        for(std::size_t i = 0; i < results.size(); i++)
+        {
+            const auto& r = results[i];
+            file << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << Escape(r.name)
+                 << "\", \"iterations\": " << r.iterations
+                 << ", \"repetitions\": " << r.ns.size() << ", \"mean_ns\": " << r.Mean()
+                 << ", \"median_ns\": " << r.Median() << ", \"min_ns\": " << r.Min()
+                 << ", \"max_ns\": " << r.Max() << ", \"stddev_ns\": " << r.StdDev();
+            if(r.bytes != 0)
+                file << ", \"bytes\": " << r.bytes;
+            if(r.allocations >= 0)
+                file << ", \"allocations\": " << r.allocations;
+            file << "}";
+        }
+        file << "\n  ]\n}\n";
+        if(!file)
+            std::cerr << "Cannot write " << json << std::endl;
+    }
+
+    template <class TType>
+    static void SaveDeadCode(const TType& value)
+    {
+        static const std::string dead_code_saver;
+        if(dead_code_saver.data() == nullptr)
+        {
+            std::cout << value << std::endl;
+            std::terminate();
+        }
+    }
+
+    protected:
+    int repetitions = 5;
+    int iterations  = 0;  // 0 doubles the count until a run takes min_time
+    double min_time = 20; // ms
+    std::string filter;
+    std::string json;
+    /// Set by tests that count heap allocations.
+    std::size_t (*allocation_counter)() = nullptr;
+    std::vector<BenchmarkResult> results;
+
+    private:
+    template <class F>
+    static double Run(F& f, std::size_t count)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for(std::size_t i = 0; i < count; i++)
+            f();
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
+
+    static void Print(const BenchmarkResult& r)
+    {
+        std::cout << r.name << ": " << r.Median() << " ns median, " << r.Min() << " .. "
+                  << r.Max() << " ns";
+        if(r.bytes != 0)
+            std::cout << ", " << r.bytes / r.Median() << " GB/s";
+        if(r.allocations >= 0)
+            std::cout << ", " << r.allocations << " allocations";
+        std::cout << std::endl;
+    }
+
+    static std::string Escape(const std::string& s)
+    {
+        std::string out;
+        for(const auto c : s)
+        {
+            if(c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out;
+    }
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SPEEDTESTS_BENCHMARK_HPP_
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SPEEDTESTS_CONV_PROBLEMS_HPP_
+#define GUARD_MIOPEN_SPEEDTESTS_CONV_PROBLEMS_HPP_
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/tensor.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// Distinct 2D convolution problems with the layer shapes of common networks, the same in every
+/// run. The problems go through all directions, so the keys of neighbours differ early.
+inline std::vector<conv::ProblemDescription> MakeConvProblems(std::size_t count)
+{
+    const std::vector<std::size_t> channels = {3, 16, 32, 64, 128, 256, 512};
+    const std::vector<std::size_t> sizes    = {7, 14, 28, 56, 112, 224};
+    const std::vector<int> filters          = {1, 3, 5, 7};
+    const std::vector<std::size_t> batches  = {1, 8, 16, 32, 64, 128, 256};
+
+    std::vector<conv::ProblemDescription> problems;
+    problems.reserve(count);
+    for(std::size_t i = 0; problems.size() < count; i++)
+    {
+        // Digits of i in the mixed radix of the lists.
+        auto digits     = i;
+        const auto next = [&](std::size_t radix) {
+            const auto digit = digits % radix;
+            digits /= radix;
+            return digit;
+        };
+        const auto direction = static_cast<conv::Direction>(next(3));
+        const auto c         = channels[next(channels.size())];
+        const auto k         = channels[next(channels.size())];
+        const auto size      = sizes[next(sizes.size())];
+        const auto filter    = filters[next(filters.size())];
+        const auto n         = batches[next(batches.size())];
+        const auto stride    = static_cast<int>(1 + next(2));
+
+        const ConvolutionDescriptor conv{{filter / 2, filter / 2}, {stride, stride}, {1, 1}};
+        const TensorDescriptor x{miopenFloat, {n, c, size, size}};
+        const TensorDescriptor w{
+            miopenFloat,
+            {k, c, static_cast<std::size_t>(filter), static_cast<std::size_t>(filter)}};
+        const auto y = conv.GetForwardOutputTensor(x, w);
+        if(direction == conv::Direction::Forward)
+            problems.emplace_back(x, w, y, conv, direction);
+        else
+            problems.emplace_back(y, w, x, conv, direction);
+    }
+    return problems;
+}
+
+/// Db key of a problem.
+template <class TProblem>
+std::string SerializeProblem(const TProblem& problem)
+{
+    std::ostringstream ss;
+    problem.Serialize(ss);
+    return ss.str();
+}
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SPEEDTESTS_CONV_PROBLEMS_HPP_
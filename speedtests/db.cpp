@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include "benchmark.hpp"
+#include "conv_problems.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// Measures record lookups in a text perf-db of the given size, one pass lookups of many keys,
+/// reading the db into memory and lookups in memory.
+struct DbSpeedTest : public BenchmarkDriver
+{
+    DbSpeedTest() { add(records, "records"); }
+
+    void run()
+    {
+        const TmpDir dir{"db_speedtest"};
+        const auto path = (dir.path / "gfx906_60.cd.pdb.txt").string();
+        const std::string values = "ConvOclDirectFwd:16,16,1,1,4,2,2,1,8;"
+                                   "ConvAsm1x1U:1,16,1,64,2,1,1,4;"
+                                   "ConvHipImplicitGemmV4R1Fwd:64,128,8,16,2,2";
+        std::vector<std::string> keys;
+        {
+            std::ofstream file{path};
+            for(const auto& problem : MakeConvProblems(records))
+            {
+                keys.push_back(SerializeProblem(problem));
+                file << keys.back() << '=' << values << '\n';
+            }
+        }
+        const auto size = boost::filesystem::file_size(path);
+
+        // Keys spread over the file, looked up in turn.
+        std::vector<std::string> sample;
+        for(std::size_t i = 0; i < lookups; i++)
+            sample.push_back(keys[(i * 7919) % keys.size()]);
+        std::size_t next = 0;
+        const auto key   = [&]() -> const std::string& { return sample[next++ % sample.size()]; };
+
+        PlainTextDb text_db{path, true};
+        Measure("PlainTextDb hit", [&] { SaveDeadCode(text_db.FindRecord(key())->GetKey()); });
+        Measure("PlainTextDb miss", [&] { SaveDeadCode(!text_db.FindRecord(std::string{"missing"})); });
+
+        // The records of all the layers of a model, one scan against one per layer.
+        Measure("PlainTextDb, sample key by key", [&] {
+            for(const auto& k : sample)
+                SaveDeadCode(text_db.FindRecord(k)->GetKey());
+        });
+        Measure("PlainTextDb::FindRecords, sample",
+                [&] { SaveDeadCode(text_db.FindRecords(sample).size()); });
+
+        Measure("ReadonlyRamDb::Prefetch",
+                [&] {
+                    ReadonlyRamDb db{path};
+                    db.Prefetch(path, false);
+                    SaveDeadCode(db.FindRecord(keys.front())->GetKey());
+                },
+                size);
+
+        ReadonlyRamDb ram_db{path};
+        ram_db.Prefetch(path, false);
+        Measure("ReadonlyRamDb hit", [&] { SaveDeadCode(ram_db.FindRecord(key())->GetKey()); });
+        Measure("ReadonlyRamDb miss", [&] { SaveDeadCode(!ram_db.FindRecord(std::string{"missing"})); });
+
+        Report("db");
+    }
+
+    private:
+    std::size_t records = 10000;
+    std::size_t lookups = 64;
+};
+
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::DbSpeedTest>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/md5.hpp>
+#include <miopen/xxh3.hpp>
+
+#include "benchmark.hpp"
+
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// Measures the throughput of the digests used for cache keys and integrity checks.
+struct DigestSpeedTest : public BenchmarkDriver
+{
+    DigestSpeedTest() { add(sizes, "sizes"); }
+
+    void run()
+    {
+        for(const auto size : sizes)
+        {
+            std::string data(size, '\0');
+            for(std::size_t i = 0; i < size; i++)
+                data[i] = static_cast<char>(i * 31 + 7);
+
+            const auto suffix = " " + std::to_string(size);
+            Measure("md5 string" + suffix, [&] { SaveDeadCode(md5(data)); }, size);
+            Measure("md5" + suffix,
+                    [&] {
+                        Md5 hash;
+                        hash.Update(data);
+                        SaveDeadCode(hash.Final()[0]);
+                    },
+                    size);
+            Measure("xxh3 string" + suffix, [&] { SaveDeadCode(xxh3(data)); }, size);
+            Measure("xxh3" + suffix,
+                    [&] { SaveDeadCode(xxh3(data.data(), data.size())[0]); },
+                    size);
+        }
+        Report("digest");
+    }
+
+    private:
+    std::vector<std::size_t> sizes = {16, 256, 4096, 1 << 20};
+};
+
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::DigestSpeedTest>(argc, argv);
+    return 0;
+}
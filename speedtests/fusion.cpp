@@ -0,0 +1,87 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/convolution.hpp>
+#include <miopen/fusion.hpp>
+#include <miopen/fusion_plan.hpp>
+#include <miopen/md_graph.hpp>
+#include <miopen/tensor.hpp>
+
+#include "benchmark.hpp"
+
+#include <memory>
+
+namespace miopen {
+
+/// Measures building the metadata graph of fusion plans and walking it while ops are added. The
+/// graph is built for the first op of every plan, the difference between the two measurements is
+/// the cost of FusionMDGraph::Advance.
+struct FusionSpeedTest : public BenchmarkDriver
+{
+    void run()
+    {
+        TensorDescriptor x{miopenFloat, {64, 64, 56, 56}};
+        TensorDescriptor w{miopenFloat, {64, 64, 3, 3}};
+        const TensorDescriptor bias{miopenFloat, {1, 64, 1, 1}};
+        ConvolutionDescriptor conv{{1, 1}, {1, 1}, {1, 1}};
+
+        Measure("FusionMDGraph::InitConv", [&] {
+            FusionMDGraph graph;
+            FusionMDGraph::Init(graph, miopenFusionOpConvForward);
+            SaveDeadCode(graph.edge_list.size());
+        });
+        Measure("conv+bias+activ plan", [&] {
+            FusionPlanDescriptor plan{miopenVerticalFusion, x};
+            plan.AddOp(std::make_shared<ConvForwardOpDescriptor>(conv, w));
+            plan.AddOp(std::make_shared<BiasFusionOpDescriptor>(bias));
+            plan.AddOp(std::make_shared<ActivFwdFusionOpDescriptor>(miopenActivationRELU));
+            SaveDeadCode(plan.isValid());
+        });
+
+        Measure("FusionMDGraph::InitBN", [&] {
+            FusionMDGraph graph;
+            FusionMDGraph::Init(graph, miopenFusionOpBatchNormInference);
+            SaveDeadCode(graph.edge_list.size());
+        });
+        Measure("bn+activ plan", [&] {
+            FusionPlanDescriptor plan{miopenVerticalFusion, x};
+            plan.AddOp(
+                std::make_shared<BatchNormInferenceFusionOpDescriptor>(miopenBNSpatial, bias));
+            plan.AddOp(std::make_shared<ActivFwdFusionOpDescriptor>(miopenActivationRELU));
+            SaveDeadCode(plan.isValid());
+        });
+
+        Report("fusion");
+    }
+};
+
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::FusionSpeedTest>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/bz2.hpp>
+#include <miopen/kernel_cache.hpp>
+
+#include "benchmark.hpp"
+#include "conv_problems.hpp"
+
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// Measures the lookups of launched kernels in the kernel cache of a handle and the bz2
+/// compression of the binaries stored in the kernel database.
+struct KernelCacheSpeedTest : public BenchmarkDriver
+{
+    KernelCacheSpeedTest()
+    {
+        add(entries, "entries");
+        add(binary_size, "binary-size");
+    }
+
+    void run()
+    {
+        const std::vector<std::string> algorithms = {"miopenConvolutionFwdAlgoDirect",
+                                                     "miopenConvolutionFwdAlgoWinograd",
+                                                     "miopenConvolutionFwdAlgoImplicitGEMM",
+                                                     "miopenConvolutionBwdDataAlgoDirect"};
+        std::vector<KernelCache::Key> keys;
+        for(const auto& problem : MakeConvProblems(entries))
+            keys.emplace_back(algorithms[keys.size() % algorithms.size()],
+                              problem.BuildConfKey().ToString());
+
+        // The kernels are not launched, empty ones are enough for the lookups.
+        KernelCache cache;
+        for(const auto& key : keys)
+            cache.AddKernel(key, Kernel{}, 0);
+
+        std::size_t next = 0;
+        Measure("KernelCache hit", [&] {
+            const auto& key = keys[(next++ * 7919) % keys.size()];
+            SaveDeadCode(cache.HasKernels(key.first, key.second) &&
+                         !cache.GetKernels(key.first, key.second).empty());
+        });
+        Measure("KernelCache miss", [&] {
+            const auto& key = keys[(next++ * 7919) % keys.size()];
+            SaveDeadCode(cache.HasKernels(key.first, "missing"));
+        });
+
+        // Code objects repeat instruction words with varying operands.
+        std::string binary(binary_size, '\0');
+        std::uint32_t state = 1;
+        for(std::size_t i = 0; i < binary.size(); i++)
+        {
+            state     = state * 1103515245 + 12345;
+            binary[i] = static_cast<char>(i % 4 == 3 ? (state >> 24) & 0x0F : (i * 13) % 7);
+        }
+        const auto compressed = compress(binary);
+        std::cout << "bz2 ratio: " << static_cast<double>(compressed.size()) / binary.size()
+                  << std::endl;
+
+        Measure("bz2 compress", [&] { SaveDeadCode(compress(binary).size()); }, binary.size());
+        Measure("bz2 decompress",
+                [&] { SaveDeadCode(decompress(compressed, binary.size()).size()); },
+                binary.size());
+        Measure("bz2 round trip",
+                [&] { SaveDeadCode(decompress(compress(binary), binary.size()).size()); },
+                binary.size());
+
+        Report("kernel_cache");
+    }
+
+    private:
+    std::size_t entries     = 2000;
+    std::size_t binary_size = 256 * 1024;
+};
+
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::KernelCacheSpeedTest>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/context.hpp>
+#include <miopen/env.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/kernel_cache_builder.hpp>
+#include <miopen/problem_description.hpp>
+#include <miopen/solver_id.hpp>
+
+#include "benchmark.hpp"
+#include "conv_problems.hpp"
+
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_DIRECT)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_GEMM)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_WINOGRAD)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_IMPLICIT_GEMM)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_FFT)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_SCGEMM)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_GCN_ASM_KERNELS)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_AMD_ROCM_PRECOMPILED_BINARIES)
+
+namespace miopen {
+
+/// Measures the host work done for every convolution problem before a kernel is chosen: the db
+/// keys, the network config and the applicability checks of all solvers. The checks run on an
+/// offline handle of --device, which needs no GPU but is only available with the HIP backend.
+struct ProblemSpeedTest : public BenchmarkDriver
+{
+    ProblemSpeedTest()
+    {
+        add(problem_count, "problems");
+        add(device, "device");
+    }
+
+    void run()
+    {
+        const auto problems = MakeConvProblems(problem_count);
+        std::vector<ProblemDescription> legacy;
+        for(const auto& problem : problems)
+            legacy.emplace_back(problem);
+
+        std::size_t next = 0;
+        const auto index = [&] { return next++ % problems.size(); };
+
+        Measure("conv::ProblemDescription::Serialize",
+                [&] { SaveDeadCode(SerializeProblem(problems[index()])); });
+        Measure("conv::ProblemDescription::BuildConfKey",
+                [&] { SaveDeadCode(problems[index()].BuildConfKey().ToString()); });
+        Measure("ProblemDescription::Serialize",
+                [&] { SaveDeadCode(SerializeProblem(legacy[index()])); });
+        Measure("ProblemDescription::BuildConfKey",
+                [&] { SaveDeadCode(legacy[index()].BuildConfKey().ToString()); });
+
+        // Solvers check variables like these in IsApplicable(), the reads from the process
+        // snapshot are compared with reading the environment on every check.
+        Measure("8 environment checks, snapshot", [&] {
+            std::size_t disabled = 0;
+            disabled += IsDisabled(MIOPEN_DEBUG_CONV_DIRECT{}) ? 1 : 0;
+            disabled += IsDisabled(MIOPEN_DEBUG_CONV_GEMM{}) ? 1 : 0;
+            disabled += IsDisabled(MIOPEN_DEBUG_CONV_WINOGRAD{}) ? 1 : 0;
+            disabled += IsDisabled(MIOPEN_DEBUG_CONV_IMPLICIT_GEMM{}) ? 1 : 0;
+            disabled += IsDisabled(MIOPEN_DEBUG_CONV_FFT{}) ? 1 : 0;
+            disabled += IsDisabled(MIOPEN_DEBUG_CONV_SCGEMM{}) ? 1 : 0;
+            disabled += IsDisabled(MIOPEN_DEBUG_GCN_ASM_KERNELS{}) ? 1 : 0;
+            disabled += IsDisabled(MIOPEN_DEBUG_AMD_ROCM_PRECOMPILED_BINARIES{}) ? 1 : 0;
+            SaveDeadCode(disabled);
+        });
+        Measure("8 environment checks, getenv", [&] {
+            std::size_t disabled = 0;
+            for(const auto name : {MIOPEN_DEBUG_CONV_DIRECT::value(),
+                                   MIOPEN_DEBUG_CONV_GEMM::value(),
+                                   MIOPEN_DEBUG_CONV_WINOGRAD::value(),
+                                   MIOPEN_DEBUG_CONV_IMPLICIT_GEMM::value(),
+                                   MIOPEN_DEBUG_CONV_FFT::value(),
+                                   MIOPEN_DEBUG_CONV_SCGEMM::value(),
+                                   MIOPEN_DEBUG_GCN_ASM_KERNELS::value(),
+                                   MIOPEN_DEBUG_AMD_ROCM_PRECOMPILED_BINARIES::value()})
+                disabled += IsEnvvarValueDisabled(name) ? 1 : 0;
+            SaveDeadCode(disabled);
+        });
+
+        std::unique_ptr<Handle> handle;
+        try
+        {
+            const auto target = ParseKernelCacheTarget(device);
+            handle            = std::make_unique<Handle>(target.device, target.num_cu);
+        }
+        catch(const std::exception& ex)
+        {
+            std::cout << "IsApplicable sweep skipped: " << ex.what() << std::endl;
+        }
+
+        if(handle)
+        {
+            std::vector<ConvolutionContext> contexts;
+            for(const auto& problem : problems)
+            {
+                contexts.emplace_back(ProblemDescription{problem});
+                auto& ctx                   = contexts.back();
+                ctx.do_search               = false;
+                ctx.general_compile_options = "";
+                ctx.SetStream(handle.get());
+                ctx.DetectRocm();
+                ctx.SetupFloats();
+            }
+
+            Measure("ExecutionContext::DetectRocm", [&] {
+                ExecutionContext ctx;
+                ctx.SetStream(handle.get());
+                ctx.DetectRocm();
+                SaveDeadCode(ctx.use_asm_kernels);
+            });
+
+            const auto solvers = GetSolvers();
+            Measure("IsApplicable sweep of " + std::to_string(solvers.size()) + " solvers", [&] {
+                const auto& ctx        = contexts[index()];
+                std::size_t applicable = 0;
+                for(const auto& solver : solvers)
+                {
+                    try
+                    {
+                        applicable += solver.IsApplicable(ctx) ? 1 : 0;
+                    }
+                    catch(const std::exception&) // NOLINT
+                    {
+                    }
+                }
+                SaveDeadCode(applicable);
+            });
+        }
+
+        Report("problem");
+    }
+
+    private:
+    std::size_t problem_count = 256;
+    std::string device        = "gfx906:60";
+
+    static std::vector<solver::AnySolver> GetSolvers()
+    {
+        // Ids of removed solvers are left unused, the registry ends after a run of them.
+        std::vector<solver::AnySolver> solvers;
+        std::size_t unused = 0;
+        for(std::uint64_t value = 1; unused < 16; value++)
+        {
+            const auto solver = solver::Id{value}.GetSolver();
+            if(solver.IsEmpty())
+            {
+                unused++;
+                continue;
+            }
+            unused = 0;
+            solvers.push_back(solver);
+        }
+        return solvers;
+    }
+};
+
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::ProblemSpeedTest>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/convolution.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/tensor.hpp>
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace {
+std::atomic<std::size_t>& allocation_count()
+{
+    static std::atomic<std::size_t> count{0};
+    return count;
+}
+} // namespace
+
+// Counts every heap allocation made by the process.
+void* operator new(std::size_t size)
+{
+    ++allocation_count();
+    if(void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace miopen {
+
+/// Measures heap allocations and host time of building tensor descriptors and of an
+/// immediate mode forward convolution query, which creates many temporary descriptors.
+struct TensorDescriptorSpeedTest : public BenchmarkDriver
+{
+    TensorDescriptorSpeedTest()
+    {
+        add(immediate, "immediate");
+        allocation_counter = [] { return allocation_count().load(); };
+    }
+
+    void run()
+    {
+        Measure("descriptors", [&] {
+            const TensorDescriptor x{miopenFloat, input};
+            const TensorDescriptor w{miopenFloat, weights};
+            const auto flat = TensorDescriptor{miopenFloat, {x.GetElementSize()}};
+            const auto y    = conv.GetForwardOutputTensor(x, w);
+            const auto problem =
+                conv::ProblemDescription{x, w, y, conv, conv::Direction::Forward};
+            SaveDeadCode(problem.GetOutChannels() + flat.GetElementSpace());
+        });
+
+        if(immediate)
+        {
+            TensorDescriptor x{miopenFloat, input};
+            TensorDescriptor w{miopenFloat, weights};
+            auto y        = conv.GetForwardOutputTensor(x, w);
+            auto&& handle = get_handle();
+            Measure("immediate mode query", [&] {
+                std::size_t count = 0;
+                miopenConvSolution_t solutions[8];
+                miopenConvolutionForwardGetSolution(
+                    &handle, &w, &x, &conv, &y, 8, &count, solutions);
+                SaveDeadCode(count);
+            });
+        }
+        Report("tensor_descriptor");
+    }
+
+    private:
+    bool immediate                   = false;
+    std::vector<std::size_t> input   = {16, 64, 56, 56};
+    std::vector<std::size_t> weights = {64, 64, 3, 3};
+    ConvolutionDescriptor conv{{1, 1}, {1, 1}, {1, 1}};
+};
+
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::TensorDescriptorSpeedTest>(argc, argv);
+    return 0;
+}
@@ -24,6 +24,7 @@
  *
  *******************************************************************************/
 #include <miopen/activ.hpp>
+#include <miopen/api_trace.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/logger.hpp>
@@ -113,6 +114,18 @@ extern "C" miopenStatus_t miopenActivationForward(miopenHandle_t handle,
         return miopenStatusNotImplemented;
     }
     LogCmdActivation(xDesc, activDesc, true);
+    miopen::TraceScope trace{miopen::TraceCall::ActivationForward};
+    trace.Tensor(xDesc).Tensor(yDesc);
+    if(trace.Enabled() && activDesc != nullptr)
+    {
+        const auto& activ = miopen::deref(activDesc);
+        trace.Int(activ.GetMode())
+            .Real(activ.GetAlpha())
+            .Real(activ.GetBeta())
+            .Real(activ.GetGamma())
+            .Scale(alpha, 1)
+            .Scale(beta, 0);
+    }
     return miopen::try_([&] {
         miopen::deref(activDesc).Forward(miopen::deref(handle),
                                          alpha,
@@ -149,6 +162,18 @@ extern "C" miopenStatus_t miopenActivationBackward(miopenHandle_t handle,
     }
 
     LogCmdActivation(xDesc, activDesc, false);
+    miopen::TraceScope trace{miopen::TraceCall::ActivationBackward};
+    trace.Tensor(yDesc).Tensor(dyDesc).Tensor(xDesc).Tensor(dxDesc);
+    if(trace.Enabled() && activDesc != nullptr)
+    {
+        const auto& activ = miopen::deref(activDesc);
+        trace.Int(activ.GetMode())
+            .Real(activ.GetAlpha())
+            .Real(activ.GetBeta())
+            .Real(activ.GetGamma())
+            .Scale(alpha, 1)
+            .Scale(beta, 0);
+    }
     return miopen::try_([&] {
         miopen::deref(activDesc).Backward(miopen::deref(handle),
                                           alpha,
@@ -0,0 +1,696 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/api_trace.hpp>
+
+#include <miopen/convolution.hpp>
+#include <miopen/datatype.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <ostream>
+#include <sstream>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_TRACE_FILE)
+
+namespace miopen {
+
+namespace {
+
+const char trace_magic[]              = {'M', 'I', 'O', 'T', 'R', 'A', 'C', 'E'};
+// 2 added the results of the Find calls.
+constexpr std::uint64_t trace_version = 2;
+constexpr std::size_t max_varint_size = 10;
+
+void PutVarint(std::string& out, std::uint64_t value)
+{
+    while(value >= 0x80)
+    {
+        out += static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+void PutSigned(std::string& out, std::int64_t value)
+{
+    const auto bits = static_cast<std::uint64_t>(value);
+    PutVarint(out, (bits << 1) ^ (value < 0 ? ~std::uint64_t{0} : 0));
+}
+
+void PutReal(std::string& out, double value)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for(int i = 0; i < 8; i++)
+        out += static_cast<char>(bits >> (8 * i));
+}
+
+template <class T>
+void PutSizes(std::string& out, const std::vector<T>& values)
+{
+    for(const auto value : values)
+        PutVarint(out, value);
+}
+
+template <class T>
+void PutInts(std::string& out, const std::vector<T>& values)
+{
+    for(const auto value : values)
+        PutSigned(out, value);
+}
+
+// Reads the fields of a record, throws when they run past its end.
+class RecordReader
+{
+    public:
+    RecordReader(const std::string& data_) : data(data_) {}
+
+    std::uint64_t Varint()
+    {
+        std::uint64_t value = 0;
+        for(std::size_t i = 0; i < max_varint_size; i++)
+        {
+            const auto byte = static_cast<unsigned char>(Byte());
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << (7 * i);
+            if((byte & 0x80) == 0)
+                return value;
+        }
+        MIOPEN_THROW("Corrupt trace record");
+    }
+
+    std::int64_t Signed()
+    {
+        const auto bits = Varint();
+        return static_cast<std::int64_t>((bits >> 1) ^ (~(bits & 1) + 1));
+    }
+
+    double Real()
+    {
+        std::uint64_t bits = 0;
+        for(int i = 0; i < 8; i++)
+            bits |= static_cast<std::uint64_t>(static_cast<unsigned char>(Byte())) << (8 * i);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Every element takes at least a byte, so larger counts can only come from corrupt data.
+    std::size_t Count()
+    {
+        const auto count = Varint();
+        if(count > data.size() - pos)
+            MIOPEN_THROW("Corrupt trace record");
+        return count;
+    }
+
+    template <class T>
+    std::vector<T> Sizes(std::size_t count)
+    {
+        std::vector<T> values(count);
+        for(auto& value : values)
+            value = static_cast<T>(Varint());
+        return values;
+    }
+
+    template <class T>
+    std::vector<T> Ints(std::size_t count)
+    {
+        std::vector<T> values(count);
+        for(auto& value : values)
+            value = static_cast<T>(Signed());
+        return values;
+    }
+
+    private:
+    const std::string& data;
+    std::size_t pos = 0;
+
+    char Byte()
+    {
+        if(pos == data.size())
+            MIOPEN_THROW("Corrupt trace record");
+        return data[pos++];
+    }
+};
+
+// Varints of the record headers are read from the stream directly. Returns false at the end of
+// the stream.
+bool ReadVarint(std::istream& stream, std::uint64_t& value)
+{
+    value = 0;
+    for(std::size_t i = 0; i < max_varint_size; i++)
+    {
+        const auto c = stream.get();
+        if(c == std::char_traits<char>::eof())
+        {
+            if(i == 0)
+                return false;
+            MIOPEN_THROW("Truncated trace");
+        }
+        value |= static_cast<std::uint64_t>(c & 0x7F) << (7 * i);
+        if((c & 0x80) == 0)
+            return true;
+    }
+    MIOPEN_THROW("Corrupt trace record");
+}
+
+TraceRecord DecodeRecord(TraceCall call, std::uint64_t version, const std::string& data)
+{
+    RecordReader reader{data};
+    TraceRecord record;
+    record.call      = call;
+    record.timestamp = reader.Varint();
+    record.duration  = reader.Varint();
+    record.workspace = reader.Varint();
+
+    record.tensors.resize(reader.Count());
+    for(auto& tensor : record.tensors)
+    {
+        tensor.type     = static_cast<miopenDataType_t>(reader.Varint());
+        const auto rank = reader.Count();
+        tensor.lengths  = reader.Sizes<std::size_t>(rank);
+        tensor.strides  = reader.Sizes<std::size_t>(rank);
+    }
+
+    if(reader.Varint() != 0)
+    {
+        TraceConvolution conv;
+        conv.mode              = static_cast<miopenConvolutionMode_t>(reader.Varint());
+        conv.padding_mode      = static_cast<miopenPaddingMode_t>(reader.Varint());
+        const auto spatial     = reader.Count();
+        conv.pads              = reader.Ints<int>(spatial);
+        conv.strides           = reader.Ints<int>(spatial);
+        conv.dilations         = reader.Ints<int>(spatial);
+        conv.trans_output_pads = reader.Ints<int>(spatial);
+        conv.group_count       = static_cast<int>(reader.Signed());
+        record.convolution     = conv;
+    }
+
+    record.ints = reader.Ints<std::int64_t>(reader.Count());
+    record.reals.resize(reader.Count());
+    for(auto& real : record.reals)
+        real = reader.Real();
+
+    if(version >= 2)
+    {
+        record.results.resize(reader.Count());
+        for(auto& result : record.results)
+        {
+            result.algorithm = reader.Signed();
+            result.time      = reader.Real();
+            result.memory    = reader.Varint();
+        }
+    }
+    return record;
+}
+
+// Scaling factors point to the compute type of the tensors, which is float for every data type of
+// this API, the half and integer ones included.
+double ReadScale(const void* value, miopenDataType_t type)
+{
+    switch(type)
+    {
+    case miopenHalf:
+    case miopenFloat:
+    case miopenInt32:
+    case miopenInt8:
+    case miopenInt8x4:
+    case miopenBFloat16: return *static_cast<const float*>(value);
+    }
+    // Types of newer versions are not read.
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+std::size_t GetProcessId()
+{
+#ifdef __linux__
+    return ::getpid();
+#else
+    return 0;
+#endif
+}
+
+std::size_t GetTensorBytes(const TraceTensor& tensor)
+{
+    if(tensor.lengths.empty() || tensor.lengths.size() != tensor.strides.size())
+        return 0;
+    std::size_t space = 1;
+    for(std::size_t i = 0; i < tensor.lengths.size(); i++)
+    {
+        if(tensor.lengths[i] == 0)
+            return 0;
+        space += (tensor.lengths[i] - 1) * tensor.strides[i];
+    }
+    return space * GetTypeSize(tensor.type);
+}
+
+template <class T>
+std::string JoinDims(const std::vector<T>& dims)
+{
+    std::ostringstream ss;
+    for(std::size_t i = 0; i < dims.size(); i++)
+        ss << (i == 0 ? "" : "x") << dims[i];
+    return ss.str();
+}
+
+} // namespace
+
+std::string GetTraceCallName(TraceCall call)
+{
+    switch(call)
+    {
+    case TraceCall::ConvolutionForwardGetWorkSpaceSize:
+        return "miopenConvolutionForwardGetWorkSpaceSize";
+    case TraceCall::ConvolutionBackwardDataGetWorkSpaceSize:
+        return "miopenConvolutionBackwardDataGetWorkSpaceSize";
+    case TraceCall::ConvolutionBackwardWeightsGetWorkSpaceSize:
+        return "miopenConvolutionBackwardWeightsGetWorkSpaceSize";
+    case TraceCall::FindConvolutionForwardAlgorithm: return "miopenFindConvolutionForwardAlgorithm";
+    case TraceCall::FindConvolutionBackwardDataAlgorithm:
+        return "miopenFindConvolutionBackwardDataAlgorithm";
+    case TraceCall::FindConvolutionBackwardWeightsAlgorithm:
+        return "miopenFindConvolutionBackwardWeightsAlgorithm";
+    case TraceCall::ConvolutionForward: return "miopenConvolutionForward";
+    case TraceCall::ConvolutionBackwardData: return "miopenConvolutionBackwardData";
+    case TraceCall::ConvolutionBackwardWeights: return "miopenConvolutionBackwardWeights";
+    case TraceCall::ConvolutionForwardImmediate: return "miopenConvolutionForwardImmediate";
+    case TraceCall::ConvolutionBackwardDataImmediate:
+        return "miopenConvolutionBackwardDataImmediate";
+    case TraceCall::ConvolutionBackwardWeightsImmediate:
+        return "miopenConvolutionBackwardWeightsImmediate";
+    case TraceCall::ActivationForward: return "miopenActivationForward";
+    case TraceCall::ActivationBackward: return "miopenActivationBackward";
+    case TraceCall::SoftmaxForward: return "miopenSoftmaxForward_V2";
+    case TraceCall::SoftmaxBackward: return "miopenSoftmaxBackward_V2";
+    }
+    return "unknown";
+}
+
+bool operator==(const TraceTensor& l, const TraceTensor& r)
+{
+    return l.type == r.type && l.lengths == r.lengths && l.strides == r.strides;
+}
+
+bool operator==(const TraceConvolution& l, const TraceConvolution& r)
+{
+    return l.mode == r.mode && l.padding_mode == r.padding_mode && l.pads == r.pads &&
+           l.strides == r.strides && l.dilations == r.dilations &&
+           l.trans_output_pads == r.trans_output_pads && l.group_count == r.group_count;
+}
+
+bool operator==(const TraceFindResult& l, const TraceFindResult& r)
+{
+    return l.algorithm == r.algorithm && l.time == r.time && l.memory == r.memory;
+}
+
+bool operator==(const TraceRecord& l, const TraceRecord& r)
+{
+    return l.call == r.call && l.timestamp == r.timestamp && l.duration == r.duration &&
+           l.workspace == r.workspace && l.tensors == r.tensors &&
+           l.convolution == r.convolution && l.ints == r.ints && l.reals == r.reals &&
+           l.results == r.results;
+}
+
+void WriteTraceHeader(std::ostream& stream)
+{
+    std::string header{trace_magic, sizeof(trace_magic)};
+    PutVarint(header, trace_version);
+    stream.write(header.data(), header.size());
+}
+
+void WriteTraceRecord(std::ostream& stream, const TraceRecord& record)
+{
+    std::string payload;
+    PutVarint(payload, record.timestamp);
+    PutVarint(payload, record.duration);
+    PutVarint(payload, record.workspace);
+
+    PutVarint(payload, record.tensors.size());
+    for(const auto& tensor : record.tensors)
+    {
+        PutVarint(payload, tensor.type);
+        PutVarint(payload, tensor.lengths.size());
+        PutSizes(payload, tensor.lengths);
+        PutSizes(payload, tensor.strides);
+    }
+
+    PutVarint(payload, record.convolution ? 1 : 0);
+    if(record.convolution)
+    {
+        const auto& conv = *record.convolution;
+        PutVarint(payload, conv.mode);
+        PutVarint(payload, conv.padding_mode);
+        PutVarint(payload, conv.pads.size());
+        PutInts(payload, conv.pads);
+        PutInts(payload, conv.strides);
+        PutInts(payload, conv.dilations);
+        PutInts(payload, conv.trans_output_pads);
+        PutSigned(payload, conv.group_count);
+    }
+
+    PutVarint(payload, record.ints.size());
+    PutInts(payload, record.ints);
+    PutVarint(payload, record.reals.size());
+    for(const auto real : record.reals)
+        PutReal(payload, real);
+    PutVarint(payload, record.results.size());
+    for(const auto& result : record.results)
+    {
+        PutSigned(payload, result.algorithm);
+        PutReal(payload, result.time);
+        PutVarint(payload, result.memory);
+    }
+
+    std::string header;
+    PutVarint(header, static_cast<std::uint32_t>(record.call));
+    PutVarint(header, payload.size());
+    stream.write(header.data(), header.size());
+    stream.write(payload.data(), payload.size());
+}
+
+std::vector<TraceRecord> ReadTrace(std::istream& stream)
+{
+    char magic[sizeof(trace_magic)];
+    std::uint64_t version = 0;
+    if(!stream.read(magic, sizeof(magic)) ||
+       !std::equal(magic, magic + sizeof(magic), trace_magic) || !ReadVarint(stream, version) ||
+       version == 0)
+        MIOPEN_THROW("Not an API trace");
+
+    std::vector<TraceRecord> records;
+    std::uint64_t call;
+    while(ReadVarint(stream, call))
+    {
+        std::uint64_t size;
+        if(!ReadVarint(stream, size) || call > std::numeric_limits<std::uint32_t>::max())
+            MIOPEN_THROW("Truncated trace");
+        // Grows with the data read, so a corrupt size cannot allocate much.
+        std::string data;
+        while(data.size() < size)
+        {
+            char buffer[4096];
+            const auto chunk = std::min<std::uint64_t>(sizeof(buffer), size - data.size());
+            if(!stream.read(buffer, chunk))
+                MIOPEN_THROW("Truncated trace");
+            data.append(buffer, chunk);
+        }
+        records.push_back(DecodeRecord(static_cast<TraceCall>(call), version, data));
+    }
+    return records;
+}
+
+std::vector<TraceRecord> ReadTrace(const std::string& path)
+{
+    std::ifstream file{path, std::ios::binary};
+    if(!file)
+        MIOPEN_THROW("Cannot open " + path);
+    return ReadTrace(file);
+}
+
+TraceWriter::TraceWriter(const std::string& path)
+    : start(std::chrono::steady_clock::now()), file(path, std::ios::binary | std::ios::trunc)
+{
+    if(!file)
+        MIOPEN_THROW("Cannot open " + path);
+    WriteTraceHeader(file);
+}
+
+std::uint64_t TraceWriter::Now() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                start)
+        .count();
+}
+
+void TraceWriter::Write(const TraceRecord& record)
+{
+    std::ostringstream encoded;
+    WriteTraceRecord(encoded, record);
+    const auto data = encoded.str();
+    std::lock_guard<std::mutex> lock{mutex};
+    file.write(data.data(), data.size());
+}
+
+void TraceWriter::Flush()
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    file.flush();
+}
+
+TraceWriter* GetApiTraceWriter()
+{
+    static const auto writer = []() -> std::unique_ptr<TraceWriter> {
+        const auto name = GetStringEnv(MIOPEN_TRACE_FILE{});
+        if(name == nullptr || *name == '\0')
+            return nullptr;
+        auto path      = std::string{name};
+        const auto pid = path.find("%p");
+        if(pid != std::string::npos)
+            path.replace(pid, 2, std::to_string(GetProcessId()));
+        try
+        {
+            auto trace = std::make_unique<TraceWriter>(path);
+            MIOPEN_LOG_I("Tracing API calls to " << path);
+            return trace;
+        }
+        catch(const Exception& ex)
+        {
+            MIOPEN_LOG_E(ex.what());
+            return nullptr;
+        }
+    }();
+    return writer.get();
+}
+
+TraceScope::TraceScope(TraceCall call) : writer(GetApiTraceWriter())
+{
+    record.call = call;
+    if(writer != nullptr)
+        record.timestamp = writer->Now();
+}
+
+TraceScope::~TraceScope()
+{
+    if(writer == nullptr)
+        return;
+    record.duration = writer->Now() - record.timestamp;
+    writer->Write(record);
+}
+
+TraceScope& TraceScope::Tensor(miopenTensorDescriptor_t desc)
+{
+    if(writer == nullptr)
+        return *this;
+    TraceTensor tensor;
+    if(desc != nullptr)
+    {
+        const auto& t  = deref(desc);
+        tensor.type    = t.GetType();
+        tensor.lengths = t.GetLengths();
+        tensor.strides = t.GetStrides();
+    }
+    record.tensors.push_back(tensor);
+    return *this;
+}
+
+TraceScope& TraceScope::Convolution(miopenConvolutionDescriptor_t desc)
+{
+    if(writer == nullptr || desc == nullptr)
+        return *this;
+    const auto& c = deref(desc);
+    TraceConvolution conv;
+    conv.mode              = c.mode;
+    conv.padding_mode      = c.paddingMode;
+    conv.pads              = c.GetConvPads();
+    conv.strides           = c.GetConvStrides();
+    conv.dilations         = c.GetConvDilations();
+    conv.trans_output_pads = c.GetTransposeConvPads();
+    conv.group_count       = c.group_count;
+    record.convolution     = conv;
+    return *this;
+}
+
+TraceScope& TraceScope::Int(std::int64_t value)
+{
+    if(writer != nullptr)
+        record.ints.push_back(value);
+    return *this;
+}
+
+TraceScope& TraceScope::Real(double value)
+{
+    if(writer != nullptr)
+        record.reals.push_back(value);
+    return *this;
+}
+
+TraceScope& TraceScope::Scale(const void* value, float fallback)
+{
+    if(writer == nullptr)
+        return *this;
+    const auto type = record.tensors.empty() ? miopenFloat : record.tensors.front().type;
+    return Real(value == nullptr ? fallback : ReadScale(value, type));
+}
+
+TraceScope& TraceScope::FindResults(int count, const miopenConvAlgoPerf_t* perf)
+{
+    if(writer == nullptr)
+        return *this;
+    for(int i = 0; i < count; i++)
+    {
+        TraceFindResult result;
+        switch(record.call)
+        {
+        case TraceCall::FindConvolutionBackwardDataAlgorithm:
+            result.algorithm = perf[i].bwd_data_algo;
+            break;
+        case TraceCall::FindConvolutionBackwardWeightsAlgorithm:
+            result.algorithm = perf[i].bwd_weights_algo;
+            break;
+        default: result.algorithm = perf[i].fwd_algo; break;
+        }
+        result.time   = perf[i].time;
+        result.memory = perf[i].memory;
+        record.results.push_back(result);
+    }
+    return *this;
+}
+
+TraceScope& TraceScope::Workspace(std::size_t size)
+{
+    record.workspace = size;
+    return *this;
+}
+
+std::vector<TraceReplayStep> ScheduleTraceReplay(const std::vector<TraceRecord>& records,
+                                                 const TraceReplayOptions& options)
+{
+    if(records.empty())
+        return {};
+
+    // Records are written when the calls end, calls of other threads may come first.
+    std::vector<std::size_t> order(records.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](auto l, auto r) {
+        return records[l].timestamp < records[r].timestamp;
+    });
+
+    const auto first   = records[order.front()].timestamp;
+    std::uint64_t span = 0;
+    for(const auto& record : records)
+        span = std::max(span, record.timestamp + record.duration - first);
+
+    std::vector<TraceReplayStep> steps;
+    steps.reserve(order.size() * options.iterations);
+    for(std::size_t iteration = 0; iteration < options.iterations; iteration++)
+    {
+        for(const auto i : order)
+        {
+            const auto recorded = iteration * span + records[i].timestamp - first;
+            const auto issue_at =
+                options.speed > 0 ? static_cast<std::uint64_t>(recorded / options.speed) : 0;
+            steps.push_back({i, issue_at});
+        }
+    }
+    return steps;
+}
+
+TraceReplayBuffers GetTraceReplayBuffers(const std::vector<TraceRecord>& records)
+{
+    TraceReplayBuffers buffers;
+    for(const auto& record : records)
+    {
+        if(buffers.tensors.size() < record.tensors.size())
+            buffers.tensors.resize(record.tensors.size());
+        for(std::size_t i = 0; i < record.tensors.size(); i++)
+            buffers.tensors[i] = std::max(buffers.tensors[i], GetTensorBytes(record.tensors[i]));
+        buffers.workspace = std::max<std::size_t>(buffers.workspace, record.workspace);
+    }
+    return buffers;
+}
+
+std::string GetTraceRecordSignature(const TraceRecord& record)
+{
+    std::ostringstream ss;
+    ss << GetTraceCallName(record.call);
+    if(!record.tensors.empty())
+        ss << ' ' << GetDataType(record.tensors.front().type);
+    for(const auto& tensor : record.tensors)
+        ss << ' ' << (tensor.lengths.empty() ? "null" : JoinDims(tensor.lengths));
+    if(record.convolution)
+    {
+        const auto& conv = *record.convolution;
+        ss << " pad " << JoinDims(conv.pads) << " stride " << JoinDims(conv.strides)
+           << " dilation " << JoinDims(conv.dilations);
+        if(conv.group_count != 1)
+            ss << " group " << conv.group_count;
+        if(conv.mode == miopenTranspose)
+            ss << " transpose";
+    }
+    for(const auto value : record.ints)
+        ss << ' ' << value;
+    return ss.str();
+}
+
+void TraceReplayReport::Add(const TraceRecord& record, double latency_us)
+{
+    const auto signature = GetTraceRecordSignature(record);
+    const auto found     = index.find(signature);
+    const auto i         = found != index.end() ? found->second : stats.size();
+    if(i == stats.size())
+    {
+        index.emplace(signature, i);
+        stats.push_back({});
+        stats.back().signature = signature;
+        stats.back().min       = latency_us;
+        stats.back().max       = latency_us;
+    }
+
+    auto& s = stats[i];
+    ++s.count;
+    // Running means, the totals are not kept.
+    s.recorded += (record.duration / 1000.0 - s.recorded) / s.count;
+    s.mean += (latency_us - s.mean) / s.count;
+    s.min = std::min(s.min, latency_us);
+    s.max = std::max(s.max, latency_us);
+}
+
+std::vector<TraceReplayStats> TraceReplayReport::GetStats() const { return stats; }
+
+} // namespace miopen
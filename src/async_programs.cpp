@@ -0,0 +1,88 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/async_programs.hpp>
+#include <miopen/env.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/kernel_cache.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_COMPILE_PARALLEL_LEVEL)
+
+namespace miopen {
+
+std::shared_ptr<CompileJob> Handle::CompileAsync(const std::vector<solver::KernelInfo>& kernels,
+                                                 int priority) const
+{
+    std::call_once(first_use->async_programs, [&]() {
+        const auto threads = std::min<std::size_t>(Value(MIOPEN_COMPILE_PARALLEL_LEVEL{}, 20),
+                                                   std::thread::hardware_concurrency());
+        async_programs = std::make_unique<AsyncPrograms>(std::max<std::size_t>(threads, 1));
+        first_use->has_async_programs.store(true, std::memory_order_release);
+    });
+    auto& async = *async_programs;
+
+    std::vector<std::function<void()>> tasks;
+    std::set<std::pair<std::string, std::string>> programs;
+    for(const auto& kernel : kernels)
+    {
+        auto params = kernel.comp_options;
+        KernelCache::ProcessParams(params);
+        if(HasProgram(kernel.kernel_file, params))
+            continue;
+        if(!programs.emplace(kernel.kernel_file, params).second)
+            continue;
+
+        const auto name = kernel.kernel_file;
+        tasks.push_back([this, &async, name, params]() {
+            auto program = LoadProgram(name, params, false, "");
+            std::lock_guard<std::mutex> lock(async.mutex);
+            async.built.push_back({name, params, std::move(program)});
+        });
+    }
+    return async.scheduler.Submit(std::move(tasks), priority);
+}
+
+void Handle::AddAsyncPrograms() const
+{
+    if(!first_use->has_async_programs.load(std::memory_order_acquire))
+        return;
+
+    std::vector<AsyncProgram> built;
+    {
+        std::lock_guard<std::mutex> lock(async_programs->mutex);
+        built.swap(async_programs->built);
+    }
+    for(const auto& item : built)
+        AddProgram(item.program, item.name, item.params);
+}
+
+} // namespace miopen
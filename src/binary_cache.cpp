@@ -37,13 +37,26 @@
 #include <miopen/kern_db.hpp>
 #include <miopen/db.hpp>
 #include <miopen/db_path.hpp>
+#include <miopen/load_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/write_file.hpp>
+#include <miopen/xxh3.hpp>
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cctype>
+#include <ctime>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace miopen {
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DISABLE_CACHE)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_COMPILE_LEASE_TIMEOUT)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_CACHE_MAX_SIZE)
 
 static boost::filesystem::path ComputeSysCachePath()
 {
@@ -110,13 +123,235 @@ KDb GetDb(const std::string& device, size_t num_cu)
 }
 
 #if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
-boost::filesystem::path GetCacheFile(const std::string& device,
+boost::filesystem::path GetCacheFile(const boost::filesystem::path& cache_dir,
+                                     const std::string& device,
                                      const std::string& name,
                                      const std::string& args,
                                      bool is_kernel_str)
 {
     std::string filename = (is_kernel_str ? miopen::md5(name) : name) + ".o";
-    return GetCachePath(false) / miopen::md5(device + ":" + args) / filename;
+    return cache_dir / "index" / miopen::md5(device + ":" + args) / filename;
+}
+
+boost::filesystem::path GetCacheFile(const std::string& device,
+                                     const std::string& name,
+                                     const std::string& args,
+                                     bool is_kernel_str)
+{
+    return GetCacheFile(GetCachePath(false), device, name, args, is_kernel_str);
+}
+
+static boost::filesystem::path GetCacheBlob(const boost::filesystem::path& cache_dir,
+                                            const std::string& digest)
+{
+    return cache_dir / "blobs" / (digest + ".o");
+}
+
+static bool IsDigest(const std::string& digest)
+{
+    return digest.size() == 32 && std::all_of(digest.begin(), digest.end(), [](char c) {
+               return std::isxdigit(static_cast<unsigned char>(c)) != 0;
+           });
+}
+
+boost::filesystem::path LoadCacheBlob(const boost::filesystem::path& cache_dir,
+                                      const boost::filesystem::path& entry)
+{
+    if(!boost::filesystem::exists(entry))
+        return {};
+    const auto digest = LoadFile(entry);
+    if(!IsDigest(digest))
+        return {};
+    const auto blob = GetCacheBlob(cache_dir, digest);
+    if(!boost::filesystem::exists(blob))
+        return {};
+
+    // The modification time of a blob is the time it was last used, see PruneBinaryCache().
+    boost::system::error_code ec;
+    boost::filesystem::last_write_time(blob, std::time(nullptr), ec);
+    return blob;
+}
+
+void SaveCacheBlob(const boost::filesystem::path& cache_dir,
+                   const boost::filesystem::path& binary_path,
+                   const boost::filesystem::path& entry)
+{
+    const auto digest = miopen::xxh3(LoadFile(binary_path));
+    const auto blob   = GetCacheBlob(cache_dir, digest);
+    boost::filesystem::create_directories(blob.parent_path());
+    if(boost::filesystem::exists(blob))
+    {
+        boost::filesystem::remove(binary_path);
+        boost::system::error_code ec;
+        boost::filesystem::last_write_time(blob, std::time(nullptr), ec);
+    }
+    else
+    {
+        // Renames are atomic, concurrent stores of the same binary leave one complete blob.
+        boost::filesystem::rename(binary_path, blob);
+    }
+
+    const auto tmp = cache_dir / boost::filesystem::unique_path();
+    WriteFile(digest, tmp);
+    boost::filesystem::create_directories(entry.parent_path());
+    boost::filesystem::rename(tmp, entry);
+}
+
+// Before the cache was content addressed the binaries were stored at
+// <md5 of device and args>/<name>.o, the path of their index entry without the index directory.
+// Moves them to blobs and points their index entries to them.
+static std::size_t MigrateBinaryCache(const boost::filesystem::path& cache_dir)
+{
+    namespace fs = boost::filesystem;
+    std::size_t migrated = 0;
+    boost::system::error_code ec;
+    if(!fs::is_directory(cache_dir))
+        return migrated;
+
+    std::vector<fs::path> old_dirs;
+    for(fs::directory_iterator it(cache_dir), end; it != end; ++it)
+    {
+        if(IsDigest(it->path().filename().string()) && fs::is_directory(it->path(), ec))
+            old_dirs.push_back(it->path());
+    }
+
+    for(const auto& old_dir : old_dirs)
+    {
+        std::vector<fs::path> binaries;
+        for(fs::directory_iterator it(old_dir, ec), end; !ec && it != end; it.increment(ec))
+        {
+            if(it->path().extension() == ".o" && fs::is_regular_file(it->path(), ec))
+                binaries.push_back(it->path());
+        }
+        for(const auto& binary : binaries)
+        {
+            const auto entry = cache_dir / "index" / old_dir.filename() / binary.filename();
+            try
+            {
+                if(fs::exists(entry))
+                    fs::remove(binary);
+                else
+                    SaveCacheBlob(cache_dir, binary, entry);
+                migrated++;
+            }
+            catch(const fs::filesystem_error& ex)
+            {
+                // Another process migrates the same binary.
+                MIOPEN_LOG_I2("Unable to migrate " << binary << ": " << ex.what());
+            }
+        }
+        fs::remove_all(old_dir, ec);
+    }
+    return migrated;
+}
+
+BinaryCachePruneResult PruneBinaryCache(const boost::filesystem::path& cache_dir,
+                                        std::uintmax_t max_size)
+{
+    namespace fs = boost::filesystem;
+    // Blobs stored before their entries are written are not collected.
+    constexpr std::time_t min_unused_age = 60;
+
+    BinaryCachePruneResult result;
+    result.migrated_entries = MigrateBinaryCache(cache_dir);
+    const auto blobs_dir = cache_dir / "blobs";
+    const auto index_dir = cache_dir / "index";
+    boost::system::error_code ec;
+
+    std::unordered_map<std::string, std::vector<fs::path>> entries;
+    if(fs::is_directory(index_dir))
+    {
+        for(fs::recursive_directory_iterator it(index_dir), end; it != end; ++it)
+        {
+            if(!fs::is_regular_file(it->path(), ec))
+                continue;
+            auto digest = LoadFile(it->path());
+            if(!IsDigest(digest))
+                digest.clear();
+            entries[digest].push_back(it->path());
+        }
+    }
+
+    struct Blob
+    {
+        std::string digest;
+        fs::path path;
+        std::time_t used;
+        std::uintmax_t size;
+    };
+    std::vector<Blob> blobs;
+    std::unordered_set<std::string> present;
+    const auto now = std::time(nullptr);
+    if(fs::is_directory(blobs_dir))
+    {
+        for(fs::directory_iterator it(blobs_dir), end; it != end; ++it)
+        {
+            // Skips the blobs other processes remove meanwhile.
+            const auto& path = it->path();
+            const auto used  = fs::last_write_time(path, ec);
+            if(ec)
+                continue;
+            const auto size = fs::file_size(path, ec);
+            if(ec)
+                continue;
+            const auto digest = path.stem().string();
+            present.insert(digest);
+            if(entries.count(digest) == 0 && now - used >= min_unused_age)
+            {
+                if(fs::remove(path, ec))
+                    result.removed_blobs++;
+                continue;
+            }
+            blobs.push_back({digest, path, used, size});
+        }
+    }
+
+    const auto remove_entries = [&](const std::vector<fs::path>& paths) {
+        for(const auto& path : paths)
+        {
+            if(fs::remove(path, ec))
+                result.removed_entries++;
+        }
+    };
+    for(const auto& entry : entries)
+    {
+        if(present.count(entry.first) == 0)
+            remove_entries(entry.second);
+    }
+
+    for(const auto& blob : blobs)
+        result.size += blob.size;
+    std::sort(blobs.begin(), blobs.end(), [](const Blob& l, const Blob& r) {
+        return l.used < r.used;
+    });
+    auto left = blobs.begin();
+    for(; left != blobs.end() && result.size > max_size; ++left)
+    {
+        if(fs::remove(left->path, ec))
+            result.removed_blobs++;
+        result.size -= left->size;
+        const auto entry = entries.find(left->digest);
+        if(entry != entries.end())
+            remove_entries(entry->second);
+    }
+    result.blobs = std::distance(left, blobs.end());
+    return result;
+}
+
+static void PruneUserCache()
+{
+    const auto max_size = Value(MIOPEN_CACHE_MAX_SIZE{});
+    if(max_size == 0)
+    {
+        const auto migrated = MigrateBinaryCache(GetCachePath(false));
+        if(migrated != 0)
+            MIOPEN_LOG_I2("Migrated " << migrated << " binaries to the binary cache");
+        return;
+    }
+    const auto result = PruneBinaryCache(GetCachePath(false), max_size << 20);
+    MIOPEN_LOG_I2("Pruned binary cache: removed " << result.removed_blobs << " binaries, "
+                                                  << result.blobs << " binaries and "
+                                                  << result.size << " bytes left");
 }
 #endif
 
@@ -169,15 +404,7 @@ boost::filesystem::path LoadBinary(const std::string& device,
         return {};
 
     (void)num_cu;
-    auto f = GetCacheFile(device, name, args, is_kernel_str);
-    if(boost::filesystem::exists(f))
-    {
-        return f.string();
-    }
-    else
-    {
-        return {};
-    }
+    return LoadCacheBlob(GetCachePath(false), GetCacheFile(device, name, args, is_kernel_str));
 }
 
 void SaveBinary(const boost::filesystem::path& binary_path,
@@ -192,10 +419,28 @@ void SaveBinary(const boost::filesystem::path& binary_path,
     }
     else
     {
-        auto p = GetCacheFile(device, name, args, is_kernel_str);
-        boost::filesystem::create_directories(p.parent_path());
-        boost::filesystem::rename(binary_path, p);
+        static std::once_flag prune_once;
+        std::call_once(prune_once, PruneUserCache);
+        SaveCacheBlob(
+            GetCachePath(false), binary_path, GetCacheFile(device, name, args, is_kernel_str));
     }
 }
 #endif
+
+BuildLease LeaseBinaryBuild(const std::string& device,
+                            const std::string& name,
+                            const std::string& args,
+                            bool is_kernel_str)
+{
+    static const auto user_dir = ComputeUserCachePath();
+    const auto timeout         = Value(MIOPEN_COMPILE_LEASE_TIMEOUT{}, 300);
+    if(miopen::IsCacheDisabled() || user_dir.empty() || timeout == 0)
+        return {};
+
+    // Named like the index entries of the binary cache, see GetCacheFile().
+    const auto filename = (is_kernel_str ? miopen::md5(name) : name) + ".o";
+    return {user_dir / "index" / miopen::md5(device + ":" + args) / filename,
+            std::chrono::seconds{timeout}};
+}
+
 } // namespace miopen
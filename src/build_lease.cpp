@@ -0,0 +1,154 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/build_lease.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/sync/file_lock.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+namespace fs = boost::filesystem;
+
+namespace miopen {
+
+namespace {
+
+// Leases held by the threads of this process. File locks belong to the process, so they do not
+// exclude its threads, and closing any descriptor of a file releases its lock.
+struct ProcessLeases
+{
+    std::mutex mutex;
+    std::condition_variable released;
+    std::set<std::string> held;
+};
+
+ProcessLeases& GetProcessLeases()
+{
+    static ProcessLeases leases;
+    return leases;
+}
+
+} // namespace
+
+struct BuildLeaseImpl
+{
+    std::string path;
+    bool in_process = false;
+    std::unique_ptr<boost::interprocess::file_lock> file;
+
+    ~BuildLeaseImpl()
+    {
+        // Other threads may only open the file after it is closed here.
+        file.reset();
+        if(!in_process)
+            return;
+        auto& leases = GetProcessLeases();
+        std::lock_guard<std::mutex> lock(leases.mutex);
+        leases.held.erase(path);
+        leases.released.notify_all();
+    }
+};
+
+BuildLease::BuildLease() {}
+
+BuildLease::BuildLease(const fs::path& item, std::chrono::milliseconds timeout)
+{
+    using clock         = std::chrono::steady_clock;
+    const auto deadline = clock::now() + timeout;
+    const auto poll     = std::chrono::milliseconds{100};
+
+    try
+    {
+        auto lease  = std::make_unique<BuildLeaseImpl>();
+        lease->path = LockFilePath(item);
+
+        auto& leases = GetProcessLeases();
+        {
+            std::unique_lock<std::mutex> lock(leases.mutex);
+            if(!leases.released.wait_until(
+                   lock, deadline, [&]() { return leases.held.count(lease->path) == 0; }))
+            {
+                MIOPEN_LOG_W("Timeout waiting for another thread to build " << item.string());
+                return;
+            }
+            leases.held.insert(lease->path);
+            lease->in_process = true;
+        }
+
+        if(!fs::exists(lease->path))
+        {
+            if(!std::ofstream{lease->path})
+                MIOPEN_THROW("Error creating file <" + lease->path + "> for locking.");
+            fs::permissions(lease->path, fs::all_all);
+        }
+        lease->file = std::make_unique<boost::interprocess::file_lock>(lease->path.c_str());
+
+        for(auto waiting = false; !lease->file->try_lock(); waiting = true)
+        {
+            const auto now = clock::now();
+            if(now >= deadline)
+            {
+                MIOPEN_LOG_W("Timeout waiting for another process to build " << item.string());
+                return;
+            }
+            if(!waiting)
+                MIOPEN_LOG_I2("Waiting for another process to build " << item.string());
+            std::this_thread::sleep_for(std::min<clock::duration>(poll, deadline - now));
+        }
+        impl = std::move(lease);
+    }
+    catch(const fs::filesystem_error& ex)
+    {
+        MIOPEN_LOG_W("Build lease of " << item.string() << " is not available: " << ex.what());
+    }
+    catch(const boost::interprocess::interprocess_exception& ex)
+    {
+        MIOPEN_LOG_W("Build lease of " << item.string() << " is not available: " << ex.what());
+    }
+    catch(const Exception& ex)
+    {
+        MIOPEN_LOG_W("Build lease of " << item.string() << " is not available: " << ex.what());
+    }
+}
+
+BuildLease::BuildLease(BuildLease&&) noexcept            = default;
+BuildLease& BuildLease::operator=(BuildLease&&) noexcept = default;
+BuildLease::~BuildLease()                                = default;
+
+bool BuildLease::IsHeld() const { return impl != nullptr; }
+
+} // namespace miopen
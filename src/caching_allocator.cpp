@@ -0,0 +1,250 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/caching_allocator.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace miopen {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEVICE_MEMORY_CACHE_LIMIT)
+
+namespace {
+
+void* CachingAllocate(void* context, std::size_t n)
+{
+    return static_cast<CachingAllocator*>(context)->Allocate(n);
+}
+
+void CachingDeallocate(void* context, void* ptr)
+{
+    static_cast<CachingAllocator*>(context)->Deallocate(ptr);
+}
+
+} // namespace
+
+CachingAllocator::CachingAllocator(Allocator upstream_,
+                                   std::size_t cache_limit_,
+                                   const void* stream_)
+    : upstream(upstream_), cache_limit(cache_limit_), stream(stream_)
+{
+}
+
+CachingAllocator::~CachingAllocator()
+{
+    Trim();
+    if(!in_use.empty())
+        MIOPEN_LOG_W(in_use.size() << " buffers outlive their memory pool");
+}
+
+std::size_t CachingAllocator::SizeClass(std::size_t n)
+{
+    constexpr std::size_t min_size    = 512;
+    constexpr std::size_t large_size  = std::size_t{1} << 20;
+    constexpr std::size_t granularity = std::size_t{2} << 20;
+
+    if(n > std::numeric_limits<std::size_t>::max() - granularity)
+        return n;
+    if(n > large_size)
+        return (n + granularity - 1) / granularity * granularity;
+
+    auto size = min_size;
+    while(size < n)
+        size *= 2;
+    return size;
+}
+
+void* CachingAllocator::Allocate(std::size_t n)
+{
+    // Not tracked, Deallocate passes unknown buffers through.
+    if(n == 0)
+        return upstream.allocator(upstream.context, n);
+
+    const auto size = SizeClass(n);
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.requests++;
+
+    // The most recently freed buffer of the stream, the older ones are trimmed first.
+    const auto range = cached.equal_range(size);
+    auto block       = range.second;
+    for(auto it = range.first; it != range.second; ++it)
+    {
+        if(it->second.stream == stream &&
+           (block == range.second || it->second.freed_at > block->second.freed_at))
+            block = it;
+    }
+
+    void* ptr = nullptr;
+    if(block != range.second)
+    {
+        ptr = block->second.ptr;
+        cached.erase(block);
+        stats.hits++;
+        stats.bytes_cached -= size;
+    }
+    else
+    {
+        ptr = AllocateUpstream(size);
+        if(ptr == nullptr)
+            return nullptr;
+    }
+
+    in_use.emplace(ptr, Allocation{size, stream});
+    stats.bytes_in_use += size;
+
+    stats.peak_bytes_in_use   = std::max(stats.peak_bytes_in_use, stats.bytes_in_use);
+    stats.peak_bytes_reserved =
+        std::max(stats.peak_bytes_reserved, stats.bytes_in_use + stats.bytes_cached);
+    return ptr;
+}
+
+void* CachingAllocator::AllocateUpstream(std::size_t size)
+{
+    void* ptr = nullptr;
+    try
+    {
+        ptr = upstream.allocator(upstream.context, size);
+    }
+    catch(const Exception&)
+    {
+        if(cached.empty())
+            throw;
+    }
+
+    // The memory may be held by the cache, release it and try again.
+    if(ptr == nullptr && !cached.empty())
+    {
+        MIOPEN_LOG_I2("Releasing " << stats.bytes_cached << " cached bytes to allocate "
+                                   << size);
+        TrimUnlocked(0);
+        ptr = upstream.allocator(upstream.context, size);
+    }
+
+    if(ptr != nullptr)
+        stats.upstream_allocations++;
+    return ptr;
+}
+
+void CachingAllocator::Deallocate(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = in_use.find(ptr);
+    if(it == in_use.end())
+    {
+        upstream.deallocator(upstream.context, ptr);
+        return;
+    }
+
+    const auto size  = it->second.size;
+    const auto owner = it->second.stream;
+    in_use.erase(it);
+    stats.bytes_in_use -= size;
+
+    if(size > cache_limit)
+    {
+        upstream.deallocator(upstream.context, ptr);
+        stats.upstream_deallocations++;
+        return;
+    }
+
+    // Not the current stream, SetStream() may have been called while the buffer was in use.
+    cached.emplace(size, Block{ptr, owner, clock++});
+    stats.bytes_cached += size;
+    TrimUnlocked(cache_limit);
+}
+
+void CachingAllocator::SetStream(const void* stream_)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    stream = stream_;
+}
+
+void CachingAllocator::Trim(std::size_t limit)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    TrimUnlocked(limit);
+}
+
+void CachingAllocator::TrimUnlocked(std::size_t limit)
+{
+    const auto release = [&](std::multimap<std::size_t, Block>::iterator block) {
+        upstream.deallocator(upstream.context, block->second.ptr);
+        stats.bytes_cached -= block->first;
+        stats.upstream_deallocations++;
+        return cached.erase(block);
+    };
+
+    if(limit == 0)
+    {
+        for(auto it = cached.begin(); it != cached.end();)
+            it = release(it);
+        return;
+    }
+
+    while(stats.bytes_cached > limit)
+    {
+        release(std::min_element(cached.begin(), cached.end(), [](auto&& l, auto&& r) {
+            return l.second.freed_at < r.second.freed_at;
+        }));
+    }
+}
+
+void CachingAllocator::Retire()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    cache_limit = 0;
+    TrimUnlocked(0);
+}
+
+CachingAllocatorStats CachingAllocator::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+Allocator CachingAllocator::GetAllocator() { return {CachingAllocate, CachingDeallocate, this}; }
+
+Allocator MakeCachingAllocator(const Allocator& allocator,
+                               const void* stream,
+                               std::vector<std::unique_ptr<CachingAllocator>>& pools)
+{
+    if(!pools.empty())
+        pools.back()->Retire();
+
+    const auto limit = Value(MIOPEN_DEVICE_MEMORY_CACHE_LIMIT{});
+    if(limit == 0)
+        return allocator;
+
+    pools.push_back(std::make_unique<CachingAllocator>(allocator, limit << 20, stream));
+    MIOPEN_LOG_I2("Device memory cache limit: " << limit << " MiB");
+    return pools.back()->GetAllocator();
+}
+
+} // namespace miopen
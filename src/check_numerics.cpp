@@ -67,8 +67,8 @@ bool checkNumericsImpl(
 
     CheckNumericsResult abnormal_h;
 
-    auto abnormal_d =
-        handle.Create(sizeof(CheckNumericsResult)); // TODO - someday avoid slow malloc/free here
+    // Reused between calls when MIOPEN_DEVICE_MEMORY_CACHE_LIMIT is set.
+    auto abnormal_d = handle.Create(sizeof(CheckNumericsResult));
     handle.WriteTo(&abnormal_h, abnormal_d, sizeof(CheckNumericsResult));
 
     std::string params            = GetDataTypeKernelParams(dDesc.GetType());
@@ -0,0 +1,188 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/compile_scheduler.hpp>
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+
+namespace miopen {
+
+CompileJob::CompileJob(std::vector<std::function<void()>> tasks_) : tasks(std::move(tasks_)) {}
+
+CompileJobState CompileJob::GetState() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(!IsReadyUnsafe())
+        return started == 0 ? CompileJobState::Queued : CompileJobState::Running;
+    if(error)
+        return CompileJobState::Failed;
+    if(started < tasks.size())
+        return CompileJobState::Cancelled;
+    return CompileJobState::Done;
+}
+
+bool CompileJob::IsReady() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return IsReadyUnsafe();
+}
+
+void CompileJob::Wait() const
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    ready.wait(lock, [&]() { return IsReadyUnsafe(); });
+}
+
+std::exception_ptr CompileJob::GetError() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return error;
+}
+
+void CompileJob::Cancel()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    skipping = true;
+    if(IsReadyUnsafe())
+        ready.notify_all();
+}
+
+bool CompileJob::Start()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(skipping)
+        return false;
+    started++;
+    return true;
+}
+
+void CompileJob::Finish(std::exception_ptr task_error)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    finished++;
+    if(task_error && !error)
+    {
+        error    = task_error;
+        skipping = true;
+    }
+    if(IsReadyUnsafe())
+        ready.notify_all();
+}
+
+CompileScheduler::CompileScheduler(std::size_t workers)
+{
+    if(workers == 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Compile scheduler needs at least one thread");
+    threads.reserve(workers);
+    for(std::size_t i = 0; i < workers; i++)
+        threads.emplace_back([this]() { Work(); });
+}
+
+CompileScheduler::~CompileScheduler()
+{
+    std::vector<std::shared_ptr<CompileJob>> jobs;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        for(const auto& entry : queue)
+            jobs.push_back(entry.second.first);
+        queue.clear();
+    }
+    queued.notify_all();
+    for(const auto& job : jobs)
+        job->Cancel();
+    for(auto& thread : threads)
+        thread.join();
+}
+
+std::shared_ptr<CompileJob> CompileScheduler::Submit(std::vector<std::function<void()>> tasks,
+                                                     int priority)
+{
+    const auto job = std::make_shared<CompileJob>(std::move(tasks));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(stopping)
+            MIOPEN_THROW("Compile scheduler is stopping");
+        for(std::size_t i = 0; i < job->tasks.size(); i++)
+            queue.emplace(QueueKey{-priority, submitted++}, std::make_pair(job, i));
+    }
+    queued.notify_all();
+    return job;
+}
+
+void CompileScheduler::SetPriority(const std::shared_ptr<CompileJob>& job, int priority)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::pair<QueueKey, std::size_t>> moved;
+    for(auto it = queue.begin(); it != queue.end();)
+    {
+        if(it->second.first != job)
+        {
+            ++it;
+            continue;
+        }
+        moved.emplace_back(it->first, it->second.second);
+        it = queue.erase(it);
+    }
+    // Tasks keep their order of submission among the tasks of the same priority.
+    for(const auto& task : moved)
+        queue.emplace(QueueKey{-priority, task.first.second}, std::make_pair(job, task.second));
+}
+
+void CompileScheduler::Work()
+{
+    for(;;)
+    {
+        std::shared_ptr<CompileJob> job;
+        std::size_t task = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            queued.wait(lock, [&]() { return stopping || !queue.empty(); });
+            if(stopping)
+                return;
+            job  = queue.begin()->second.first;
+            task = queue.begin()->second.second;
+            queue.erase(queue.begin());
+        }
+
+        if(!job->Start())
+            continue;
+
+        std::exception_ptr error;
+        try
+        {
+            job->tasks[task]();
+        }
+        catch(...)
+        {
+            error = std::current_exception();
+        }
+        job->Finish(error);
+    }
+}
+
+} // namespace miopen
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/context_cache.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/tensor.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+namespace miopen {
+
+ContextCache& Handle::GetContextCache() const
+{
+    std::call_once(first_use->contexts, [&]() { contexts = std::make_unique<ContextCache>(); });
+    return *contexts;
+}
+
+ConvolutionProblemKey::ConvolutionProblemKey(const TensorDescriptor& in,
+                                             const TensorDescriptor& weights,
+                                             const TensorDescriptor& out,
+                                             const ConvolutionDescriptor& conv,
+                                             conv::Direction direction)
+{
+    // Each range is preceded by its size, so different splits of the values do not collide.
+    const auto add_range = [&](const auto& range) {
+        values.push_back(range.size());
+        for(const auto value : range)
+            values.push_back(value);
+    };
+    for(const auto* desc : {&in, &weights, &out})
+    {
+        values.push_back(desc->GetType());
+        add_range(desc->GetLengths());
+        add_range(desc->GetStrides());
+    }
+
+    std::uint32_t lowp_quant;
+    static_assert(sizeof(lowp_quant) == sizeof(conv.lowp_quant), "");
+    std::memcpy(&lowp_quant, &conv.lowp_quant, sizeof(lowp_quant));
+
+    values.push_back(static_cast<std::size_t>(direction));
+    values.push_back(conv.spatialDim);
+    values.push_back(conv.mode);
+    values.push_back(conv.paddingMode);
+    values.push_back(conv.group_count);
+    values.push_back(lowp_quant);
+    add_range(conv.GetConvPads());
+    add_range(conv.GetConvStrides());
+    add_range(conv.GetConvDilations());
+    add_range(conv.GetTransposeConvPads());
+}
+
+std::shared_ptr<const CachedConvolutionContext>
+GetConvolutionContext(Handle& handle,
+                      const TensorDescriptor& in,
+                      const TensorDescriptor& weights,
+                      const TensorDescriptor& out,
+                      const ConvolutionDescriptor& conv,
+                      conv::Direction direction)
+{
+    auto& cache = handle.GetContextCache();
+    const auto key = ConvolutionProblemKey{in, weights, out, conv, direction};
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.DropStale();
+        const auto it = cache.problems.find(key);
+        // The contexts refer to the handle, a moved handle builds them again.
+        if(it != cache.problems.end() && &it->second->context.GetStream() == &handle)
+            return it->second;
+    }
+
+    // Built unlocked, DetectRocm() takes the lock for the environment.
+    auto ctx = ConvolutionContext{in, weights, out, conv, direction};
+    ctx.SetStream(&handle);
+    ctx.DetectRocm();
+    ctx.SetupFloats();
+    auto cached = std::make_shared<const CachedConvolutionContext>(ctx);
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if(cache.problems.size() >= ContextCache::max_problems)
+        cache.problems.clear();
+    cache.problems[key] = cached;
+    return cached;
+}
+
+} // namespace miopen
@@ -40,6 +40,38 @@ EncodeDataTypesForKey(miopenDataType_t in, miopenDataType_t weights, miopenDataT
 
 namespace conv {
 
+std::string GetConvLayout(const TensorDescriptor& desc, std::size_t spatial_dims)
+{
+    const std::string labels = spatial_dims == 3 ? "NCDHW" : "NCHW";
+    if(desc.GetSize() != labels.size() || desc.IsPossibleLayout(labels, labels))
+        return DefaultLayout();
+    const std::string channels_last = spatial_dims == 3 ? "NDHWC" : "NHWC";
+    if(desc.IsPossibleLayout(labels, channels_last))
+        return channels_last;
+    return desc.GetLayout(labels);
+}
+
+std::string GetConvLayout(const TensorDescriptor& desc,
+                          std::size_t spatial_dims,
+                          const std::string& in_layout)
+{
+    const std::string labels = spatial_dims == 3 ? "NCDHW" : "NCHW";
+    const auto layout        = in_layout == DefaultLayout() ? labels : in_layout;
+    if(desc.GetSize() == labels.size() && layout.size() == labels.size() &&
+       desc.IsPossibleLayout(labels, layout))
+        return in_layout;
+    return GetConvLayout(desc, spatial_dims);
+}
+
+std::string EncodeLayoutsForKey(const std::string& in_layout,
+                                const std::string& weights_layout,
+                                const std::string& out_layout)
+{
+    if(in_layout == weights_layout && in_layout == out_layout)
+        return in_layout;
+    return in_layout + weights_layout + out_layout;
+}
+
 std::function<void(std::ostream&)>
 PrintDHW(char sep, int spatial_dims, int depth, int height, int width)
 {
@@ -67,7 +99,7 @@ void ProblemDescription::BuildConfKey(std::string& conf_key) const
     ss << 'x' << GetOutChannels();
     ss << 'x' << PrintDHW('x', GetSpatialDims(), GetOutDepth(), GetOutHeight(), GetOutWidth());
     ss << 'x' << GetInBatchSize();
-    ss << 'x' << GetInLayout();
+    ss << 'x' << EncodeLayoutsForKey(GetInLayout(), GetWeightsLayout(), GetOutLayout());
     ss << 'x' << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
     ss << 'x' << PrintDHW('x', GetSpatialDims(), GetPadD(), GetPadH(), GetPadW());
     ss << 'x'
@@ -95,7 +127,7 @@ void ProblemDescription::Serialize(std::ostream& stream) const
     stream << sep << PrintDHW('x', GetSpatialDims(), GetKernelStrideD(), GetKernelStrideH(), GetKernelStrideW());
     stream << sep << PrintDHW('x', GetSpatialDims(), GetDilationD(), GetDilationH(), GetDilationW());
     stream << sep << GetBias();
-    stream << sep << GetInLayout();
+    stream << sep << EncodeLayoutsForKey(GetInLayout(), GetWeightsLayout(), GetOutLayout());
     stream << sep << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
 
     switch(GetDirection())
@@ -24,6 +24,7 @@
  *
  *******************************************************************************/
 #include <miopen/config.h>
+#include <miopen/context_cache.hpp>
 #include <miopen/convolution.hpp>
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
@@ -32,6 +33,7 @@
 #include <miopen/logger.hpp>
 #include <miopen/miopen.h>
 #include <miopen/mlo_internal.hpp>
+#include <miopen/problem_description.hpp>
 #include <miopen/solver.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/algorithm.hpp>
@@ -41,7 +43,9 @@
 #include <cstddef>
 #include <algorithm>
 #include <cmath>
+#include <mutex>
 #include <ostream>
+#include <string>
 
 #include <boost/range/combine.hpp>
 #include <boost/range/adaptors.hpp>
@@ -413,13 +417,65 @@ ConvolutionDescriptor::WrwGetValidWorkSpaceSizeGemm(const TensorDescriptor& dyDe
 #endif
 }
 
+/// Workspace sizes of the Normal find mode depend only on the problem, the device and the
+/// environment, so each problem is evaluated once per handle and environment, see ContextCache.
+/// In the Fast and Hybrid modes the result follows the find-db, which changes after Find()
+/// calls, and is not memoized.
+template <class F>
+static std::size_t
+MemoizeWorkSpaceSize(const Handle& handle, const ProblemDescription& problem, F compute)
+{
+    const miopen::FindMode fm;
+    if(fm.IsFast() || fm.IsHybrid())
+        return compute();
+
+    std::string key;
+    problem.conv_problem.BuildConfKey(key);
+    key += 'x' + std::to_string(static_cast<int>(problem.conv_problem.GetDirection()));
+    key += 'x' + std::to_string(static_cast<int>(problem.conv_problem.GetConv().mode));
+
+    auto& cache = handle.GetContextCache();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.DropStale();
+        const auto it = cache.workspace_sizes.find(key);
+        if(it != cache.workspace_sizes.end())
+        {
+            MIOPEN_LOG_I2(it->second);
+            return it->second;
+        }
+    }
+
+    const auto generation     = EnvironmentGeneration();
+    const auto workspace_size = compute();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    // A size computed with the environment before a reload is not kept.
+    cache.DropStale();
+    if(generation != EnvironmentGeneration())
+        return workspace_size;
+    if(cache.workspace_sizes.size() >= ContextCache::max_problems)
+        cache.workspace_sizes.clear();
+    cache.workspace_sizes.emplace(key, workspace_size);
+    return workspace_size;
+}
+
 std::size_t ConvolutionDescriptor::ForwardGetWorkSpaceSize(Handle& handle,
                                                            const TensorDescriptor& wDesc,
                                                            const TensorDescriptor& xDesc,
                                                            const TensorDescriptor& yDesc) const
 {
     MIOPEN_LOG_I("");
+    const auto problem = ProblemDescription{xDesc, wDesc, yDesc, *this, conv::Direction::Forward};
+    return MemoizeWorkSpaceSize(
+        handle, problem, [&] { return ForwardGetWorkSpaceSizeImpl(handle, wDesc, xDesc, yDesc); });
+}
 
+std::size_t
+ConvolutionDescriptor::ForwardGetWorkSpaceSizeImpl(Handle& handle,
+                                                   const TensorDescriptor& wDesc,
+                                                   const TensorDescriptor& xDesc,
+                                                   const TensorDescriptor& yDesc) const
+{
     auto ctx = ConvolutionContext{xDesc, wDesc, yDesc, *this, conv::Direction::Forward};
     ctx.SetStream(&handle);
     ctx.DetectRocm();
@@ -527,7 +583,19 @@ ConvolutionDescriptor::BackwardDataGetWorkSpaceSize(Handle& handle,
                                                     const TensorDescriptor& dxDesc) const
 {
     MIOPEN_LOG_I("");
+    const auto problem =
+        ProblemDescription{dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData};
+    return MemoizeWorkSpaceSize(handle, problem, [&] {
+        return BackwardDataGetWorkSpaceSizeImpl(handle, wDesc, dyDesc, dxDesc);
+    });
+}
 
+std::size_t
+ConvolutionDescriptor::BackwardDataGetWorkSpaceSizeImpl(Handle& handle,
+                                                        const TensorDescriptor& wDesc,
+                                                        const TensorDescriptor& dyDesc,
+                                                        const TensorDescriptor& dxDesc) const
+{
     auto ctx = ConvolutionContext{dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData};
     ctx.SetStream(&handle);
     ctx.DetectRocm();
@@ -867,6 +935,17 @@ ConvolutionDescriptor::BackwardWeightsGetWorkSpaceSize(Handle& handle,
                                                        const TensorDescriptor& dwDesc) const
 {
     MIOPEN_LOG_I("");
+    return MemoizeWorkSpaceSize(handle, MakeWrwProblem(dyDesc, xDesc, dwDesc), [&] {
+        return BackwardWeightsGetWorkSpaceSizeImpl(handle, dyDesc, xDesc, dwDesc);
+    });
+}
+
+std::size_t
+ConvolutionDescriptor::BackwardWeightsGetWorkSpaceSizeImpl(Handle& handle,
+                                                           const TensorDescriptor& dyDesc,
+                                                           const TensorDescriptor& xDesc,
+                                                           const TensorDescriptor& dwDesc) const
+{
     const miopen::FindMode fm;
     while(fm.IsFast() || fm.IsHybrid())
     {
@@ -23,6 +23,7 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include <miopen/api_trace.hpp>
 #include <miopen/convolution.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
@@ -240,6 +241,8 @@ miopenConvolutionForwardGetWorkSpaceSize(miopenHandle_t handle,
 {
 
     MIOPEN_LOG_FUNCTION(handle, wDesc, yDesc, convDesc, workSpaceSize);
+    miopen::TraceScope trace{miopen::TraceCall::ConvolutionForwardGetWorkSpaceSize};
+    trace.Tensor(xDesc).Tensor(wDesc).Tensor(yDesc).Convolution(convDesc);
     miopen::try_([&] {
         miopen::deref(workSpaceSize) =
             miopen::deref(convDesc).mode == miopenTranspose
@@ -251,6 +254,7 @@ miopenConvolutionForwardGetWorkSpaceSize(miopenHandle_t handle,
                                                                   miopen::deref(wDesc),
                                                                   miopen::deref(xDesc),
                                                                   miopen::deref(yDesc));
+        trace.Workspace(*workSpaceSize);
     });
 
     return (miopenStatusSuccess);
@@ -370,6 +374,14 @@ miopenFindConvolutionForwardAlgorithm(miopenHandle_t handle,
                         workSpace,
                         workSpaceSize,
                         exhaustiveSearch);
+    miopen::TraceScope trace{miopen::TraceCall::FindConvolutionForwardAlgorithm};
+    trace.Tensor(xDesc)
+        .Tensor(wDesc)
+        .Tensor(yDesc)
+        .Convolution(convDesc)
+        .Int(requestAlgoCount)
+        .Int(exhaustiveSearch ? 1 : 0)
+        .Workspace(workSpaceSize);
 
     /// workaround for previous trans conv logic
     if(miopen::deref(convDesc).mode == miopenTranspose)
@@ -394,6 +406,7 @@ miopenFindConvolutionForwardAlgorithm(miopenHandle_t handle,
                 perfResults[i].fwd_algo =
                     static_cast<miopenConvFwdAlgorithm_t>(perfResults[i].bwd_data_algo);
             }
+            trace.FindResults(*returnedAlgoCount, perfResults);
         });
 
     return miopen::try_([&] {
@@ -410,6 +423,7 @@ miopenFindConvolutionForwardAlgorithm(miopenHandle_t handle,
                                                      DataCast(workSpace),
                                                      workSpaceSize,
                                                      exhaustiveSearch);
+        trace.FindResults(*returnedAlgoCount, perfResults);
     });
 }
 
@@ -442,6 +456,13 @@ extern "C" miopenStatus_t miopenConvolutionForward(miopenHandle_t handle,
                         workSpace,
                         workSpaceSize);
     LogCmdConvolution(xDesc, wDesc, convDesc, ConvDirection::Fwd, false);
+    miopen::TraceScope trace{miopen::TraceCall::ConvolutionForward};
+    trace.Tensor(xDesc)
+        .Tensor(wDesc)
+        .Tensor(yDesc)
+        .Convolution(convDesc)
+        .Int(algo)
+        .Workspace(workSpaceSize);
 
     /// workaround for previous trans conv logic
     if(miopen::deref(convDesc).mode == miopenTranspose)
@@ -565,6 +586,40 @@ miopenConvolutionForwardGetSolution(miopenHandle_t handle,
     });
 }
 
+extern "C" miopenStatus_t
+miopenConvolutionForwardGetSolutionWithinWorkspace(miopenHandle_t handle,
+                                                   const miopenTensorDescriptor_t wDesc,
+                                                   const miopenTensorDescriptor_t xDesc,
+                                                   const miopenConvolutionDescriptor_t convDesc,
+                                                   const miopenTensorDescriptor_t yDesc,
+                                                   const size_t workSpaceLimit,
+                                                   const size_t maxSolutionCount,
+                                                   size_t* solutionCount,
+                                                   miopenConvSolution_t* solutions)
+{
+    MIOPEN_LOG_FUNCTION(handle, wDesc, xDesc, convDesc, yDesc, workSpaceLimit, maxSolutionCount);
+    return miopen::try_([&] {
+        if(miopen::deref(convDesc).mode == miopenTranspose)
+            miopen::deref(convDesc).GetBackwardSolutions(miopen::deref(handle),
+                                                         miopen::deref(xDesc),
+                                                         miopen::deref(wDesc),
+                                                         miopen::deref(yDesc),
+                                                         maxSolutionCount,
+                                                         solutionCount,
+                                                         solutions,
+                                                         workSpaceLimit);
+        else
+            miopen::deref(convDesc).GetForwardSolutions(miopen::deref(handle),
+                                                        miopen::deref(wDesc),
+                                                        miopen::deref(xDesc),
+                                                        miopen::deref(yDesc),
+                                                        maxSolutionCount,
+                                                        solutionCount,
+                                                        solutions,
+                                                        workSpaceLimit);
+    });
+}
+
 extern "C" miopenStatus_t
 miopenConvolutionForwardGetSolutionWorkspaceSize(miopenHandle_t handle,
                                                  const miopenTensorDescriptor_t wDesc,
@@ -634,6 +689,13 @@ miopenConvolutionForwardImmediate(miopenHandle_t handle,
     MIOPEN_LOG_FUNCTION(
         handle, wDesc, w, xDesc, x, convDesc, yDesc, y, workSpace, workSpaceSize, solution_id);
     LogCmdConvolution(xDesc, wDesc, convDesc, ConvDirection::Fwd, true);
+    miopen::TraceScope trace{miopen::TraceCall::ConvolutionForwardImmediate};
+    trace.Tensor(xDesc)
+        .Tensor(wDesc)
+        .Tensor(yDesc)
+        .Convolution(convDesc)
+        .Int(solution_id)
+        .Workspace(workSpaceSize);
 
     return miopen::try_([&] {
         if(miopen::deref(convDesc).mode == miopenTranspose)
@@ -717,6 +779,40 @@ miopenConvolutionBackwardDataGetSolution(miopenHandle_t handle,
     });
 }
 
+extern "C" miopenStatus_t miopenConvolutionBackwardDataGetSolutionWithinWorkspace(
+    miopenHandle_t handle,
+    const miopenTensorDescriptor_t dyDesc,
+    const miopenTensorDescriptor_t wDesc,
+    const miopenConvolutionDescriptor_t convDesc,
+    const miopenTensorDescriptor_t dxDesc,
+    const size_t workSpaceLimit,
+    const size_t maxSolutionCount,
+    size_t* solutionCount,
+    miopenConvSolution_t* solutions)
+{
+    MIOPEN_LOG_FUNCTION(handle, dyDesc, wDesc, convDesc, dxDesc, workSpaceLimit, maxSolutionCount);
+    return miopen::try_([&] {
+        if(miopen::deref(convDesc).mode == miopenTranspose)
+            miopen::deref(convDesc).GetForwardSolutions(miopen::deref(handle),
+                                                        miopen::deref(wDesc),
+                                                        miopen::deref(dyDesc),
+                                                        miopen::deref(dxDesc),
+                                                        maxSolutionCount,
+                                                        solutionCount,
+                                                        solutions,
+                                                        workSpaceLimit);
+        else
+            miopen::deref(convDesc).GetBackwardSolutions(miopen::deref(handle),
+                                                         miopen::deref(dyDesc),
+                                                         miopen::deref(wDesc),
+                                                         miopen::deref(dxDesc),
+                                                         maxSolutionCount,
+                                                         solutionCount,
+                                                         solutions,
+                                                         workSpaceLimit);
+    });
+}
+
 extern "C" miopenStatus_t
 miopenConvolutionBackwardDataGetSolutionWorkspaceSize(miopenHandle_t handle,
                                                       const miopenTensorDescriptor_t dyDesc,
@@ -786,6 +882,13 @@ miopenConvolutionBackwardDataImmediate(miopenHandle_t handle,
     MIOPEN_LOG_FUNCTION(
         handle, dyDesc, wDesc, convDesc, dxDesc, workSpace, workSpaceSize, solution_id);
     LogCmdConvolution(dxDesc, wDesc, convDesc, ConvDirection::Bwd, true);
+    miopen::TraceScope trace{miopen::TraceCall::ConvolutionBackwardDataImmediate};
+    trace.Tensor(dyDesc)
+        .Tensor(wDesc)
+        .Tensor(dxDesc)
+        .Convolution(convDesc)
+        .Int(solution_id)
+        .Workspace(workSpaceSize);
     return miopen::try_([&] {
         if(miopen::deref(convDesc).mode == miopenTranspose)
             miopen::deref(convDesc).ConvolutionForwardImmediate(miopen::deref(handle),
@@ -865,6 +968,40 @@ miopenConvolutionBackwardWeightsGetSolution(miopenHandle_t handle,
     });
 }
 
+extern "C" miopenStatus_t miopenConvolutionBackwardWeightsGetSolutionWithinWorkspace(
+    miopenHandle_t handle,
+    const miopenTensorDescriptor_t dyDesc,
+    const miopenTensorDescriptor_t xDesc,
+    const miopenConvolutionDescriptor_t convDesc,
+    const miopenTensorDescriptor_t dwDesc,
+    const size_t workSpaceLimit,
+    const size_t maxSolutionCount,
+    size_t* solutionCount,
+    miopenConvSolution_t* solutions)
+{
+    MIOPEN_LOG_FUNCTION(handle, dyDesc, xDesc, convDesc, dwDesc, workSpaceLimit, maxSolutionCount);
+    return miopen::try_([&] {
+        if(miopen::deref(convDesc).mode == miopenTranspose)
+            miopen::deref(convDesc).GetWrwSolutions(miopen::deref(handle),
+                                                    miopen::deref(xDesc),
+                                                    miopen::deref(dyDesc),
+                                                    miopen::deref(dwDesc),
+                                                    maxSolutionCount,
+                                                    solutionCount,
+                                                    solutions,
+                                                    workSpaceLimit);
+        else
+            miopen::deref(convDesc).GetWrwSolutions(miopen::deref(handle),
+                                                    miopen::deref(dyDesc),
+                                                    miopen::deref(xDesc),
+                                                    miopen::deref(dwDesc),
+                                                    maxSolutionCount,
+                                                    solutionCount,
+                                                    solutions,
+                                                    workSpaceLimit);
+    });
+}
+
 extern "C" miopenStatus_t miopenConvolutionBackwardWeightsGetSolutionWorkspaceSize(
     miopenHandle_t handle,
     const miopenTensorDescriptor_t dyDesc,
@@ -934,6 +1071,13 @@ miopenConvolutionBackwardWeightsImmediate(miopenHandle_t handle,
     MIOPEN_LOG_FUNCTION(
         handle, dyDesc, dy, xDesc, x, convDesc, dwDesc, dw, workSpace, workSpaceSize, solution_id);
     LogCmdConvolution(xDesc, dwDesc, convDesc, ConvDirection::WrW, true);
+    miopen::TraceScope trace{miopen::TraceCall::ConvolutionBackwardWeightsImmediate};
+    trace.Tensor(dyDesc)
+        .Tensor(xDesc)
+        .Tensor(dwDesc)
+        .Convolution(convDesc)
+        .Int(solution_id)
+        .Workspace(workSpaceSize);
     return miopen::try_([&] {
         if(miopen::deref(convDesc).mode == miopenTranspose)
             miopen::deref(convDesc).ConvolutionWrwImmediate(miopen::deref(handle),
@@ -991,6 +1135,14 @@ miopenFindConvolutionBackwardDataAlgorithm(miopenHandle_t handle,
                         workSpace,
                         workSpaceSize,
                         exhaustiveSearch);
+    miopen::TraceScope trace{miopen::TraceCall::FindConvolutionBackwardDataAlgorithm};
+    trace.Tensor(dyDesc)
+        .Tensor(wDesc)
+        .Tensor(dxDesc)
+        .Convolution(convDesc)
+        .Int(requestAlgoCount)
+        .Int(exhaustiveSearch ? 1 : 0)
+        .Workspace(workSpaceSize);
 
     /// workaround for previous trans conv logic
     if(miopen::deref(convDesc).mode == miopenTranspose)
@@ -1015,6 +1167,7 @@ miopenFindConvolutionBackwardDataAlgorithm(miopenHandle_t handle,
                 perfResults[i].bwd_data_algo =
                     static_cast<miopenConvBwdDataAlgorithm_t>(perfResults[i].fwd_algo);
             }
+            trace.FindResults(*returnedAlgoCount, perfResults);
         });
 
     return miopen::try_([&] {
@@ -1031,6 +1184,7 @@ miopenFindConvolutionBackwardDataAlgorithm(miopenHandle_t handle,
                                                          DataCast(workSpace),
                                                          workSpaceSize,
                                                          exhaustiveSearch);
+        trace.FindResults(*returnedAlgoCount, perfResults);
     });
 }
 
@@ -1064,6 +1218,13 @@ miopenConvolutionBackwardData(miopenHandle_t handle,
                         workSpace,
                         workSpaceSize);
     LogCmdConvolution(dxDesc, wDesc, convDesc, ConvDirection::Bwd, false);
+    miopen::TraceScope trace{miopen::TraceCall::ConvolutionBackwardData};
+    trace.Tensor(dyDesc)
+        .Tensor(wDesc)
+        .Tensor(dxDesc)
+        .Convolution(convDesc)
+        .Int(algo)
+        .Workspace(workSpaceSize);
 
     /// workaround for previous trans conv logic
     if(miopen::deref(convDesc).mode == miopenTranspose)
@@ -1110,6 +1271,8 @@ miopenConvolutionBackwardDataGetWorkSpaceSize(miopenHandle_t handle,
 {
 
     MIOPEN_LOG_FUNCTION(handle, dyDesc, wDesc, convDesc, dxDesc, workSpaceSize);
+    miopen::TraceScope trace{miopen::TraceCall::ConvolutionBackwardDataGetWorkSpaceSize};
+    trace.Tensor(dyDesc).Tensor(wDesc).Tensor(dxDesc).Convolution(convDesc);
     return miopen::try_([&] {
         miopen::deref(workSpaceSize) =
             miopen::deref(convDesc).mode == miopenTranspose
@@ -1121,6 +1284,7 @@ miopenConvolutionBackwardDataGetWorkSpaceSize(miopenHandle_t handle,
                                                                        miopen::deref(wDesc),
                                                                        miopen::deref(dyDesc),
                                                                        miopen::deref(dxDesc));
+        trace.Workspace(*workSpaceSize);
     });
 }
 
@@ -1134,6 +1298,8 @@ miopenConvolutionBackwardWeightsGetWorkSpaceSize(miopenHandle_t handle,
 {
 
     MIOPEN_LOG_FUNCTION(handle, dyDesc, xDesc, convDesc, dwDesc, workSpaceSize);
+    miopen::TraceScope trace{miopen::TraceCall::ConvolutionBackwardWeightsGetWorkSpaceSize};
+    trace.Tensor(dyDesc).Tensor(xDesc).Tensor(dwDesc).Convolution(convDesc);
     return miopen::try_([&] {
         miopen::deref(workSpaceSize) = miopen::deref(convDesc).BackwardWeightsGetWorkSpaceSize(
             miopen::deref(handle),
@@ -1142,6 +1308,7 @@ miopenConvolutionBackwardWeightsGetWorkSpaceSize(miopenHandle_t handle,
             miopen::deref(convDesc).mode == miopenTranspose ? miopen::deref(dyDesc)
                                                             : miopen::deref(xDesc),
             miopen::deref(dwDesc));
+        trace.Workspace(*workSpaceSize);
     });
 }
 
@@ -1177,6 +1344,14 @@ miopenFindConvolutionBackwardWeightsAlgorithm(miopenHandle_t handle,
                         workSpaceSize,
                         exhaustiveSearch);
     LogCmdConvolution(xDesc, dwDesc, convDesc, ConvDirection::WrW, false);
+    miopen::TraceScope trace{miopen::TraceCall::FindConvolutionBackwardWeightsAlgorithm};
+    trace.Tensor(dyDesc)
+        .Tensor(xDesc)
+        .Tensor(dwDesc)
+        .Convolution(convDesc)
+        .Int(requestAlgoCount)
+        .Int(exhaustiveSearch ? 1 : 0)
+        .Workspace(workSpaceSize);
 
     return miopen::try_([&] {
         miopen::deref(convDesc).FindConvBwdWeightsAlgorithm(
@@ -1196,6 +1371,7 @@ miopenFindConvolutionBackwardWeightsAlgorithm(miopenHandle_t handle,
             DataCast(workSpace),
             workSpaceSize,
             exhaustiveSearch);
+        trace.FindResults(*returnedAlgoCount, perfResults);
     });
 }
 
@@ -1228,6 +1404,13 @@ miopenConvolutionBackwardWeights(miopenHandle_t handle,
                         dw,
                         workSpace,
                         workSpaceSize);
+    miopen::TraceScope trace{miopen::TraceCall::ConvolutionBackwardWeights};
+    trace.Tensor(dyDesc)
+        .Tensor(xDesc)
+        .Tensor(dwDesc)
+        .Convolution(convDesc)
+        .Int(algo)
+        .Workspace(workSpaceSize);
     return miopen::try_([&] {
         miopen::deref(convDesc).ConvolutionBackwardWeights(
             miopen::deref(handle),
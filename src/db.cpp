@@ -45,6 +45,7 @@
 #include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace miopen {
@@ -221,6 +222,77 @@ boost::optional<DbRecord> PlainTextDb::FindRecordUnsafe(const std::string& key,
     return boost::none;
 }
 
+std::unordered_map<std::string, DbRecord>
+PlainTextDb::FindRecords(const std::vector<std::string>& keys)
+{
+    auto records = std::unordered_map<std::string, DbRecord>{};
+    if(keys.empty())
+        return records;
+
+    const auto lock = shared_lock(lock_file, GetLockTimeout());
+    MIOPEN_VALIDATE_LOCK(lock);
+
+    MIOPEN_LOG_I2("Looking for " << keys.size() << " keys in file " << filename);
+
+    std::ifstream file(filename);
+
+    if(!file)
+    {
+        if(warn_if_unreadable)
+            MIOPEN_LOG_W("File is unreadable: " << filename);
+        else
+            MIOPEN_LOG_I2("File is unreadable: " << filename);
+
+        return records;
+    }
+
+    const auto wanted = std::unordered_set<std::string>(keys.begin(), keys.end());
+    auto line         = std::string{};
+    int n_line        = 0;
+
+    // Like FindRecordUnsafe(), the first line of a key is used.
+    while(records.size() < wanted.size() && std::getline(file, line))
+    {
+        ++n_line;
+
+        const auto key_size = line.find('=');
+        const bool is_key   = (key_size != std::string::npos && key_size != 0);
+        if(!is_key)
+        {
+            if(!line.empty()) // Do not blame empty lines.
+            {
+                MIOPEN_LOG_E("Ill-formed record: key not found: " << filename << "#" << n_line);
+            }
+            continue;
+        }
+
+        auto key = line.substr(0, key_size);
+        if(wanted.find(key) == wanted.end() || records.find(key) != records.end())
+            continue;
+
+        const auto contents = line.substr(key_size + 1);
+        if(contents.empty())
+        {
+            MIOPEN_LOG_E("None contents under the key: " << key << " form file " << filename << "#"
+                                                         << n_line);
+            continue;
+        }
+
+        DbRecord record(key);
+        if(!record.ParseContents(contents))
+        {
+            MIOPEN_LOG_E("Error parsing payload under the key: " << key << " form file "
+                                                                 << filename
+                                                                 << "#"
+                                                                 << n_line);
+            MIOPEN_LOG_E("Contents: " << contents);
+        }
+        records.emplace(std::move(key), std::move(record));
+    }
+
+    return records;
+}
+
 static void Copy(std::istream& from, std::ostream& to, std::streamoff count)
 {
     constexpr auto buffer_size_limit = 4 * 1024 * 1024;
@@ -0,0 +1,435 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_compact.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/db.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/find_planner.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/perf_field.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/stringutils.hpp>
+
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+namespace miopen {
+
+namespace fs = boost::filesystem;
+
+namespace {
+
+using Entries = std::map<std::string, std::string>; // ID -> VALUES
+using Records = std::map<std::string, Entries>;     // KEY -> entries
+
+boost::optional<ConvolutionContext> MakeContext(Handle& handle, const std::string& key)
+{
+    std::vector<conv::ProblemDescription> problems;
+    try
+    {
+        problems = ParseFindPlanLine(key);
+    }
+    catch(const Exception& ex)
+    {
+        MIOPEN_LOG_I2("Not checked: " << key << ": " << ex.what());
+        return boost::none;
+    }
+    if(problems.size() != 1)
+        return boost::none;
+
+    auto ctx                    = ConvolutionContext{ProblemDescription{problems.front()}};
+    ctx.do_search               = false;
+    ctx.general_compile_options = "";
+    ctx.SetStream(&handle);
+    ctx.DetectRocm();
+    ctx.SetupFloats();
+    return ctx;
+}
+
+void Count(DbCompactResult& result, DbEntryCheck check)
+{
+    switch(check)
+    {
+    case DbEntryCheck::Valid: break;
+    case DbEntryCheck::UnknownSolver: ++result.unknown_solvers; break;
+    case DbEntryCheck::InvalidValues: ++result.invalid_values; break;
+    }
+}
+
+// Checked records of the file. Like PlainTextDb::FindRecord() only the first record with a key
+// is used.
+Records ReadTextDb(const std::string& path, const DbEntryChecker& check, DbCompactResult& result)
+{
+    std::ifstream file{path};
+    if(!file)
+        MIOPEN_THROW("Cannot open " + path);
+
+    Records records;
+    std::string line;
+    while(std::getline(file, line))
+    {
+        if(line.empty())
+            continue;
+        const auto equals = line.find('=');
+        if(equals == 0 || equals == std::string::npos)
+        {
+            ++result.malformed;
+            continue;
+        }
+
+        const auto key = line.substr(0, equals);
+        Entries entries;
+        std::istringstream contents{line.substr(equals + 1)};
+        std::string pair;
+        while(std::getline(contents, pair, ';'))
+        {
+            const auto colon = pair.find(':');
+            if(colon == 0 || colon == std::string::npos)
+                ++result.malformed;
+            else if(!entries.emplace(pair.substr(0, colon), pair.substr(colon + 1)).second)
+                ++result.shadowed;
+        }
+
+        if(records.count(key) != 0)
+        {
+            result.shadowed += entries.size();
+            continue;
+        }
+        for(auto it = entries.begin(); it != entries.end();)
+        {
+            const auto status = check(key, it->first, it->second);
+            Count(result, status);
+            it = status == DbEntryCheck::Valid ? std::next(it) : entries.erase(it);
+        }
+        records.emplace(key, std::move(entries));
+    }
+    return records;
+}
+
+void WriteTextDb(const std::string& path, const Records& records)
+{
+    const auto directory = fs::absolute(path).parent_path();
+    fs::create_directories(directory);
+    // Readers see either the old or the new file.
+    const auto temp = directory / fs::unique_path(fs::path{path}.filename().string() +
+                                                  "-%%%%-%%%%-%%%%.tmp");
+    {
+        std::ofstream file{temp.string()};
+        for(const auto& record : records)
+        {
+            file << record.first << '=';
+            auto first = true;
+            for(const auto& entry : record.second)
+            {
+                file << (first ? "" : ";") << entry.first << ':' << entry.second;
+                first = false;
+            }
+            file << '\n';
+        }
+        if(!file.flush())
+        {
+            fs::remove(temp);
+            MIOPEN_THROW("Cannot write " + temp.string());
+        }
+    }
+    fs::rename(temp, path);
+}
+
+std::uintmax_t GetTotalSize(const std::string& path, const std::vector<std::string>& merge)
+{
+    auto size = fs::exists(path) ? fs::file_size(path) : 0;
+    for(const auto& other : merge)
+        size += fs::file_size(other);
+    return size;
+}
+
+} // namespace
+
+DbEntryChecker MakePerfDbChecker(Handle* handle)
+{
+    // The entries of a record are checked one after another, so the context of the last key is
+    // reused.
+    auto last_key = std::make_shared<std::string>();
+    auto context  = std::make_shared<boost::optional<ConvolutionContext>>();
+    return [=](const std::string& key, const std::string& id, const std::string& values) {
+        const auto solver_id = solver::Id{id};
+        if(!solver_id.IsValid())
+            return DbEntryCheck::UnknownSolver;
+        if(handle == nullptr || key.empty())
+            return DbEntryCheck::Valid;
+
+        if(key != *last_key)
+        {
+            *last_key = key;
+            *context  = MakeContext(*handle, key);
+        }
+        const auto solver = solver_id.GetSolver();
+        if(!*context || solver.IsEmpty())
+            return DbEntryCheck::Valid;
+        return solver.TestPerfDbValues(**context, values) ? DbEntryCheck::Valid
+                                                          : DbEntryCheck::InvalidValues;
+    };
+}
+
+DbEntryChecker MakeFindDbChecker()
+{
+    return [](const std::string&, const std::string&, const std::string& values) {
+        FindDbData data;
+        if(!data.Deserialize(values))
+            return DbEntryCheck::InvalidValues;
+        return solver::Id{data.solver_id}.IsValid() ? DbEntryCheck::Valid
+                                                    : DbEntryCheck::UnknownSolver;
+    };
+}
+
+DbCompactResult CompactTextDb(const std::string& path,
+                              const std::vector<std::string>& merge,
+                              const std::string& output,
+                              bool merge_records,
+                              const DbEntryChecker& check,
+                              bool dry_run)
+{
+    DbCompactResult result;
+    result.size_before = GetTotalSize(path, merge);
+
+    // Processes using the output db wait until it is replaced.
+    auto& lock_file = LockFile::Get(LockFilePath(output).c_str());
+    std::unique_lock<LockFile> lock{lock_file, std::defer_lock};
+    if(!dry_run && !lock.try_lock_for(std::chrono::seconds{60}))
+        MIOPEN_THROW("Db lock has failed to lock.");
+
+    // The db with the highest priority is read first.
+    Records records;
+    for(auto i = merge.size() + 1; i-- > 0;)
+    {
+        const bool merged  = i > 0;
+        const auto& source = merged ? merge[i - 1] : path;
+        if(!merged && !fs::exists(source))
+            continue;
+
+        for(auto& record : ReadTextDb(source, check, result))
+        {
+            if(record.second.empty())
+                continue;
+            const auto count = record.second.size();
+            const auto found = records.find(record.first);
+            if(found == records.end())
+            {
+                records.emplace(record.first, std::move(record.second));
+                result.merged += merged ? count : 0;
+            }
+            else if(!merge_records)
+            {
+                result.shadowed += count;
+            }
+            else
+            {
+                for(auto& entry : record.second)
+                {
+                    if(found->second.insert(entry).second)
+                        result.merged += merged ? 1 : 0;
+                    else
+                        ++result.shadowed;
+                }
+            }
+        }
+    }
+
+    result.records = records.size();
+    for(const auto& record : records)
+    {
+        result.entries += record.second.size();
+        // KEY=ID:VALUES;ID:VALUES\n
+        result.size_after += record.first.size() + 1;
+        for(const auto& entry : record.second)
+            result.size_after += entry.first.size() + entry.second.size() + 2;
+    }
+    if(!dry_run)
+        WriteTextDb(output, records);
+    return result;
+}
+
+std::vector<std::string> GetTextDbKeys(const std::string& path)
+{
+    std::ifstream file{path};
+    if(!file)
+        MIOPEN_THROW("Cannot open " + path);
+
+    std::vector<std::string> keys;
+    std::string line;
+    while(std::getline(file, line))
+    {
+        const auto equals = line.find('=');
+        if(equals != 0 && equals != std::string::npos)
+            keys.push_back(line.substr(0, equals));
+    }
+    return keys;
+}
+
+double MeasureTextDbLookups(const std::string& path, const std::vector<std::string>& keys)
+{
+    if(keys.empty())
+        return 0;
+    PlainTextDb db{path, true};
+    const auto start = std::chrono::steady_clock::now();
+    for(const auto& key : keys)
+        db.FindRecord(key);
+    const auto time = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>{time}.count() / keys.size();
+}
+
+bool IsSQLiteDb(const std::string& path)
+{
+    static const std::string header{"SQLite format 3\0", 16};
+    std::ifstream file{path, std::ios::binary};
+    std::string start(header.size(), '\0');
+    return file.read(&start[0], start.size()) && start == header;
+}
+
+#if MIOPEN_ENABLE_SQLITE
+namespace {
+
+std::string Quote(const std::string& value)
+{
+    std::string quoted = "'";
+    for(const auto c : value)
+        quoted += c == '\'' ? std::string{"''"} : std::string{c};
+    return quoted + "'";
+}
+
+std::vector<std::string> GetConfigColumns(const SQLite& sql, const std::string& schema)
+{
+    std::vector<std::string> columns;
+    for(const auto& row : sql.Exec("PRAGMA " + schema + ".table_info(config);"))
+    {
+        if(row.at("name") != "id")
+            columns.push_back(row.at("name"));
+    }
+    std::sort(columns.begin(), columns.end());
+    return columns;
+}
+
+std::size_t CountRows(const SQLite& sql, const std::string& table)
+{
+    return std::stoul(sql.Exec("SELECT COUNT(*) AS count FROM " + table + ";").front().at("count"));
+}
+
+} // namespace
+
+DbCompactResult CompactSQLitePerfDb(const std::string& path,
+                                    const std::vector<std::string>& merge,
+                                    const std::string& output,
+                                    const DbEntryChecker& check,
+                                    bool dry_run)
+{
+    DbCompactResult result;
+    result.size_before = GetTotalSize(path, merge);
+
+    // Dry runs work on a copy.
+    const auto target =
+        dry_run ? fs::temp_directory_path() / fs::unique_path("miopen-db-compact-%%%%-%%%%.db")
+                : fs::path{output};
+    if(!fs::exists(target) || !fs::equivalent(path, target))
+        fs::copy_file(path, target, fs::copy_option::overwrite_if_exists);
+
+    {
+        const SQLite sql{target.string(), false};
+        if(!sql.Valid())
+            MIOPEN_THROW("Cannot open " + target.string());
+        const auto columns = GetConfigColumns(sql, "main");
+        if(columns.empty())
+            MIOPEN_THROW("Not a perf-db: " + path);
+
+        std::vector<std::string> matches;
+        for(const auto& column : columns)
+            matches.push_back("c.`" + column + "` = m.`" + column + "`");
+        const auto column_list = "`" + JoinStrings(columns, "`,`") + "`";
+
+        // Later dbs replace the entries of earlier ones.
+        for(const auto& other : merge)
+        {
+            sql.Exec("ATTACH DATABASE " + Quote(other) + " AS merged;");
+            if(GetConfigColumns(sql, "merged") != columns)
+            {
+                sql.Exec("DETACH DATABASE merged;");
+                MIOPEN_THROW("The config tables of " + path + " and " + other + " differ");
+            }
+            // clang-format off
+            sql.Exec(
+                "BEGIN;"
+                "INSERT OR IGNORE INTO config(" + column_list + ") "
+                "SELECT " + column_list + " FROM merged.config;"
+                "INSERT OR REPLACE INTO perf_db(config, solver, params, arch, num_cu) "
+                "SELECT c.id, p.solver, p.params, p.arch, p.num_cu "
+                "FROM merged.perf_db AS p "
+                "INNER JOIN merged.config AS m ON p.config = m.id "
+                "INNER JOIN config AS c ON " + JoinStrings(matches, " AND ") + ";");
+            // clang-format on
+            result.merged += sql.Changes();
+            sql.Exec("COMMIT;");
+            sql.Exec("DETACH DATABASE merged;");
+        }
+
+        std::vector<std::string> rejected;
+        for(const auto& row : sql.Exec("SELECT id, solver, params FROM perf_db;"))
+        {
+            const auto status = check("", row.at("solver"), row.at("params"));
+            Count(result, status);
+            if(status != DbEntryCheck::Valid)
+                rejected.push_back(row.at("id"));
+        }
+        if(!rejected.empty())
+            sql.Exec("DELETE FROM perf_db WHERE id IN (" + JoinStrings(rejected, ",") + ");");
+        sql.Exec("DELETE FROM config WHERE id NOT IN (SELECT config FROM perf_db);");
+
+        result.records = CountRows(sql, "config");
+        result.entries = CountRows(sql, "perf_db");
+        sql.Exec("VACUUM;");
+    }
+
+    result.size_after = fs::file_size(target);
+    if(dry_run)
+        fs::remove(target);
+    return result;
+}
+#endif
+
+} // namespace miopen
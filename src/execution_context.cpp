@@ -26,6 +26,7 @@
 
 #include <miopen/execution_context.hpp>
 
+#include <miopen/context_cache.hpp>
 #include <miopen/gcn_asm_utils.hpp>
 #include <miopen/hip_build_utils.hpp>
 #include <miopen/stringutils.hpp>
@@ -37,6 +38,8 @@
 
 #include <miopen/env.hpp>
 
+#include <mutex>
+
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_OPENCL_CONVOLUTIONS)
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_GCN_ASM_KERNELS)
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_HIP_KERNELS)
@@ -211,6 +214,31 @@ static bool IsHipKernelsEnabled()
 }
 
 void miopen::ExecutionContext::DetectRocm()
+{
+    if(stream == nullptr)
+    {
+        DetectEnvironment();
+        return;
+    }
+
+    auto& cache = stream->GetContextCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.DropStale();
+    if(!cache.environment)
+    {
+        DetectEnvironment();
+        cache.environment = *this;
+        return;
+    }
+    const auto& environment = *cache.environment;
+    use_binaries            = environment.use_binaries;
+    use_asm_kernels         = environment.use_asm_kernels;
+    use_hip_kernels         = environment.use_hip_kernels;
+    use_opencl_convolutions = environment.use_opencl_convolutions;
+    rmv                     = environment.rmv;
+}
+
+void miopen::ExecutionContext::DetectEnvironment()
 {
     use_binaries            = false;
     use_asm_kernels         = false;
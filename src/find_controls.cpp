@@ -32,6 +32,7 @@
 #include <ostream>
 #include <cstdlib>
 #include <cstring>
+#include <list>
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_FIND_ENFORCE)
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_FIND_ENFORCE_SCOPE)
@@ -92,8 +93,8 @@ FindEnforceAction GetFindEnforceActionImpl()
 
 FindEnforceAction GetFindEnforceAction()
 {
-    static const FindEnforceAction val = GetFindEnforceActionImpl();
-    return val;
+    static EnvCache<FindEnforceAction> cache;
+    return cache.Get(GetFindEnforceActionImpl);
 }
 
 const char* ToCString(const FindEnforceScope mode)
@@ -136,8 +137,8 @@ FindEnforceScope GetFindEnforceScopeImpl()
 
 FindEnforceScope GetFindEnforceScope()
 {
-    static const FindEnforceScope val = GetFindEnforceScopeImpl();
-    return val;
+    static EnvCache<FindEnforceScope> cache;
+    return cache.Get(GetFindEnforceScopeImpl);
 }
 
 solver::Id GetEnvFindOnlySolverImpl()
@@ -181,8 +182,13 @@ std::ostream& operator<<(std::ostream& os, const FindEnforce& val)
 
 solver::Id GetEnvFindOnlySolver()
 {
-    static const auto once = GetEnvFindOnlySolverImpl();
-    return once;
+    // Looking the id up in the registry again would cost more than the check it serves.
+    static EnvCache<const solver::Id*> cache;
+    static std::list<solver::Id> ids;
+    return *cache.Get([] {
+        ids.push_back(GetEnvFindOnlySolverImpl());
+        return &ids.back();
+    });
 }
 
 namespace {
@@ -240,8 +246,8 @@ FindMode::Values GetFindModeValueImpl()
 
 FindMode::Values GetFindModeValue()
 {
-    static const FindMode::Values val = GetFindModeValueImpl();
-    return val;
+    static EnvCache<FindMode::Values> cache;
+    return cache.Get(GetFindModeValueImpl);
 }
 
 } // namespace
@@ -31,7 +31,11 @@
 #include <miopen/logger.hpp>
 #include <miopen/perf_field.hpp>
 
+#include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace miopen {
@@ -62,6 +66,88 @@ std::string FindDbRecord_t<TDb>::GetUserPath(Handle& handle)
 #endif
 }
 
+/// Records loaded by FindDbRecord::Prefetch(). The problems are keyed by the installed and the
+/// user find-db paths first, none marks a problem that has no record in the files.
+struct PrefetchedFindDb
+{
+    using Records = std::unordered_map<std::string, boost::optional<DbRecord>>;
+
+    std::mutex mutex;
+    std::map<std::pair<std::string, std::string>, Records> files;
+};
+
+static PrefetchedFindDb& GetPrefetchedFindDb()
+{
+    static PrefetchedFindDb data;
+    return data;
+}
+
+template <class TDb>
+std::size_t FindDbRecord_t<TDb>::PrefetchKeys(Handle& handle, const std::vector<std::string>& keys)
+{
+    if(!testing_find_db_enabled || IsEnabled(MIOPEN_DEBUG_DISABLE_FIND_DB{}))
+        return 0;
+
+    const auto& path_override = testing_find_db_path_override();
+    const auto user_path      = path_override ? *path_override : GetUserPath(handle);
+    const auto installed_path = path_override ? *path_override : GetInstalledPath(handle);
+
+    auto found   = DbTimer<FindDb>{installed_path, user_path, "", 0}.FindRecords(keys);
+    auto records = PrefetchedFindDb::Records{};
+    for(const auto& key : keys)
+    {
+        const auto it = found.find(key);
+        if(it == found.end())
+            records.emplace(key, boost::none);
+        else
+            records.emplace(key, it->second);
+    }
+
+    MIOPEN_LOG_I("Prefetched " << found.size() << " records of " << records.size()
+                               << " problems from "
+                               << installed_path
+                               << " and "
+                               << user_path);
+
+    auto& prefetched = GetPrefetchedFindDb();
+    const std::lock_guard<std::mutex> lock{prefetched.mutex};
+    auto& file_records = prefetched.files[{installed_path, user_path}];
+    for(auto& record : records)
+        file_records[record.first] = std::move(record.second);
+    return found.size();
+}
+
+template <class TDb>
+void FindDbRecord_t<TDb>::DropPrefetched(const std::string& user_path, const std::string& key)
+{
+    auto& prefetched = GetPrefetchedFindDb();
+    const std::lock_guard<std::mutex> lock{prefetched.mutex};
+    for(auto& file : prefetched.files)
+        if(file.first.second == user_path)
+            file.second.erase(key);
+}
+
+template <class TDb>
+bool FindDbRecord_t<TDb>::LoadPrefetched(const std::string& key)
+{
+    auto& prefetched = GetPrefetchedFindDb();
+    const std::lock_guard<std::mutex> lock{prefetched.mutex};
+    if(prefetched.files.empty())
+        return false;
+
+    const auto file = prefetched.files.find({installed_path, path});
+    if(file == prefetched.files.end())
+        return false;
+    const auto record = file->second.find(key);
+    if(record == file->second.end())
+        return false;
+
+    MIOPEN_LOG_I2("Prefetched find-db record of " << key);
+    content = record->second;
+    in_sync = content.is_initialized();
+    return true;
+}
+
 bool CheckInvokerSupport(const std::string& algo)
 {
     return algo == "miopenConvolutionFwdAlgoDirect" ||
@@ -0,0 +1,547 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/find_planner.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/problem_description.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <utility>
+
+namespace miopen {
+
+namespace {
+
+const std::vector<std::string>& DriverConvCommands()
+{
+    static const std::vector<std::string> commands = {
+        "conv", "convfp16", "convbfp16", "convint8"};
+    return commands;
+}
+
+// Flags of ConvDriver::AddCmdLineArgs() that describe the problem, with their defaults.
+struct DriverFlag
+{
+    const char* name;
+    char short_name;
+    const char* value;
+};
+
+const std::vector<DriverFlag>& DriverConvFlags()
+{
+    static const std::vector<DriverFlag> flags = {
+        {"spatial_dim", '_', "2"},        {"forw", 'F', "0"},
+        {"batchsize", 'n', "100"},        {"in_channels", 'c', "3"},
+        {"in_d", '!', "32"},              {"in_h", 'H', "32"},
+        {"in_w", 'W', "32"},              {"out_channels", 'k', "32"},
+        {"fil_d", '@', "3"},              {"fil_h", 'y', "3"},
+        {"fil_w", 'x', "3"},              {"conv_stride_d", '#', "1"},
+        {"conv_stride_h", 'u', "1"},      {"conv_stride_w", 'v', "1"},
+        {"pad_d", '$', "0"},              {"pad_h", 'p', "0"},
+        {"pad_w", 'q', "0"},              {"trans_output_pad_d", '%', "0"},
+        {"trans_output_pad_h", 'Y', "0"}, {"trans_output_pad_w", 'X', "0"},
+        {"dilation_d", '^', "1"},         {"dilation_h", 'l', "1"},
+        {"dilation_w", 'j', "1"},         {"group_count", 'g', "1"},
+        {"mode", 'm', "conv"},            {"pad_mode", 'z', "default"},
+    };
+    return flags;
+}
+
+int ToInt(const std::string& value)
+{
+    std::size_t end = 0;
+    int result      = 0;
+    try
+    {
+        result = std::stoi(value, &end);
+    }
+    catch(const std::exception&)
+    {
+        end = 0;
+    }
+    if(end == 0 || end != value.size())
+        MIOPEN_THROW(miopenStatusBadParm, "Not a number: " + value);
+    return result;
+}
+
+std::vector<std::string> Split(const std::string& value, char delim)
+{
+    std::vector<std::string> result;
+    std::istringstream ss(value);
+    std::string item;
+    while(std::getline(ss, item, delim))
+        result.push_back(item);
+    return result;
+}
+
+std::vector<int> SplitInts(const std::string& value, char delim)
+{
+    std::vector<int> result;
+    for(const auto& item : Split(value, delim))
+        result.push_back(ToInt(item));
+    return result;
+}
+
+bool AllOnes(const std::vector<int>& values)
+{
+    return std::all_of(values.begin(), values.end(), [](int v) { return v == 1; });
+}
+
+miopenDataType_t ParseDataTypeName(const std::string& encoded, std::size_t& pos)
+{
+    // Longer names first, INT8 is a prefix of INT8x4.
+    for(const auto type :
+        {miopenInt8x4, miopenInt32, miopenInt8, miopenFloat, miopenHalf, miopenBFloat16})
+    {
+        const auto name = GetDataTypeName(type);
+        if(encoded.compare(pos, name.size(), name) == 0)
+        {
+            pos += name.size();
+            return type;
+        }
+    }
+    MIOPEN_THROW(miopenStatusBadParm, "Unknown data types: " + encoded);
+}
+
+// Reverse of EncodeDataTypesForKey().
+std::vector<miopenDataType_t> ParseDataTypesForKey(const std::string& encoded)
+{
+    std::vector<miopenDataType_t> types;
+    std::size_t pos = 0;
+    while(pos < encoded.size())
+        types.push_back(ParseDataTypeName(encoded, pos));
+    if(types.size() == 1)
+        return {types[0], types[0], types[0]};
+    if(types.size() != 3)
+        MIOPEN_THROW(miopenStatusBadParm, "Unknown data types: " + encoded);
+    return types;
+}
+
+std::vector<std::size_t> MakeLengths(int n, int c, const std::vector<int>& spatial)
+{
+    std::vector<std::size_t> lengths = {static_cast<std::size_t>(n), static_cast<std::size_t>(c)};
+    for(const auto len : spatial)
+        lengths.push_back(len);
+    return lengths;
+}
+
+// C-H-W-YxX-K-oH-oW-N-PxQ-UxV-LxJ-bias-NCHW-FP32-F[_gN], see conv::ProblemDescription::Serialize.
+// 3D keys have a depth in front of each spatial group.
+std::vector<conv::ProblemDescription> ParseFindDbKey(const std::string& line)
+{
+    auto fields = Split(line, '-');
+    if(fields.size() != 15 && fields.size() != 17)
+        MIOPEN_THROW(miopenStatusBadParm, "Not a find-db key: " + line);
+    const std::size_t spatial_dims = fields.size() == 15 ? 2 : 3;
+
+    int group_count       = 1;
+    auto& direction_field = fields.back();
+    const auto optional   = direction_field.find('_');
+    if(optional != std::string::npos)
+    {
+        const auto groups = direction_field.substr(optional + 1);
+        if(!StartsWith(groups, "g"))
+            MIOPEN_THROW(miopenStatusBadParm, "Unknown key suffix: " + line);
+        group_count = ToInt(groups.substr(1));
+        direction_field.erase(optional);
+    }
+
+    conv::Direction direction;
+    if(direction_field == "F")
+        direction = conv::Direction::Forward;
+    else if(direction_field == "B")
+        direction = conv::Direction::BackwardData;
+    else if(direction_field == "W")
+        direction = conv::Direction::BackwardWeights;
+    else
+        MIOPEN_THROW(miopenStatusBadParm, "Unknown direction: " + line);
+
+    std::size_t i        = 0;
+    const auto next_dims = [&] {
+        std::vector<int> dims;
+        for(std::size_t d = 0; d < spatial_dims; d++)
+            dims.push_back(ToInt(fields[i++]));
+        return dims;
+    };
+    const auto next_group = [&] {
+        const auto dims = SplitInts(fields[i++], 'x');
+        if(dims.size() != spatial_dims)
+            MIOPEN_THROW(miopenStatusBadParm, "Wrong number of dimensions: " + line);
+        return dims;
+    };
+
+    const int in_c       = ToInt(fields[i++]);
+    const auto in_dims   = next_dims();
+    const auto filter    = next_group();
+    const int out_c      = ToInt(fields[i++]);
+    const auto out_dims  = next_dims();
+    const int batch      = ToInt(fields[i++]);
+    const auto pads      = next_group();
+    const auto strides   = next_group();
+    const auto dilations = next_group();
+    const int bias       = ToInt(fields[i++]);
+    if(fields[i++] != "NCHW")
+        MIOPEN_THROW(miopenStatusBadParm, "Only NCHW problems are supported: " + line);
+    const auto types = ParseDataTypesForKey(fields[i++]);
+
+    if(group_count < 1 || in_c % group_count != 0 || out_c % group_count != 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Invalid group count: " + line);
+
+    // The weights keep their forward layout, the channels of the key follow the direction.
+    const bool forward   = direction == conv::Direction::Forward;
+    const int weights_k  = forward ? out_c : in_c;
+    const int weights_c  = (forward ? in_c : out_c) / group_count;
+    const auto in        = TensorDescriptor{types[0], MakeLengths(batch, in_c, in_dims)};
+    const auto weights   = TensorDescriptor{types[1], MakeLengths(weights_k, weights_c, filter)};
+    const auto out       = TensorDescriptor{types[2], MakeLengths(batch, out_c, out_dims)};
+    const auto trans_pad = std::vector<int>(spatial_dims, 0);
+    const auto conv      = ConvolutionDescriptor{spatial_dims,
+                                                 miopenConvolution,
+                                                 miopenPaddingDefault,
+                                                 pads,
+                                                 strides,
+                                                 dilations,
+                                                 trans_pad,
+                                                 group_count};
+
+    return {conv::ProblemDescription{in, weights, out, conv, direction, bias}};
+}
+
+std::vector<conv::ProblemDescription> ParseDriverCommand(const std::vector<std::string>& args)
+{
+    const auto& commands = DriverConvCommands();
+    const auto command   = std::find_first_of(
+        args.begin(), args.end(), commands.begin(), commands.end());
+    if(command == args.end())
+        MIOPEN_THROW(miopenStatusBadParm, "Not a convolution command line");
+
+    const auto& flags = DriverConvFlags();
+    std::map<std::string, std::string> values;
+    for(const auto& flag : flags)
+        values[flag.name] = flag.value;
+
+    for(auto arg = std::next(command); arg != args.end(); ++arg)
+    {
+        std::string name;
+        if(StartsWith(*arg, "--"))
+        {
+            name = arg->substr(2);
+        }
+        else if(arg->size() == 2 && (*arg)[0] == '-')
+        {
+            const auto flag = std::find_if(
+                flags.begin(), flags.end(), [&](auto&& f) { return f.short_name == (*arg)[1]; });
+            // Flags that do not change the problem, like -t or -V.
+            name = flag != flags.end() ? flag->name : "";
+        }
+        else
+        {
+            MIOPEN_THROW(miopenStatusBadParm, "Unexpected argument: " + *arg);
+        }
+
+        if(std::next(arg) == args.end())
+            MIOPEN_THROW(miopenStatusBadParm, "Missing value of " + *arg);
+        ++arg;
+        if(values.count(name) != 0)
+            values[name] = *arg;
+    }
+
+    const auto get = [&](const std::string& name) { return ToInt(values.at(name)); };
+
+    const int spatial_dims = get("spatial_dim");
+    if(spatial_dims != 2 && spatial_dims != 3)
+        MIOPEN_THROW(miopenStatusBadParm, "Unsupported convolution dimension");
+
+    const auto get_dims = [&](const std::string& d, const std::string& h, const std::string& w) {
+        return spatial_dims == 2 ? std::vector<int>{get(h), get(w)}
+                                 : std::vector<int>{get(d), get(h), get(w)};
+    };
+
+    const auto in_spatial = get_dims("in_d", "in_h", "in_w");
+    const auto filter     = get_dims("fil_d", "fil_h", "fil_w");
+    const auto strides    = get_dims("conv_stride_d", "conv_stride_h", "conv_stride_w");
+    const auto dilations  = get_dims("dilation_d", "dilation_h", "dilation_w");
+    const auto trans_pads =
+        get_dims("trans_output_pad_d", "trans_output_pad_h", "trans_output_pad_w");
+    auto pads = get_dims("pad_d", "pad_h", "pad_w");
+
+    const int in_c        = get("in_channels");
+    const int out_c       = get("out_channels");
+    const int group_count = std::max(get("group_count"), 1);
+    if(in_c % group_count != 0 || out_c % group_count != 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Invalid group number");
+
+    miopenConvolutionMode_t mode;
+    if(values.at("mode") == "conv")
+        mode = miopenConvolution;
+    else if(values.at("mode") == "trans")
+        mode = miopenTranspose;
+    else
+        MIOPEN_THROW(miopenStatusBadParm, "Incorrect Convolution Mode");
+
+    // Same adjustment as ConvDriver::SetConvDescriptorFromCmdLineArgs().
+    if(mode == miopenConvolution && (AllOnes(dilations) || AllOnes(filter)))
+    {
+        if(values.at("pad_mode") == "same")
+        {
+            for(int i = 0; i < spatial_dims; ++i)
+            {
+                pads[i] = (in_spatial[i] % strides[i] == 0)
+                              ? std::max(filter[i] - strides[i], 0)
+                              : std::max(filter[i] - (in_spatial[i] % strides[i]), 0);
+                pads[i] /= 2;
+            }
+        }
+        else if(values.at("pad_mode") == "valid")
+        {
+            std::fill(pads.begin(), pads.end(), 0);
+        }
+    }
+
+    miopenDataType_t data_type = miopenFloat;
+    if(*command == "convfp16")
+        data_type = miopenHalf;
+    else if(*command == "convbfp16")
+        data_type = miopenBFloat16;
+    else if(*command == "convint8")
+        data_type = miopenInt8;
+    const auto out_type = data_type == miopenInt8 ? miopenFloat : data_type;
+
+    const auto conv = ConvolutionDescriptor{static_cast<std::size_t>(spatial_dims),
+                                            mode,
+                                            miopenPaddingDefault,
+                                            pads,
+                                            strides,
+                                            dilations,
+                                            trans_pads,
+                                            group_count};
+
+    const auto in = TensorDescriptor{data_type, MakeLengths(get("batchsize"), in_c, in_spatial)};
+    const auto weights =
+        mode == miopenTranspose
+            ? TensorDescriptor{data_type, MakeLengths(in_c, out_c / group_count, filter)}
+            : TensorDescriptor{data_type, MakeLengths(out_c, in_c / group_count, filter)};
+    const auto out = conv.GetForwardOutputTensor(in, weights, out_type);
+
+    int directions = get("forw");
+    if(directions == 0)
+        directions = 1 | 2 | 4;
+    // Only the forward direction is supported for int8.
+    if(data_type == miopenInt8)
+        directions &= 1;
+
+    // The library solves a transposed forward convolution as the backward data convolution
+    // from the output to the input and vice versa, see miopenFindConvolutionForwardAlgorithm().
+    const bool trans = mode == miopenTranspose;
+    std::vector<conv::ProblemDescription> problems;
+    if((directions & 1) != 0)
+    {
+        if(trans)
+            problems.emplace_back(in, weights, out, conv, conv::Direction::BackwardData);
+        else
+            problems.emplace_back(in, weights, out, conv, conv::Direction::Forward);
+    }
+    if((directions & 2) != 0)
+    {
+        if(trans)
+            problems.emplace_back(out, weights, in, conv, conv::Direction::Forward);
+        else
+            problems.emplace_back(out, weights, in, conv, conv::Direction::BackwardData);
+    }
+    if((directions & 4) != 0)
+    {
+        if(trans)
+            problems.emplace_back(in, weights, out, conv, conv::Direction::BackwardWeights);
+        else
+            problems.emplace_back(out, weights, in, conv, conv::Direction::BackwardWeights);
+    }
+    return problems;
+}
+
+} // namespace
+
+std::vector<conv::ProblemDescription> ParseFindPlanLine(const std::string& line)
+{
+    const auto args = SplitSpaceSeparated(line);
+    if(args.size() == 1)
+        return ParseFindDbKey(args[0]);
+    return ParseDriverCommand(args);
+}
+
+std::string GetFindPlanKey(const conv::ProblemDescription& problem)
+{
+    std::string key;
+    problem.BuildConfKey(key);
+    // The key does not tell the backward directions apart.
+    return key + 'x' + std::to_string(static_cast<int>(problem.GetDirection()));
+}
+
+void FindPlan::Add(const conv::ProblemDescription& problem)
+{
+    auto key = GetFindPlanKey(problem);
+    ++total;
+
+    const auto it = index.find(key);
+    if(it != index.end())
+    {
+        ++problems[it->second].uses;
+        return;
+    }
+
+    index.emplace(key, problems.size());
+    problems.push_back({problem, std::move(key), 1});
+}
+
+FindPlan ReadFindPlan(std::istream& input)
+{
+    FindPlan plan;
+    std::string line;
+    for(std::size_t line_number = 1; std::getline(input, line); line_number++)
+    {
+        const auto args = SplitSpaceSeparated(line);
+        if(args.empty() || StartsWith(args.front(), "#"))
+            continue;
+
+        try
+        {
+            for(const auto& problem : ParseFindPlanLine(line))
+                plan.Add(problem);
+        }
+        catch(const Exception& ex)
+        {
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "Line " + std::to_string(line_number) + ": " + ex.what());
+        }
+    }
+    return plan;
+}
+
+std::vector<solver::ConvSolution> FindPlanJobs::GetAllSolutions() const
+{
+    std::vector<solver::ConvSolution> all;
+    for(const auto& problem_solutions : solutions)
+        all.insert(all.end(), problem_solutions.begin(), problem_solutions.end());
+    return all;
+}
+
+FindPlanJobs MakeFindPlanJobs(const FindPlan& plan, const FindPlanEnumerator& enumerate)
+{
+    FindPlanJobs jobs;
+    std::map<std::pair<std::string, std::string>, std::size_t> program_index;
+
+    for(std::size_t i = 0; i < plan.problems.size(); i++)
+    {
+        auto problem_solutions = enumerate(plan.problems[i].problem);
+        for(const auto& solution : problem_solutions)
+        {
+            if(!solution.Succeeded())
+                continue;
+            for(const auto& kernel : solution.construction_params)
+            {
+                const auto inserted = program_index.emplace(
+                    std::make_pair(kernel.kernel_file, kernel.comp_options), jobs.programs.size());
+                if(inserted.second)
+                    jobs.programs.push_back({kernel, {}});
+
+                auto& users = jobs.programs[inserted.first->second].problems;
+                if(users.empty() || users.back() != i)
+                    users.push_back(i);
+            }
+        }
+        jobs.solutions.push_back(std::move(problem_solutions));
+    }
+
+    return jobs;
+}
+
+namespace {
+
+template <class F>
+std::vector<solver::ConvSolution> TryFindSolutions(F f)
+{
+    try
+    {
+        return f();
+    }
+    catch(const Exception& ex)
+    {
+        MIOPEN_LOG_W(ex.what());
+        return {};
+    }
+}
+
+void Append(std::vector<solver::ConvSolution>& to, const std::vector<solver::ConvSolution>& from)
+{
+    to.insert(to.end(), from.begin(), from.end());
+}
+
+} // namespace
+
+std::vector<solver::ConvSolution> FindPlanSolutions(Handle& handle,
+                                                    const conv::ProblemDescription& problem)
+{
+    const auto direction = problem.GetDirection();
+    const auto& conv     = problem.GetConv();
+
+    auto ctx                    = ConvolutionContext{ProblemDescription{problem}};
+    ctx.do_search               = false;
+    ctx.save_srch_req           = true;
+    ctx.general_compile_options = "";
+    ctx.SetStream(&handle);
+    ctx.DetectRocm();
+    ctx.SetupFloats();
+
+    std::vector<solver::ConvSolution> all;
+    if(direction == conv::Direction::BackwardWeights)
+    {
+        Append(all, TryFindSolutions([&] { return FindWinogradWrWAllSolutions(ctx); }));
+        Append(all, TryFindSolutions([&] { return FindAllBwdWrW2DSolutions(ctx); }));
+        Append(all, TryFindSolutions([&] { return FindImplicitGemmWrWAllSolutions(ctx); }));
+        return all;
+    }
+
+    const bool forward = direction == conv::Direction::Forward;
+    const auto& x      = forward ? problem.GetIn() : problem.GetOut();
+    const auto& w      = problem.GetWeights();
+    const auto& y      = forward ? problem.GetOut() : problem.GetIn();
+    const ConvolutionUserBuffers bufs;
+
+    Append(all, conv.FindWinogradSolutions(ctx));
+    Append(all, conv.FindDataDirectSolutions(handle, x, w, y, false, forward, bufs));
+    Append(all, conv.FindDataImplicitGemmSolutions(handle, x, w, y, false, forward, bufs));
+    if(forward)
+        Append(all, conv.FindSCGemmSolutions(handle, x, w, y, false, true, bufs));
+    return all;
+}
+
+} // namespace miopen
@@ -27,7 +27,10 @@
 #include <miopen/config.h>
 #include <miopen/handle.hpp>
 
+#include <miopen/async_programs.hpp>
 #include <miopen/binary_cache.hpp>
+#include <miopen/caching_allocator.hpp>
+#include <miopen/context_cache.hpp>
 #include <miopen/device_name.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/gemm_geometry.hpp>
@@ -52,7 +55,10 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <limits>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
 
 #define MIOPEN_WORKAROUND_ROCM_COMPILER_SUPPORT_ISSUE_30 MIOPEN_USE_COMGR
 
@@ -146,6 +152,10 @@ struct HandleImpl
     using StreamPtr = std::shared_ptr<typename std::remove_pointer<hipStream_t>::type>;
 
     HandleImpl() : ctx(get_ctx()) {}
+    HandleImpl(const std::string& device_name, std::size_t num_cu)
+        : ctx(nullptr), offline_device(device_name), offline_num_cu(num_cu)
+    {
+    }
 
     StreamPtr create_stream()
     {
@@ -183,9 +193,33 @@ struct HandleImpl
     StreamPtr stream       = nullptr;
     float profiling_result = 0.0;
     int device             = -1;
+    std::vector<std::unique_ptr<CachingAllocator>> pools;
     Allocator allocator{};
     KernelCache cache;
+#if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    // Programs loaded from the binary cache by blob, at most max_binary_programs of them.
+    static constexpr std::size_t max_binary_programs = 256;
+    std::mutex binary_mutex;
+    std::unordered_map<std::string, Program> binary_programs;
+
+    /// Programs with identical binaries share the blob and the loaded program.
+    template <class F>
+    Program GetBinaryProgram(const std::string& blob, F load)
+    {
+        std::lock_guard<std::mutex> lock(binary_mutex);
+        const auto program = binary_programs.find(blob);
+        if(program != binary_programs.end())
+            return program->second;
+        // The kernel cache keeps the evicted programs that are in use.
+        if(binary_programs.size() >= max_binary_programs)
+            binary_programs.erase(binary_programs.begin());
+        return binary_programs.emplace(blob, load()).first->second;
+    }
+#endif
     hipCtx_t ctx;
+    // Target of a handle that is not bound to a device, empty otherwise.
+    std::string offline_device;
+    std::size_t offline_num_cu = 0;
 };
 
 Handle::Handle(miopenAcceleratorQueue_t stream) : impl(new HandleImpl())
@@ -225,11 +259,21 @@ Handle::Handle() : impl(new HandleImpl())
     MIOPEN_LOG_NQI(*this);
 }
 
+Handle::Handle(const std::string& offline_device, std::size_t offline_num_cu)
+    : impl(new HandleImpl(GetDeviceNameFromMap(offline_device), offline_num_cu))
+{
+    this->impl->stream         = HandleImpl::reference_stream(nullptr);
+    m_MaxMemoryAllocSizeCached = std::numeric_limits<std::size_t>::max();
+    MIOPEN_LOG_NQI(*this);
+}
+
 Handle::~Handle() {}
 
 void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
 {
     this->impl->stream = HandleImpl::reference_stream(streamID);
+    if(!this->impl->pools.empty())
+        this->impl->pools.back()->SetStream(streamID);
 
 #if MIOPEN_USE_ROCBLAS
     rocblas_set_stream(this->rhandle_.get(), this->GetStream());
@@ -242,10 +286,10 @@ void Handle::SetAllocator(miopenAllocatorFunction allocator,
                           miopenDeallocatorFunction deallocator,
                           void* allocatorContext) const
 {
-    this->impl->allocator.allocator   = allocator == nullptr ? default_allocator : allocator;
-    this->impl->allocator.deallocator = deallocator == nullptr ? default_deallocator : deallocator;
-
-    this->impl->allocator.context = allocatorContext;
+    const Allocator upstream{allocator == nullptr ? default_allocator : allocator,
+                             deallocator == nullptr ? default_deallocator : deallocator,
+                             allocatorContext};
+    this->impl->allocator = MakeCachingAllocator(upstream, this->GetStream(), this->impl->pools);
 }
 
 void Handle::EnableProfiling(bool enable) const { this->impl->enable_profiling = enable; }
@@ -299,7 +343,7 @@ KernelInvoke Handle::AddKernel(const std::string& algorithm,
                                bool is_kernel_str,
                                const std::string& kernel_src) const
 {
-
+    this->AddAsyncPrograms();
     auto obj = this->impl->cache.AddKernel(*this,
                                            algorithm,
                                            network_config,
@@ -317,6 +361,7 @@ KernelInvoke Handle::AddKernel(const std::string& algorithm,
 Invoker Handle::PrepareInvoker(const InvokerFactory& factory,
                                const std::vector<solver::KernelInfo>& kernels) const
 {
+    this->AddAsyncPrograms();
     std::vector<Kernel> built;
     for(auto& k : kernels)
     {
@@ -369,6 +414,17 @@ Program Handle::LoadProgram(const std::string& program_name,
     params += " -mcpu=" + this->GetDeviceName();
     auto hsaco = miopen::LoadBinary(
         this->GetDeviceName(), this->GetMaxComputeUnits(), program_name, params, is_kernel_str);
+
+    // Other processes may be building the program, wait for them and look it up again.
+    BuildLease lease;
+    if(hsaco.empty())
+    {
+        lease =
+            miopen::LeaseBinaryBuild(this->GetDeviceName(), program_name, params, is_kernel_str);
+        hsaco = miopen::LoadBinary(
+            this->GetDeviceName(), this->GetMaxComputeUnits(), program_name, params, is_kernel_str);
+    }
+
     if(hsaco.empty())
     {
         auto p =
@@ -391,18 +447,28 @@ Program Handle::LoadProgram(const std::string& program_name,
         else
             boost::filesystem::copy_file(p.GetCodeObjectPathname(), path);
         miopen::SaveBinary(path, this->GetDeviceName(), program_name, params, is_kernel_str);
+        hsaco = miopen::LoadBinary(
+            this->GetDeviceName(), this->GetMaxComputeUnits(), program_name, params, is_kernel_str);
+        if(!hsaco.empty())
+            return this->impl->GetBinaryProgram(hsaco.string(), [&]() { return p; });
 #endif
 
         return p;
     }
     else
     {
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
         return HIPOCProgram{program_name, hsaco};
+#else
+        return this->impl->GetBinaryProgram(hsaco.string(),
+                                            [&]() { return HIPOCProgram{program_name, hsaco}; });
+#endif
     }
 }
 
 bool Handle::HasProgram(const std::string& program_name, const std::string& params) const
 {
+    this->AddAsyncPrograms();
     return this->impl->cache.HasProgram(program_name, params);
 }
 
@@ -469,6 +535,9 @@ std::size_t Handle::GetGlobalMemorySize() const
 
 std::size_t Handle::GetMaxComputeUnits() const
 {
+    if(!this->impl->offline_device.empty())
+        return this->impl->offline_num_cu;
+
     int result;
     auto status =
         hipDeviceGetAttribute(&result, hipDeviceAttributeMultiprocessorCount, this->impl->device);
@@ -514,6 +583,9 @@ std::size_t Handle::GetMaxMemoryAllocSize()
 
 std::string Handle::GetDeviceName() const
 {
+    if(!this->impl->offline_device.empty())
+        return this->impl->offline_device;
+
     hipDeviceProp_t props{};
     hipGetDeviceProperties(&props, this->impl->device);
     std::string n("gfx" + std::to_string(props.gcnArch));
@@ -522,6 +594,9 @@ std::string Handle::GetDeviceName() const
 
 std::ostream& Handle::Print(std::ostream& os) const
 {
+    if(!this->impl->offline_device.empty())
+        return os << "offline target: " << this->impl->offline_device << ", "
+                  << this->impl->offline_num_cu << " CUs";
     os << "stream: " << this->impl->stream << ", device_id: " << this->impl->device;
     return os;
 }
@@ -31,6 +31,7 @@
 #include <miopen/hipoc_program.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/kernel_warnings.hpp>
+#include <miopen/load_file.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/tmp_dir.hpp>
 #include <miopen/write_file.hpp>
@@ -123,7 +124,13 @@ struct HIPOCProgramImpl
     {
     }
 
-    HIPOCProgramImpl(const std::string& program_name,
+    struct BuildOnly
+    {
+    };
+
+    /// Builds the code object without loading it, no device is needed.
+    HIPOCProgramImpl(BuildOnly,
+                     const std::string& program_name,
                      std::string params,
                      bool is_kernel_str,
                      std::string dev_name,
@@ -131,6 +138,15 @@ struct HIPOCProgramImpl
         : program(program_name), device(dev_name)
     {
         BuildCodeObject(params, is_kernel_str, kernel_src);
+    }
+
+    HIPOCProgramImpl(const std::string& program_name,
+                     std::string params,
+                     bool is_kernel_str,
+                     std::string dev_name,
+                     const std::string& kernel_src)
+        : HIPOCProgramImpl(BuildOnly{}, program_name, params, is_kernel_str, dev_name, kernel_src)
+    {
         if(!binary.empty())
             module = CreateModuleInMem(binary);
         else
@@ -265,4 +281,17 @@ std::string HIPOCProgram::GetCodeObjectBlob() const
 
 bool HIPOCProgram::IsCodeObjectInMemory() const { return !impl->binary.empty(); };
 
+std::string CompileCodeObject(const std::string& program_name,
+                              std::string params,
+                              bool is_kernel_str,
+                              const std::string& dev_name,
+                              const std::string& kernel_src)
+{
+    const HIPOCProgramImpl impl{
+        HIPOCProgramImpl::BuildOnly{}, program_name, params, is_kernel_str, dev_name, kernel_src};
+    if(!impl.binary.empty())
+        return {impl.binary.data(), impl.binary.size()};
+    return LoadFile(impl.hsaco_file);
+}
+
 } // namespace miopen
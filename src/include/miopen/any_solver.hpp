@@ -66,6 +66,11 @@ struct AnySolver
         assert(ptr_value != nullptr);
         return ptr_value->GetSolverDbId();
     }
+    bool TestPerfDbValues(const ConvolutionContext& ctx, const std::string& values) const
+    {
+        assert(ptr_value != nullptr);
+        return ptr_value->TestPerfDbValues(ctx, values);
+    }
 
     size_t GetWorkspaceSize(const ConvolutionContext& ctx) const
     {
@@ -84,6 +89,8 @@ struct AnySolver
         virtual std::string GetSolverDbId() const                      = 0;
         virtual ConvSolution FindSolution(const ConvolutionContext& ctx, Db& db) const = 0;
         virtual size_t GetWorkspaceSize(const ConvolutionContext& ctx) const = 0;
+        virtual bool TestPerfDbValues(const ConvolutionContext& ctx,
+                                      const std::string& values) const = 0;
     };
 
     // templated derived class
@@ -93,7 +100,7 @@ struct AnySolver
         AnySolver_tmpl(T obj) : value(std::move(obj)){};
         bool IsApplicable(const ConvolutionContext& ctx) const override
         {
-            return value.IsApplicable(ctx);
+            return IsSolverApplicable(value, ctx);
         }
         ConvSolution FindSolution(const ConvolutionContext& ctx, Db& db) const override
         {
@@ -105,6 +112,11 @@ struct AnySolver
         }
         const std::type_info& Type() const override { return typeid(T); };
         std::string GetSolverDbId() const override { return ComputeSolverDbId(value); }
+        bool TestPerfDbValues(const ConvolutionContext& ctx,
+                              const std::string& values) const override
+        {
+            return miopen::solver::TestPerfDbValues(value, ctx, values);
+        }
 
         private:
         T value;
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_API_TRACE_HPP_
+#define GUARD_MIOPEN_API_TRACE_HPP_
+
+#include <miopen/miopen.h>
+
+#include <boost/optional.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// API calls a trace records. The values are stored in trace files and must not change. The
+/// tensors of a record are the descriptors of the call in the order listed here.
+enum class TraceCall : std::uint32_t
+{
+    // x, w, y
+    ConvolutionForwardGetWorkSpaceSize = 1,
+    // dy, w, dx
+    ConvolutionBackwardDataGetWorkSpaceSize = 2,
+    // dy, x, dw
+    ConvolutionBackwardWeightsGetWorkSpaceSize = 3,
+    // Tensors like the above, ints: requested algorithms, exhaustive search, results: the
+    // returned algorithms.
+    FindConvolutionForwardAlgorithm         = 4,
+    FindConvolutionBackwardDataAlgorithm    = 5,
+    FindConvolutionBackwardWeightsAlgorithm = 6,
+    // ints: algorithm
+    ConvolutionForward         = 7,
+    ConvolutionBackwardData    = 8,
+    ConvolutionBackwardWeights = 9,
+    // ints: solution id
+    ConvolutionForwardImmediate         = 10,
+    ConvolutionBackwardDataImmediate    = 11,
+    ConvolutionBackwardWeightsImmediate = 12,
+    // x, y, ints: mode, reals: activation alpha, beta, gamma, scaling alpha, beta
+    ActivationForward = 13,
+    // y, dy, x, dx, same values
+    ActivationBackward = 14,
+    // x, y, ints: algorithm, mode, reals: scaling alpha, beta
+    SoftmaxForward = 15,
+    // y, dy, dx, same values
+    SoftmaxBackward = 16,
+};
+
+/// Name of the API function, "unknown" for values written by newer versions.
+std::string GetTraceCallName(TraceCall call);
+
+struct TraceTensor
+{
+    miopenDataType_t type = miopenFloat;
+    std::vector<std::size_t> lengths; // empty if the descriptor was null
+    std::vector<std::size_t> strides;
+
+    friend bool operator==(const TraceTensor& l, const TraceTensor& r);
+};
+
+struct TraceConvolution
+{
+    miopenConvolutionMode_t mode     = miopenConvolution;
+    miopenPaddingMode_t padding_mode = miopenPaddingDefault;
+    std::vector<int> pads;
+    std::vector<int> strides;
+    std::vector<int> dilations;
+    std::vector<int> trans_output_pads;
+    int group_count = 1;
+
+    friend bool operator==(const TraceConvolution& l, const TraceConvolution& r);
+};
+
+struct TraceFindResult
+{
+    std::int64_t algorithm = 0;
+    double time            = 0; // ms
+    std::uint64_t memory   = 0; // workspace bytes
+
+    friend bool operator==(const TraceFindResult& l, const TraceFindResult& r);
+};
+
+struct TraceRecord
+{
+    TraceCall call;
+    std::uint64_t timestamp = 0; // ns from opening the trace to the call
+    std::uint64_t duration  = 0; // ns spent in the call on the host
+    std::uint64_t workspace = 0; // bytes passed to the call
+    std::vector<TraceTensor> tensors;
+    boost::optional<TraceConvolution> convolution;
+    std::vector<std::int64_t> ints;
+    std::vector<double> reals;
+    std::vector<TraceFindResult> results;
+
+    friend bool operator==(const TraceRecord& l, const TraceRecord& r);
+};
+
+/// A trace is a header followed by the records. Numbers are stored as LEB128 varints, signed
+/// ones zigzag encoded, and reals as little endian doubles. Every record starts with its call
+/// and its size, so readers skip the fields added after them.
+void WriteTraceHeader(std::ostream& stream);
+void WriteTraceRecord(std::ostream& stream, const TraceRecord& record);
+/// Throws on files that are not traces and on truncated or corrupt records.
+std::vector<TraceRecord> ReadTrace(std::istream& stream);
+std::vector<TraceRecord> ReadTrace(const std::string& path);
+
+/// Appends records to a trace file, from any thread.
+class TraceWriter
+{
+    public:
+    TraceWriter(const std::string& path);
+
+    /// Time since the trace was opened.
+    std::uint64_t Now() const;
+    void Write(const TraceRecord& record);
+    void Flush();
+
+    private:
+    std::chrono::steady_clock::time_point start;
+    std::mutex mutex;
+    std::ofstream file;
+};
+
+/// Writer of the trace named by MIOPEN_TRACE_FILE, nullptr if it is not set. "%p" in the name is
+/// replaced by the process id. Records are buffered and written when the buffer fills and when
+/// the process exits.
+TraceWriter* GetApiTraceWriter();
+
+/// Records one API call if tracing is enabled, the setters do nothing otherwise. The record is
+/// written with the host time of the call when the scope ends.
+class TraceScope
+{
+    public:
+    TraceScope(TraceCall call);
+    ~TraceScope();
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    bool Enabled() const { return writer != nullptr; }
+    TraceScope& Tensor(miopenTensorDescriptor_t desc);
+    TraceScope& Convolution(miopenConvolutionDescriptor_t desc);
+    TraceScope& Int(std::int64_t value);
+    TraceScope& Real(double value);
+    /// Reads a scaling factor of the API, of the type the first tensor of the record is computed
+    /// in. Null stands for default.
+    TraceScope& Scale(const void* value, float fallback);
+    /// The algorithms a Find call returned.
+    TraceScope& FindResults(int count, const miopenConvAlgoPerf_t* perf);
+    TraceScope& Workspace(std::size_t size);
+
+    private:
+    TraceWriter* writer;
+    TraceRecord record;
+};
+
+struct TraceReplayOptions
+{
+    /// 0 issues the calls back to back, otherwise the recorded gaps between the calls are
+    /// divided by speed.
+    double speed           = 0;
+    std::size_t iterations = 1;
+};
+
+struct TraceReplayStep
+{
+    std::size_t record;
+    std::uint64_t issue_at; // ns after the start of the replay, the earliest time to issue it
+};
+
+/// Order and timing of the calls of a replay. The calls are replayed in the order they were made,
+/// every iteration starts when the trace of the previous one would have ended.
+std::vector<TraceReplayStep> ScheduleTraceReplay(const std::vector<TraceRecord>& records,
+                                                 const TraceReplayOptions& options);
+
+/// Bytes of the buffer of the tensor at each position, enough for every record, and of the
+/// workspace. The replay binds tensor i of every call to buffer i.
+struct TraceReplayBuffers
+{
+    std::vector<std::size_t> tensors;
+    std::size_t workspace = 0;
+};
+
+TraceReplayBuffers GetTraceReplayBuffers(const std::vector<TraceRecord>& records);
+
+/// Call and tensor shapes, records with equal signatures are reported together.
+std::string GetTraceRecordSignature(const TraceRecord& record);
+
+struct TraceReplayStats
+{
+    std::string signature;
+    std::size_t count = 0;
+    double recorded   = 0; // mean host time of the traced calls, us
+    double mean       = 0; // replayed latency, us
+    double min        = 0;
+    double max        = 0;
+};
+
+/// Collects the latency of the replayed calls per signature.
+class TraceReplayReport
+{
+    public:
+    void Add(const TraceRecord& record, double latency_us);
+    /// In the order of the first call of each signature.
+    std::vector<TraceReplayStats> GetStats() const;
+
+    private:
+    std::vector<TraceReplayStats> stats;
+    std::map<std::string, std::size_t> index;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_API_TRACE_HPP_
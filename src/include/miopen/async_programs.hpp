@@ -0,0 +1,58 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_ASYNC_PROGRAMS_HPP_
+#define GUARD_MIOPEN_ASYNC_PROGRAMS_HPP_
+
+#include <miopen/compile_scheduler.hpp>
+#include <miopen/kernel.hpp>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct AsyncProgram
+{
+    std::string name;
+    std::string params;
+    Program program;
+};
+
+/// Programs a handle builds in the background, see Handle::CompileAsync().
+struct AsyncPrograms
+{
+    explicit AsyncPrograms(std::size_t workers) : scheduler(workers) {}
+
+    std::mutex mutex;
+    std::vector<AsyncProgram> built; // not added to the kernel cache of the handle yet
+    // Declared last, so the running builds finish before the rest is destroyed.
+    CompileScheduler scheduler;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_ASYNC_PROGRAMS_HPP_
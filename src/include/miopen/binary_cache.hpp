@@ -28,16 +28,29 @@
 #define GUARD_MLOPEN_BINARY_CACHE_HPP
 
 #include <miopen/config.h>
+#include <miopen/build_lease.hpp>
 
 #if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
 #include <boost/filesystem/path.hpp>
 #endif
 
+#include <cstdint>
 #include <string>
 
 namespace miopen {
 
 #if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
+/// The binary cache is content addressed. Binaries are stored once in blobs/<hash>.o, named
+/// by the XXH3 hash of their contents, and programs with identical binaries share a blob. The
+/// index entry of a program, index/<md5 of device and args>/<name>.o, holds the hash of its
+/// blob.
+boost::filesystem::path GetCacheFile(const boost::filesystem::path& cache_dir,
+                                     const std::string& device,
+                                     const std::string& name,
+                                     const std::string& args,
+                                     bool is_kernel_str);
+
+/// Index entry of the program in the user cache.
 boost::filesystem::path GetCacheFile(const std::string& device,
                                      const std::string& name,
                                      const std::string& args,
@@ -45,6 +58,33 @@ boost::filesystem::path GetCacheFile(const std::string& device,
 
 boost::filesystem::path GetCachePath(bool is_system);
 
+/// Blob the index entry refers to, empty if there is none. Marks the blob as used.
+boost::filesystem::path LoadCacheBlob(const boost::filesystem::path& cache_dir,
+                                      const boost::filesystem::path& entry);
+
+/// Moves the binary to its blob, unless an identical one is stored already, and points the
+/// index entry to it.
+void SaveCacheBlob(const boost::filesystem::path& cache_dir,
+                   const boost::filesystem::path& binary_path,
+                   const boost::filesystem::path& entry);
+
+struct BinaryCachePruneResult
+{
+    std::size_t blobs            = 0; // left in the cache
+    std::uintmax_t size          = 0; // of the blobs left in the cache
+    std::size_t removed_blobs    = 0;
+    std::size_t removed_entries  = 0;
+    std::size_t migrated_entries = 0; // from the layout before the index
+};
+
+/// Moves the binaries stored before the cache was content addressed to blobs and index
+/// entries, and removes their directories. Removes the blobs no index entry refers to and the
+/// entries of missing blobs. Then removes the least recently used blobs with their entries
+/// until the blobs take at most max_size bytes. Other processes may use the cache meanwhile,
+/// programs whose blobs are removed are built again.
+BinaryCachePruneResult PruneBinaryCache(const boost::filesystem::path& cache_dir,
+                                        std::uintmax_t max_size);
+
 boost::filesystem::path LoadBinary(const std::string& device,
                                    std::size_t num_cu,
                                    const std::string& name,
@@ -70,6 +110,13 @@ void SaveBinary(const std::string& hsaco,
                 bool is_kernel_str = false);
 #endif
 
+/// Waits until no other thread or process builds the program into the cache, see BuildLease.
+/// The lease is not taken when the cache is disabled, the result could not be shared.
+BuildLease LeaseBinaryBuild(const std::string& device,
+                            const std::string& name,
+                            const std::string& args,
+                            bool is_kernel_str = false);
+
 } // namespace miopen
 
 #endif
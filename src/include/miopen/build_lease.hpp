@@ -0,0 +1,62 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_BUILD_LEASE_HPP_
+#define GUARD_MIOPEN_BUILD_LEASE_HPP_
+
+#include <boost/filesystem/path.hpp>
+
+#include <chrono>
+#include <memory>
+
+namespace miopen {
+
+struct BuildLeaseImpl;
+
+/// Exclusive right to build the item named by a path, shared by the threads of the process and
+/// by all processes of the node. The holders of a lease file wait for each other, so an item
+/// built into a shared cache is built once and the waiters find it there. The lease is a lock
+/// of a file in the directory of LockFilePath(), the system releases it when a process dies,
+/// so another one takes over. Waiting ends after the timeout, the caller then builds without
+/// the lease.
+class BuildLease
+{
+    public:
+    BuildLease();
+    BuildLease(const boost::filesystem::path& item, std::chrono::milliseconds timeout);
+    BuildLease(BuildLease&&) noexcept;
+    BuildLease& operator=(BuildLease&&) noexcept;
+    ~BuildLease();
+
+    /// False if the lease was not taken because of the timeout or an error.
+    bool IsHeld() const;
+
+    private:
+    std::unique_ptr<BuildLeaseImpl> impl;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_BUILD_LEASE_HPP_
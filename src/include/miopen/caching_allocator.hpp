@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_CACHING_ALLOCATOR_HPP_
+#define GUARD_MIOPEN_CACHING_ALLOCATOR_HPP_
+
+#include <miopen/allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+struct CachingAllocatorStats
+{
+    std::size_t requests               = 0; // calls of Allocate with a non zero size
+    std::size_t hits                   = 0; // requests served from the cache
+    std::size_t upstream_allocations   = 0;
+    std::size_t upstream_deallocations = 0;
+    std::size_t bytes_in_use           = 0; // by size class, not by requested size
+    std::size_t bytes_cached           = 0;
+    std::size_t peak_bytes_in_use      = 0;
+    std::size_t peak_bytes_reserved    = 0; // in use and cached
+};
+
+/// Caches the buffers of an upstream allocator, so temporary buffers of the same size class
+/// do not go to the device allocator every time. Buffers are never split, a cached buffer is
+/// only handed out again for requests of its own size class and on the stream it was allocated
+/// on, the work queued on that stream may still use it after it is freed.
+/// The cache is trimmed, least recently freed buffers first, when it grows over the limit and
+/// when the upstream allocator fails.
+///
+/// The pool has to outlive the buffers it handed out.
+struct CachingAllocator
+{
+    CachingAllocator(Allocator upstream_,
+                     std::size_t cache_limit_,
+                     const void* stream_ = nullptr);
+    CachingAllocator(const CachingAllocator&) = delete;
+    CachingAllocator& operator=(const CachingAllocator&) = delete;
+    ~CachingAllocator();
+
+    /// Size of the buffers used for a request of n bytes: powers of two up to 1 MiB,
+    /// multiples of 2 MiB above.
+    static std::size_t SizeClass(std::size_t n);
+
+    void* Allocate(std::size_t n);
+    void Deallocate(void* ptr);
+
+    /// Stream of the requests from now on. Buffers allocated before keep their stream.
+    void SetStream(const void* stream_);
+    /// Releases cached buffers, least recently freed first, until at most limit bytes are left.
+    void Trim(std::size_t limit = 0);
+    /// Trims the cache and stops caching, buffers still in use are released when freed.
+    void Retire();
+
+    CachingAllocatorStats GetStats() const;
+
+    /// Callbacks which serve the handle from this pool.
+    Allocator GetAllocator();
+
+    private:
+    struct Allocation
+    {
+        std::size_t size;
+        const void* stream;
+    };
+
+    struct Block
+    {
+        void* ptr;
+        const void* stream;
+        std::uint64_t freed_at;
+    };
+
+    void* AllocateUpstream(std::size_t size);
+    void TrimUnlocked(std::size_t limit);
+
+    Allocator upstream;
+    std::size_t cache_limit;
+    const void* stream  = nullptr;
+    std::uint64_t clock = 0;
+    mutable std::mutex mutex;
+    std::unordered_map<void*, Allocation> in_use;
+    std::multimap<std::size_t, Block> cached; // by size class
+    CachingAllocatorStats stats;
+};
+
+/// Puts a CachingAllocator in front of the allocator when MIOPEN_DEVICE_MEMORY_CACHE_LIMIT
+/// (the cache size in MiB) is set, otherwise returns it unchanged. The previous pool is
+/// retired but stays in pools, buffers it handed out may still be in use.
+Allocator MakeCachingAllocator(const Allocator& allocator,
+                               const void* stream,
+                               std::vector<std::unique_ptr<CachingAllocator>>& pools);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_CACHING_ALLOCATOR_HPP_
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_COMPILE_SCHEDULER_HPP_
+#define GUARD_MIOPEN_COMPILE_SCHEDULER_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+enum class CompileJobState
+{
+    Queued,    // no task has started yet
+    Running,   // some tasks have started
+    Done,      // all tasks have finished
+    Failed,    // a task has thrown, the tasks that did not start were skipped
+    Cancelled, // the tasks that did not start when Cancel() was called were skipped
+};
+
+/// A group of tasks submitted to a CompileScheduler together, like the builds of the programs
+/// of a solution. The submitter polls or waits for it and may cancel it.
+class CompileJob
+{
+    public:
+    CompileJob(std::vector<std::function<void()>> tasks_);
+
+    CompileJobState GetState() const;
+    /// True when no task runs or will run anymore.
+    bool IsReady() const;
+    void Wait() const;
+
+    template <class Rep, class Period>
+    bool WaitFor(std::chrono::duration<Rep, Period> timeout) const
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return ready.wait_for(lock, timeout, [&]() { return IsReadyUnsafe(); });
+    }
+
+    /// Exception of the first failed task, if any.
+    std::exception_ptr GetError() const;
+
+    /// Skips the tasks that have not started. Running tasks are not interrupted, the job is
+    /// ready after they finish.
+    void Cancel();
+
+    private:
+    friend class CompileScheduler;
+
+    mutable std::mutex mutex;
+    mutable std::condition_variable ready;
+    std::vector<std::function<void()>> tasks;
+    std::size_t started  = 0;
+    std::size_t finished = 0;
+    bool skipping        = false; // set by Cancel() and by a failed task
+    std::exception_ptr error;
+
+    bool IsReadyUnsafe() const
+    {
+        return skipping ? started == finished : finished == tasks.size();
+    }
+    /// Returns false if the task is skipped.
+    bool Start();
+    void Finish(std::exception_ptr task_error);
+};
+
+/// Runs the tasks of the jobs on a fixed number of threads. Tasks of jobs with higher priority
+/// run first, in the order of submission otherwise.
+class CompileScheduler
+{
+    public:
+    explicit CompileScheduler(std::size_t workers);
+    CompileScheduler(const CompileScheduler&) = delete;
+    CompileScheduler& operator=(const CompileScheduler&) = delete;
+    /// Cancels the queued jobs and waits for the running tasks.
+    ~CompileScheduler();
+
+    std::shared_ptr<CompileJob> Submit(std::vector<std::function<void()>> tasks,
+                                       int priority = 0);
+
+    /// Changes the priority of the tasks of the job that are still queued.
+    void SetPriority(const std::shared_ptr<CompileJob>& job, int priority);
+
+    private:
+    using QueueKey = std::pair<int, std::size_t>; // -priority, order of submission
+
+    std::mutex mutex;
+    std::condition_variable queued;
+    std::map<QueueKey, std::pair<std::shared_ptr<CompileJob>, std::size_t>> queue;
+    std::size_t submitted = 0;
+    bool stopping         = false;
+    std::vector<std::thread> threads;
+
+    void Work();
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_COMPILE_SCHEDULER_HPP_
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_CONTEXT_CACHE_HPP_
+#define GUARD_MIOPEN_CONTEXT_CACHE_HPP_
+
+#include <miopen/conv/context.hpp>
+#include <miopen/env.hpp>
+#include <miopen/names.hpp>
+
+#include <boost/optional.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+/// Identifies a convolution problem by the descriptors its ProblemDescription is built from,
+/// so a lookup does not have to build the description first.
+struct ConvolutionProblemKey
+{
+    ConvolutionProblemKey(const TensorDescriptor& in,
+                          const TensorDescriptor& weights,
+                          const TensorDescriptor& out,
+                          const ConvolutionDescriptor& conv,
+                          conv::Direction direction);
+
+    bool operator<(const ConvolutionProblemKey& other) const { return values < other.values; }
+
+    private:
+    std::vector<std::size_t> values;
+};
+
+/// Problem part of the contexts, shared by all queries of the problem made with a handle.
+struct CachedConvolutionContext
+{
+    explicit CachedConvolutionContext(const ConvolutionContext& ctx)
+        : context(ctx), network_config(ctx.BuildConfKey())
+    {
+    }
+
+    /// Has the stream, the environment and the floats set up. Copy it to change the buffers
+    /// or the search options.
+    const ConvolutionContext context;
+    const NetworkConfig network_config;
+};
+
+/// Contexts built with a handle, see Handle::GetContextCache().
+struct ContextCache
+{
+    /// The problems of a model fit easily, a sweep over more shapes starts the cache over.
+    static constexpr std::size_t max_problems = 1024;
+
+    std::mutex mutex;
+    /// Result of ExecutionContext::DetectRocm(), which depends only on the device and the
+    /// process.
+    boost::optional<ExecutionContext> environment;
+    std::map<ConvolutionProblemKey, std::shared_ptr<const CachedConvolutionContext>> problems;
+    /// Normal find mode workspace sizes by the network config, the direction and the mode of the
+    /// problem. They depend on the MIOPEN_DEBUG_CONV_* switches.
+    std::unordered_map<std::string, std::size_t> workspace_sizes;
+
+    /// Drops what was built before the last ReloadEnvironment(). Called with the mutex locked.
+    void DropStale()
+    {
+        const auto current = EnvironmentGeneration();
+        if(generation == current)
+            return;
+        environment = boost::none;
+        problems.clear();
+        workspace_sizes.clear();
+        generation = current;
+    }
+
+    private:
+    unsigned generation = 0;
+};
+
+/// Context of the problem for the queries that do not change it. Built on the first query of
+/// the problem with the handle.
+std::shared_ptr<const CachedConvolutionContext>
+GetConvolutionContext(Handle& handle,
+                      const TensorDescriptor& in,
+                      const TensorDescriptor& weights,
+                      const TensorDescriptor& out,
+                      const ConvolutionDescriptor& conv,
+                      conv::Direction direction);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_CONTEXT_CACHE_HPP_
@@ -52,73 +52,100 @@ inline std::string GetDataTypeName(miopenDataType_t data_type)
     return "Unknown(" + std::to_string(data_type) + ")";
 }
 
-template <class TElement>
-constexpr auto GetDHW(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr auto GetDHW(int spatial_dims, const TData& data)
 {
     if(spatial_dims == 2)
         return std::make_tuple(0, data[0], data[1]);
     return std::make_tuple(data[0], data[1], data[2]);
 }
 
-template <class TElement>
-constexpr TElement GetD3(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetD3(int spatial_dims, const TData& data)
 {
     return std::get<0>(GetDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetH3(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetH3(int spatial_dims, const TData& data)
 {
     return std::get<1>(GetDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetW3(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetW3(int spatial_dims, const TData& data)
 {
     return std::get<2>(GetDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr auto GetNCDHW(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr auto GetNCDHW(int spatial_dims, const TData& data)
 {
     if(spatial_dims == 3)
         return miopen::tien<5>(data, 1);
     else
-        return std::make_tuple(data[0], data[1], static_cast<TElement>(1), data[2], data[3]);
+        return std::make_tuple(
+            data[0], data[1], static_cast<typename TData::value_type>(1), data[2], data[3]);
 }
 
-template <class TElement>
-constexpr TElement GetN5(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetN5(int spatial_dims, const TData& data)
 {
     return std::get<0>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetC5(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetC5(int spatial_dims, const TData& data)
 {
     return std::get<1>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetD5(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetD5(int spatial_dims, const TData& data)
 {
     return std::get<2>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetH5(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetH5(int spatial_dims, const TData& data)
 {
     return std::get<3>(GetNCDHW(spatial_dims, data));
 }
 
-template <class TElement>
-constexpr TElement GetW5(int spatial_dims, const std::vector<TElement>& data)
+template <class TData>
+constexpr typename TData::value_type GetW5(int spatial_dims, const TData& data)
 {
     return std::get<4>(GetNCDHW(spatial_dims, data));
 }
 
 namespace conv {
 
+/// Layout the db keys name the channels first activation tensors with, for 3d problems too.
+inline const char* DefaultLayout() { return "NCHW"; }
+
+inline bool IsChannelsLastLayout(const std::string& layout)
+{
+    return layout == "NHWC" || layout == "NDHWC";
+}
+
+/// Memory layout of a convolution activation tensor: DefaultLayout() if the tensor can be
+/// addressed channels first, "NHWC" or "NDHWC" if it is stored channels last and the order of
+/// the strides otherwise. Tensors with a channel or spatial size of 1 may fit both, they get the
+/// default layout, so their db keys do not change.
+std::string GetConvLayout(const TensorDescriptor& desc, std::size_t spatial_dims);
+
+/// Layout of a tensor of a problem whose input has in_layout. A tensor that can be addressed in
+/// in_layout gets it, so problems stored in one layout have one layout string.
+std::string GetConvLayout(const TensorDescriptor& desc,
+                          std::size_t spatial_dims,
+                          const std::string& in_layout);
+
+/// Layouts of a problem in its db keys. Problems with one layout are keyed by it, as before the
+/// output and weights layouts were told apart.
+std::string EncodeLayoutsForKey(const std::string& in_layout,
+                                const std::string& weights_layout,
+                                const std::string& out_layout);
+
 struct ProblemDescription
 #if MIOPEN_ENABLE_SQLITE
     : SQLiteSerializable<ProblemDescription>
@@ -132,7 +159,15 @@ struct ProblemDescription
                        const ConvolutionDescriptor& conv_,
                        Direction direction_,
                        int bias_ = 0)
-        : in(in_), weights(weights_), out(out_), conv(conv_), direction(direction_), bias(bias_)
+        : in(in_),
+          weights(weights_),
+          out(out_),
+          conv(conv_),
+          in_layout(GetConvLayout(in, GetSpatialDims())),
+          weights_layout(GetConvLayout(weights, GetSpatialDims(), in_layout)),
+          out_layout(GetConvLayout(out, GetSpatialDims(), in_layout)),
+          direction(direction_),
+          bias(bias_)
     {
     }
 
@@ -161,13 +196,13 @@ struct ProblemDescription
     std::size_t GetInStrideD() const { return GetD5(GetSpatialDims(), in.GetStrides()); }
     std::size_t GetInStrideH() const { return GetH5(GetSpatialDims(), in.GetStrides()); }
     std::size_t GetInStrideW() const { return GetW5(GetSpatialDims(), in.GetStrides()); }
-    std::string GetInLayout() const { return "NCHW"; }
+    const std::string& GetInLayout() const { return in_layout; }
     std::size_t GetInElementSize() const { return GetTypeSize(GetInDataType()); }
 
     std::size_t GetInSize() const
     {
         // clang-format off
-        return (GetInLayout() == "NCHW")
+        return IsPackedLayout(GetInLayout())
             ? GetInBatchSize() * GetInChannels() * GetInDepth() * GetInHeight() * GetInWidth() * GetInElementSize()
             : GetInBatchSize() * GetInBatchStride() * GetInChannelStride() * GetInStrideH() * GetInStrideW() * GetInElementSize(); // Todo: GetInStrideD() ?
         // clang-format on
@@ -185,13 +220,13 @@ struct ProblemDescription
     std::size_t GetOutStrideD() const { return GetD5(GetSpatialDims(), out.GetStrides()); }
     std::size_t GetOutStrideH() const { return GetH5(GetSpatialDims(), out.GetStrides()); }
     std::size_t GetOutStrideW() const { return GetW5(GetSpatialDims(), out.GetStrides()); }
-    std::string GetOutLayout() const { return "NCHW"; }
+    const std::string& GetOutLayout() const { return out_layout; }
     std::size_t GetOutElementSize() const { return GetTypeSize(GetOutDataType()); }
 
     std::size_t GetOutSize() const
     {
         // clang-format off
-        return (GetOutLayout() == "NCHW")
+        return IsPackedLayout(GetOutLayout())
             ? GetOutBatchSize() * GetOutChannels() * GetOutDepth() * GetOutHeight() * GetOutWidth() * GetOutElementSize()
             : GetOutBatchSize() * GetOutBatchStride() * GetOutChannelStride() * GetOutStrideH() * GetOutStrideW() * GetOutElementSize(); // Todo: GetOutStrideD() ?
         // clang-format on
@@ -208,7 +243,7 @@ struct ProblemDescription
     // }
     // std::size_t GetWeightsStrideW() const { return GetW5(GetSpatialDims(), weights.GetStrides());
     // }
-    std::string GetWeightsLayout() const { return ""; }
+    const std::string& GetWeightsLayout() const { return weights_layout; }
     std::size_t GetWeightsElementSize() const { return GetTypeSize(GetWeightsDataType()); }
 
     std::size_t GetWeightsSize() const
@@ -247,6 +282,19 @@ struct ProblemDescription
 
     bool Is2d() const { return GetSpatialDims() == 2; }
 
+    /// All tensors are stored channels first. All solvers handle such problems.
+    bool IsLayoutDefault() const
+    {
+        return GetInLayout() == DefaultLayout() && GetWeightsLayout() == DefaultLayout() &&
+               GetOutLayout() == DefaultLayout();
+    }
+    /// All tensors are stored channels last.
+    bool IsLayoutNHWC() const
+    {
+        return IsChannelsLastLayout(GetInLayout()) && IsChannelsLastLayout(GetWeightsLayout()) &&
+               IsChannelsLastLayout(GetOutLayout());
+    }
+
     bool IsFp32() const
     {
         return GetInDataType() == miopenFloat && GetWeightsDataType() == miopenFloat &&
@@ -299,7 +347,11 @@ struct ProblemDescription
         f(std::to_string(self.GetDilationH()), "dilation_h");
         f(std::to_string(self.GetDilationW()), "dilation_w");
         f(std::to_string(self.GetBias()), "bias");
-        f("'" + self.GetInLayout() + "'", "layout");
+        f("'" +
+              EncodeLayoutsForKey(
+                  self.GetInLayout(), self.GetWeightsLayout(), self.GetOutLayout()) +
+              "'",
+          "layout");
         std::string data_type = EncodeDataTypesForKey(
             self.GetInDataType(), self.GetWeightsDataType(), self.GetOutDataType());
         f("'" + data_type + "'", "data_type");
@@ -315,12 +367,20 @@ struct ProblemDescription
     }
 
     private:
+    static bool IsPackedLayout(const std::string& layout)
+    {
+        return layout == DefaultLayout() || IsChannelsLastLayout(layout);
+    }
+
     TensorDescriptor in;
     TensorDescriptor weights;
     TensorDescriptor out;
     ConvolutionDescriptor conv;
-    Direction direction = Direction::Forward;
-    int bias            = 0;
+    std::string in_layout      = DefaultLayout();
+    std::string weights_layout = DefaultLayout();
+    std::string out_layout     = DefaultLayout();
+    Direction direction        = Direction::Forward;
+    int bias                   = 0;
 };
 
 } // namespace conv
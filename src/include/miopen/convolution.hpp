@@ -33,6 +33,8 @@
 #include <miopen/solver_id.hpp>
 #include <miopen/names.hpp>
 
+#include <limits>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -43,6 +45,11 @@ namespace solver {
 struct ConvSolution;
 } // namespace solver
 
+namespace conv {
+struct ProblemDescription;
+} // namespace conv
+
+class CompileJob;
 struct ConvolutionContext;
 struct Handle;
 struct TensorDescriptor;
@@ -242,13 +249,17 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                                         const TensorDescriptor& xDesc,
                                         const TensorDescriptor& yDesc) const;
 
+    /// Applicable solutions, fastest first. Solutions which need more than workspace_limit
+    /// bytes of workspace are skipped.
     void GetForwardSolutions(Handle& handle,
                              const TensorDescriptor& wDesc,
                              const TensorDescriptor& xDesc,
                              const TensorDescriptor& yDesc,
                              size_t maxSolutionCount,
                              size_t* solutionCount,
-                             miopenConvSolution_t* solutions) const;
+                             miopenConvSolution_t* solutions,
+                             std::size_t workspace_limit =
+                                 std::numeric_limits<std::size_t>::max()) const;
 
     void CompileForwardSolution(Handle& handle,
                                 const TensorDescriptor& wDesc,
@@ -256,6 +267,16 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                                 const TensorDescriptor& yDesc,
                                 solver::Id solver_id) const;
 
+    /// Builds the kernels of the solution on the background compile threads of the handle and
+    /// returns at once. Until the job is ready the caller may run a fallback solution, after
+    /// that CompileForwardSolution and the immediate mode call do not compile anything.
+    std::shared_ptr<CompileJob> CompileForwardSolutionAsync(Handle& handle,
+                                                            const TensorDescriptor& wDesc,
+                                                            const TensorDescriptor& xDesc,
+                                                            const TensorDescriptor& yDesc,
+                                                            solver::Id solver_id,
+                                                            int priority = 0) const;
+
     std::size_t GetForwardSolutionWorkspaceSize(Handle& handle,
                                                 const TensorDescriptor& wDesc,
                                                 const TensorDescriptor& xDesc,
@@ -326,7 +347,9 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                               const TensorDescriptor& dxDesc,
                               size_t maxSolutionCount,
                               size_t* solutionCount,
-                              miopenConvSolution_t* solutions) const;
+                              miopenConvSolution_t* solutions,
+                              std::size_t workspace_limit =
+                                  std::numeric_limits<std::size_t>::max()) const;
 
     void CompileBackwardSolution(Handle& handle,
                                  const TensorDescriptor& dyDesc,
@@ -334,6 +357,14 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                                  const TensorDescriptor& dxDesc,
                                  solver::Id solver_id) const;
 
+    /// See CompileForwardSolutionAsync.
+    std::shared_ptr<CompileJob> CompileBackwardSolutionAsync(Handle& handle,
+                                                             const TensorDescriptor& dyDesc,
+                                                             const TensorDescriptor& wDesc,
+                                                             const TensorDescriptor& dxDesc,
+                                                             solver::Id solver_id,
+                                                             int priority = 0) const;
+
     std::size_t GetBackwardSolutionWorkspaceSize(Handle& handle,
                                                  const TensorDescriptor& dyDesc,
                                                  const TensorDescriptor& wDesc,
@@ -362,7 +393,9 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                          const TensorDescriptor& dwDesc,
                          size_t maxSolutionCount,
                          size_t* solutionCount,
-                         miopenConvSolution_t* solutions) const;
+                         miopenConvSolution_t* solutions,
+                         std::size_t workspace_limit =
+                             std::numeric_limits<std::size_t>::max()) const;
 
     void CompileWrwSolution(Handle& handle,
                             const TensorDescriptor& dyDesc,
@@ -370,6 +403,14 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                             const TensorDescriptor& dwDesc,
                             solver::Id solver_id) const;
 
+    /// See CompileForwardSolutionAsync.
+    std::shared_ptr<CompileJob> CompileWrwSolutionAsync(Handle& handle,
+                                                        const TensorDescriptor& dyDesc,
+                                                        const TensorDescriptor& xDesc,
+                                                        const TensorDescriptor& dwDesc,
+                                                        solver::Id solver_id,
+                                                        int priority = 0) const;
+
     std::size_t GetWrwSolutionWorkspaceSize(Handle& handle,
                                             const TensorDescriptor& dyDesc,
                                             const TensorDescriptor& xDesc,
@@ -464,6 +505,21 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                                       const TensorDescriptor& xDesc,
                                       const TensorDescriptor& dwDesc) const;
 
+    std::size_t ForwardGetWorkSpaceSizeImpl(Handle& handle,
+                                            const TensorDescriptor& wDesc,
+                                            const TensorDescriptor& xDesc,
+                                            const TensorDescriptor& yDesc) const;
+
+    std::size_t BackwardDataGetWorkSpaceSizeImpl(Handle& handle,
+                                                 const TensorDescriptor& wDesc,
+                                                 const TensorDescriptor& dyDesc,
+                                                 const TensorDescriptor& dxDesc) const;
+
+    std::size_t BackwardWeightsGetWorkSpaceSizeImpl(Handle& handle,
+                                                    const TensorDescriptor& dyDesc,
+                                                    const TensorDescriptor& xDesc,
+                                                    const TensorDescriptor& dwDesc) const;
+
     void BackwardWeightsGemm(Handle& handle,
                              const ConvWrwTensors& tensors,
                              Data_t workSpace,
@@ -558,6 +614,15 @@ void ConvolutionBackwardBias(const Handle& handle,
 
 std::ostream& operator<<(std::ostream& stream, const ConvolutionDescriptor& c);
 
+/// Prepares the immediate mode calls of the problems, e.g. of all the convolutions of a model.
+/// The find-db records of the problems are loaded at once, see FindDbRecord::Prefetch(). With
+/// compile the kernels of the fastest solution of each problem with a record are built
+/// concurrently on the compile threads of the handle, then its invokers are registered.
+/// Returns the number of different problems with a find-db record.
+std::size_t PrefetchConvolutions(Handle& handle,
+                                 const std::vector<conv::ProblemDescription>& problems,
+                                 bool compile = true);
+
 } // namespace miopen
 MIOPEN_DEFINE_OBJECT(miopenConvolutionDescriptor, miopen::ConvolutionDescriptor);
 
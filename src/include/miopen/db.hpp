@@ -35,6 +35,9 @@
 
 #include <chrono>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace boost {
 namespace filesystem {
@@ -68,6 +71,10 @@ class PlainTextDb
         return FindRecord(key);
     }
 
+    /// Searches db for all of the keys in one pass over the file. The keys that are not found
+    /// are missing from the result.
+    std::unordered_map<std::string, DbRecord> FindRecords(const std::vector<std::string>& keys);
+
     /// Stores provided record in database. If record with same key is already in database it is
     /// replaced by provided record.
     ///
@@ -222,6 +229,42 @@ class MultiFileDb
 #endif
     }
 
+    /// Records of the keys, looked up the same way as by FindRecord().
+    template <bool merge = merge_records, std::enable_if_t<merge>* = nullptr>
+    auto FindRecords(const std::vector<std::string>& keys)
+    {
+        auto installed = _installed.FindRecords(keys);
+#if !MIOPEN_DISABLE_USERDB
+        for(auto&& user : _user.FindRecords(keys))
+        {
+            const auto it = installed.find(user.first);
+            if(it != installed.end())
+                user.second.Merge(it->second);
+            installed[user.first] = std::move(user.second);
+        }
+#endif
+        return installed;
+    }
+
+    template <bool merge = merge_records, std::enable_if_t<!merge>* = nullptr>
+    auto FindRecords(const std::vector<std::string>& keys)
+    {
+#if !MIOPEN_DISABLE_USERDB
+        auto records = _user.FindRecords(keys);
+        auto missing = std::vector<std::string>{};
+        for(const auto& key : keys)
+            if(records.find(key) == records.end())
+                missing.push_back(key);
+        if(missing.empty())
+            return records;
+        for(auto&& installed : _installed.FindRecords(missing))
+            records.emplace(std::move(installed));
+        return records;
+#else
+        return _installed.FindRecords(keys);
+#endif
+    }
+
     template <typename... U>
     auto StoreRecord(const U&... args)
     {
@@ -233,8 +276,8 @@ class MultiFileDb
 #endif
     }
 
-    template <typename... U>
-    auto UpdateRecord(U&... args)
+    template <class TDb = TUser, typename... U>
+    auto UpdateRecord(U&... args) -> decltype(std::declval<TDb&>().UpdateRecord(args...))
     {
 #if MIOPEN_DISABLE_USERDB
         sink{args...};
@@ -338,14 +381,20 @@ class DbTimer
         return Measure("FindRecord", [&]() { return inner.FindRecord(args...); });
     }
 
+    template <typename... U>
+    auto FindRecords(const U&... args)
+    {
+        return Measure("FindRecords", [&]() { return inner.FindRecords(args...); });
+    }
+
     template <typename... U>
     auto StoreRecord(U&... record)
     {
         return Measure("StoreRecord", [&]() { return inner.StoreRecord(record...); });
     }
 
-    template <typename... U>
-    auto UpdateRecord(U&... args)
+    template <class TDb = TInnerDb, typename... U>
+    auto UpdateRecord(U&... args) -> decltype(std::declval<TDb&>().UpdateRecord(args...))
     {
         return Measure("UpdateRecord", [&]() { return inner.UpdateRecord(args...); });
     }
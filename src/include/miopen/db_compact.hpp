@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DB_COMPACT_HPP_
+#define GUARD_MIOPEN_DB_COMPACT_HPP_
+
+#include <miopen/config.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+enum class DbEntryCheck
+{
+    Valid,
+    UnknownSolver, // the id or the solver of the values is not registered
+    InvalidValues, // the values do not parse or are rejected by the solver
+};
+
+/// Checks an ID:VALUES entry of the record with the key.
+using DbEntryChecker = std::function<DbEntryCheck(
+    const std::string& key, const std::string& id, const std::string& values)>;
+
+/// Perf-db entries are kept if the solver is registered. With a handle the values also have to
+/// be a valid performance config of the problem on its device, keys of problems that cannot be
+/// parsed are not checked.
+DbEntryChecker MakePerfDbChecker(Handle* handle = nullptr);
+
+/// Find-db entries are kept if they parse and their solver is registered.
+DbEntryChecker MakeFindDbChecker();
+
+struct DbCompactResult
+{
+    std::size_t records         = 0; // records written
+    std::size_t entries         = 0; // ID:VALUES pairs written
+    std::size_t merged          = 0; // pairs written from the merged dbs
+    std::size_t shadowed        = 0; // pairs hidden by a record or pair read before
+    std::size_t unknown_solvers = 0;
+    std::size_t invalid_values  = 0;
+    std::size_t malformed       = 0; // lines or pairs that are not valid db syntax
+    std::uintmax_t size_before  = 0; // bytes of the db and the merged dbs
+    std::uintmax_t size_after   = 0; // also computed by dry runs
+};
+
+/// Merges the text dbs in merge into the text db at path and writes the result to output,
+/// which may be path. The merged dbs take priority over path and later ones over earlier
+/// ones, for equal keys they are combined per ID with merge_records, like the perf-db does,
+/// and the record of the first db with the key is used otherwise, like the find-db does. In
+/// one file the first record with a key is kept. Entries rejected by check are dropped, the
+/// records are written sorted by key with sorted IDs. Nothing is written with dry_run.
+DbCompactResult CompactTextDb(const std::string& path,
+                              const std::vector<std::string>& merge,
+                              const std::string& output,
+                              bool merge_records,
+                              const DbEntryChecker& check,
+                              bool dry_run = false);
+
+/// Keys of a text db in file order.
+std::vector<std::string> GetTextDbKeys(const std::string& path);
+
+/// Average time in microseconds PlainTextDb needs to find a record of the text db at path.
+double MeasureTextDbLookups(const std::string& path, const std::vector<std::string>& keys);
+
+/// True for files with the SQLite header.
+bool IsSQLiteDb(const std::string& path);
+
+#if MIOPEN_ENABLE_SQLITE
+/// CompactTextDb() for SQLite perf-dbs, the merged dbs take priority per solver. check gets
+/// empty keys, the config table does not store the problem keys. Configs without entries are
+/// removed and the file is vacuumed.
+DbCompactResult CompactSQLitePerfDb(const std::string& path,
+                                    const std::vector<std::string>& merge,
+                                    const std::string& output,
+                                    const DbEntryChecker& check,
+                                    bool dry_run = false);
+#endif
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_COMPACT_HPP_
@@ -242,6 +242,8 @@ class DbRecord
     friend class PlainTextDb;
     friend class SQLitePerfDb;
     friend class ReadonlyRamDb;
+    template <class TDb>
+    friend class FindDbRecord_t;
 };
 
 } // namespace miopen
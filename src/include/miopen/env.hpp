@@ -26,8 +26,11 @@
 #ifndef GUARD_MIOPEN_ENV_HPP
 #define GUARD_MIOPEN_ENV_HPP
 
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
+#include <list>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -88,35 +91,83 @@ inline std::vector<std::string> GetEnv(const char* name)
         return {{p}};
 }
 
+/// The library reads each environment variable once and keeps the parsed value, so the checks
+/// on the hot paths are plain loads. ReloadEnvironment() makes the next checks read the
+/// environment again. It is meant for tests and must not run concurrently with other calls.
+void ReloadEnvironment();
+
+namespace detail {
+/// Incremented by ReloadEnvironment(). Starts at 1, so a value cached at 0 is never current.
+extern std::atomic<unsigned> environment_generation;
+} // namespace detail
+
+inline unsigned EnvironmentGeneration()
+{
+    return detail::environment_generation.load(std::memory_order_acquire);
+}
+
+/// Parsed value of an environment variable of the current generation.
+template <class V>
+class EnvCache
+{
+    public:
+    template <class F>
+    V Get(F read)
+    {
+        const auto generation = EnvironmentGeneration();
+        if(stamp.load(std::memory_order_acquire) != generation)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(stamp.load(std::memory_order_relaxed) != generation)
+            {
+                value.store(read(), std::memory_order_relaxed);
+                stamp.store(generation, std::memory_order_release);
+            }
+        }
+        return value.load(std::memory_order_relaxed);
+    }
+
+    private:
+    std::atomic<unsigned> stamp{0};
+    std::atomic<V> value{};
+    std::mutex mutex;
+};
+
 template <class T>
 inline const char* GetStringEnv(T)
 {
-    static const std::vector<std::string> result = GetEnv(T::value());
-    if(result.empty())
-        return nullptr;
-    else
-        return result.front().c_str();
+    static EnvCache<const char*> cache;
+    // Every value read stays, the pointers returned before a reload remain valid.
+    static std::list<std::string> values;
+    return cache.Get([]() -> const char* {
+        const auto value_env_p = std::getenv(T::value());
+        if(value_env_p == nullptr)
+            return nullptr;
+        values.emplace_back(value_env_p);
+        return values.back().c_str();
+    });
 }
 
 template <class T>
 inline bool IsEnabled(T)
 {
-    static const bool result = miopen::IsEnvvarValueEnabled(T::value());
-    return result;
+    static EnvCache<bool> cache;
+    return cache.Get([] { return miopen::IsEnvvarValueEnabled(T::value()); });
 }
 
 template <class T>
 inline bool IsDisabled(T)
 {
-    static const bool result = miopen::IsEnvvarValueDisabled(T::value());
-    return result;
+    static EnvCache<bool> cache;
+    return cache.Get([] { return miopen::IsEnvvarValueDisabled(T::value()); });
 }
 
+/// The fallback of the first call of a generation is kept.
 template <class T>
 inline unsigned long int Value(T, unsigned long int fallback = 0)
 {
-    static const auto result = miopen::EnvvarValue(T::value(), fallback);
-    return result;
+    static EnvCache<unsigned long int> cache;
+    return cache.Get([&] { return miopen::EnvvarValue(T::value(), fallback); });
 }
 } // namespace miopen
 
@@ -81,6 +81,8 @@ struct ExecutionContext
 
     ExecutionContext() = default;
 
+    /// Sets the environment part of the context. A context with a stream takes it from the
+    /// handle, which detects it once.
     void DetectRocm();
 
     std::string GetPerfDbPath() const
@@ -122,5 +124,7 @@ struct ExecutionContext
 
     private:
     Handle* stream = nullptr;
+
+    void DetectEnvironment();
 };
 } // namespace miopen
@@ -37,6 +37,7 @@
 #include <boost/optional.hpp>
 
 #include <functional>
+#include <string>
 #include <vector>
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_DISABLE_FIND_DB)
@@ -81,20 +82,23 @@ class FindDbRecord_t
     FindDbRecord_t(const FindDbRecord_t&) = delete;
     FindDbRecord_t& operator=(const FindDbRecord_t&) = delete;
 
+    /// Problems loaded by Prefetch() are not looked up in the files.
     template <class TProblemDescription, class TTestDb = TDb>
     FindDbRecord_t(Handle& handle, const TProblemDescription& problem, is_immediate_t<TTestDb> = 0)
         : path(testing_find_db_path_override() ? *testing_find_db_path_override()
                                                : GetUserPath(handle)),
           installed_path(testing_find_db_path_override() ? *testing_find_db_path_override()
-                                                         : GetInstalledPath(handle)),
-          db(boost::make_optional<DbTimer<TDb>>(testing_find_db_enabled &&
-                                                    !IsEnabled(MIOPEN_DEBUG_DISABLE_FIND_DB{}),
-                                                DbTimer<TDb>{installed_path, path, "", 0}))
+                                                         : GetInstalledPath(handle))
     {
-        if(!db.is_initialized())
+        if(!testing_find_db_enabled || IsEnabled(MIOPEN_DEBUG_DISABLE_FIND_DB{}))
             return;
 
-        content = db->FindRecord(problem);
+        const auto key = DbRecord::Serialize(problem);
+        if(LoadPrefetched(key))
+            return;
+
+        db.emplace(installed_path, path, "", 0);
+        content = db->FindRecord(key);
         in_sync = content.is_initialized();
     }
 
@@ -123,6 +127,7 @@ class FindDbRecord_t
             return;
         if(!db->StoreRecord(content.get()))
             MIOPEN_LOG_E("Failed to store record to find-db at <" << path << ">");
+        DropPrefetched(path, content->GetKey());
     }
 
     auto begin() const { return content->As<FindDbData>().begin(); }
@@ -157,6 +162,22 @@ class FindDbRecord_t
         return ret;
     }
 
+    /// Loads the records of the problems, for example of all the convolutions of a model, with
+    /// one pass over each find-db file. Later immediate mode lookups of the problems, including
+    /// of those without a record, are served from memory until the user find-db record of the
+    /// problem is stored again. Returns the number of different problems with a record.
+    template <class TProblemDescription, class TTestDb = TDb>
+    static std::size_t Prefetch(Handle& handle,
+                                const std::vector<TProblemDescription>& problems,
+                                is_immediate_t<TTestDb> = 0)
+    {
+        auto keys = std::vector<std::string>{};
+        keys.reserve(problems.size());
+        for(const auto& problem : problems)
+            keys.push_back(DbRecord::Serialize(problem));
+        return PrefetchKeys(handle, keys);
+    }
+
     private:
     std::string path;
     std::string installed_path;
@@ -169,6 +190,11 @@ class FindDbRecord_t
     static std::string GetInstalledPath(Handle& handle);
     static std::string GetUserPath(Handle& handle);
 
+    static std::size_t PrefetchKeys(Handle& handle, const std::vector<std::string>& keys);
+    static void DropPrefetched(const std::string& user_path, const std::string& key);
+    /// Returns false if the key was not prefetched with the paths of the record.
+    bool LoadPrefetched(const std::string& key);
+
     // Returns true if rebuild is required
     bool Validate(Handle& handle, const NetworkConfig& config) const;
     void CopyTo(std::vector<PerfField>& to) const;
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_FIND_PLANNER_HPP_
+#define GUARD_MIOPEN_FIND_PLANNER_HPP_
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv_solution.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// Parses one line of a find plan. The line is either a MIOpenDriver convolution command line,
+/// like "MIOpenDriver conv -n 32 -c 64 -H 56 -W 56 -k 64 -y 3 -x 3 -p 1 -q 1 -F 1", or a
+/// find-db key, like "64-56-56-3x3-64-56-56-32-1x1-1x1-1x1-0-NCHW-FP32-F". A command line gives
+/// one problem per direction selected by -F, transposed convolutions are converted to the
+/// problems the library solves for them. Throws on malformed lines.
+std::vector<conv::ProblemDescription> ParseFindPlanLine(const std::string& line);
+
+/// Problems with equal keys share their find-db and perf-db records.
+std::string GetFindPlanKey(const conv::ProblemDescription& problem);
+
+struct FindPlanProblem
+{
+    conv::ProblemDescription problem;
+    std::string key;
+    std::size_t uses; // number of times the problem appears in the input
+};
+
+/// Unique problems of a network, in the order of their first appearance.
+struct FindPlan
+{
+    std::vector<FindPlanProblem> problems;
+    std::size_t total = 0; // problems before deduplication
+
+    void Add(const conv::ProblemDescription& problem);
+
+    private:
+    std::unordered_map<std::string, std::size_t> index;
+};
+
+/// Reads a plan, one problem per line, see ParseFindPlanLine. Empty lines and lines starting
+/// with '#' are skipped. Errors are reported with the line number.
+FindPlan ReadFindPlan(std::istream& input);
+
+/// A program that has to be built before the problems using it are measured.
+struct FindPlanProgram
+{
+    solver::KernelInfo kernel;
+    std::vector<std::size_t> problems; // indices into FindPlan::problems
+};
+
+struct FindPlanJobs
+{
+    /// Applicable solutions of each problem of the plan.
+    std::vector<std::vector<solver::ConvSolution>> solutions;
+    /// Every program needed by the solutions once, in the order of their first use.
+    std::vector<FindPlanProgram> programs;
+
+    std::vector<solver::ConvSolution> GetAllSolutions() const;
+};
+
+using FindPlanEnumerator =
+    std::function<std::vector<solver::ConvSolution>(const conv::ProblemDescription&)>;
+
+/// Collects the solutions of all problems of the plan and the programs they need. The
+/// enumerator is the only part that needs a device, so the job graph can be built and
+/// inspected on the host.
+FindPlanJobs MakeFindPlanJobs(const FindPlan& plan, const FindPlanEnumerator& enumerate);
+
+/// The solutions Find() builds for the problem without a search, that is with the perf-db
+/// or the default configurations. Only the target of the handle is queried, so an offline
+/// handle can be used. Solvers that fail are skipped with a warning.
+std::vector<solver::ConvSolution> FindPlanSolutions(Handle& handle,
+                                                    const conv::ProblemDescription& problem);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_FIND_PLANNER_HPP_
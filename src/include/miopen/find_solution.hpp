@@ -30,9 +30,12 @@
 #include <miopen/env.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/find_controls.hpp>
+#include <miopen/perf_db_snapshot.hpp>
 #include <miopen/solver_id.hpp>
 
 #include <limits>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 namespace miopen {
@@ -125,6 +128,51 @@ ConvSolution FindSolution(Solver s, const Context& context, Db& db)
     return solution;
 }
 
+template <class Solver, class Context>
+auto TestPerfDbValuesImpl(rank<1>, Solver s, const Context& context, const std::string& values)
+    -> decltype(s.IsValidPerformanceConfig(context, s.GetPerformanceConfig(context)))
+{
+    using PerformanceConfig = decltype(s.GetPerformanceConfig(context));
+    PerformanceConfig config{};
+    return config.Deserialize(values) && s.IsValidPerformanceConfig(context, config);
+}
+
+template <class Solver, class Context>
+bool TestPerfDbValuesImpl(rank<0>, Solver, const Context&, const std::string&)
+{
+    return false;
+}
+
+/// Checks values stored in the perf-db for the solver, like FindSolution() does before using
+/// them. Solvers that are not searchable have no valid perf-db values.
+template <class Solver, class Context>
+bool TestPerfDbValues(Solver s, const Context& context, const std::string& values)
+{
+    return TestPerfDbValuesImpl(rank<1>{}, s, context, values);
+}
+
+template <class Solver, class Context>
+auto IsLayoutSupportedImpl(rank<1>, Solver s, const Context& context)
+    -> decltype(s.IsLayoutSupported(context))
+{
+    return s.IsLayoutSupported(context);
+}
+
+template <class Solver, class Context>
+bool IsLayoutSupportedImpl(rank<0>, Solver, const Context& context)
+{
+    return context.IsLayoutDefault();
+}
+
+/// IsApplicable() of the solver, for problems with a memory layout it handles. Solvers take
+/// channels first tensors only, unless they declare other layouts with
+/// bool IsLayoutSupported(const ConvolutionContext&) const.
+template <class Solver, class Context>
+bool IsSolverApplicable(Solver s, const Context& context)
+{
+    return IsLayoutSupportedImpl(rank<1>{}, s, context) && s.IsApplicable(context);
+}
+
 template <class... Solvers>
 struct SolverContainer
 {
@@ -138,6 +186,8 @@ struct SolverContainer
         std::vector<Solution> ss;
         std::size_t count    = 0;
         const auto find_only = GetEnvFindOnlySolver();
+        // The solvers share one read of the perf-db record of the problem.
+        PerfDbSnapshot<std::remove_reference_t<Db>, Context> snapshot{db, search_params};
         miopen::each_args(
             [&](auto solver) {
                 if(count >= limit)
@@ -145,9 +195,9 @@ struct SolverContainer
                 if(find_only.IsValid() && find_only != Id{SolverDbId(solver)})
                 { // Do nothing (and keep silence for the sake of Tuna), just skip.
                 }
-                else if(solver.IsApplicable(search_params))
+                else if(IsSolverApplicable(solver, search_params))
                 {
-                    const Solution s = FindSolution(solver, search_params, db);
+                    const Solution s = FindSolution(solver, search_params, snapshot);
                     if(s.Succeeded())
                     {
                         ++count;
@@ -171,6 +221,7 @@ struct SolverContainer
                 }
             },
             Solvers{}...);
+        snapshot.Flush();
         return ss;
     }
     template <class Context>
@@ -183,7 +234,7 @@ struct SolverContainer
                 if(find_only.IsValid() && find_only != Id{SolverDbId(solver)})
                 { // Do nothing (and keep silence for the sake of Tuna), just skip.
                 }
-                else if(solver.IsApplicable(search_params))
+                else if(IsSolverApplicable(solver, search_params))
                 {
                     auto sz = solver.GetWorkspaceSize(search_params);
                     res.push_back(std::make_pair(SolverDbId(solver), sz));
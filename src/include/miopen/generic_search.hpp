@@ -30,6 +30,7 @@
 #include <miopen/config.h>
 
 #include <vector>
+#include <cstdint>
 #include <cstdlib>
 #include <limits>
 #include <iterator>
@@ -38,6 +39,7 @@
 
 #include <miopen/logger.hpp>
 #include <miopen/handle.hpp>
+#include <miopen/philox.hpp>
 
 namespace miopen {
 namespace solver {
@@ -230,18 +232,22 @@ class HeartBeat
     }
 };
 
-inline void InitRandomly(std::vector<float>& vec, const double offset, const double factor)
+/// Buffers are filled from different streams of the generator, so they get different data.
+inline void InitRandomly(std::vector<float>& vec,
+                         const std::uint64_t stream,
+                         const double offset,
+                         const double factor)
 {
-    float* p = vec.data();
-    for(unsigned long i = 0; i < vec.size(); ++i)
-        *p++ = static_cast<float>((rand() * (1.0 / RAND_MAX) + offset) * factor);
+    Philox4x32 rng;
+    rng.stream = stream;
+    ParRandomFill(rng, vec.data(), vec.size(), [=](float u) {
+        return static_cast<float>((u + offset) * factor);
+    });
 }
 
-inline void InitRandomly(std::vector<float>& vec)
+inline void InitRandomly(std::vector<float>& vec, const std::uint64_t stream)
 {
-    float* p = vec.data();
-    for(unsigned long i = 0; i < vec.size(); ++i)
-        *p++ = static_cast<float>(rand() * (1.0 / RAND_MAX));
+    InitRandomly(vec, stream, 0.0, 1.0);
 }
 
 inline size_t divide_round_plus_inf(const size_t x, const unsigned y)
@@ -398,13 +404,13 @@ auto GenericSearch(const Solver s,
     std::vector<float> bot(bot_size);
     std::vector<float> wei(wei_size);
     std::vector<float> bias(bias_size);
-    InitRandomly(bot);
+    InitRandomly(bot, 0);
     if(!(context.direction.IsBackwardData() || context.direction.IsForward()))
-        InitRandomly(top);
+        InitRandomly(top, 1);
     if(!context.direction.IsBackwardWrW())
-        InitRandomly(wei, -0.5, 0.001);
+        InitRandomly(wei, 2, -0.5, 0.001);
     if(context.bias)
-        InitRandomly(bias);
+        InitRandomly(bias, 3);
 
     miopen::Handle profile_h;
     auto bot_ocl_buf  = profile_h.Write(bot);
@@ -40,11 +40,13 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include <ios>
 #include <sstream>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
 
@@ -56,6 +58,9 @@
 namespace miopen {
 
 struct HandleImpl;
+struct AsyncPrograms;
+struct ContextCache;
+class CompileJob;
 #if MIOPEN_USE_MIOPENGEMM
 struct GemmGeometry;
 using GemmKey = std::pair<std::string, std::string>;
@@ -70,6 +75,10 @@ struct Handle : miopenHandle
 
     Handle();
     Handle(miopenAcceleratorQueue_t stream);
+    /// Handle that is not bound to a device. It only answers the target queries of the
+    /// solvers (device name, number of CUs), so solutions can be enumerated for GPUs that
+    /// are not present. Kernels cannot be run and memory cannot be allocated with it.
+    Handle(const std::string& offline_device, std::size_t offline_num_cu);
     Handle(Handle&&) noexcept;
     ~Handle();
 
@@ -132,6 +141,15 @@ struct Handle : miopenHandle
 
     void AddProgram(Program prog, const std::string& program_name, const std::string& params) const;
 
+    /// Builds the programs of the kernels that are not in the cache on background threads and
+    /// returns immediately. The built programs are added to the cache by the next call that
+    /// looks programs up on this thread. The handle cancels the queued builds and waits for
+    /// the running ones when it is destroyed.
+    std::shared_ptr<CompileJob> CompileAsync(const std::vector<solver::KernelInfo>& kernels,
+                                             int priority = 0) const;
+    /// Adds the programs built by CompileAsync() to the cache.
+    void AddAsyncPrograms() const;
+
     void Finish() const;
     void Flush() const;
 
@@ -229,6 +247,9 @@ struct Handle : miopenHandle
         return invokers.GetFound1_0(config, *algo);
     }
 
+    /// Environment and problem contexts built with this handle.
+    ContextCache& GetContextCache() const;
+
 #if MIOPEN_USE_ROCBLAS
     const rocblas_handle_ptr& rhandle() const { return rhandle_; }
 
@@ -239,6 +260,18 @@ struct Handle : miopenHandle
     private:
 #endif
     InvokerCache invokers;
+    // Guards the members created on first use. On the heap, so handles stay movable.
+    struct FirstUse
+    {
+        std::once_flag contexts;
+        std::once_flag async_programs;
+        // Set once async_programs exists, AddAsyncPrograms reads it without the once_flag.
+        std::atomic<bool> has_async_programs{false};
+    };
+    std::unique_ptr<FirstUse> first_use = std::make_unique<FirstUse>();
+    mutable std::unique_ptr<ContextCache> contexts;
+    // Destroyed first, the background builds use the handle.
+    mutable std::unique_ptr<AsyncPrograms> async_programs;
 };
 
 inline std::ostream& operator<<(std::ostream& os, const Handle& handle) { return handle.Print(os); }
@@ -61,6 +61,14 @@ struct HIPOCProgram
     /// False if CO resides on filesystem.
     bool IsCodeObjectInMemory() const;
 };
+
+/// Builds the program for dev_name like the HIPOCProgram ctor does, but does not load it,
+/// so no device is needed. \return The code object.
+std::string CompileCodeObject(const std::string& program_name,
+                              std::string params,
+                              bool is_kernel_str,
+                              const std::string& dev_name,
+                              const std::string& kernel_src);
 } // namespace miopen
 
 #endif
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_INLINE_VECTOR_HPP_
+#define GUARD_MIOPEN_INLINE_VECTOR_HPP_
+
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// Vector-like container with a fixed capacity and inline storage. Copying, constructing and
+/// destroying it never touches the heap, which makes it suitable for small, frequently created
+/// objects like tensor lengths and strides. Exceeding the capacity throws miopenStatusBadParm.
+///
+/// It converts implicitly to std::vector, so it can be passed where a vector is expected, and
+/// can be compared with vectors of the same value type.
+template <class T, std::size_t N>
+struct InlineVector
+{
+    using value_type             = T;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = T*;
+    using const_pointer          = const T*;
+    using iterator               = T*;
+    using const_iterator         = const T*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr std::size_t capacity() { return N; }
+
+    InlineVector() = default;
+
+    InlineVector(std::size_t n, const T& value = T{}) { resize(n, value); }
+
+    InlineVector(std::initializer_list<T> init) : InlineVector(init.begin(), init.end()) {}
+
+    template <class Iterator,
+              class = typename std::iterator_traits<Iterator>::iterator_category>
+    InlineVector(Iterator first, Iterator last)
+    {
+        assign(first, last);
+    }
+
+    template <class U>
+    InlineVector(const std::vector<U>& v) : InlineVector(v.begin(), v.end())
+    {
+    }
+
+    template <class Iterator,
+              class = typename std::iterator_traits<Iterator>::iterator_category>
+    void assign(Iterator first, Iterator last)
+    {
+        clear();
+        for(; first != last; ++first)
+            push_back(static_cast<T>(*first));
+    }
+
+    template <class U>
+    operator std::vector<U>() const
+    {
+        return std::vector<U>(begin(), end());
+    }
+
+    std::vector<T> ToVector() const { return {begin(), end()}; }
+
+    iterator begin() { return storage; }
+    iterator end() { return storage + count; }
+    const_iterator begin() const { return storage; }
+    const_iterator end() const { return storage + count; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator{end()}; }
+    reverse_iterator rend() { return reverse_iterator{begin()}; }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+    const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+
+    T* data() { return storage; }
+    const T* data() const { return storage; }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    T& operator[](std::size_t i)
+    {
+        assert(i < count);
+        return storage[i];
+    }
+    const T& operator[](std::size_t i) const
+    {
+        assert(i < count);
+        return storage[i];
+    }
+
+    T& at(std::size_t i)
+    {
+        if(i >= count)
+            MIOPEN_THROW(miopenStatusInternalError, "InlineVector index out of range");
+        return storage[i];
+    }
+    const T& at(std::size_t i) const
+    {
+        if(i >= count)
+            MIOPEN_THROW(miopenStatusInternalError, "InlineVector index out of range");
+        return storage[i];
+    }
+
+    T& front() { return (*this)[0]; }
+    const T& front() const { return (*this)[0]; }
+    T& back() { return (*this)[count - 1]; }
+    const T& back() const { return (*this)[count - 1]; }
+
+    void clear() { count = 0; }
+
+    void push_back(const T& x)
+    {
+        if(count == N)
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "Too many dimensions, at most " + std::to_string(N) + " are supported");
+        storage[count++] = x;
+    }
+
+    void pop_back()
+    {
+        assert(count > 0);
+        --count;
+    }
+
+    void resize(std::size_t n, const T& value = T{})
+    {
+        if(n > N)
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "Too many dimensions, at most " + std::to_string(N) + " are supported");
+        for(auto i = count; i < n; ++i)
+            storage[i] = value;
+        count = n;
+    }
+
+    friend bool operator==(const InlineVector& l, const InlineVector& r)
+    {
+        return std::equal(l.begin(), l.end(), r.begin(), r.end());
+    }
+    friend bool operator!=(const InlineVector& l, const InlineVector& r) { return !(l == r); }
+    friend bool operator<(const InlineVector& l, const InlineVector& r)
+    {
+        return std::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());
+    }
+    friend bool operator>(const InlineVector& l, const InlineVector& r) { return r < l; }
+    friend bool operator<=(const InlineVector& l, const InlineVector& r) { return !(r < l); }
+    friend bool operator>=(const InlineVector& l, const InlineVector& r) { return !(l < r); }
+
+    friend bool operator==(const InlineVector& l, const std::vector<T>& r)
+    {
+        return std::equal(l.begin(), l.end(), r.begin(), r.end());
+    }
+    friend bool operator==(const std::vector<T>& l, const InlineVector& r) { return r == l; }
+    friend bool operator!=(const InlineVector& l, const std::vector<T>& r) { return !(l == r); }
+    friend bool operator!=(const std::vector<T>& l, const InlineVector& r) { return !(r == l); }
+
+    /// For boost::hash and the hashed containers built on it.
+    friend std::size_t hash_value(const InlineVector& v)
+    {
+        std::size_t seed = v.count;
+        for(const auto& x : v)
+            seed ^= std::hash<T>{}(x) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+
+    private:
+    T storage[N]      = {};
+    std::size_t count = 0;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_INLINE_VECTOR_HPP_
@@ -85,10 +85,14 @@ class KernelCache
 
     bool HasKernels(const std::string& algorithm, const std::string& network_config) const;
 
-    bool HasProgram(const std::string& name, const std::string& params) const;
+    bool HasProgram(const std::string& name, std::string params) const;
 
     void AddProgram(Program prog, const std::string& program_name, std::string params);
 
+    /// Brings program options to the form programs are cached and built with, callers that
+    /// build programs directly must use it to get the same binary cache records.
+    static void ProcessParams(std::string& params);
+
     KernelCache();
 
     private:
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_KERNEL_CACHE_BUILDER_HPP_
+#define GUARD_MIOPEN_KERNEL_CACHE_BUILDER_HPP_
+
+#include <miopen/kernel_info.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// A GPU the kernel cache is built for.
+struct KernelCacheTarget
+{
+    std::string device;
+    std::size_t num_cu;
+};
+
+/// Parses "<device>:<number of CUs>", like "gfx906:60". Device names are mapped like the
+/// names reported by the runtime, see GetDeviceNameFromMap().
+KernelCacheTarget ParseKernelCacheTarget(const std::string& spec);
+
+/// Name of the system kernel database of the target, which the binary cache reads next to the
+/// user one when it is placed in the system database directory.
+std::string GetKernelCacheFileName(const KernelCacheTarget& target);
+
+/// A program as the binary cache of a handle of the target stores it.
+struct KernelCacheProgram
+{
+    std::string name;
+    std::string args; // build options the handle adds to the options of the solution
+};
+
+/// Every program needed by the kernels once, with the cache records of the device.
+std::vector<KernelCacheProgram>
+GetKernelCachePrograms(const std::vector<solver::KernelInfo>& kernels, const std::string& device);
+
+/// Builds a program for the device and returns the code object, throws on failure.
+using KernelCacheCompiler =
+    std::function<std::string(const KernelCacheProgram& program, const std::string& device)>;
+
+/// Builds the program with the compiler the handle uses, without a device. Only the HIP backend
+/// supports it.
+std::string CompileKernelCacheProgram(const KernelCacheProgram& program,
+                                      const std::string& device);
+
+struct KernelCacheBuildResult
+{
+    std::size_t built   = 0;
+    std::size_t present = 0; // found in the database and skipped
+    std::vector<KernelCacheProgram> failed;
+};
+
+/// Compiles the programs missing from the kernel database at path, at most max_jobs of them at
+/// a time, and stores the code objects. Programs that fail to build are logged and returned, the
+/// other ones are still stored.
+KernelCacheBuildResult BuildKernelCache(const std::string& path,
+                                        const KernelCacheTarget& target,
+                                        const std::vector<KernelCacheProgram>& programs,
+                                        const KernelCacheCompiler& compile,
+                                        std::size_t max_jobs);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_KERNEL_CACHE_BUILDER_HPP_
@@ -1,11 +1,49 @@
 #ifndef GUARD_MLOPEN_MD5_HPP
 #define GUARD_MLOPEN_MD5_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace miopen {
 
-std::string md5(std::string s);
+/// Incremental md5 of data given in any number of pieces. Final() may be called once.
+class Md5
+{
+    public:
+    static constexpr std::size_t digest_size = 16;
+    using Digest                             = std::array<unsigned char, digest_size>;
+
+    struct Context
+    {
+        std::uint32_t lo, hi;
+        std::uint32_t a, b, c, d;
+        unsigned char buffer[64];
+        std::uint32_t block[digest_size];
+    };
+
+    Md5();
+    void Update(const void* data, std::size_t size);
+    void Update(const std::string& s) { Update(s.data(), s.size()); }
+    Digest Final();
+
+    private:
+    Context ctx;
+};
+
+/// Writes 2 * size lower case hex digits to out.
+void WriteHex(const unsigned char* data, std::size_t size, char* out);
+
+template <std::size_t N>
+std::string ToHex(const std::array<unsigned char, N>& digest)
+{
+    std::string result(2 * N, '0');
+    WriteHex(digest.data(), N, &result[0]);
+    return result;
+}
+
+std::string md5(const std::string& s);
 
 } // namespace miopen
 
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_PERF_DB_SNAPSHOT_HPP_
+#define GUARD_MIOPEN_PERF_DB_SNAPSHOT_HPP_
+
+#include <miopen/db_record.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/rank.hpp>
+
+#include <boost/optional.hpp>
+
+#include <exception>
+#include <map>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace miopen {
+
+/// Perf-db values of one problem, shared by the solvers tried for it. The record is read on
+/// the first Load() instead of once per solver. Update() and Remove() change the snapshot and
+/// are written to the db by Flush(), or by the destructor if the search is left by an exception.
+/// Provides the part of the db interface FindSolution() uses, the problem arguments must be the
+/// problem of the snapshot.
+template <class Db, class Problem>
+class PerfDbSnapshot
+{
+    public:
+    PerfDbSnapshot(Db& db_, const Problem& problem_) : db(db_), problem(problem_) {}
+
+    PerfDbSnapshot(const PerfDbSnapshot&) = delete;
+    PerfDbSnapshot& operator=(const PerfDbSnapshot&) = delete;
+
+    ~PerfDbSnapshot()
+    {
+        try
+        {
+            if(!Flush())
+                MIOPEN_LOG_W("Unable to write the perf-db changes");
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Unable to write the perf-db changes: " << ex.what());
+        }
+    }
+
+    template <class V>
+    bool Load(const Problem&, const std::string& id, V& values)
+    {
+        return GetRecord().GetValues(id, values);
+    }
+
+    template <class V>
+    bool Update(const Problem&, const std::string& id, const V& values)
+    {
+        std::ostringstream stream;
+        values.Serialize(stream);
+        const auto serialized = SerializedValues{stream.str()};
+        GetRecord().SetValues(id, serialized);
+        removed.erase(id);
+        updated[id] = serialized;
+        return true;
+    }
+
+    bool Remove(const Problem&, const std::string& id)
+    {
+        updated.erase(id);
+        if(!GetRecord().EraseValues(id))
+            return false;
+        removed.insert(id);
+        return true;
+    }
+
+    /// Writes the staged changes, the updates in one record write when the db supports it.
+    /// Returns false if any of them failed.
+    bool Flush()
+    {
+        // Unstaged first, so a throwing write is not repeated by the destructor.
+        const auto to_remove = std::move(removed);
+        const auto to_update = std::move(updated);
+        removed.clear();
+        updated.clear();
+
+        bool ok = true;
+        for(const auto& id : to_remove)
+            ok = db.Remove(problem, id) && ok;
+        if(!to_update.empty())
+            ok = Write(rank<1>{}, db, to_update) && ok;
+        return ok;
+    }
+
+    private:
+    struct SerializedValues
+    {
+        std::string values;
+        void Serialize(std::ostream& stream) const { stream << values; }
+    };
+
+    Db& db;
+    const Problem& problem;
+    boost::optional<DbRecord> record;
+    std::map<std::string, SerializedValues> updated;
+    std::set<std::string> removed;
+
+    template <class TDb>
+    auto Write(rank<1>, TDb& target, const std::map<std::string, SerializedValues>& values)
+        -> decltype(bool(target.UpdateRecord(std::declval<DbRecord&>())))
+    {
+        DbRecord staged{problem};
+        for(const auto& item : values)
+            staged.SetValues(item.first, item.second);
+        return target.UpdateRecord(staged);
+    }
+
+    template <class TDb>
+    bool Write(rank<0>, TDb& target, const std::map<std::string, SerializedValues>& values)
+    {
+        bool ok = true;
+        for(const auto& item : values)
+            ok = bool(target.Update(problem, item.first, item.second)) && ok;
+        return ok;
+    }
+
+    DbRecord& GetRecord()
+    {
+        if(!record)
+        {
+            auto found = db.FindRecord(problem);
+            record     = found ? std::move(*found) : DbRecord{problem};
+        }
+        return *record;
+    }
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_PERF_DB_SNAPSHOT_HPP_
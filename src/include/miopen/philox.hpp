@@ -0,0 +1,163 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_PHILOX_HPP_
+#define GUARD_MIOPEN_PHILOX_HPP_
+
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace miopen {
+
+/// Philox4x32-10 counter based random number generator (Salmon et al., "Parallel random
+/// numbers: as easy as 1, 2, 3"). Value i of a stream depends only on the seed, the stream and
+/// i, so any range of values can be generated independently. Filling a buffer gives the same
+/// result regardless of how the work is split between threads.
+struct Philox4x32
+{
+    /// Values produced per counter.
+    static constexpr std::size_t lanes = 4;
+    /// Counters processed together by Generate(), the loops over them are vectorized.
+    static constexpr std::size_t batch = 16;
+
+    std::uint64_t seed   = 0;
+    std::uint64_t stream = 0; // upper half of the counter, selects independent sequences
+
+    /// Random bits of counters first .. first + n - 1, n <= batch. out[l][j] is lane l of
+    /// counter first + j.
+    void Generate(std::uint64_t first, std::size_t n, std::uint32_t (&out)[lanes][batch]) const
+    {
+        constexpr std::uint32_t mul0 = 0xD2511F53;
+        constexpr std::uint32_t mul1 = 0xCD9E8D57;
+        constexpr std::uint32_t inc0 = 0x9E3779B9;
+        constexpr std::uint32_t inc1 = 0xBB67AE85;
+
+        std::uint32_t key0 = static_cast<std::uint32_t>(seed);
+        std::uint32_t key1 = static_cast<std::uint32_t>(seed >> 32);
+
+        std::uint32_t c0[batch];
+        std::uint32_t c1[batch];
+        std::uint32_t c2[batch];
+        std::uint32_t c3[batch];
+        for(std::size_t j = 0; j < batch; j++)
+        {
+            const auto counter = first + j;
+            c0[j]              = static_cast<std::uint32_t>(counter);
+            c1[j]              = static_cast<std::uint32_t>(counter >> 32);
+            c2[j]              = static_cast<std::uint32_t>(stream);
+            c3[j]              = static_cast<std::uint32_t>(stream >> 32);
+        }
+
+        for(int round = 0; round < 10; round++)
+        {
+            for(std::size_t j = 0; j < batch; j++)
+            {
+                const std::uint64_t p0 = static_cast<std::uint64_t>(mul0) * c0[j];
+                const std::uint64_t p1 = static_cast<std::uint64_t>(mul1) * c2[j];
+                const std::uint32_t n0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1[j] ^ key0;
+                const std::uint32_t n2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3[j] ^ key1;
+                c1[j]                  = static_cast<std::uint32_t>(p1);
+                c3[j]                  = static_cast<std::uint32_t>(p0);
+                c0[j]                  = n0;
+                c2[j]                  = n2;
+            }
+            key0 += inc0;
+            key1 += inc1;
+        }
+
+        std::copy(c0, c0 + n, out[0]);
+        std::copy(c1, c1 + n, out[1]);
+        std::copy(c2, c2 + n, out[2]);
+        std::copy(c3, c3 + n, out[3]);
+    }
+
+    /// Random bits of value i of the stream.
+    std::uint32_t Bits(std::uint64_t i) const
+    {
+        std::uint32_t out[lanes][batch];
+        Generate(i / lanes, 1, out);
+        return out[i % lanes][0];
+    }
+
+    /// Maps random bits to [0, 1) with 24 bits of precision, so the result is exact in float.
+    static float ToUniform(std::uint32_t bits)
+    {
+        return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+    }
+
+    float Uniform(std::uint64_t i) const { return ToUniform(Bits(i)); }
+};
+
+/// Sets element k of [first, first + n) to f(u), where u is value offset + k of the stream
+/// mapped to [0, 1).
+template <class T, class F>
+void RandomFill(const Philox4x32& rng, T* first, std::size_t n, F f, std::uint64_t offset = 0)
+{
+    constexpr auto lanes = Philox4x32::lanes;
+    constexpr auto batch = Philox4x32::batch;
+
+    std::size_t k = 0;
+    // Values before the first full counter.
+    for(; k < n && (offset + k) % lanes != 0; k++)
+        first[k] = f(rng.Uniform(offset + k));
+
+    std::uint32_t bits[lanes][batch];
+    while(n - k >= lanes)
+    {
+        const auto counters = std::min<std::size_t>(batch, (n - k) / lanes);
+        rng.Generate((offset + k) / lanes, counters, bits);
+        for(std::size_t j = 0; j < counters; j++)
+        {
+            for(std::size_t l = 0; l < lanes; l++)
+                first[k + j * lanes + l] = f(Philox4x32::ToUniform(bits[l][j]));
+        }
+        k += counters * lanes;
+    }
+
+    for(; k < n; k++)
+        first[k] = f(rng.Uniform(offset + k));
+}
+
+/// RandomFill on the host threads. f is called concurrently and must not have side effects.
+template <class T, class F>
+void ParRandomFill(const Philox4x32& rng, T* first, std::size_t n, F f)
+{
+    // A multiple of the counter batch, so only the last chunk has a partial batch.
+    constexpr std::size_t chunk = std::size_t{1} << 16;
+
+    const auto chunks = (n + chunk - 1) / chunk;
+    par_for(chunks, 1, [&](std::size_t c) {
+        const auto begin = c * chunk;
+        RandomFill(rng, first + begin, std::min(chunk, n - begin), f, begin);
+    });
+}
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_PHILOX_HPP_
@@ -55,7 +55,8 @@ SetDescFromMLDesc(int spatial_dims, TTo& to, const TensorDescriptor& tensor, con
 
     std::tie(ns, cs, hs, ws) = miopen::tien<4>(tensor.GetStrides(), 0);
 
-    (to.*method)("NCHW", tensor.GetType(), n, c, d, h, w, ns, cs, hs, ws);
+    const auto layout = conv::GetConvLayout(tensor, spatial_dims);
+    (to.*method)(layout, tensor.GetType(), n, c, d, h, w, ns, cs, hs, ws);
 
     return tensor.GetElementSpace();
 }
@@ -146,7 +147,8 @@ struct ProblemDescription
     {
         if(!self.direction.IsKnown())
             MIOPEN_THROW("!direction.IsKnown()");
-        f(self.in_layout, "layout");
+        f(conv::EncodeLayoutsForKey(self.in_layout, self.GetWeightsLayout(), self.out_layout),
+          "layout");
         std::string data_type =
             EncodeDataTypesForKey(self.in_data_type, self.weights_data_type, self.out_data_type);
         f(data_type, "data_type");
@@ -180,6 +182,24 @@ struct ProblemDescription
     bool Is2d() const { return spatial_dims == 2; }
     bool Is3d() const { return spatial_dims == 3; }
 
+    /// Layout of the weights, weights_layout is empty if it is the layout of the input.
+    const std::string& GetWeightsLayout() const
+    {
+        return weights_layout.empty() ? in_layout : weights_layout;
+    }
+
+    bool IsLayoutDefault() const
+    {
+        return in_layout == conv::DefaultLayout() && GetWeightsLayout() == conv::DefaultLayout() &&
+               out_layout == conv::DefaultLayout();
+    }
+    bool IsLayoutNHWC() const
+    {
+        return conv::IsChannelsLastLayout(in_layout) &&
+               conv::IsChannelsLastLayout(GetWeightsLayout()) &&
+               conv::IsChannelsLastLayout(out_layout);
+    }
+
     bool IsFp32() const
     {
         return in_data_type == miopenFloat && weights_data_type == miopenFloat &&
@@ -235,9 +255,10 @@ struct ProblemDescription
     {
         batch_sz     = batch;
         int data_len = GetTypeSize(data_type);
-        size_t size  = (layout == "NCHW")
-                          ? batch * channels * depth * height * width * data_len
-                          : batch * batch_stride * channel_stride * stride * w_stride * data_len;
+        size_t size  =
+            (layout == conv::DefaultLayout() || conv::IsChannelsLastLayout(layout))
+                ? batch * channels * depth * height * width * data_len
+                : batch * batch_stride * channel_stride * stride * w_stride * data_len;
 
         out_width          = width;
         out_height         = height;
@@ -270,9 +291,10 @@ struct ProblemDescription
     {
         batch_sz     = batch;
         int data_len = GetTypeSize(data_type);
-        size_t size  = (layout == "NCHW")
-                          ? batch * channels * depth * height * width * data_len
-                          : batch * batch_stride * channel_stride * stride * w_stride * data_len;
+        size_t size  =
+            (layout == conv::DefaultLayout() || conv::IsChannelsLastLayout(layout))
+                ? batch * channels * depth * height * width * data_len
+                : batch * batch_stride * channel_stride * stride * w_stride * data_len;
 
         in_width          = width;
         in_height         = height;
@@ -33,6 +33,7 @@
 #include <unordered_map>
 #include <string>
 #include <sstream>
+#include <vector>
 
 namespace miopen {
 
@@ -41,6 +42,10 @@ class ReadonlyRamDb
     public:
     ReadonlyRamDb(std::string path) : db_path(path) {}
 
+    /// Reads the records of the file into the db. Instances are normally created and filled by
+    /// GetCached(), the speed tests call it directly.
+    void Prefetch(const std::string& path, bool warn_if_unreadable);
+
     static ReadonlyRamDb& GetCached(const std::string& path,
                                     bool warn_if_unreadable,
                                     const std::string& arch = "",
@@ -79,6 +84,20 @@ class ReadonlyRamDb
         return FindRecord(key);
     }
 
+    /// The records are in memory already, this only gives the same interface as PlainTextDb.
+    std::unordered_map<std::string, DbRecord>
+    FindRecords(const std::vector<std::string>& keys) const
+    {
+        auto records = std::unordered_map<std::string, DbRecord>{};
+        for(const auto& key : keys)
+        {
+            auto record = FindRecord(key);
+            if(record)
+                records.emplace(key, std::move(*record));
+        }
+        return records;
+    }
+
     template <class TProblem, class TValue>
     bool Load(const TProblem& problem, const std::string& id, TValue& value) const
     {
@@ -102,8 +121,6 @@ class ReadonlyRamDb
     ReadonlyRamDb(ReadonlyRamDb&&)      = default;
     ReadonlyRamDb& operator=(const ReadonlyRamDb&) = default;
     ReadonlyRamDb& operator=(ReadonlyRamDb&&) = default;
-
-    void Prefetch(const std::string& path, bool warn_if_unreadable);
 };
 
 } // namespace miopen
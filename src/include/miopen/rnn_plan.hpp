@@ -0,0 +1,146 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_RNN_PLAN_HPP_
+#define GUARD_MIOPEN_RNN_PLAN_HPP_
+
+#include <miopen/miopen.h>
+#include <miopen/gemm_v2.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace miopen {
+
+struct RNNDescriptor;
+
+enum class RNNPlanPass
+{
+    ForwardInference,
+    ForwardTraining,
+    BackwardData,
+};
+
+/// Everything the launch schedule of one pass depends on. Plans are cached by this key.
+struct RNNPlanKey
+{
+    RNNPlanPass pass;
+    miopenRNNMode_t rnn_mode;
+    bool bidirectional;
+    int layers;
+    int hidden_tensors; // nHiddenTensorsPerLayer
+    int workspace_scale;
+    miopenDataType_t data_type;
+    int in_h;              // input vector size, 0 in the skip input mode
+    int hy_h;              // hidden size
+    int hy_n;              // max batch size
+    std::vector<int> in_n; // batch size of every time step
+    bool batched_gemm;     // merge independent GEMMs of both directions, see BuildRNNLaunchPlan
+
+    friend bool operator<(const RNNPlanKey& l, const RNNPlanKey& r);
+    friend bool operator==(const RNNPlanKey& l, const RNNPlanKey& r);
+};
+
+/// Buffer an operand of a planned launch lives in. Work is the workspace in inference
+/// and the reserve space in training, like in the hand written passes.
+enum class RNNPlanBuffer
+{
+    Hx,
+    Weights,
+    Work,
+};
+
+/// A GEMM of the plan. Merged launches have desc.batch_count > 1 and the offsets of the first
+/// batch, the other ones follow at desc.strideA/B/C.
+struct RNNGemmLaunch
+{
+    GemmDescriptor desc;
+    RNNPlanBuffer a;
+    int a_offset;
+    RNNPlanBuffer b;
+    int b_offset;
+    RNNPlanBuffer c;
+    int c_offset;
+};
+
+/// One (layer, time step, direction) cell of the recurrence.
+struct RNNPlanStep
+{
+    int cur_time;      // sequence position processed by this cell
+    int use_time;      // neighbouring position the recurrence reads from, 0 if there is none
+    int cur_batch;     // number of rows of all time steps stored before cur_time
+    int offset;        // first row of cur_time in the hidden state buffer
+    int pretime_shift; // first row of use_time in the hidden state buffer, 0 if there is none
+    std::size_t gemm_begin;
+    std::size_t gemm_end;
+};
+
+/// Launch schedule of the hidden state recurrence of one RNN pass. All offsets and GEMM
+/// descriptors are computed once by BuildRNNLaunchPlan, the passes only look the cells up
+/// and replay the GEMM records in order.
+struct RNNLaunchPlan
+{
+    RNNPlanKey key;
+    int seq_len;
+    int bi;
+    int batch_n;
+    int hy_stride;
+    int uni_stride;
+    int wei_stride;
+    int wei_len;
+    int hid_off;
+
+    /// Indexed by (layer, time step, direction), see Step().
+    std::vector<RNNPlanStep> steps;
+    /// In the order the pass issues them.
+    std::vector<RNNGemmLaunch> gemms;
+
+    const RNNPlanStep& Step(int layer, int ti, int ri) const
+    {
+        return steps[(static_cast<std::size_t>(layer) * seq_len + ti) * bi + ri];
+    }
+};
+
+RNNPlanKey MakeRNNPlanKey(const RNNDescriptor& rnn,
+                          RNNPlanPass pass,
+                          miopenDataType_t data_type,
+                          int in_h,
+                          int hy_h,
+                          int hy_n,
+                          const std::vector<int>& in_n);
+
+/// With key.batched_gemm the forward passes issue the recurrent GEMMs of both directions of
+/// a time step, which have the same shape and do not depend on each other, as one strided
+/// batched launch. It is stored in the cell of the forward direction.
+RNNLaunchPlan BuildRNNLaunchPlan(const RNNPlanKey& key);
+
+/// Returns the cached plan for the key, building it on the first use.
+std::shared_ptr<const RNNLaunchPlan> GetRNNLaunchPlan(const RNNPlanKey& key);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_RNN_PLAN_HPP_
@@ -32,8 +32,10 @@
 #include <miopen/each_args.hpp>
 #include <miopen/returns.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/inline_vector.hpp>
 
 #include <cassert>
+#include <string>
 #include <vector>
 
 namespace miopen {
@@ -114,6 +116,12 @@ std::ptrdiff_t integer_division_ceil(X x, Y y)
     return (tx + ty - 1) / ty;
 }
 
+/// Maximum number of dimensions of a TensorDescriptor.
+constexpr std::size_t TensorMaxDims = 8;
+
+/// Lengths and strides of tensors are stored inline, so building descriptors does not allocate.
+using TensorDims = InlineVector<std::size_t, TensorMaxDims>;
+
 struct TensorDescriptor : miopenTensorDescriptor
 {
     TensorDescriptor();
@@ -125,8 +133,9 @@ struct TensorDescriptor : miopenTensorDescriptor
     TensorDescriptor(miopenDataType_t t, const int* plens, const int* pstrides, int size);
 
     TensorDescriptor(miopenDataType_t t,
-                     std::vector<std::size_t> lens_in,
-                     std::vector<std::size_t> strides_in);
+                     const std::vector<std::size_t>& lens_in,
+                     const std::vector<std::size_t>& strides_in);
+    TensorDescriptor(miopenDataType_t t, const TensorDims& lens_in, const TensorDims& strides_in);
 
     template <class Range>
     TensorDescriptor(miopenDataType_t t, const Range& plens)
@@ -144,8 +153,8 @@ struct TensorDescriptor : miopenTensorDescriptor
 
     void CalculateStrides();
 
-    const std::vector<std::size_t>& GetLengths() const;
-    const std::vector<std::size_t>& GetStrides() const;
+    const TensorDims& GetLengths() const;
+    const TensorDims& GetStrides() const;
     int GetSize() const;
 
     miopenDataType_t GetType() const;
@@ -166,6 +175,14 @@ struct TensorDescriptor : miopenTensorDescriptor
 
     bool IsPacked() const;
 
+    /// Order of the dimensions in memory, outermost first. labels names the dimensions in the
+    /// order of the lengths, e.g. "NCHW", and the result is a permutation of it, e.g. "NHWC"
+    /// for a channels-last tensor. Dimensions with equal strides keep the order of labels.
+    std::string GetLayout(const std::string& labels) const;
+    /// True if the tensor can be addressed as stored in the given layout: every dimension of
+    /// it, except the ones of length 1, spans at most the stride of the previous one.
+    bool IsPossibleLayout(const std::string& labels, const std::string& layout) const;
+
     bool operator==(const TensorDescriptor& rhs) const;
     bool operator!=(const TensorDescriptor& rhs) const;
     bool operator<(const TensorDescriptor& rhs) const;
@@ -176,14 +193,21 @@ struct TensorDescriptor : miopenTensorDescriptor
     friend std::ostream& operator<<(std::ostream& stream, const TensorDescriptor& t);
 
     private:
-    std::vector<std::size_t> lens;
-    std::vector<std::size_t> strides;
+    TensorDims lens;
+    TensorDims strides;
 
     bool packed;
 
     miopenDataType_t type = miopenFloat;
 };
 
+/// Strides of a packed tensor with the lengths given in the order of labels and stored in
+/// the order of layout. GetPackedStrides({n, c, h, w}, "NCHW", "NHWC") gives channels-last
+/// strides.
+std::vector<std::size_t> GetPackedStrides(const std::vector<std::size_t>& lens,
+                                          const std::string& labels,
+                                          const std::string& layout);
+
 } // namespace miopen
 
 MIOPEN_DEFINE_OBJECT(miopenTensorDescriptor, miopen::TensorDescriptor)
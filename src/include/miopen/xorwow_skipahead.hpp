@@ -0,0 +1,210 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_XORWOW_SKIPAHEAD_HPP_
+#define GUARD_MIOPEN_XORWOW_SKIPAHEAD_HPP_
+
+#include <miopen/dropout.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace miopen {
+
+/// Xorshift part of the xorwow state: x, y, z, w, v. The Weyl sequence value is not linear.
+using XorwowVector = std::array<std::uint32_t, 5>;
+
+/// Host side engine for skipping ahead xorwow generators, used by the dropout emulators.
+///
+/// The xorshift step is linear over GF(2), so skipping n steps is a product with the n-th
+/// power of its 160x160 bit matrix. Row r of a matrix is the image of state bit r, bit r % 32 of
+/// word r / 32, which is the layout of the precalculated tables of MIOpenDropout.cl.
+struct XorwowMatrix
+{
+    static constexpr std::size_t words = 5;
+    static constexpr std::size_t bits  = words * 32;
+
+    std::array<XorwowVector, bits> rows;
+
+    static XorwowMatrix Identity()
+    {
+        XorwowMatrix m{};
+        for(std::size_t r = 0; r < bits; r++)
+            m.rows[r][r / 32] = 1U << (r % 32);
+        return m;
+    }
+
+    /// One step of the generator.
+    static XorwowMatrix Step()
+    {
+        XorwowMatrix m{};
+        for(std::size_t r = 0; r < bits; r++)
+        {
+            XorwowVector s{};
+            s[r / 32] = 1U << (r % 32);
+
+            const std::uint32_t t = s[0] ^ (s[0] >> 2);
+            m.rows[r] = {s[1], s[2], s[3], s[4], (s[4] ^ (s[4] << 4)) ^ (t ^ (t << 1))};
+        }
+        return m;
+    }
+};
+
+/// Four Russians form of a matrix: the products of the matrix with all 16 values of every nibble
+/// of the state. A vector-matrix product takes 40 lookups and word-wise XORs instead of one per
+/// set bit.
+struct XorwowTable
+{
+    static constexpr std::size_t nibbles = XorwowMatrix::bits / 4;
+
+    explicit XorwowTable(const XorwowMatrix& m) : entries(nibbles * 16)
+    {
+        for(std::size_t n = 0; n < nibbles; n++)
+        {
+            auto* entry = &entries[n * 16];
+            entry[0]    = XorwowVector{};
+            for(std::size_t b = 0; b < 4; b++)
+            {
+                for(std::size_t c = 0; c < (1U << b); c++)
+                    entry[c | (1U << b)] = Xor(entry[c], m.rows[n * 4 + b]);
+            }
+        }
+    }
+
+    XorwowVector Apply(const XorwowVector& v) const
+    {
+        XorwowVector result{};
+        for(std::size_t w = 0; w < XorwowMatrix::words; w++)
+        {
+            for(std::size_t n = 0; n < 8; n++)
+            {
+                const auto c = (v[w] >> (n * 4)) & 0xFU;
+                result       = Xor(result, entries[(w * 8 + n) * 16 + c]);
+            }
+        }
+        return result;
+    }
+
+    private:
+    std::vector<XorwowVector> entries;
+
+    static XorwowVector Xor(const XorwowVector& l, const XorwowVector& r)
+    {
+        XorwowVector result;
+        for(std::size_t w = 0; w < XorwowMatrix::words; w++)
+            result[w] = l[w] ^ r[w];
+        return result;
+    }
+};
+
+/// The map applying l, then r.
+inline XorwowMatrix operator*(const XorwowMatrix& l, const XorwowMatrix& r)
+{
+    const XorwowTable table{r};
+    XorwowMatrix result;
+    for(std::size_t i = 0; i < XorwowMatrix::bits; i++)
+        result.rows[i] = table.Apply(l.rows[i]);
+    return result;
+}
+
+inline XorwowMatrix Pow(XorwowMatrix m, unsigned long long power)
+{
+    auto result = XorwowMatrix::Identity();
+    while(power != 0)
+    {
+        if((power & 1) != 0)
+            result = result * m;
+        power >>= 1;
+        if(power != 0)
+            m = m * m;
+    }
+    return result;
+}
+
+/// m^(2^k) for k < 64 as tables, so any number of jumps by m takes at most 64 products.
+struct XorwowSkipAhead
+{
+    static constexpr std::size_t jumps = 64;
+
+    explicit XorwowSkipAhead(XorwowMatrix m)
+    {
+        matrices.reserve(jumps);
+        tables.reserve(jumps);
+        for(std::size_t k = 0; k < jumps; k++)
+        {
+            if(k > 0)
+                m = m * m;
+            matrices.push_back(m);
+            tables.emplace_back(m);
+        }
+    }
+
+    /// m^(2^k).
+    const XorwowMatrix& Matrix(std::size_t k) const { return matrices.at(k); }
+
+    XorwowVector Apply(unsigned long long skip, XorwowVector v) const
+    {
+        for(std::size_t k = 0; skip != 0; k++, skip >>= 1)
+        {
+            if((skip & 1) != 0)
+                v = tables[k].Apply(v);
+        }
+        return v;
+    }
+
+    void Apply(unsigned long long skip, prngStates& state) const
+    {
+        const auto v = Apply(skip, XorwowVector{state.x, state.y, state.z, state.w, state.v});
+        state.x      = v[0];
+        state.y      = v[1];
+        state.z      = v[2];
+        state.w      = v[3];
+        state.v      = v[4];
+    }
+
+    /// Skips single steps of a sequence.
+    static const XorwowSkipAhead& Offset()
+    {
+        static const XorwowSkipAhead skipahead{XorwowMatrix::Step()};
+        return skipahead;
+    }
+
+    /// Skips whole subsequences, which are 2^67 steps long.
+    static const XorwowSkipAhead& Sequence()
+    {
+        static const XorwowSkipAhead skipahead{Pow(Offset().Matrix(jumps - 1), 1ULL << 4)};
+        return skipahead;
+    }
+
+    private:
+    std::vector<XorwowMatrix> matrices;
+    std::vector<XorwowTable> tables;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_XORWOW_SKIPAHEAD_HPP_
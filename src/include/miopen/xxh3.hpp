@@ -0,0 +1,76 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_XXH3_HPP_
+#define GUARD_MIOPEN_XXH3_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace miopen {
+
+/// Incremental XXH3 128 bit hash (https://github.com/Cyan4973/xxHash) with the default secret
+/// and seed 0, it gives the same results as XXH3_128bits(). Not cryptographic, it is meant
+/// for lookup keys and integrity checks, and is many times faster than md5. Final() does not
+/// change the state, more data may be added afterwards.
+class Xxh3
+{
+    public:
+    static constexpr std::size_t digest_size = 16;
+    /// Canonical form, the high half first, both big endian.
+    using Digest = std::array<unsigned char, digest_size>;
+
+    Xxh3();
+    void Update(const void* data, std::size_t size);
+    void Update(const std::string& s) { Update(s.data(), s.size()); }
+    Digest Final() const;
+
+    private:
+    static constexpr std::size_t stripe_size = 64;
+    static constexpr std::size_t max_short   = 240;
+
+    void ConsumeStripe(const unsigned char* stripe);
+
+    std::uint64_t acc[8];
+    std::size_t stripes = 0; // consumed in the current block
+    std::uint64_t total = 0;
+    bool is_long        = false;
+    // Input not consumed yet, all of it while the total is at most max_short.
+    unsigned char buffer[max_short];
+    std::size_t buffered = 0;
+    // The last 64 bytes of the input are hashed again at the end.
+    unsigned char last_stripe[stripe_size];
+};
+
+Xxh3::Digest xxh3(const void* data, std::size_t size);
+
+/// Hex digits of the canonical XXH3 128 bit hash.
+std::string xxh3(const std::string& s);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_XXH3_HPP_
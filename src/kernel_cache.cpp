@@ -112,7 +112,7 @@ static void AddKernelDumpKernelParams(const std::string& program_name,
                            << params);
 }
 
-static void ProcessParams(std::string& params)
+void KernelCache::ProcessParams(std::string& params)
 {
     if(params.length() > 0)
     {
@@ -162,8 +162,9 @@ bool KernelCache::HasKernels(const std::string& algorithm, const std::string& ne
     return true;
 }
 
-bool KernelCache::HasProgram(const std::string& name, const std::string& params) const
+bool KernelCache::HasProgram(const std::string& name, std::string params) const
 {
+    ProcessParams(params);
     const auto key = std::make_pair(name, params);
     return program_map.count(key) > 0;
 }
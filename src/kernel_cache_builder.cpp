@@ -0,0 +1,147 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/kernel_cache_builder.hpp>
+#include <miopen/config.h>
+#include <miopen/device_name.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/kern_db.hpp>
+#include <miopen/kernel_cache.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/par_for.hpp>
+
+#if MIOPEN_BACKEND_HIP
+#include <miopen/hipoc_program.hpp>
+#endif
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace miopen {
+
+KernelCacheTarget ParseKernelCacheTarget(const std::string& spec)
+{
+    const auto colon = spec.find(':');
+    if(colon == 0 || colon == std::string::npos || colon + 1 == spec.size())
+        MIOPEN_THROW(miopenStatusBadParm, "Target should be <device>:<CUs>: " + spec);
+
+    const auto cus = spec.substr(colon + 1);
+    if(!std::all_of(cus.begin(), cus.end(), [](char c) { return c >= '0' && c <= '9'; }))
+        MIOPEN_THROW(miopenStatusBadParm, "Invalid number of CUs: " + spec);
+
+    const auto num_cu = std::stoul(cus);
+    if(num_cu == 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Invalid number of CUs: " + spec);
+    return {GetDeviceNameFromMap(spec.substr(0, colon)), num_cu};
+}
+
+std::string GetKernelCacheFileName(const KernelCacheTarget& target)
+{
+    return Handle::GetDbBasename(target.device, target.num_cu) + ".kdb";
+}
+
+std::vector<KernelCacheProgram>
+GetKernelCachePrograms(const std::vector<solver::KernelInfo>& kernels, const std::string& device)
+{
+    std::vector<KernelCacheProgram> programs;
+    std::set<std::pair<std::string, std::string>> known;
+    for(const auto& kernel : kernels)
+    {
+        // Options as KernelCache::AddKernel() and Handle::LoadProgram() make them.
+        auto args = kernel.comp_options;
+        KernelCache::ProcessParams(args);
+        args += " -mcpu=" + device;
+        if(known.emplace(kernel.kernel_file, args).second)
+            programs.push_back({kernel.kernel_file, args});
+    }
+    return programs;
+}
+
+std::string CompileKernelCacheProgram(const KernelCacheProgram& program,
+                                      const std::string& device)
+{
+#if MIOPEN_BACKEND_HIP
+    return CompileCodeObject(program.name, program.args, false, device, "");
+#else
+    (void)program;
+    (void)device;
+    MIOPEN_THROW(miopenStatusNotImplemented, "Kernel cache can only be built for HIP");
+#endif
+}
+
+KernelCacheBuildResult BuildKernelCache(const std::string& path,
+                                        const KernelCacheTarget& target,
+                                        const std::vector<KernelCacheProgram>& programs,
+                                        const KernelCacheCompiler& compile,
+                                        std::size_t max_jobs)
+{
+    KernDb db{path, false, target.device, target.num_cu};
+    KernelCacheBuildResult result;
+
+    // Records are named like the ones of the binary cache, see LoadBinary().
+    std::vector<KernelCacheProgram> missing;
+    for(const auto& program : programs)
+    {
+        const KernelConfig cfg{program.name + ".o", program.args, ""};
+        if(db.FindRecord(cfg))
+            result.present++;
+        else
+            missing.push_back(program);
+    }
+
+    std::mutex mutex;
+    std::vector<char> failed(missing.size(), 0); // not vector<bool>, set concurrently
+    par_for(missing.size(), max_threads{std::max<std::size_t>(max_jobs, 1)}, [&](auto i) {
+        const auto& program = missing[i];
+        try
+        {
+            const auto blob = compile(program, target.device);
+            const KernelConfig cfg{program.name + ".o", program.args, blob};
+            std::lock_guard<std::mutex> lock(mutex);
+            db.StoreRecord(cfg);
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_E("Failed to build " << program.name << " '" << program.args << "': "
+                                            << ex.what());
+            failed[i] = 1;
+        }
+    });
+
+    for(std::size_t i = 0; i < missing.size(); i++)
+    {
+        if(failed[i] != 0)
+            result.failed.push_back(missing[i]);
+        else
+            result.built++;
+    }
+    return result;
+}
+
+} // namespace miopen
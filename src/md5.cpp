@@ -41,18 +41,8 @@
 #include <array>
 #include <cstring>
 #include <cstdint>
-#include <sstream>
-#include <iomanip>
 
-#define MD5_DIGEST_LENGTH 16
-
-struct MD5_CTX
-{
-    uint32_t lo, hi;
-    uint32_t a, b, c, d;
-    unsigned char buffer[64];
-    uint32_t block[MD5_DIGEST_LENGTH];
-};
+using MD5_CTX = miopen::Md5::Context;
 
 /*
  * The basic MD5 functions.
@@ -300,20 +290,31 @@ static void MD5_Final(unsigned char* result, MD5_CTX* ctx)
 
 namespace miopen {
 
-std::string md5(std::string s)
-{
-    std::array<unsigned char, MD5_DIGEST_LENGTH> result{};
+Md5::Md5() : ctx() { MD5_Init(&ctx); }
+
+void Md5::Update(const void* data, std::size_t size) { MD5_Update(&ctx, data, size); }
 
-    MD5_CTX ctx{};
-    MD5_Init(&ctx);
-    MD5_Update(&ctx, s.data(), s.length());
+Md5::Digest Md5::Final()
+{
+    Digest result{};
     MD5_Final(result.data(), &ctx);
+    return result;
+}
 
-    std::ostringstream sout;
-    sout << std::hex << std::setfill('0');
-    for(auto c : result)
-        sout << std::setw(2) << int{c};
+void WriteHex(const unsigned char* data, std::size_t size, char* out)
+{
+    static const char digits[] = "0123456789abcdef";
+    for(std::size_t i = 0; i < size; i++)
+    {
+        out[2 * i]     = digits[data[i] >> 4];
+        out[2 * i + 1] = digits[data[i] & 0xf];
+    }
+}
 
-    return sout.str();
+std::string md5(const std::string& s)
+{
+    Md5 hash;
+    hash.Update(s);
+    return ToHex(hash.Final());
 }
 } // namespace miopen
@@ -26,7 +26,9 @@
 #include <miopen/algorithm.hpp>
 #include <miopen/conv_algo_name.hpp>
 #include <miopen/check_numerics.hpp>
+#include <miopen/compile_scheduler.hpp>
 #include <miopen/config.h>
+#include <miopen/context_cache.hpp>
 #include <miopen/convolution.hpp>
 #include <miopen/conv_algo_name.hpp>
 #include <miopen/db.hpp>
@@ -59,6 +61,7 @@
 #endif
 
 #include <cassert>
+#include <set>
 #include <type_traits>
 
 #include <boost/range/adaptors.hpp>
@@ -1776,13 +1779,14 @@ static inline bool IsAlgorithmDisabled(const miopenConvAlgorithm_t algo)
 }
 
 void GetSolutions(Handle& handle,
-                  const ProblemDescription& problem,
+                  const ConvolutionContext& ctx,
                   const size_t maxSolutionCount,
                   size_t* solutionCount,
                   miopenConvSolution_t* solutions,
+                  const std::size_t workspace_limit,
                   std::function<int(const std::string&)>&& algoResolver)
 {
-    const FindDbRecord fdb_record{handle, problem};
+    const FindDbRecord fdb_record{handle, ctx};
 
     if(fdb_record.empty())
     {
@@ -1810,15 +1814,12 @@ void GetSolutions(Handle& handle,
     // Applicability is also affected by presence of external tools (e.g. assembler)
     // ROCm version, specific features of GPU (like xnack) etc.
     // All the above can be found by calling IsApplicable().
-    // We need fully initialized context for this, see below.
-    auto ctx = ConvolutionContext{problem};
-    ctx.SetStream(&handle);
-    ctx.DetectRocm();
+    // We need fully initialized context for this, the caller provides it.
 
     for(const auto& pair : fdb_record)
     {
         const auto algo = static_cast<miopenConvAlgorithm_t>(algoResolver(pair.first));
-        if(IsAlgorithmDisabled(algo))
+        if(IsAlgorithmDisabled(algo) || pair.second.workspace > workspace_limit)
             continue;
 
         const auto solver_id = solver::Id{pair.second.solver_id};
@@ -1851,6 +1852,17 @@ void GetSolutions(Handle& handle,
     *solutionCount = i;
 }
 
+// The fallback solutions are not filtered by GetSolutions().
+static void ApplyWorkspaceLimit(const std::size_t workspace_limit,
+                                size_t* const solutionCount,
+                                miopenConvSolution_t* const solutions)
+{
+    const auto end = std::remove_if(solutions, solutions + *solutionCount, [&](auto&& solution) {
+        return solution.workspace_size > workspace_limit;
+    });
+    *solutionCount = std::distance(solutions, end);
+}
+
 void ConvolutionDescriptor::GetForwardSolutionsFallback(Handle& handle,
                                                         const TensorDescriptor& wDesc,
                                                         const TensorDescriptor& xDesc,
@@ -1950,7 +1962,8 @@ void ConvolutionDescriptor::GetForwardSolutions(Handle& handle,
                                                 const TensorDescriptor& yDesc,
                                                 const size_t maxSolutionCount,
                                                 size_t* const solutionCount,
-                                                miopenConvSolution_t* const solutions) const
+                                                miopenConvSolution_t* const solutions,
+                                                const std::size_t workspace_limit) const
 {
     MIOPEN_LOG_I("");
     if(solutionCount == nullptr)
@@ -1958,13 +1971,22 @@ void ConvolutionDescriptor::GetForwardSolutions(Handle& handle,
     if(solutions == nullptr)
         MIOPEN_THROW(miopenStatusBadParm, "solutions cannot be nullptr");
 
-    const auto problem = ProblemDescription{xDesc, wDesc, yDesc, *this, conv::Direction::Forward};
-    GetSolutions(
-        handle, problem, maxSolutionCount, solutionCount, solutions, StringToConvolutionFwdAlgo);
+    const auto ctx =
+        GetConvolutionContext(handle, xDesc, wDesc, yDesc, *this, conv::Direction::Forward);
+    GetSolutions(handle,
+                 ctx->context,
+                 maxSolutionCount,
+                 solutionCount,
+                 solutions,
+                 workspace_limit,
+                 StringToConvolutionFwdAlgo);
 
     if(*solutionCount == 0)
+    {
         GetForwardSolutionsFallback(
             handle, wDesc, xDesc, yDesc, maxSolutionCount, solutionCount, solutions);
+        ApplyWorkspaceLimit(workspace_limit, solutionCount, solutions);
+    }
 }
 
 std::size_t
@@ -2046,12 +2068,11 @@ std::size_t ConvolutionDescriptor::GetForwardSolutionWorkspaceSize(Handle& handl
         MIOPEN_THROW(miopenStatusBadParm, "invalid solution id = " + solver_id.ToString());
     if(solver_id != solver::Id::gemm() && solver_id != solver::Id::fft())
     {
-        auto sol = solver_id.GetSolver();
-        auto ctx = ConvolutionContext{xDesc, wDesc, yDesc, *this, conv::Direction::Forward};
-        ctx.SetStream(&handle);
-        ctx.DetectRocm();
-        if(sol.IsApplicable(ctx))
-            return sol.GetWorkspaceSize(ctx);
+        auto sol       = solver_id.GetSolver();
+        const auto ctx =
+            GetConvolutionContext(handle, xDesc, wDesc, yDesc, *this, conv::Direction::Forward);
+        if(sol.IsApplicable(ctx->context))
+            return sol.GetWorkspaceSize(ctx->context);
         else
         {
             MIOPEN_THROW(miopenStatusBadParm,
@@ -2066,14 +2087,12 @@ std::size_t ConvolutionDescriptor::GetForwardSolutionWorkspaceSize(Handle& handl
 }
 
 // Todo: remove when all immediate mode calls will support invokers
+// The contexts come from GetConvolutionContext(), so they are fully set up.
 static std::vector<KernelInvoke> CompileSolver(const Handle& handle,
-                                               ConvolutionContext& ctx,
+                                               const ConvolutionContext& ctx,
                                                solver::Id solver_id,
                                                const FindDbKCacheKey& key)
 {
-    ctx.DetectRocm();
-    ctx.SetupFloats();
-
     const auto solver   = solver_id.GetSolver();
     auto db             = GetDb(ctx);
     const auto solution = solver.FindSolution(ctx, db);
@@ -2084,14 +2103,11 @@ static std::vector<KernelInvoke> CompileSolver(const Handle& handle,
 }
 
 static Invoker PrepareInvoker(Handle& handle,
-                              ConvolutionContext& ctx,
+                              const ConvolutionContext& ctx,
                               const NetworkConfig& config,
                               solver::Id solver_id,
                               conv::Direction dir)
 {
-    ctx.DetectRocm();
-    ctx.SetupFloats();
-
     const auto solver = solver_id.GetSolver();
     auto db           = GetDb(ctx);
     auto solution     = solver.FindSolution(ctx, db);
@@ -2102,12 +2118,12 @@ static Invoker PrepareInvoker(Handle& handle,
 }
 
 static Invoker LoadOrPrepareInvoker(Handle& handle,
-                                    ConvolutionContext& ctx,
+                                    const ConvolutionContext& ctx,
+                                    const NetworkConfig& config,
                                     solver::Id solver_id,
                                     conv::Direction dir)
 {
-    const auto config = ctx.BuildConfKey();
-    auto invoker      = handle.GetInvoker(config, solver_id);
+    auto invoker = handle.GetInvoker(config, solver_id);
     if(invoker)
         return *invoker;
     return PrepareInvoker(handle, ctx, config, solver_id, dir);
@@ -2121,7 +2137,7 @@ static bool CheckInvokerSupport(const solver::Id solver_id, conv::Direction dir)
 
 static void CompileSolution(Handle& handle,
                             const solver::Id solver_id,
-                            ConvolutionContext& ctx,
+                            const ConvolutionContext& ctx,
                             conv::Direction dir,
                             std::function<void()>&& fft_finder)
 {
@@ -2130,7 +2146,7 @@ static void CompileSolution(Handle& handle,
 
     if(CheckInvokerSupport(solver_id, dir))
     {
-        LoadOrPrepareInvoker(handle, ctx, solver_id, dir);
+        LoadOrPrepareInvoker(handle, ctx, ctx.BuildConfKey(), solver_id, dir);
         return;
     }
 
@@ -2167,6 +2183,150 @@ static void CompileSolution(Handle& handle,
     MIOPEN_THROW(miopenStatusNotImplemented);
 }
 
+static std::shared_ptr<CompileJob> CompileSolutionAsync(Handle& handle,
+                                                        const solver::Id solver_id,
+                                                        const ConvolutionContext& ctx,
+                                                        conv::Direction dir,
+                                                        int priority)
+{
+    if(!solver_id.IsValid())
+        MIOPEN_THROW(miopenStatusBadParm, "solver_id = " + solver_id.ToString());
+
+    const auto done = [] {
+        return std::make_shared<CompileJob>(std::vector<std::function<void()>>{});
+    };
+
+    // GEMM has nothing to precompile and FFT kernels are only built by the find.
+    if(solver_id == solver::Id::gemm() || solver_id == solver::Id::fft())
+        return done();
+    if(CheckInvokerSupport(solver_id, dir) && handle.GetInvoker(ctx.BuildConfKey(), solver_id))
+        return done();
+
+    const auto solver = solver_id.GetSolver();
+    if(!solver.IsApplicable(ctx))
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "The supplied solution id: " + solver_id.ToString() +
+                         " is not applicable to the current problem");
+    auto db             = GetDb(ctx);
+    const auto solution = solver.FindSolution(ctx, db);
+    return handle.CompileAsync(solution.construction_params, priority);
+}
+
+static std::function<int(const std::string&)> GetAlgorithmResolver(conv::Direction dir)
+{
+    switch(dir)
+    {
+    case conv::Direction::Forward: return StringToConvolutionFwdAlgo;
+    case conv::Direction::BackwardData: return StringToConvolutionBwdDataAlgo;
+    case conv::Direction::BackwardWeights: return StringToConvolutionBwdWeightsAlgo;
+    }
+    MIOPEN_THROW(miopenStatusInternalError);
+}
+
+// conv::ProblemDescription has in = dy for the backward directions, the descriptor functions take
+// the tensors of the forward convolution: x, w and y.
+static const TensorDescriptor& GetX(const conv::ProblemDescription& problem)
+{
+    return problem.GetDirection() == conv::Direction::Forward ? problem.GetIn() : problem.GetOut();
+}
+
+static const TensorDescriptor& GetY(const conv::ProblemDescription& problem)
+{
+    return problem.GetDirection() == conv::Direction::Forward ? problem.GetOut() : problem.GetIn();
+}
+
+// The public entry points also build the FFT kernels, which have no asynchronous build.
+static void CompileProblemSolution(Handle& handle,
+                                   const conv::ProblemDescription& problem,
+                                   solver::Id solver_id)
+{
+    const auto& descriptor = problem.GetConv();
+    const auto& x          = GetX(problem);
+    const auto& w          = problem.GetWeights();
+    const auto& y          = GetY(problem);
+    switch(problem.GetDirection())
+    {
+    case conv::Direction::Forward:
+        descriptor.CompileForwardSolution(handle, w, x, y, solver_id);
+        break;
+    case conv::Direction::BackwardData:
+        descriptor.CompileBackwardSolution(handle, y, w, x, solver_id);
+        break;
+    case conv::Direction::BackwardWeights:
+        descriptor.CompileWrwSolution(handle, y, x, w, solver_id);
+        break;
+    }
+}
+
+std::size_t PrefetchConvolutions(Handle& handle,
+                                 const std::vector<conv::ProblemDescription>& problems,
+                                 bool compile)
+{
+    // Immediate mode looks the records up with these.
+    const auto descriptions = std::vector<ProblemDescription>(problems.begin(), problems.end());
+
+    const auto found = FindDbRecord::Prefetch(handle, descriptions);
+    if(!compile || found == 0)
+        return found;
+
+    struct Warmup
+    {
+        const conv::ProblemDescription* problem;
+        std::shared_ptr<const CachedConvolutionContext> cached;
+        solver::Id solver_id;
+        std::shared_ptr<CompileJob> job;
+    };
+
+    std::vector<Warmup> warmups;
+    // A model repeats its layers, each problem is built once.
+    std::set<const CachedConvolutionContext*> queued;
+
+    for(const auto& problem : problems)
+    {
+        const auto dir    = problem.GetDirection();
+        const auto cached = GetConvolutionContext(
+            handle, GetX(problem), problem.GetWeights(), GetY(problem), problem.GetConv(), dir);
+        if(queued.count(cached.get()) != 0)
+            continue;
+
+        auto solution = miopenConvSolution_t{};
+        auto count    = std::size_t{0};
+        GetSolutions(handle,
+                     cached->context,
+                     1,
+                     &count,
+                     &solution,
+                     std::numeric_limits<std::size_t>::max(),
+                     GetAlgorithmResolver(dir));
+        if(count == 0)
+            continue;
+
+        auto ctx                   = cached->context;
+        ctx.disable_search_enforce = true;
+        const auto solver_id       = solver::Id{solution.solution_id};
+        auto job                   = CompileSolutionAsync(handle, solver_id, ctx, dir, 0);
+        queued.insert(cached.get());
+        warmups.push_back({&problem, cached, solver_id, std::move(job)});
+    }
+
+    MIOPEN_LOG_I("Building the solutions of " << warmups.size() << " problems");
+
+    // The programs are in the cache now, so this only creates the invokers and the kernels.
+    for(const auto& warmup : warmups)
+    {
+        warmup.job->Wait();
+        if(warmup.job->GetError())
+        {
+            MIOPEN_LOG_W("Build of " << warmup.solver_id.ToString() << " has failed for "
+                                     << warmup.cached->network_config.ToString());
+            continue;
+        }
+        CompileProblemSolution(handle, *warmup.problem, warmup.solver_id);
+    }
+
+    return found;
+}
+
 void ConvolutionDescriptor::CompileForwardSolution(Handle& handle,
                                                    const TensorDescriptor& wDesc,
                                                    const TensorDescriptor& xDesc,
@@ -2175,8 +2335,9 @@ void ConvolutionDescriptor::CompileForwardSolution(Handle& handle,
 {
     MIOPEN_LOG_I("solver_id = " << solver_id.ToString());
 
-    auto ctx = ConvolutionContext{xDesc, wDesc, yDesc, *this, conv::Direction::Forward};
-    ctx.SetStream(&handle);
+    const auto cached =
+        GetConvolutionContext(handle, xDesc, wDesc, yDesc, *this, conv::Direction::Forward);
+    auto ctx                   = cached->context;
     ctx.disable_search_enforce = true;
 
     CompileSolution(handle, solver_id, ctx, conv::Direction::Forward, [&]() {
@@ -2187,6 +2348,24 @@ void ConvolutionDescriptor::CompileForwardSolution(Handle& handle,
     });
 }
 
+std::shared_ptr<CompileJob>
+ConvolutionDescriptor::CompileForwardSolutionAsync(Handle& handle,
+                                                   const TensorDescriptor& wDesc,
+                                                   const TensorDescriptor& xDesc,
+                                                   const TensorDescriptor& yDesc,
+                                                   const solver::Id solver_id,
+                                                   int priority) const
+{
+    MIOPEN_LOG_I("solver_id = " << solver_id.ToString() << ", priority = " << priority);
+
+    const auto cached =
+        GetConvolutionContext(handle, xDesc, wDesc, yDesc, *this, conv::Direction::Forward);
+    auto ctx                   = cached->context;
+    ctx.disable_search_enforce = true;
+
+    return CompileSolutionAsync(handle, solver_id, ctx, conv::Direction::Forward, priority);
+}
+
 void ConvolutionDescriptor::ConvolutionForwardImmediate(Handle& handle,
                                                         const TensorDescriptor& wDesc,
                                                         ConstData_t w,
@@ -2206,13 +2385,14 @@ void ConvolutionDescriptor::ConvolutionForwardImmediate(Handle& handle,
         MIOPEN_THROW(miopenStatusBadParm);
 
     ConvForwardCheckNumerics(handle, tensors, [&]() {
-        auto ctx = ConvolutionContext{xDesc, wDesc, yDesc, *this, conv::Direction::Forward};
-        ctx.SetStream(&handle);
+        const auto cached =
+            GetConvolutionContext(handle, xDesc, wDesc, yDesc, *this, conv::Direction::Forward);
+        const auto& ctx = cached->context;
 
         if(CheckInvokerSupport(solver_id, conv::Direction::Forward))
         {
-            const auto invoker =
-                LoadOrPrepareInvoker(handle, ctx, solver_id, conv::Direction::Forward);
+            const auto invoker = LoadOrPrepareInvoker(
+                handle, ctx, cached->network_config, solver_id, conv::Direction::Forward);
             const auto invoke_ctx = conv::DataInvokeParams{tensors, workSpace, workSpaceSize};
             invoker(handle, invoke_ctx);
             return;
@@ -2225,8 +2405,8 @@ void ConvolutionDescriptor::ConvolutionForwardImmediate(Handle& handle,
             return;
         }
 
-        const auto network_config = ctx.BuildConfKey();
-        const auto algo_name      = solver_id.GetAlgo(conv::Direction::Forward);
+        const auto& network_config = cached->network_config;
+        const auto algo_name       = solver_id.GetAlgo(conv::Direction::Forward);
         const auto&& chk_kernels  = handle.GetKernels(algo_name, network_config);
         auto v_chk_kernels = std::vector<KernelInvoke>{chk_kernels.begin(), chk_kernels.end()};
 
@@ -2243,9 +2423,7 @@ void ConvolutionDescriptor::ConvolutionForwardImmediate(Handle& handle,
             return;
         }
 
-        const auto problem =
-            ProblemDescription{xDesc, wDesc, yDesc, *this, conv::Direction::Forward};
-        const FindDbRecord fdb_record{handle, problem};
+        const FindDbRecord fdb_record{handle, ctx};
 
         for(const auto& pair : fdb_record)
         {
@@ -3097,7 +3275,8 @@ void ConvolutionDescriptor::GetBackwardSolutions(Handle& handle,
                                                  const TensorDescriptor& dxDesc,
                                                  size_t maxSolutionCount,
                                                  size_t* solutionCount,
-                                                 miopenConvSolution_t* solutions) const
+                                                 miopenConvSolution_t* solutions,
+                                                 std::size_t workspace_limit) const
 {
     MIOPEN_LOG_I("");
     if(solutionCount == nullptr)
@@ -3105,18 +3284,22 @@ void ConvolutionDescriptor::GetBackwardSolutions(Handle& handle,
     if(solutions == nullptr)
         MIOPEN_THROW(miopenStatusBadParm, "solutions cannot be nullptr");
 
-    const auto problem =
-        ProblemDescription{dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData};
+    const auto ctx =
+        GetConvolutionContext(handle, dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData);
     GetSolutions(handle,
-                 problem,
+                 ctx->context,
                  maxSolutionCount,
                  solutionCount,
                  solutions,
+                 workspace_limit,
                  StringToConvolutionBwdDataAlgo);
 
     if(*solutionCount == 0)
+    {
         GetBwdSolutionsFallback(
             handle, dyDesc, wDesc, dxDesc, maxSolutionCount, solutionCount, solutions);
+        ApplyWorkspaceLimit(workspace_limit, solutionCount, solutions);
+    }
 }
 
 void ConvolutionDescriptor::CompileBackwardSolution(Handle& handle,
@@ -3127,8 +3310,9 @@ void ConvolutionDescriptor::CompileBackwardSolution(Handle& handle,
 {
     MIOPEN_LOG_I("solver_id = " << solver_id.ToString());
 
-    auto ctx = ConvolutionContext{dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData};
-    ctx.SetStream(&handle);
+    const auto cached =
+        GetConvolutionContext(handle, dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData);
+    auto ctx                   = cached->context;
     ctx.disable_search_enforce = true;
 
     CompileSolution(handle, solver_id, ctx, conv::Direction::BackwardData, [&]() {
@@ -3139,6 +3323,24 @@ void ConvolutionDescriptor::CompileBackwardSolution(Handle& handle,
     });
 }
 
+std::shared_ptr<CompileJob>
+ConvolutionDescriptor::CompileBackwardSolutionAsync(Handle& handle,
+                                                    const TensorDescriptor& dyDesc,
+                                                    const TensorDescriptor& wDesc,
+                                                    const TensorDescriptor& dxDesc,
+                                                    const solver::Id solver_id,
+                                                    int priority) const
+{
+    MIOPEN_LOG_I("solver_id = " << solver_id.ToString() << ", priority = " << priority);
+
+    const auto cached =
+        GetConvolutionContext(handle, dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData);
+    auto ctx                   = cached->context;
+    ctx.disable_search_enforce = true;
+
+    return CompileSolutionAsync(handle, solver_id, ctx, conv::Direction::BackwardData, priority);
+}
+
 std::size_t ConvolutionDescriptor::GetBackwardSolutionWorkspaceSize(Handle& handle,
                                                                     const TensorDescriptor& dyDesc,
                                                                     const TensorDescriptor& wDesc,
@@ -3150,12 +3352,11 @@ std::size_t ConvolutionDescriptor::GetBackwardSolutionWorkspaceSize(Handle& hand
         MIOPEN_THROW(miopenStatusBadParm, "invalid solution id = " + solver_id.ToString());
     if(solver_id != solver::Id::gemm() && solver_id != solver::Id::fft())
     {
-        auto sol = solver_id.GetSolver();
-        auto ctx = ConvolutionContext{dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData};
-        ctx.SetStream(&handle);
-        ctx.DetectRocm();
-        if(sol.IsApplicable(ctx))
-            return sol.GetWorkspaceSize(ctx);
+        auto sol       = solver_id.GetSolver();
+        const auto ctx = GetConvolutionContext(
+            handle, dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData);
+        if(sol.IsApplicable(ctx->context))
+            return sol.GetWorkspaceSize(ctx->context);
         else
         {
             MIOPEN_THROW(miopenStatusBadParm,
@@ -3195,12 +3396,14 @@ void ConvolutionDescriptor::ConvolutionBackwardImmediate(Handle& handle,
         }
         ValidateGroupCount(dxDesc, wDesc, *this);
 
-        auto ctx = ConvolutionContext{dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData};
+        const auto cached = GetConvolutionContext(
+            handle, dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData);
+        const auto& ctx = cached->context;
 
         if(CheckInvokerSupport(solver_id, conv::Direction::BackwardData))
         {
-            const auto invoker =
-                LoadOrPrepareInvoker(handle, ctx, solver_id, conv::Direction::BackwardData);
+            const auto invoker = LoadOrPrepareInvoker(
+                handle, ctx, cached->network_config, solver_id, conv::Direction::BackwardData);
             const auto invoke_ctx = conv::DataInvokeParams{tensors, workSpace, workSpaceSize};
             invoker(handle, invoke_ctx);
             return;
@@ -3212,9 +3415,8 @@ void ConvolutionDescriptor::ConvolutionBackwardImmediate(Handle& handle,
             return;
         }
 
-        ctx.SetStream(&handle);
-        const auto network_config = ctx.BuildConfKey();
-        const auto algo_name      = solver_id.GetAlgo(conv::Direction::BackwardData);
+        const auto& network_config = cached->network_config;
+        const auto algo_name       = solver_id.GetAlgo(conv::Direction::BackwardData);
         const auto&& chk_kernels  = handle.GetKernels(algo_name, network_config);
         auto v_chk_kernels = std::vector<KernelInvoke>{chk_kernels.begin(), chk_kernels.end()};
 
@@ -3229,9 +3431,7 @@ void ConvolutionDescriptor::ConvolutionBackwardImmediate(Handle& handle,
             return;
         }
 
-        const auto problem =
-            ProblemDescription{dxDesc, wDesc, dyDesc, *this, conv::Direction::BackwardData};
-        const FindDbRecord fdb_record{handle, problem};
+        const FindDbRecord fdb_record{handle, ctx};
 
         for(const auto& pair : fdb_record)
         {
@@ -4704,7 +4904,8 @@ void ConvolutionDescriptor::GetWrwSolutions(Handle& handle,
                                             const TensorDescriptor& dwDesc,
                                             size_t maxSolutionCount,
                                             size_t* solutionCount,
-                                            miopenConvSolution_t* solutions) const
+                                            miopenConvSolution_t* solutions,
+                                            std::size_t workspace_limit) const
 {
     MIOPEN_LOG_I("");
     if(solutionCount == nullptr)
@@ -4712,17 +4913,22 @@ void ConvolutionDescriptor::GetWrwSolutions(Handle& handle,
     if(solutions == nullptr)
         MIOPEN_THROW(miopenStatusBadParm, "solutions cannot be nullptr");
 
-    const auto problem = MakeWrwProblem(dyDesc, xDesc, dwDesc);
+    const auto ctx = GetConvolutionContext(
+        handle, xDesc, dwDesc, dyDesc, *this, conv::Direction::BackwardWeights);
     GetSolutions(handle,
-                 problem,
+                 ctx->context,
                  maxSolutionCount,
                  solutionCount,
                  solutions,
+                 workspace_limit,
                  StringToConvolutionBwdWeightsAlgo);
 
     if(*solutionCount == 0)
+    {
         GetWrwSolutionsFallback(
             handle, dyDesc, xDesc, dwDesc, maxSolutionCount, solutionCount, solutions);
+        ApplyWorkspaceLimit(workspace_limit, solutionCount, solutions);
+    }
 }
 
 void ConvolutionDescriptor::CompileWrwSolution(Handle& handle,
@@ -4732,8 +4938,9 @@ void ConvolutionDescriptor::CompileWrwSolution(Handle& handle,
                                                solver::Id solver_id) const
 {
     MIOPEN_LOG_I("solver_id = " << solver_id.ToString());
-    auto ctx = ConvolutionContext{xDesc, dwDesc, dyDesc, *this, conv::Direction::BackwardWeights};
-    ctx.SetStream(&handle);
+    const auto cached = GetConvolutionContext(
+        handle, xDesc, dwDesc, dyDesc, *this, conv::Direction::BackwardWeights);
+    auto ctx                   = cached->context;
     ctx.disable_search_enforce = true;
 
     CompileSolution(handle, solver_id, ctx, conv::Direction::BackwardWeights, [&]() {
@@ -4741,6 +4948,24 @@ void ConvolutionDescriptor::CompileWrwSolution(Handle& handle,
     });
 }
 
+std::shared_ptr<CompileJob>
+ConvolutionDescriptor::CompileWrwSolutionAsync(Handle& handle,
+                                               const TensorDescriptor& dyDesc,
+                                               const TensorDescriptor& xDesc,
+                                               const TensorDescriptor& dwDesc,
+                                               const solver::Id solver_id,
+                                               int priority) const
+{
+    MIOPEN_LOG_I("solver_id = " << solver_id.ToString() << ", priority = " << priority);
+
+    const auto cached = GetConvolutionContext(
+        handle, xDesc, dwDesc, dyDesc, *this, conv::Direction::BackwardWeights);
+    auto ctx                   = cached->context;
+    ctx.disable_search_enforce = true;
+
+    return CompileSolutionAsync(handle, solver_id, ctx, conv::Direction::BackwardWeights, priority);
+}
+
 std::size_t ConvolutionDescriptor::GetWrwSolutionWorkspaceSize(Handle& handle,
                                                                const TensorDescriptor& dyDesc,
                                                                const TensorDescriptor& xDesc,
@@ -4752,14 +4977,11 @@ std::size_t ConvolutionDescriptor::GetWrwSolutionWorkspaceSize(Handle& handle,
         MIOPEN_THROW(miopenStatusBadParm, "invalid solution id = " + solver_id.ToString());
     if(solver_id != solver::Id::gemm() && solver_id != solver::Id::fft())
     {
-        auto sol = solver_id.GetSolver();
-        auto problem =
-            ProblemDescription{xDesc, dwDesc, dyDesc, *this, conv::Direction::BackwardWeights};
-        auto ctx = ConvolutionContext{problem};
-        ctx.SetStream(&handle);
-        ctx.DetectRocm();
-        if(sol.IsApplicable(ctx))
-            return sol.GetWorkspaceSize(ctx);
+        auto sol       = solver_id.GetSolver();
+        const auto ctx = GetConvolutionContext(
+            handle, xDesc, dwDesc, dyDesc, *this, conv::Direction::BackwardWeights);
+        if(sol.IsApplicable(ctx->context))
+            return sol.GetWorkspaceSize(ctx->context);
         else
         {
             MIOPEN_THROW(miopenStatusBadParm,
@@ -4792,14 +5014,14 @@ void ConvolutionDescriptor::ConvolutionWrwImmediate(Handle& handle,
     ConvWrwCheckNumerics(handle, tensors, &beta, [&]() {
         ValidateGroupCount(xDesc, dwDesc, *this);
 
-        auto ctx =
-            ConvolutionContext{xDesc, dwDesc, dyDesc, *this, conv::Direction::BackwardWeights};
-        ctx.SetStream(&handle);
+        const auto cached = GetConvolutionContext(
+            handle, xDesc, dwDesc, dyDesc, *this, conv::Direction::BackwardWeights);
+        const auto& ctx = cached->context;
 
         if(CheckInvokerSupport(solver_id, conv::Direction::BackwardWeights))
         {
-            const auto invoker =
-                LoadOrPrepareInvoker(handle, ctx, solver_id, conv::Direction::BackwardWeights);
+            const auto invoker = LoadOrPrepareInvoker(
+                handle, ctx, cached->network_config, solver_id, conv::Direction::BackwardWeights);
             const auto invoke_ctx = conv::WrWInvokeParams{tensors, workSpace, workSpaceSize};
             invoker(handle, invoke_ctx);
             return;
@@ -4811,8 +5033,8 @@ void ConvolutionDescriptor::ConvolutionWrwImmediate(Handle& handle,
             return;
         }
 
-        const auto network_config = ctx.BuildConfKey();
-        auto algo_name            = solver_id.GetAlgo(conv::Direction::BackwardWeights);
+        const auto& network_config = cached->network_config;
+        auto algo_name             = solver_id.GetAlgo(conv::Direction::BackwardWeights);
         const auto&& chk_kernels  = handle.GetKernels(algo_name, network_config);
         auto v_chk_kernels = std::vector<KernelInvoke>{chk_kernels.begin(), chk_kernels.end()};
         if(!v_chk_kernels.empty())
@@ -43,10 +43,10 @@
 namespace miopen {
 
 template <typename T>
-inline void SquashPairedTensor(const std::vector<T> x_len,
-                               const std::vector<T> x_str,
-                               const std::vector<T> y_len,
-                               const std::vector<T> y_str,
+inline void SquashPairedTensor(const TensorDims& x_len,
+                               const TensorDims& x_str,
+                               const TensorDims& y_len,
+                               const TensorDims& y_str,
                                std::vector<T>& in_len,
                                std::vector<T>& in_str,
                                std::vector<T>& out_len,
@@ -26,7 +26,10 @@
 
 #include <miopen/handle.hpp>
 
+#include <miopen/async_programs.hpp>
 #include <miopen/binary_cache.hpp>
+#include <miopen/caching_allocator.hpp>
+#include <miopen/context_cache.hpp>
 #include <miopen/config.h>
 #include <miopen/device_name.hpp>
 #include <miopen/errors.hpp>
@@ -44,7 +47,9 @@
 
 #include <boost/filesystem.hpp>
 
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #ifndef _WIN32
 #include <unistd.h>
@@ -270,8 +275,29 @@ struct HandleImpl
     ContextPtr context  = nullptr;
     AqPtr queue         = nullptr;
     cl_device_id device = nullptr; // NOLINT
+    std::vector<std::unique_ptr<CachingAllocator>> pools;
     Allocator allocator{};
     KernelCache cache;
+#if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    // Programs loaded from the binary cache by blob, at most max_binary_programs of them.
+    static constexpr std::size_t max_binary_programs = 256;
+    std::mutex binary_mutex;
+    std::unordered_map<std::string, Program> binary_programs;
+
+    /// Programs with identical binaries share the blob and the loaded program.
+    template <class F>
+    Program GetBinaryProgram(const std::string& blob, F load)
+    {
+        std::lock_guard<std::mutex> lock(binary_mutex);
+        const auto program = binary_programs.find(blob);
+        if(program != binary_programs.end())
+            return program->second;
+        // The kernel cache keeps the evicted programs that are in use.
+        if(binary_programs.size() >= max_binary_programs)
+            binary_programs.erase(binary_programs.begin());
+        return binary_programs.emplace(blob, load()).first->second;
+    }
+#endif
     bool enable_profiling  = false;
     float profiling_result = 0.0;
 
@@ -440,6 +466,11 @@ Handle::Handle() : impl(new HandleImpl())
     MIOPEN_LOG_NQI(*this);
 }
 
+Handle::Handle(const std::string&, std::size_t) : impl(new HandleImpl())
+{
+    MIOPEN_THROW(miopenStatusNotImplemented, "Offline handles require the HIP backend");
+}
+
 Handle::Handle(Handle&&) noexcept = default;
 Handle::~Handle()                 = default;
 
@@ -452,6 +483,8 @@ void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
 
     clRetainCommandQueue(streamID);
     impl->queue = HandleImpl::AqPtr{streamID};
+    if(!impl->pools.empty())
+        impl->pools.back()->SetStream(streamID);
 }
 
 miopenAcceleratorQueue_t Handle::GetStream() const { return impl->queue.get(); }
@@ -464,11 +497,11 @@ void Handle::SetAllocator(miopenAllocatorFunction allocator,
     {
         MIOPEN_THROW("Allocator context can not be used with the default allocator");
     }
-    this->impl->allocator.allocator   = allocator == nullptr ? default_allocator : allocator;
-    this->impl->allocator.deallocator = deallocator == nullptr ? default_deallocator : deallocator;
-
-    this->impl->allocator.context =
-        allocatorContext == nullptr ? this->impl->context.get() : allocatorContext;
+    const Allocator upstream{
+        allocator == nullptr ? default_allocator : allocator,
+        deallocator == nullptr ? default_deallocator : deallocator,
+        allocatorContext == nullptr ? this->impl->context.get() : allocatorContext};
+    this->impl->allocator = MakeCachingAllocator(upstream, this->GetStream(), this->impl->pools);
 }
 
 void Handle::EnableProfiling(bool enable) const { this->impl->enable_profiling = enable; }
@@ -489,7 +522,7 @@ KernelInvoke Handle::AddKernel(const std::string& algorithm,
                                bool is_kernel_str,
                                const std::string& kernel_src) const
 {
-
+    this->AddAsyncPrograms();
     auto obj = this->impl->cache.AddKernel(*this,
                                            algorithm,
                                            network_config,
@@ -507,6 +540,7 @@ KernelInvoke Handle::AddKernel(const std::string& algorithm,
 Invoker Handle::PrepareInvoker(const InvokerFactory& factory,
                                const std::vector<solver::KernelInfo>& kernels) const
 {
+    this->AddAsyncPrograms();
     std::vector<Kernel> built;
     for(auto& k : kernels)
     {
@@ -565,6 +599,17 @@ Program Handle::LoadProgram(const std::string& program_name,
 {
     auto hsaco = miopen::LoadBinary(
         this->GetDeviceName(), this->GetMaxComputeUnits(), program_name, params, is_kernel_str);
+
+    // Other processes may be building the program, wait for them and look it up again.
+    BuildLease lease;
+    if(hsaco.empty())
+    {
+        lease =
+            miopen::LeaseBinaryBuild(this->GetDeviceName(), program_name, params, is_kernel_str);
+        hsaco = miopen::LoadBinary(
+            this->GetDeviceName(), this->GetMaxComputeUnits(), program_name, params, is_kernel_str);
+    }
+
     if(hsaco.empty())
     {
         auto p = miopen::LoadProgram(miopen::GetContext(this->GetStream()),
@@ -589,23 +634,34 @@ Program Handle::LoadProgram(const std::string& program_name,
         miopen::SaveProgramBinary(p, path.string());
         miopen::SaveBinary(
             path.string(), this->GetDeviceName(), program_name, params, is_kernel_str);
+        hsaco = miopen::LoadBinary(
+            this->GetDeviceName(), this->GetMaxComputeUnits(), program_name, params, is_kernel_str);
+        if(!hsaco.empty())
+        {
+            Program program = std::move(p);
+            return this->impl->GetBinaryProgram(hsaco.string(), [&]() { return program; });
+        }
 #endif
         return std::move(p);
     }
     else
     {
-        return LoadBinaryProgram(miopen::GetContext(this->GetStream()),
-                                 miopen::GetDevice(this->GetStream()),
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
-                                 hsaco);
+        return LoadBinaryProgram(
+            miopen::GetContext(this->GetStream()), miopen::GetDevice(this->GetStream()), hsaco);
 #else
-                                 miopen::LoadFile(hsaco));
+        return this->impl->GetBinaryProgram(hsaco.string(), [&]() -> Program {
+            return LoadBinaryProgram(miopen::GetContext(this->GetStream()),
+                                     miopen::GetDevice(this->GetStream()),
+                                     miopen::LoadFile(hsaco));
+        });
 #endif
     }
 }
 
 bool Handle::HasProgram(const std::string& program_name, const std::string& params) const
 {
+    this->AddAsyncPrograms();
     return this->impl->cache.HasProgram(program_name, params);
 }
 
@@ -77,8 +77,8 @@ static std::string get_pooling_index_type_max_name(miopenIndexType_t index_type)
     MIOPEN_THROW("not belong to any case");
 }
 
-template <typename T>
-std::string get_vect_config(std::vector<T> v)
+template <typename TVec>
+std::string get_vect_config(const TVec& v)
 {
     std::string str;
     for(auto itr = v.begin(); itr < v.end(); itr++)
@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include <miopen/rnn.hpp>
+#include <miopen/rnn_plan.hpp>
 #include <miopen/rnn_util.hpp>
 
 #include <miopen/activ.hpp>
@@ -35,9 +36,59 @@
 #include <vector>
 #include <numeric>
 #include <algorithm>
+#include <cassert>
 
 namespace miopen {
 
+#if MIOPEN_USE_GEMM
+// Replays the GEMMs of one cell of a launch plan. Launches reading hx are skipped when
+// there is no initial hidden state, merged ones never mix hx with the other buffers.
+static void RunRNNPlanGemms(const Handle& handle,
+                            const RNNLaunchPlan& plan,
+                            const RNNPlanStep& step,
+                            ConstData_t hx,
+                            ConstData_t w,
+                            Data_t work,
+                            float& ctime)
+{
+    for(auto i = step.gemm_begin; i < step.gemm_end; i++)
+    {
+        const auto& gemm = plan.gemms[i];
+        if(gemm.a == RNNPlanBuffer::Hx && hx == nullptr)
+            continue;
+        assert(gemm.b == RNNPlanBuffer::Weights && gemm.c == RNNPlanBuffer::Work);
+
+        // Merged launches of both directions go through the strided batched interface.
+        const auto call_gemm       = gemm.desc.batch_count > 1 ? CallGemmStridedBatched : CallGemm;
+        miopenStatus_t gemm_status = call_gemm(handle,
+                                               gemm.desc,
+                                               gemm.a == RNNPlanBuffer::Hx ? hx : work,
+                                               gemm.a_offset,
+                                               w,
+                                               gemm.b_offset,
+                                               work,
+                                               gemm.c_offset,
+                                               nullptr,
+                                               false,
+                                               GemmBackend_t::miopengemm);
+
+        if(gemm_status != miopenStatusSuccess)
+        {
+            if(gemm_status == miopenStatusNotImplemented)
+            {
+                MIOPEN_LOG_E("GEMM not implemented");
+            }
+            else
+            {
+                MIOPEN_LOG_E("GEMM failed");
+            }
+        }
+        // Update time
+        profileRNNkernels(handle, 1, ctime);
+    }
+}
+#endif
+
 // Assuming sequence length is set to > 0 otherwise throw exception.
 void RNNDescriptor::RNNForwardInference(Handle& handle,
                                         const int seqLen,
@@ -228,6 +279,9 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
         activDesc = {miopenActivationTANH, 1, 1, 1};
     }
 
+    const auto plan = GetRNNLaunchPlan(MakeRNNPlanKey(
+        *this, RNNPlanPass::ForwardInference, xDesc[0].GetType(), in_h, hy_h, hy_n, in_n));
+
     for(int li = 0; li < nLayers; li++)
     {
         int hid_shift           = li * batch_n * hy_stride;
@@ -542,176 +596,19 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
         }
 
         // from hidden state
-        int bacc   = 0;
-        int baccbi = batch_n;
         for(int ti = 0; ti < seqLen; ti++)
         {
-            baccbi -= in_n.at(seqLen - 1 - ti);
-            wei_shift         = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
-            int pretime_shift = 0;
-            int use_time      = 0;
-
             for(int ri = 0; ri < bi; ri++)
             {
-                int cur_time  = ri == 0 ? ti : seqLen - 1 - ti;
-                int cur_batch = ri == 0 ? bacc : baccbi;
-                offset        = hid_shift + cur_batch * hy_stride;
-                if(ti > 0)
-                {
-                    pretime_shift =
-                        ri == 0 ? hid_shift + (bacc - in_n.at(ti - 1)) * hy_stride
-                                : hid_shift + (baccbi + in_n.at(seqLen - 1 - ti)) * hy_stride;
-                    use_time = ri == 0 ? ti : seqLen - ti;
-                }
+                const auto& step        = plan->Step(li, ti, ri);
+                const int cur_time      = step.cur_time;
+                const int use_time      = step.use_time;
+                const int pretime_shift = step.pretime_shift;
+                offset                  = step.offset;
 
                 if(in_n.at(cur_time) > 0)
                 {
-                    if(ti == 0)
-                    {
-                        if(hx != nullptr)
-                        {
-                            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                              false,
-                                                                              true,
-                                                                              in_n.at(cur_time),
-                                                                              wei_len,
-                                                                              hy_h,
-                                                                              uni_stride,
-                                                                              uni_stride,
-                                                                              hy_stride,
-                                                                              1, // batch count
-                                                                              0, // Stride A
-                                                                              0, // Stride B
-                                                                              0, // Stride C
-                                                                              1, // alpha
-                                                                              1, // beta
-                                                                              xDesc[0].GetType()};
-
-                            miopenStatus_t gemm_status =
-                                CallGemm(handle,
-                                         gemm_desc,
-                                         hx,
-                                         hx_shift + ri * hy_n * hy_h,
-                                         w,
-                                         wei_shift + ri * wei_len * uni_stride,
-                                         workSpace,
-                                         static_cast<int>(offset) + ri * wei_len,
-                                         nullptr,
-                                         false,
-                                         GemmBackend_t::miopengemm);
-
-                            if(gemm_status != miopenStatusSuccess)
-                            {
-                                if(gemm_status == miopenStatusNotImplemented)
-                                {
-                                    MIOPEN_LOG_E("GEMM not implemented");
-                                }
-                                else
-                                {
-                                    MIOPEN_LOG_E("GEMM failed");
-                                }
-                            }
-                            // Update time
-                            profileRNNkernels(handle, 1, ctime);
-                        }
-                    }
-                    else
-                    {
-                        if(ri == 1 && hx != nullptr && in_n.at(cur_time) > in_n.at(use_time))
-                        {
-                            miopen::GemmDescriptor gemm_desc =
-                                GemmDescriptor{false,
-                                               false,
-                                               true,
-                                               (in_n.at(cur_time) - in_n.at(use_time)),
-                                               wei_len,
-                                               hy_h,
-                                               uni_stride,
-                                               uni_stride,
-                                               hy_stride,
-                                               1, // batch count
-                                               0, // Stride A
-                                               0, // Stride B
-                                               0, // Stride C
-                                               1, // alpha
-                                               1, // beta
-                                               xDesc[0].GetType()};
-                            miopenStatus_t gemm_status =
-                                CallGemm(handle,
-                                         gemm_desc,
-                                         hx,
-                                         hx_shift + ri * hy_n * hy_h + in_n.at(use_time) * hy_h,
-                                         w,
-                                         wei_shift + ri * wei_len * uni_stride,
-                                         workSpace,
-                                         static_cast<int>(offset) + ri * wei_len +
-                                             in_n.at(use_time) * hy_stride,
-                                         nullptr,
-                                         false,
-                                         GemmBackend_t::miopengemm);
-
-                            if(gemm_status != miopenStatusSuccess)
-                            {
-                                if(gemm_status == miopenStatusNotImplemented)
-                                {
-                                    MIOPEN_LOG_E("GEMM not implemented");
-                                }
-                                else
-                                {
-                                    MIOPEN_LOG_E("GEMM failed");
-                                }
-                            }
-                            // Update time
-                            profileRNNkernels(handle, 1, ctime);
-                        }
-
-                        if(in_n.at(use_time) > 0)
-                        {
-                            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                              false,
-                                                                              true,
-                                                                              in_n.at(use_time),
-                                                                              wei_len,
-                                                                              hy_h,
-                                                                              hy_stride,
-                                                                              uni_stride,
-                                                                              hy_stride,
-                                                                              1, // batch count
-                                                                              0, // Stride A
-                                                                              0, // Stride B
-                                                                              0, // Stride C
-                                                                              1, // alpha
-                                                                              1, // beta
-                                                                              xDesc[0].GetType()};
-
-                            miopenStatus_t gemm_status =
-                                CallGemm(handle,
-                                         gemm_desc,
-                                         workSpace,
-                                         pretime_shift + hid_off + ri * hy_h,
-                                         w,
-                                         wei_shift + ri * wei_len * uni_stride,
-                                         workSpace,
-                                         static_cast<int>(offset) + ri * wei_len,
-                                         nullptr,
-                                         false,
-                                         GemmBackend_t::miopengemm);
-
-                            if(gemm_status != miopenStatusSuccess)
-                            {
-                                if(gemm_status == miopenStatusNotImplemented)
-                                {
-                                    MIOPEN_LOG_E("GEMM not implemented");
-                                }
-                                else
-                                {
-                                    MIOPEN_LOG_E("GEMM failed");
-                                }
-                            }
-                            // Update time
-                            profileRNNkernels(handle, 1, ctime);
-                        }
-                    }
+                    RunRNNPlanGemms(handle, *plan, step, hx, w, workSpace, ctime);
 
                     // update hidden status
                     sp_size[1] = in_n.at(cur_time);
@@ -1166,8 +1063,6 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
                     }
                 }
             }
-
-            bacc += in_n.at(ti);
         }
 
         // update hy, cy
@@ -1176,8 +1071,8 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
             hx_size[2] = hy_h;
             sp_size[2] = hy_h;
 
-            bacc   = batch_n;
-            baccbi = 0;
+            int bacc   = batch_n;
+            int baccbi = 0;
             for(int ti = seqLen - 1; ti >= 0; ti--)
             {
                 bacc -= in_n.at(ti);
@@ -1463,6 +1358,9 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
         activDesc = {miopenActivationTANH, 1, 1, 1};
     }
 
+    const auto plan = GetRNNLaunchPlan(MakeRNNPlanKey(
+        *this, RNNPlanPass::ForwardTraining, xDesc[0].GetType(), in_h, hy_h, hy_n, in_n));
+
     for(int li = 0; li < nLayers; li++)
     {
         int hid_shift           = li * batch_n * hy_stride;
@@ -1822,177 +1720,20 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
         }
 
         // from hidden state
-        int bacc   = 0;
-        int baccbi = batch_n;
         for(int ti = 0; ti < seqLen; ti++)
         {
-            baccbi -= in_n.at(seqLen - 1 - ti);
-            wei_shift         = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
-            int pretime_shift = 0;
-            int use_time      = 0;
-
             for(int ri = 0; ri < bi; ri++)
             {
-                int cur_time  = ri == 0 ? ti : seqLen - 1 - ti;
-                int cur_batch = ri == 0 ? bacc : baccbi;
-                offset        = hid_shift + cur_batch * hy_stride;
-                if(ti > 0)
-                {
-                    pretime_shift =
-                        ri == 0 ? hid_shift + (bacc - in_n.at(ti - 1)) * hy_stride
-                                : hid_shift + (baccbi + in_n.at(seqLen - 1 - ti)) * hy_stride;
-                    use_time = ri == 0 ? ti : seqLen - ti;
-                }
+                const auto& step        = plan->Step(li, ti, ri);
+                const int cur_time      = step.cur_time;
+                const int use_time      = step.use_time;
+                const int cur_batch     = step.cur_batch;
+                const int pretime_shift = step.pretime_shift;
+                offset                  = step.offset;
 
                 if(in_n.at(cur_time) > 0)
                 {
-                    if(ti == 0)
-                    {
-                        if(hx != nullptr)
-                        {
-                            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                              false,
-                                                                              true,
-                                                                              in_n.at(cur_time),
-                                                                              wei_len,
-                                                                              hy_h,
-                                                                              uni_stride,
-                                                                              uni_stride,
-                                                                              hy_stride,
-                                                                              1, // batch count
-                                                                              0, // Stride A
-                                                                              0, // Stride B
-                                                                              0, // Stride C
-                                                                              1, // alpha
-                                                                              1, // beta
-                                                                              xDesc[0].GetType()};
-
-                            miopenStatus_t gemm_status =
-                                CallGemm(handle,
-                                         gemm_desc,
-                                         hx,
-                                         hx_shift + ri * hy_n * hy_h,
-                                         w,
-                                         wei_shift + ri * wei_len * uni_stride,
-                                         reserveSpace,
-                                         static_cast<int>(offset) + ri * wei_len,
-                                         nullptr,
-                                         false,
-                                         GemmBackend_t::miopengemm);
-
-                            if(gemm_status != miopenStatusSuccess)
-                            {
-                                if(gemm_status == miopenStatusNotImplemented)
-                                {
-                                    MIOPEN_LOG_E("GEMM not implemented");
-                                }
-                                else
-                                {
-                                    MIOPEN_LOG_E("GEMM failed");
-                                }
-                            }
-                            // Update time
-                            profileRNNkernels(handle, 1, ctime);
-                        }
-                    }
-                    else
-                    {
-                        if(ri == 1 && hx != nullptr && in_n.at(cur_time) > in_n.at(use_time))
-                        {
-                            miopen::GemmDescriptor gemm_desc =
-                                GemmDescriptor{false,
-                                               false,
-                                               true,
-                                               (in_n.at(cur_time) - in_n.at(use_time)),
-                                               wei_len,
-                                               hy_h,
-                                               uni_stride,
-                                               uni_stride,
-                                               hy_stride,
-                                               1, // batch count
-                                               0, // Stride A
-                                               0, // Stride B
-                                               0, // Stride C
-                                               1, // alpha
-                                               1, // beta
-                                               xDesc[0].GetType()};
-
-                            miopenStatus_t gemm_status =
-                                CallGemm(handle,
-                                         gemm_desc,
-                                         hx,
-                                         hx_shift + ri * hy_n * hy_h + in_n.at(use_time) * hy_h,
-                                         w,
-                                         wei_shift + ri * wei_len * uni_stride,
-                                         reserveSpace,
-                                         static_cast<int>(offset) + ri * wei_len +
-                                             in_n.at(use_time) * hy_stride,
-                                         nullptr,
-                                         false,
-                                         GemmBackend_t::miopengemm);
-
-                            if(gemm_status != miopenStatusSuccess)
-                            {
-                                if(gemm_status == miopenStatusNotImplemented)
-                                {
-                                    MIOPEN_LOG_E("GEMM not implemented");
-                                }
-                                else
-                                {
-                                    MIOPEN_LOG_E("GEMM failed");
-                                }
-                            }
-                            // Update time
-                            profileRNNkernels(handle, 1, ctime);
-                        }
-
-                        if(in_n.at(use_time) > 0)
-                        {
-                            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                              false,
-                                                                              true,
-                                                                              in_n.at(use_time),
-                                                                              wei_len,
-                                                                              hy_h,
-                                                                              hy_stride,
-                                                                              uni_stride,
-                                                                              hy_stride,
-                                                                              1, // batch count
-                                                                              0, // Stride A
-                                                                              0, // Stride B
-                                                                              0, // Stride C
-                                                                              1, // alpha
-                                                                              1, // beta
-                                                                              xDesc[0].GetType()};
-
-                            miopenStatus_t gemm_status =
-                                CallGemm(handle,
-                                         gemm_desc,
-                                         reserveSpace,
-                                         pretime_shift + hid_off + ri * hy_h,
-                                         w,
-                                         wei_shift + ri * wei_len * uni_stride,
-                                         reserveSpace,
-                                         static_cast<int>(offset) + ri * wei_len,
-                                         nullptr,
-                                         false,
-                                         GemmBackend_t::miopengemm);
-
-                            if(gemm_status != miopenStatusSuccess)
-                            {
-                                if(gemm_status == miopenStatusNotImplemented)
-                                {
-                                    MIOPEN_LOG_E("GEMM not implemented");
-                                }
-                                else
-                                {
-                                    MIOPEN_LOG_E("GEMM failed");
-                                }
-                            }
-                            // Update time
-                            profileRNNkernels(handle, 1, ctime);
-                        }
-                    }
+                    RunRNNPlanGemms(handle, *plan, step, hx, w, reserveSpace, ctime);
 
                     // update hidden status
                     sp_size[1] = in_n.at(cur_time);
@@ -2468,8 +2209,6 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
                     }
                 }
             }
-
-            bacc += in_n.at(ti);
         }
 
         // update hy, cy
@@ -2478,8 +2217,8 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
             hx_size[2] = hy_h;
             sp_size[2] = hy_h;
 
-            bacc   = batch_n;
-            baccbi = 0;
+            int bacc   = batch_n;
+            int baccbi = 0;
             for(int ti = seqLen - 1; ti >= 0; ti--)
             {
                 bacc -= in_n.at(ti);
@@ -2783,6 +2522,9 @@ void RNNDescriptor::RNNBackwardData(Handle& handle,
         activDesc = {miopenActivationTANH, 1, 1, 1};
     }
 
+    const auto plan = GetRNNLaunchPlan(MakeRNNPlanKey(
+        *this, RNNPlanPass::BackwardData, yDesc[0].GetType(), in_h, hy_h, hy_n, in_n));
+
     for(int li = static_cast<int>(nLayers) - 1; li >= 0; li--)
     {
         int wei_shift     = (in_h + hy_h) * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
@@ -3039,49 +2781,13 @@ void RNNDescriptor::RNNBackwardData(Handle& handle,
                                 // Update time
                                 profileRNNkernels(handle, 1, ctime);
                             }
-                            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                              false,
-                                                                              false,
-                                                                              in_n.at(use_time),
-                                                                              hy_h,
-                                                                              wei_len,
-                                                                              hy_stride,
-                                                                              uni_stride,
-                                                                              hy_stride,
-                                                                              1, // batch count
-                                                                              0, // Stride A
-                                                                              0, // Stride B
-                                                                              0, // Stride C
-                                                                              1, // alpha
-                                                                              1, // beta
-                                                                              yDesc[0].GetType()};
-
-                            miopenStatus_t gemm_status =
-                                CallGemm(handle,
-                                         gemm_desc,
-                                         workSpace,
-                                         pretime_shift,
-                                         w,
-                                         weitime_shift + ri * wei_len * uni_stride,
-                                         workSpace,
-                                         static_cast<int>(offset) + dhd_off + ri * hy_h,
-                                         nullptr,
-                                         false,
-                                         GemmBackend_t::miopengemm);
-
-                            if(gemm_status != miopenStatusSuccess)
-                            {
-                                if(gemm_status == miopenStatusNotImplemented)
-                                {
-                                    MIOPEN_LOG_E("GEMM not implemented");
-                                }
-                                else
-                                {
-                                    MIOPEN_LOG_E("GEMM failed");
-                                }
-                            }
-                            // Update time
-                            profileRNNkernels(handle, 1, ctime);
+                            RunRNNPlanGemms(handle,
+                                            *plan,
+                                            plan->Step(li, ti, ri),
+                                            nullptr,
+                                            w,
+                                            workSpace,
+                                            ctime);
 
                             if(rnnMode == miopenGRU)
                             {
@@ -34,7 +34,7 @@ int ProblemDescription::mloBuildConf_Key(std::string& conf_key) const
     ss << 'x' << n_outputs;
     ss << 'x' << PrintDHW('x', spatial_dims, out_depth, out_height, out_width);
     ss << 'x' << batch_sz;
-    ss << 'x' << in_layout;
+    ss << 'x' << conv::EncodeLayoutsForKey(in_layout, GetWeightsLayout(), out_layout);
     ss << 'x' << EncodeDataTypesForKey(in_data_type, weights_data_type, out_data_type);
     ss << 'x' << PrintDHW('x', spatial_dims, pad_d, pad_h, pad_w);
     ss << 'x' << PrintDHW('x', spatial_dims, kernel_stride_d, kernel_stride_h, kernel_stride_w);
@@ -65,7 +65,7 @@ void ProblemDescription::Serialize(std::ostream& stream) const
     stream << sep << PrintDHW('x', spatial_dims, kernel_stride_d, kernel_stride_h, kernel_stride_w);
     stream << sep << PrintDHW('x', spatial_dims, kernel_dilation_d, kernel_dilation_h, kernel_dilation_w);
     stream << sep << bias;
-    stream << sep << in_layout;
+    stream << sep << conv::EncodeLayoutsForKey(in_layout, GetWeightsLayout(), out_layout);
     stream << sep << EncodeDataTypesForKey(in_data_type, weights_data_type, out_data_type);
     stream << sep << (direction.IsForward() ? "F" : direction.IsBackwardData() ? "B" : "W");
     // clang-format on
@@ -125,7 +125,9 @@ ProblemDescription::ProblemDescription(conv::ProblemDescription desc)
       kernel_dilation_d(conv_problem.GetDilationD()),
       bias(conv_problem.GetBias()),
       in_layout(conv_problem.GetInLayout()),
-      weights_layout(conv_problem.GetWeightsLayout()),
+      weights_layout(conv_problem.GetWeightsLayout() == conv_problem.GetInLayout()
+                         ? ""
+                         : conv_problem.GetWeightsLayout()),
       out_layout(conv_problem.GetOutLayout()),
       in_data_type(conv_problem.GetInDataType()),
       weights_data_type(conv_problem.GetWeightsDataType()),
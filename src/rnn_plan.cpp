@@ -0,0 +1,409 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/rnn_plan.hpp>
+#include <miopen/rnn.hpp>
+#include <miopen/env.hpp>
+
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+namespace miopen {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_RNN_BATCHED_GEMM)
+
+static auto Tie(const RNNPlanKey& k)
+{
+    return std::tie(k.pass,
+                    k.rnn_mode,
+                    k.bidirectional,
+                    k.layers,
+                    k.hidden_tensors,
+                    k.workspace_scale,
+                    k.data_type,
+                    k.in_h,
+                    k.hy_h,
+                    k.hy_n,
+                    k.in_n,
+                    k.batched_gemm);
+}
+
+bool operator<(const RNNPlanKey& l, const RNNPlanKey& r) { return Tie(l) < Tie(r); }
+bool operator==(const RNNPlanKey& l, const RNNPlanKey& r) { return Tie(l) == Tie(r); }
+
+RNNPlanKey MakeRNNPlanKey(const RNNDescriptor& rnn,
+                          RNNPlanPass pass,
+                          miopenDataType_t data_type,
+                          int in_h,
+                          int hy_h,
+                          int hy_n,
+                          const std::vector<int>& in_n)
+{
+    return {pass,
+            rnn.rnnMode,
+            rnn.dirMode != 0u,
+            static_cast<int>(rnn.nLayers),
+            static_cast<int>(rnn.nHiddenTensorsPerLayer),
+            static_cast<int>(rnn.workspaceScale),
+            data_type,
+            in_h,
+            hy_h,
+            hy_n,
+            in_n,
+            !IsDisabled(MIOPEN_DEBUG_RNN_BATCHED_GEMM{})};
+}
+
+static GemmDescriptor
+RecurrentGemm(bool transB, int m, int n, int k, int lda, int ldb, int ldc, miopenDataType_t type)
+{
+    return GemmDescriptor{false,
+                          false,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          lda,
+                          ldb,
+                          ldc,
+                          1, // batch count
+                          0, // Stride A
+                          0, // Stride B
+                          0, // Stride C
+                          1, // alpha
+                          1, // beta
+                          type};
+}
+
+// Mirrors the "from hidden state" loop of RNNForwardInference/RNNForwardTraining.
+static void BuildForwardSchedule(RNNLaunchPlan& plan)
+{
+    const auto& key     = plan.key;
+    const auto& in_n    = key.in_n;
+    const int seq_len   = plan.seq_len;
+    const int bi        = plan.bi;
+    const int hy_h      = key.hy_h;
+    const int bi_stride = hy_h * bi;
+
+    for(int li = 0; li < key.layers; li++)
+    {
+        const int hid_shift = li * plan.batch_n * plan.hy_stride;
+        const int hx_shift  = li * key.hy_n * bi_stride;
+        const int wei_shift =
+            key.in_h * plan.wei_stride + li * (bi * hy_h + hy_h) * plan.wei_stride;
+
+        int bacc   = 0;
+        int baccbi = plan.batch_n;
+        for(int ti = 0; ti < seq_len; ti++)
+        {
+            baccbi -= in_n.at(seq_len - 1 - ti);
+            for(int ri = 0; ri < bi; ri++)
+            {
+                auto& step = plan.steps[(static_cast<std::size_t>(li) * seq_len + ti) * bi + ri];
+
+                step.cur_time  = ri == 0 ? ti : seq_len - 1 - ti;
+                step.cur_batch = ri == 0 ? bacc : baccbi;
+                step.offset    = hid_shift + step.cur_batch * plan.hy_stride;
+                if(ti > 0)
+                {
+                    step.pretime_shift =
+                        ri == 0 ? hid_shift + (bacc - in_n.at(ti - 1)) * plan.hy_stride
+                                : hid_shift + (baccbi + in_n.at(seq_len - 1 - ti)) * plan.hy_stride;
+                    step.use_time = ri == 0 ? ti : seq_len - ti;
+                }
+
+                const int cur_n    = in_n.at(step.cur_time);
+                const int use_n    = in_n.at(step.use_time);
+                const int b_offset = wei_shift + ri * plan.wei_len * plan.uni_stride;
+                const int c_offset = step.offset + ri * plan.wei_len;
+                const int hx_off   = hx_shift + ri * key.hy_n * hy_h;
+                const auto gemm    = [&](int m, int lda) {
+                    return RecurrentGemm(true,
+                                         m,
+                                         plan.wei_len,
+                                         hy_h,
+                                         lda,
+                                         plan.uni_stride,
+                                         plan.hy_stride,
+                                         key.data_type);
+                };
+
+                step.gemm_begin = plan.gemms.size();
+                if(cur_n > 0)
+                {
+                    if(ti == 0)
+                    {
+                        plan.gemms.push_back({gemm(cur_n, plan.uni_stride),
+                                              RNNPlanBuffer::Hx,
+                                              hx_off,
+                                              RNNPlanBuffer::Weights,
+                                              b_offset,
+                                              RNNPlanBuffer::Work,
+                                              c_offset});
+                    }
+                    else
+                    {
+                        // The reverse direction starts the sequences which are shorter than the
+                        // previous time step from hx.
+                        if(ri == 1 && cur_n > use_n)
+                        {
+                            plan.gemms.push_back({gemm(cur_n - use_n, plan.uni_stride),
+                                                  RNNPlanBuffer::Hx,
+                                                  hx_off + use_n * hy_h,
+                                                  RNNPlanBuffer::Weights,
+                                                  b_offset,
+                                                  RNNPlanBuffer::Work,
+                                                  c_offset + use_n * plan.hy_stride});
+                        }
+                        if(use_n > 0)
+                        {
+                            plan.gemms.push_back({gemm(use_n, plan.hy_stride),
+                                                  RNNPlanBuffer::Work,
+                                                  step.pretime_shift + plan.hid_off + ri * hy_h,
+                                                  RNNPlanBuffer::Weights,
+                                                  b_offset,
+                                                  RNNPlanBuffer::Work,
+                                                  c_offset});
+                        }
+                    }
+                }
+                step.gemm_end = plan.gemms.size();
+            }
+            bacc += in_n.at(ti);
+        }
+    }
+}
+
+// Mirrors the "from post state" loop of RNNBackwardData.
+static void BuildBackwardDataSchedule(RNNLaunchPlan& plan)
+{
+    const auto& key   = plan.key;
+    const auto& in_n  = key.in_n;
+    const int seq_len = plan.seq_len;
+    const int bi      = plan.bi;
+    const int hy_h    = key.hy_h;
+
+    for(int li = key.layers - 1; li >= 0; li--)
+    {
+        const int hid_shift = li * plan.batch_n * plan.hy_stride;
+        const int weitime_shift =
+            key.in_h * plan.wei_stride + li * (bi * hy_h + hy_h) * plan.wei_stride;
+
+        int bacc   = plan.batch_n;
+        int baccbi = 0;
+        for(int ti = seq_len - 1; ti >= 0; ti--)
+        {
+            bacc -= in_n.at(ti);
+            for(int ri = 0; ri < bi; ri++)
+            {
+                auto& step = plan.steps[(static_cast<std::size_t>(li) * seq_len + ti) * bi + ri];
+
+                step.cur_time  = ri == 0 ? ti : seq_len - 1 - ti;
+                step.cur_batch = ri == 0 ? bacc : baccbi;
+                step.offset    = hid_shift + step.cur_batch * plan.hy_stride;
+                if(ti < seq_len - 1)
+                {
+                    const int pre_batch =
+                        ri == 0 ? bacc + in_n.at(ti) : baccbi - in_n.at(seq_len - 2 - ti);
+                    step.use_time      = ri == 0 ? ti + 1 : seq_len - 1 - ti;
+                    step.pretime_shift = hid_shift + pre_batch * plan.hy_stride + ri * plan.wei_len;
+                }
+
+                step.gemm_begin = plan.gemms.size();
+                if(in_n.at(step.cur_time) > 0 && ti < seq_len - 1 && in_n.at(step.use_time) > 0)
+                {
+                    plan.gemms.push_back({RecurrentGemm(false,
+                                                        in_n.at(step.use_time),
+                                                        hy_h,
+                                                        plan.wei_len,
+                                                        plan.hy_stride,
+                                                        plan.uni_stride,
+                                                        plan.hy_stride,
+                                                        key.data_type),
+                                          RNNPlanBuffer::Work,
+                                          step.pretime_shift,
+                                          RNNPlanBuffer::Weights,
+                                          weitime_shift + ri * plan.wei_len * plan.uni_stride,
+                                          RNNPlanBuffer::Work,
+                                          step.offset + plan.hid_off + ri * hy_h});
+                }
+                step.gemm_end = plan.gemms.size();
+            }
+            baccbi += in_n.at(seq_len - 1 - ti);
+        }
+    }
+}
+
+static bool SameShape(const RNNGemmLaunch& l, const RNNGemmLaunch& r)
+{
+    const auto& x = l.desc;
+    const auto& y = r.desc;
+    return l.a == r.a && l.b == r.b && l.c == r.c && x.batch_count == 1 && y.batch_count == 1 &&
+           x.transA == y.transA && x.transB == y.transB && x.m == y.m && x.n == y.n &&
+           x.k == y.k && x.lda == y.lda && x.ldb == y.ldb && x.ldc == y.ldc;
+}
+
+// Strided batched GEMM needs a common, non-negative stride direction for all operands.
+static bool MergeGemms(const RNNGemmLaunch& l, const RNNGemmLaunch& r, RNNGemmLaunch& merged)
+{
+    if(!SameShape(l, r))
+        return false;
+
+    const bool forward = r.a_offset >= l.a_offset && r.b_offset >= l.b_offset &&
+                         r.c_offset >= l.c_offset;
+    const bool backward = r.a_offset <= l.a_offset && r.b_offset <= l.b_offset &&
+                          r.c_offset <= l.c_offset;
+    if(!forward && !backward)
+        return false;
+
+    const auto& first  = forward ? l : r;
+    const auto& second = forward ? r : l;
+
+    merged                  = first;
+    merged.desc.batch_count = 2;
+    merged.desc.strideA     = second.a_offset - first.a_offset;
+    merged.desc.strideB     = second.b_offset - first.b_offset;
+    merged.desc.strideC     = second.c_offset - first.c_offset;
+    return true;
+}
+
+// The GEMMs of the reverse direction only read the hidden state of the previous time step and
+// write their own columns, so they may run together with the ones of the forward direction of
+// the same time step. Unmatched GEMMs stay in their cells.
+static void BatchDirections(RNNLaunchPlan& plan)
+{
+    std::vector<RNNGemmLaunch> gemms;
+    gemms.reserve(plan.gemms.size());
+
+    for(int li = 0; li < plan.key.layers; li++)
+    {
+        for(int ti = 0; ti < plan.seq_len; ti++)
+        {
+            auto& fwd = plan.steps[(static_cast<std::size_t>(li) * plan.seq_len + ti) * 2];
+            auto& rev = plan.steps[(static_cast<std::size_t>(li) * plan.seq_len + ti) * 2 + 1];
+
+            std::vector<bool> used(rev.gemm_end - rev.gemm_begin, false);
+
+            const auto fwd_begin = gemms.size();
+            for(auto i = fwd.gemm_begin; i < fwd.gemm_end; i++)
+            {
+                RNNGemmLaunch merged{};
+                bool found = false;
+                for(auto j = rev.gemm_begin; j < rev.gemm_end && !found; j++)
+                {
+                    if(used[j - rev.gemm_begin])
+                        continue;
+                    found = MergeGemms(plan.gemms[i], plan.gemms[j], merged);
+                    if(found)
+                        used[j - rev.gemm_begin] = true;
+                }
+                gemms.push_back(found ? merged : plan.gemms[i]);
+            }
+            const auto fwd_end = gemms.size();
+
+            for(auto j = rev.gemm_begin; j < rev.gemm_end; j++)
+            {
+                if(!used[j - rev.gemm_begin])
+                    gemms.push_back(plan.gemms[j]);
+            }
+
+            fwd.gemm_begin = fwd_begin;
+            fwd.gemm_end   = fwd_end;
+            rev.gemm_begin = fwd_end;
+            rev.gemm_end   = gemms.size();
+        }
+    }
+
+    plan.gemms = std::move(gemms);
+}
+
+RNNLaunchPlan BuildRNNLaunchPlan(const RNNPlanKey& key)
+{
+    RNNLaunchPlan plan{};
+    plan.key        = key;
+    plan.seq_len    = static_cast<int>(key.in_n.size());
+    plan.bi         = key.bidirectional ? 2 : 1;
+    plan.batch_n    = std::accumulate(key.in_n.begin(), key.in_n.end(), 0);
+    plan.hy_stride  = key.hy_h * plan.bi * key.workspace_scale;
+    plan.uni_stride = key.hy_h;
+    plan.wei_stride = key.hy_h * plan.bi * key.hidden_tensors;
+
+    switch(key.rnn_mode)
+    {
+    case miopenRNNRELU:
+    case miopenRNNTANH:
+        plan.wei_len = key.hy_h;
+        // Training keeps the activations after the pre-activations of all layers.
+        plan.hid_off = key.pass == RNNPlanPass::ForwardTraining
+                           ? key.layers * plan.batch_n * plan.hy_stride
+                           : 0;
+        break;
+    case miopenLSTM:
+        plan.wei_len = key.hy_h * 4;
+        plan.hid_off = plan.bi * key.hy_h * 5;
+        break;
+    case miopenGRU:
+        plan.wei_len = key.hy_h * 3;
+        plan.hid_off = plan.bi * key.hy_h * 3;
+        break;
+    }
+
+    plan.steps.resize(static_cast<std::size_t>(key.layers) * plan.seq_len * plan.bi);
+    if(key.pass == RNNPlanPass::BackwardData)
+        BuildBackwardDataSchedule(plan);
+    else
+        BuildForwardSchedule(plan);
+
+    // In the backward pass the GRU copies around the GEMM of every cell keep the directions
+    // apart.
+    if(key.batched_gemm && plan.bi == 2 && key.pass != RNNPlanPass::BackwardData)
+        BatchDirections(plan);
+    return plan;
+}
+
+std::shared_ptr<const RNNLaunchPlan> GetRNNLaunchPlan(const RNNPlanKey& key)
+{
+    // Plans are small, but every distinct sequence layout gets its own one.
+    constexpr std::size_t max_plans = 256;
+
+    static std::mutex mutex;
+    static std::map<RNNPlanKey, std::shared_ptr<const RNNLaunchPlan>> plans;
+
+    std::lock_guard<std::mutex> lock{mutex};
+    const auto it = plans.find(key);
+    if(it != plans.end())
+        return it->second;
+
+    if(plans.size() >= max_plans)
+        plans.clear();
+    auto plan = std::make_shared<const RNNLaunchPlan>(BuildRNNLaunchPlan(key));
+    plans.emplace(key, plan);
+    return plan;
+}
+
+} // namespace miopen
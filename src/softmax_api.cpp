@@ -24,6 +24,7 @@
  *
  *******************************************************************************/
 #include <miopen/softmax.hpp>
+#include <miopen/api_trace.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/logger.hpp>
@@ -75,6 +76,13 @@ extern "C" miopenStatus_t miopenSoftmaxForward(miopenHandle_t handle,
         return miopenStatusNotImplemented;
     }
     LogCmdSoftmax(xDesc, MIOPEN_SOFTMAX_ACCURATE, MIOPEN_SOFTMAX_MODE_CHANNEL, alpha, beta, true);
+    miopen::TraceScope trace{miopen::TraceCall::SoftmaxForward};
+    trace.Tensor(xDesc)
+        .Tensor(yDesc)
+        .Int(MIOPEN_SOFTMAX_ACCURATE)
+        .Int(MIOPEN_SOFTMAX_MODE_CHANNEL)
+        .Scale(alpha, 1)
+        .Scale(beta, 0);
     return miopen::try_([&] {
         miopen::SoftmaxForward(miopen::deref(handle),
                                alpha,
@@ -111,6 +119,14 @@ extern "C" miopenStatus_t miopenSoftmaxBackward(miopenHandle_t handle,
         return miopenStatusNotImplemented;
     }
     LogCmdSoftmax(dxDesc, MIOPEN_SOFTMAX_ACCURATE, MIOPEN_SOFTMAX_MODE_CHANNEL, alpha, beta, false);
+    miopen::TraceScope trace{miopen::TraceCall::SoftmaxBackward};
+    trace.Tensor(yDesc)
+        .Tensor(dyDesc)
+        .Tensor(dxDesc)
+        .Int(MIOPEN_SOFTMAX_ACCURATE)
+        .Int(MIOPEN_SOFTMAX_MODE_CHANNEL)
+        .Scale(alpha, 1)
+        .Scale(beta, 0);
 
     return miopen::try_([&] {
         miopen::SoftmaxBackward(miopen::deref(handle),
@@ -148,6 +164,8 @@ extern "C" miopenStatus_t miopenSoftmaxForward_V2(miopenHandle_t handle,
         return miopenStatusNotImplemented;
     }
     LogCmdSoftmax(xDesc, algorithm, mode, alpha, beta, true);
+    miopen::TraceScope trace{miopen::TraceCall::SoftmaxForward};
+    trace.Tensor(xDesc).Tensor(yDesc).Int(algorithm).Int(mode).Scale(alpha, 1).Scale(beta, 0);
     return miopen::try_([&] {
         miopen::SoftmaxForward(miopen::deref(handle),
                                alpha,
@@ -184,6 +202,14 @@ extern "C" miopenStatus_t miopenSoftmaxBackward_V2(miopenHandle_t handle,
         return miopenStatusNotImplemented;
     }
     LogCmdSoftmax(dxDesc, algorithm, mode, alpha, beta, false);
+    miopen::TraceScope trace{miopen::TraceCall::SoftmaxBackward};
+    trace.Tensor(yDesc)
+        .Tensor(dyDesc)
+        .Tensor(dxDesc)
+        .Int(algorithm)
+        .Int(mode)
+        .Scale(alpha, 1)
+        .Scale(beta, 0);
     return miopen::try_([&] {
         miopen::SoftmaxBackward(miopen::deref(handle),
                                 alpha,
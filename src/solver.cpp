@@ -29,12 +29,16 @@
 
 #include <miopen/db.hpp>
 #include <miopen/solver_id.hpp>
+#include <miopen/kernel_cache.hpp>
 #include <miopen/par_for.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/any_solver.hpp>
 
 #include <boost/range/adaptor/transformed.hpp>
 #include <ostream>
+#include <set>
+#include <string>
+#include <utility>
 
 namespace miopen {
 namespace solver {
@@ -59,7 +63,10 @@ std::vector<Program> PrecompileKernels(const Handle& h, const std::vector<Kernel
             max_threads{Value(MIOPEN_COMPILE_PARALLEL_LEVEL{}, 20)},
             [&](auto i) {
                 const KernelInfo& k = kernels[i];
-                programs[i]         = h.LoadProgram(k.kernel_file, k.comp_options, false, "");
+                auto params         = k.comp_options;
+                // Same binary cache records as the programs built by KernelCache::AddKernel.
+                KernelCache::ProcessParams(params);
+                programs[i] = h.LoadProgram(k.kernel_file, params, false, "");
             });
     return programs;
 }
@@ -68,6 +75,8 @@ void PrecompileSolutions(const Handle& h, const std::vector<ConvSolution>& sols)
 {
     // Find all kernels that need to be compiled from the solutions
     std::vector<KernelInfo> kernels;
+    // Solutions of different problems often share programs, build each of them once.
+    std::set<std::pair<std::string, std::string>> programs_to_build;
     for(auto&& sol : sols)
     {
         if(!sol.Succeeded())
@@ -76,6 +85,8 @@ void PrecompileSolutions(const Handle& h, const std::vector<ConvSolution>& sols)
         {
             if(h.HasProgram(kernel.kernel_file, kernel.comp_options))
                 continue;
+            if(!programs_to_build.emplace(kernel.kernel_file, kernel.comp_options).second)
+                continue;
             kernels.push_back(kernel);
         }
     }
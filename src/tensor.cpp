@@ -70,9 +70,17 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
 }
 
 TensorDescriptor::TensorDescriptor(miopenDataType_t t,
-                                   std::vector<std::size_t> lens_in,
-                                   std::vector<std::size_t> strides_in)
-    : lens(std::move(lens_in)), strides(std::move(strides_in)), type(t)
+                                   const std::vector<std::size_t>& lens_in,
+                                   const std::vector<std::size_t>& strides_in)
+    : lens(lens_in), strides(strides_in), type(t)
+{
+    packed = (this->GetElementSize() == this->GetElementSpace());
+}
+
+TensorDescriptor::TensorDescriptor(miopenDataType_t t,
+                                   const TensorDims& lens_in,
+                                   const TensorDims& strides_in)
+    : lens(lens_in), strides(strides_in), type(t)
 {
     packed = (this->GetElementSize() == this->GetElementSpace());
 }
@@ -88,8 +96,8 @@ void TensorDescriptor::CalculateStrides()
         lens.rbegin(), lens.rend() - 1, strides.rbegin() + 1, std::multiplies<std::size_t>());
 }
 
-const std::vector<std::size_t>& TensorDescriptor::GetLengths() const { return lens; }
-const std::vector<std::size_t>& TensorDescriptor::GetStrides() const { return strides; }
+const TensorDims& TensorDescriptor::GetLengths() const { return lens; }
+const TensorDims& TensorDescriptor::GetStrides() const { return strides; }
 int TensorDescriptor::GetSize() const
 {
     assert(lens.size() == strides.size());
@@ -111,15 +119,10 @@ std::size_t TensorDescriptor::GetIndex(std::initializer_list<int> l) const
 
 std::size_t TensorDescriptor::GetElementSpace() const
 {
-    std::vector<std::size_t> maxIndices(lens.size());
-    std::transform(lens.begin(),
-                   lens.end(),
-                   std::vector<std::size_t>(lens.size(), 1).begin(),
-                   maxIndices.begin(),
-                   std::minus<std::size_t>());
-    return std::inner_product(
-               maxIndices.begin(), maxIndices.end(), strides.begin(), std::size_t{0}) +
-           1;
+    std::size_t space = 1;
+    for(std::size_t i = 0; i < lens.size(); ++i)
+        space += (lens[i] - 1) * strides[i];
+    return space;
 }
 
 std::size_t TensorDescriptor::GetNumBytes() const
@@ -139,6 +142,52 @@ std::size_t TensorDescriptor::GetNumBytes() const
 
 bool TensorDescriptor::IsPacked() const { return this->packed; }
 
+static std::vector<std::size_t> GetLayoutOrder(const std::string& labels,
+                                               const std::string& layout)
+{
+    if(labels.size() != layout.size() ||
+       !std::is_permutation(labels.begin(), labels.end(), layout.begin()))
+        MIOPEN_THROW(miopenStatusBadParm, "Layout " + layout + " does not match " + labels);
+    std::vector<std::size_t> order;
+    order.reserve(layout.size());
+    for(const auto label : layout)
+        order.push_back(labels.find(label));
+    return order;
+}
+
+std::string TensorDescriptor::GetLayout(const std::string& labels) const
+{
+    if(labels.size() != strides.size())
+        MIOPEN_THROW(miopenStatusBadParm, "Labels " + labels + " do not match the tensor size");
+    std::vector<std::size_t> order(labels.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](auto l, auto r) {
+        return strides[l] > strides[r];
+    });
+    std::string layout;
+    for(const auto i : order)
+        layout += labels[i];
+    return layout;
+}
+
+bool TensorDescriptor::IsPossibleLayout(const std::string& labels,
+                                        const std::string& layout) const
+{
+    if(labels.size() != strides.size())
+        MIOPEN_THROW(miopenStatusBadParm, "Labels " + labels + " do not match the tensor size");
+    const auto order       = GetLayoutOrder(labels, layout);
+    std::size_t inner_span = 0;
+    for(auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        if(lens[*it] == 1)
+            continue;
+        if(strides[*it] < inner_span)
+            return false;
+        inner_span = strides[*it] * lens[*it];
+    }
+    return true;
+}
+
 bool TensorDescriptor::operator==(const TensorDescriptor& rhs) const
 {
     assert(this->lens.size() == rhs.strides.size());
@@ -176,6 +225,23 @@ std::ostream& operator<<(std::ostream& stream, const TensorDescriptor& t)
     return LogRange(stream, t.lens, ", ");
 }
 
+std::vector<std::size_t> GetPackedStrides(const std::vector<std::size_t>& lens,
+                                          const std::string& labels,
+                                          const std::string& layout)
+{
+    if(labels.size() != lens.size())
+        MIOPEN_THROW(miopenStatusBadParm, "Labels " + labels + " do not match the tensor size");
+    std::vector<std::size_t> strides(lens.size());
+    std::size_t stride = 1;
+    const auto order   = GetLayoutOrder(labels, layout);
+    for(auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        strides[*it] = stride;
+        stride *= lens[*it];
+    }
+    return strides;
+}
+
 } // namespace miopen
 
 // TODO(paul): Remove
@@ -0,0 +1,388 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/xxh3.hpp>
+#include <miopen/md5.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace miopen {
+
+namespace {
+
+constexpr std::uint32_t prime32_1 = 0x9E3779B1U;
+constexpr std::uint32_t prime32_2 = 0x85EBCA77U;
+constexpr std::uint32_t prime32_3 = 0xC2B2AE3DU;
+constexpr std::uint64_t prime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t prime64_3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t prime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t prime64_5 = 0x27D4EB2F165667C5ULL;
+constexpr std::uint64_t prime_mx1 = 0x165667919E3779F9ULL;
+constexpr std::uint64_t prime_mx2 = 0x9FB21C651E98DF25ULL;
+
+constexpr std::size_t secret_size   = 192;
+constexpr std::size_t block_stripes = (secret_size - 64) / 8;
+
+// clang-format off
+alignas(64) constexpr unsigned char secret[secret_size] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+// clang-format on
+
+struct Hash128
+{
+    std::uint64_t low;
+    std::uint64_t high;
+};
+
+// Little endian loads, like the reference implementation on the hosts MIOpen supports.
+inline std::uint32_t Read32(const unsigned char* p)
+{
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline std::uint64_t Read64(const unsigned char* p)
+{
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline std::uint64_t Rotl64(std::uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+inline std::uint32_t Rotl32(std::uint32_t x, int r) { return (x << r) | (x >> (32 - r)); }
+
+inline std::uint32_t Swap32(std::uint32_t x) { return __builtin_bswap32(x); }
+
+inline std::uint64_t Swap64(std::uint64_t x) { return __builtin_bswap64(x); }
+
+inline Hash128 Mul128(std::uint64_t l, std::uint64_t r)
+{
+    const auto product = static_cast<unsigned __int128>(l) * r;
+    return {static_cast<std::uint64_t>(product), static_cast<std::uint64_t>(product >> 64)};
+}
+
+inline std::uint64_t Mul128Fold64(std::uint64_t l, std::uint64_t r)
+{
+    const auto product = Mul128(l, r);
+    return product.low ^ product.high;
+}
+
+inline std::uint64_t Xxh64Avalanche(std::uint64_t h)
+{
+    h ^= h >> 33;
+    h *= prime64_2;
+    h ^= h >> 29;
+    h *= prime64_3;
+    return h ^ (h >> 32);
+}
+
+inline std::uint64_t Avalanche(std::uint64_t h)
+{
+    h ^= h >> 37;
+    h *= prime_mx1;
+    return h ^ (h >> 32);
+}
+
+inline std::uint64_t Mix16(const unsigned char* input, const unsigned char* key, std::uint64_t seed)
+{
+    return Mul128Fold64(Read64(input) ^ (Read64(key) + seed),
+                        Read64(input + 8) ^ (Read64(key + 8) - seed));
+}
+
+inline void Mix32(Hash128& acc,
+                  const unsigned char* input1,
+                  const unsigned char* input2,
+                  const unsigned char* key,
+                  std::uint64_t seed)
+{
+    acc.low += Mix16(input1, key, seed);
+    acc.low ^= Read64(input2) + Read64(input2 + 8);
+    acc.high += Mix16(input2, key + 16, seed);
+    acc.high ^= Read64(input1) + Read64(input1 + 8);
+}
+
+Hash128 Hash1To3(const unsigned char* input, std::size_t len)
+{
+    const std::uint32_t c1 = input[0];
+    const std::uint32_t c2 = input[len >> 1];
+    const std::uint32_t c3 = input[len - 1];
+    const std::uint32_t combined_low =
+        (c1 << 16) | (c2 << 24) | c3 | (static_cast<std::uint32_t>(len) << 8);
+    const std::uint32_t combined_high = Rotl32(Swap32(combined_low), 13);
+    const std::uint64_t bitflip_low   = Read32(secret) ^ Read32(secret + 4);
+    const std::uint64_t bitflip_high  = Read32(secret + 8) ^ Read32(secret + 12);
+    return {Xxh64Avalanche(combined_low ^ bitflip_low),
+            Xxh64Avalanche(combined_high ^ bitflip_high)};
+}
+
+Hash128 Hash4To8(const unsigned char* input, std::size_t len)
+{
+    const std::uint64_t input_low  = Read32(input);
+    const std::uint64_t input_high = Read32(input + len - 4);
+    const std::uint64_t bitflip    = Read64(secret + 16) ^ Read64(secret + 24);
+    const std::uint64_t keyed      = (input_low + (input_high << 32)) ^ bitflip;
+
+    auto m = Mul128(keyed, prime64_1 + (len << 2));
+    m.high += m.low << 1;
+    m.low ^= m.high >> 3;
+    m.low ^= m.low >> 35;
+    m.low *= prime_mx2;
+    m.low ^= m.low >> 28;
+    m.high = Avalanche(m.high);
+    return m;
+}
+
+Hash128 Hash9To16(const unsigned char* input, std::size_t len)
+{
+    const std::uint64_t bitflip_low  = Read64(secret + 32) ^ Read64(secret + 40);
+    const std::uint64_t bitflip_high = Read64(secret + 48) ^ Read64(secret + 56);
+    const std::uint64_t input_low    = Read64(input);
+    std::uint64_t input_high         = Read64(input + len - 8);
+
+    auto m = Mul128(input_low ^ input_high ^ bitflip_low, prime64_1);
+    m.low += static_cast<std::uint64_t>(len - 1) << 54;
+    input_high ^= bitflip_high;
+    m.high += input_high + static_cast<std::uint32_t>(input_high) * std::uint64_t{prime32_2 - 1};
+    m.low ^= Swap64(m.high);
+
+    auto h = Mul128(m.low, prime64_2);
+    h.high += m.high * prime64_2;
+    return {Avalanche(h.low), Avalanche(h.high)};
+}
+
+Hash128 Finish(const Hash128& acc, std::size_t len)
+{
+    const auto low  = acc.low + acc.high;
+    const auto high = acc.low * prime64_1 + acc.high * prime64_4 + len * prime64_2;
+    return {Avalanche(low), 0 - Avalanche(high)};
+}
+
+Hash128 Hash17To128(const unsigned char* input, std::size_t len)
+{
+    Hash128 acc{len * prime64_1, 0};
+    if(len > 32)
+    {
+        if(len > 64)
+        {
+            if(len > 96)
+                Mix32(acc, input + 48, input + len - 64, secret + 96, 0);
+            Mix32(acc, input + 32, input + len - 48, secret + 64, 0);
+        }
+        Mix32(acc, input + 16, input + len - 32, secret + 32, 0);
+    }
+    Mix32(acc, input, input + len - 16, secret, 0);
+    return Finish(acc, len);
+}
+
+Hash128 Hash129To240(const unsigned char* input, std::size_t len)
+{
+    constexpr std::size_t start_offset = 3;
+    constexpr std::size_t last_offset  = 17;
+    constexpr std::size_t secret_min   = 136;
+
+    Hash128 acc{len * prime64_1, 0};
+    for(std::size_t i = 0; i < 4; i++)
+        Mix32(acc, input + 32 * i, input + 32 * i + 16, secret + 32 * i, 0);
+    acc.low  = Avalanche(acc.low);
+    acc.high = Avalanche(acc.high);
+    for(std::size_t i = 4; i < len / 32; i++)
+        Mix32(acc, input + 32 * i, input + 32 * i + 16, secret + start_offset + 32 * (i - 4), 0);
+    Mix32(acc, input + len - 16, input + len - 32, secret + secret_min - last_offset - 16, 0);
+    return Finish(acc, len);
+}
+
+Hash128 HashShort(const unsigned char* input, std::size_t len)
+{
+    if(len > 128)
+        return Hash129To240(input, len);
+    if(len > 16)
+        return Hash17To128(input, len);
+    if(len > 8)
+        return Hash9To16(input, len);
+    if(len >= 4)
+        return Hash4To8(input, len);
+    if(len > 0)
+        return Hash1To3(input, len);
+    return {Xxh64Avalanche(Read64(secret + 64) ^ Read64(secret + 72)),
+            Xxh64Avalanche(Read64(secret + 80) ^ Read64(secret + 88))};
+}
+
+inline void Accumulate512(std::uint64_t* acc, const unsigned char* input, const unsigned char* key)
+{
+    for(std::size_t i = 0; i < 8; i++)
+    {
+        const auto data  = Read64(input + 8 * i);
+        const auto keyed = data ^ Read64(key + 8 * i);
+        acc[i ^ 1] += data;
+        acc[i] += static_cast<std::uint32_t>(keyed) * (keyed >> 32);
+    }
+}
+
+inline void Scramble(std::uint64_t* acc, const unsigned char* key)
+{
+    for(std::size_t i = 0; i < 8; i++)
+    {
+        auto a = acc[i];
+        a ^= a >> 47;
+        a ^= Read64(key + 8 * i);
+        acc[i] = a * prime32_1;
+    }
+}
+
+std::uint64_t MergeAccs(const std::uint64_t* acc, const unsigned char* key, std::uint64_t start)
+{
+    auto result = start;
+    for(std::size_t i = 0; i < 4; i++)
+        result += Mul128Fold64(acc[2 * i] ^ Read64(key + 16 * i),
+                               acc[2 * i + 1] ^ Read64(key + 16 * i + 8));
+    return Avalanche(result);
+}
+
+} // namespace
+
+Xxh3::Xxh3()
+    : acc{prime32_3, prime64_1, prime64_2, prime64_3, prime64_4, prime32_2, prime64_5, prime32_1}
+{
+}
+
+void Xxh3::ConsumeStripe(const unsigned char* stripe)
+{
+    Accumulate512(acc, stripe, secret + 8 * stripes);
+    if(++stripes == block_stripes)
+    {
+        Scramble(acc, secret + secret_size - stripe_size);
+        stripes = 0;
+    }
+}
+
+void Xxh3::Update(const void* data, std::size_t size)
+{
+    auto input = static_cast<const unsigned char*>(data);
+    total += size;
+    if(!is_long)
+    {
+        if(buffered + size <= max_short)
+        {
+            std::copy(input, input + size, buffer + buffered);
+            buffered += size;
+            return;
+        }
+        is_long = true;
+    }
+
+    // A stripe is consumed only when more input follows, the last one is hashed by Final().
+    if(buffered > 0)
+    {
+        std::size_t pos = 0;
+        for(; buffered - pos > stripe_size; pos += stripe_size)
+            ConsumeStripe(buffer + pos);
+        if(pos > 0)
+            std::copy(buffer + pos - stripe_size, buffer + pos, last_stripe);
+        std::copy(buffer + pos, buffer + buffered, buffer);
+        buffered -= pos;
+
+        const auto fill = std::min(stripe_size - buffered, size);
+        std::copy(input, input + fill, buffer + buffered);
+        buffered += fill;
+        input += fill;
+        size -= fill;
+        if(size == 0)
+            return;
+        ConsumeStripe(buffer);
+        std::copy(buffer, buffer + stripe_size, last_stripe);
+        buffered = 0;
+    }
+
+    if(size > stripe_size)
+    {
+        for(; size > stripe_size; input += stripe_size, size -= stripe_size)
+            ConsumeStripe(input);
+        std::copy(input - stripe_size, input, last_stripe);
+    }
+    std::copy(input, input + size, buffer);
+    buffered = size;
+}
+
+Xxh3::Digest Xxh3::Final() const
+{
+    Hash128 hash;
+    if(!is_long)
+    {
+        hash = HashShort(buffer, buffered);
+    }
+    else
+    {
+        constexpr std::size_t last_acc_start = 7;
+        constexpr std::size_t merge_start    = 11;
+
+        // Input is at least one stripe long here, its end spans the buffer and the last stripe.
+        unsigned char last[stripe_size];
+        std::copy(last_stripe + buffered, last_stripe + stripe_size, last);
+        std::copy(buffer, buffer + buffered, last + stripe_size - buffered);
+
+        std::uint64_t final_acc[8];
+        std::copy(acc, acc + 8, final_acc);
+        Accumulate512(final_acc, last, secret + secret_size - stripe_size - last_acc_start);
+        hash.low  = MergeAccs(final_acc, secret + merge_start, total * prime64_1);
+        hash.high = MergeAccs(
+            final_acc, secret + secret_size - stripe_size - merge_start, ~(total * prime64_2));
+    }
+
+    Digest digest;
+    for(std::size_t i = 0; i < 8; i++)
+    {
+        digest[i]     = static_cast<unsigned char>(hash.high >> (56 - 8 * i));
+        digest[8 + i] = static_cast<unsigned char>(hash.low >> (56 - 8 * i));
+    }
+    return digest;
+}
+
+Xxh3::Digest xxh3(const void* data, std::size_t size)
+{
+    Xxh3 hash;
+    hash.Update(data, size);
+    return hash.Final();
+}
+
+std::string xxh3(const std::string& s) { return ToHex(xxh3(s.data(), s.size())); }
+
+} // namespace miopen
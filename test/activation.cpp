@@ -35,6 +35,7 @@
 #include <miopen/tensor.hpp>
 #include <utility>
 
+#include "cpu_activation.hpp"
 #include "driver.hpp"
 #include "get_handle.hpp"
 #include "tensor_holder.hpp"
@@ -66,19 +67,21 @@ struct verify_forward_activation
     tensor<T> input;
     miopen::ActivationDescriptor desc;
 
-    template <class A>
-    tensor<T> cpu(A a)
+    tensor<T> cpu()
     {
         auto out = input;
-
-        input.par_for_each(
-            [&](int o, int w, int i, int j) { out(o, w, i, j) = a(input(o, w, i, j)); });
-
+        cpu_activation_forward(desc.GetMode(),
+                               desc.GetAlpha(),
+                               desc.GetBeta(),
+                               desc.GetGamma(),
+                               nc_view(input.desc),
+                               input.data.data(),
+                               nc_view(out.desc),
+                               out.data.data());
         return out;
     }
 
-    template <class A>
-    tensor<T> gpu(A)
+    tensor<T> gpu()
     {
         auto&& handle = get_handle();
         auto out      = input;
@@ -93,8 +96,7 @@ struct verify_forward_activation
         return out;
     }
 
-    template <class A>
-    void fail(float, A)
+    void fail(float)
     {
         std::cout << "Forward Activation: " << to_name(desc.GetMode()) << std::endl;
         std::cout << "Input tensor: " << input.desc.ToString() << std::endl;
@@ -109,20 +111,25 @@ struct verify_backwards_activation
     tensor<T> out;
     miopen::ActivationDescriptor desc;
 
-    template <class A>
-    tensor<T> cpu(A a)
+    tensor<T> cpu()
     {
         auto dinput = input;
-
-        input.par_for_each([&](int o, int w, int i, int j) {
-            dinput(o, w, i, j) = a(dout(o, w, i, j), input(o, w, i, j), out(o, w, i, j));
-        });
-
+        cpu_activation_backward(desc.GetMode(),
+                                desc.GetAlpha(),
+                                desc.GetBeta(),
+                                desc.GetGamma(),
+                                nc_view(out.desc),
+                                out.data.data(),
+                                nc_view(dout.desc),
+                                dout.data.data(),
+                                nc_view(input.desc),
+                                input.data.data(),
+                                nc_view(dinput.desc),
+                                dinput.data.data());
         return dinput;
     }
 
-    template <class A>
-    tensor<T> gpu(A)
+    tensor<T> gpu()
     {
         auto&& handle = get_handle();
         auto dinput   = input;
@@ -155,8 +162,7 @@ struct verify_backwards_activation
         return dinput;
     }
 
-    template <class A>
-    void fail(float, A)
+    void fail(float)
     {
         std::cout << "Backwards Activation: " << to_name(desc.GetMode()) << std::endl;
         std::cout << "Input tensor: " << input.desc.ToString() << std::endl;
@@ -179,62 +185,25 @@ struct activation_driver : test_driver
     std::string mode = "PASTHRU";
     std::unordered_map<std::string, std::function<void()>> lookup;
 
-    template <class A>
-    struct callback
-    {
-        void operator()(activation_driver* self) const { self->template run<A>(); }
-    };
-
-    template <class Forward, class Backward>
-    void add_mode(miopenActivationMode_t m, Forward f, Backward b)
+    void add_mode(miopenActivationMode_t m)
     {
-        lookup.emplace(transform_mode(to_name(m)), [=] { this->run(m, f, b); });
+        lookup.emplace(transform_mode(to_name(m)), [=] { this->run(m); });
     }
 
     activation_driver()
     {
         disabled_cache = true;
-        add_mode(miopenActivationPASTHRU,
-                 [=](double x) { return x; },
-                 [=](double dy, double, double) { return dy; });
-        add_mode(miopenActivationLOGISTIC,
-                 [=](double x) { return 1 / (1 + std::exp(-x)); },
-                 [=](double dy, double, double y) { return dy * y * (1 - y); });
-        add_mode(miopenActivationTANH,
-                 // y = beta * tanh(alpha * x)
-                 [=](double x) { return beta * std::tanh(alpha * x); },
-                 [=](double dy, double, double y) { return dy * alpha * (beta - y * y / beta); });
-        add_mode(miopenActivationRELU,
-                 [=](double x) { return (x > 0) ? x : 0; },
-                 [=](double dy, double x, double) { return (x > 0) ? dy : 0; });
-        add_mode(miopenActivationSOFTRELU,
-                 [=](double x) { return std::log1p(std::exp(x)); },
-                 [=](double dy, double x, double) {
-                     static const double threshold = 50.;
-                     double expval                 = std::exp(std::min(x, threshold));
-                     return dy * expval / (expval + 1.0);
-                 });
-        add_mode(miopenActivationABS,
-                 [=](double x) { return std::abs(x); },
-                 [=](double dy, double x, double) { return dy * ((x > 0) ? 1 : -1); });
-        add_mode(miopenActivationPOWER,
-                 [=](double x) {
-                     double v = alpha + beta * x;
-                     return v <= std::numeric_limits<double>::epsilon() ? 0 : pow(v, gamma);
-                 },
-                 [=](double, double x, double y) {
-                     auto v = alpha + beta * x;
-                     return v <= std::numeric_limits<double>::epsilon() ? 0 : gamma * beta * y / v;
-                 });
-        add_mode(miopenActivationCLIPPEDRELU,
-                 [=](double x) { return std::min(alpha, std::max(double(0), x)); },
-                 [=](double dy, double x, double) { return (x > 0 && x <= alpha) ? dy : 0; });
-        add_mode(miopenActivationLEAKYRELU,
-                 [=](double x) { return (x > 0) ? x : x * alpha; },
-                 [=](double dy, double x, double) { return dy * ((x > 0) ? 1 : alpha); });
-        add_mode(miopenActivationELU,
-                 [=](double x) { return (x > 0) ? x : alpha * std::expm1(x); },
-                 [=](double dy, double x, double y) { return dy * ((x > 0) ? 1 : y + alpha); });
+        for(auto m : {miopenActivationPASTHRU,
+                      miopenActivationLOGISTIC,
+                      miopenActivationTANH,
+                      miopenActivationRELU,
+                      miopenActivationSOFTRELU,
+                      miopenActivationABS,
+                      miopenActivationPOWER,
+                      miopenActivationCLIPPEDRELU,
+                      miopenActivationLEAKYRELU,
+                      miopenActivationELU})
+            add_mode(m);
         add(input,
             "input",
             get_input_tensor(tensor_elem_gen_integer{miopen_type<T>{} == miopenHalf ? 5 : 17}));
@@ -280,18 +249,17 @@ struct activation_driver : test_driver
         lookup[transform_mode(mode)]();
     }
 
-    template <class Forward, class Backward>
-    void run(miopenActivationMode_t m, Forward f, Backward b)
+    void run(miopenActivationMode_t m)
     {
         auto desc = make_descriptor(m);
-        auto out  = verify(verify_forward_activation<T>{input, desc}, f);
+        auto out  = verify(verify_forward_activation<T>{input, desc});
         auto dout = out.first;
         dout.generate([&](int n, int c, int h, int w) {
             T x      = out.first(n, c, h, w);
             double y = (877 * n + 547 * c + 701 * h + 1049 * w + static_cast<int>(769 * x)) % 2503;
             return ((x * y) / 1301.0);
         });
-        verify(verify_backwards_activation<T>{input, dout, out.first, desc}, b);
+        verify(verify_backwards_activation<T>{input, dout, out.first, desc});
     }
 };
 
@@ -0,0 +1,270 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/api_trace.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using miopen::TraceCall;
+using miopen::TraceRecord;
+
+static TraceRecord MakeConvRecord(std::uint64_t timestamp, std::uint64_t duration)
+{
+    TraceRecord record;
+    record.call      = TraceCall::ConvolutionForward;
+    record.timestamp = timestamp;
+    record.duration  = duration;
+    record.workspace = 4096;
+    record.tensors   = {{miopenHalf, {16, 64, 56, 56}, {200704, 3136, 56, 1}},
+                      {miopenHalf, {64, 64, 3, 3}, {576, 9, 3, 1}},
+                      {miopenHalf, {16, 64, 56, 56}, {200704, 3136, 56, 1}}};
+    miopen::TraceConvolution conv;
+    conv.pads              = {1, 1};
+    conv.strides           = {1, 1};
+    conv.dilations         = {1, 1};
+    conv.trans_output_pads = {0, 0};
+    record.convolution     = conv;
+    record.ints            = {miopenConvolutionFwdAlgoDirect};
+    return record;
+}
+
+static TraceRecord MakeSoftmaxRecord(std::uint64_t timestamp, std::uint64_t duration)
+{
+    TraceRecord record;
+    record.call      = TraceCall::SoftmaxForward;
+    record.timestamp = timestamp;
+    record.duration  = duration;
+    record.tensors   = {{miopenFloat, {8, 1000, 1, 1}, {1000, 1, 1, 1}},
+                      {miopenFloat, {8, 1000, 1, 1}, {1000, 1, 1, 1}}};
+    record.ints      = {MIOPEN_SOFTMAX_LOG, -1};
+    record.reals     = {0.5, -0.25};
+    return record;
+}
+
+static TraceRecord MakeFindRecord()
+{
+    auto record    = MakeConvRecord(7, 500000);
+    record.call    = TraceCall::FindConvolutionForwardAlgorithm;
+    record.ints    = {2, 1};
+    record.results = {{miopenConvolutionFwdAlgoWinograd, 0.125, 0},
+                      {miopenConvolutionFwdAlgoImplicitGEMM, 0.5, std::uint64_t{1} << 33}};
+    return record;
+}
+
+static std::string Encode(const std::vector<TraceRecord>& records)
+{
+    std::ostringstream stream;
+    miopen::WriteTraceHeader(stream);
+    for(const auto& record : records)
+        miopen::WriteTraceRecord(stream, record);
+    return stream.str();
+}
+
+static std::vector<TraceRecord> Decode(const std::string& data)
+{
+    std::istringstream stream{data};
+    return miopen::ReadTrace(stream);
+}
+
+static void RoundTrip()
+{
+    const std::vector<TraceRecord> records = {MakeConvRecord(1000, 20000),
+                                              MakeSoftmaxRecord(std::uint64_t{1} << 40, 3),
+                                              MakeFindRecord()};
+    const auto decoded = Decode(Encode(records));
+    EXPECT(decoded.size() == 3);
+    EXPECT(decoded == records);
+    EXPECT(Decode(Encode({})).empty());
+
+    // A null descriptor is an empty tensor.
+    auto record       = MakeSoftmaxRecord(0, 0);
+    record.tensors[1] = {};
+    EXPECT(Decode(Encode({record})).front() == record);
+}
+
+static void CorruptInput()
+{
+    const auto data = Encode({MakeConvRecord(0, 1), MakeSoftmaxRecord(5, 1)});
+    for(std::size_t size = 10; size < data.size(); size++)
+    {
+        const auto truncated = data.substr(0, size);
+        // Cuts between the records leave a valid trace.
+        if(size == Encode({MakeConvRecord(0, 1)}).size())
+        {
+            EXPECT(Decode(truncated).size() == 1);
+            continue;
+        }
+        EXPECT(throws([&] { Decode(truncated); }));
+    }
+
+    EXPECT(Decode(data.substr(0, 9)).empty());
+    EXPECT(throws([&] { Decode("MIOTRAC"); }));
+    EXPECT(throws([&] { Decode("NOTATRACE"); }));
+
+    // A record claiming more elements than it has bytes.
+    auto bad = Encode({});
+    bad += '\x07';
+    bad += '\x04';
+    bad += std::string(3, '\0');
+    bad += '\x7f';
+    EXPECT(throws([&] { Decode(bad); }));
+}
+
+static void ExtendedRecord()
+{
+    // Fields appended by newer writers are skipped.
+    auto data              = Encode({MakeSoftmaxRecord(1, 2)});
+    const auto header_size = 9;
+    auto payload           = data.substr(header_size + 2);
+    const auto size        = static_cast<char>(payload.size() + 3);
+    data = data.substr(0, header_size + 1) + size + payload + "abc";
+    data += Encode({MakeConvRecord(3, 4)}).substr(header_size);
+    const auto decoded = Decode(data);
+    EXPECT(decoded.size() == 2);
+    EXPECT(decoded[0] == MakeSoftmaxRecord(1, 2));
+    EXPECT(decoded[1] == MakeConvRecord(3, 4));
+}
+
+static void Version1()
+{
+    // Records of version 1 traces end before the results.
+    auto record    = MakeFindRecord();
+    record.results = {};
+    auto data      = Encode({record});
+    EXPECT(data.back() == '\0');
+    data.pop_back();
+    data[8]  = '\x01';
+    data[10] = static_cast<char>(data[10] - 1);
+    EXPECT(Decode(data) == std::vector<TraceRecord>{record});
+}
+
+static void Writer()
+{
+    const miopen::TmpDir dir{"api_trace"};
+    const auto path = (dir.path / "calls.trace").string();
+    {
+        miopen::TraceWriter writer{path};
+        const auto record = MakeConvRecord(writer.Now(), 0);
+        writer.Write(record);
+        writer.Flush();
+        EXPECT(miopen::ReadTrace(path).size() == 1);
+        writer.Write(record);
+    }
+    EXPECT(miopen::ReadTrace(path).size() == 2);
+    EXPECT(throws([&] { miopen::ReadTrace((dir.path / "missing.trace").string()); }));
+}
+
+static void Schedule()
+{
+    const std::vector<TraceRecord> records = {MakeConvRecord(3000, 500),
+                                              MakeSoftmaxRecord(1000, 4000),
+                                              MakeConvRecord(2000, 100)};
+    miopen::TraceReplayOptions options;
+    options.iterations = 2;
+
+    const auto back_to_back = miopen::ScheduleTraceReplay(records, options);
+    EXPECT(back_to_back.size() == 6);
+    const std::vector<std::size_t> order = {1, 2, 0, 1, 2, 0};
+    for(std::size_t i = 0; i < order.size(); i++)
+    {
+        EXPECT_EQUAL(back_to_back[i].record, order[i]);
+        EXPECT_EQUAL(back_to_back[i].issue_at, 0);
+    }
+
+    // The trace spans from 1000 to the end of the softmax at 5000.
+    options.speed    = 2;
+    const auto timed = miopen::ScheduleTraceReplay(records, options);
+    const std::vector<std::uint64_t> issue_at = {0, 500, 1000, 2000, 2500, 3000};
+    for(std::size_t i = 0; i < issue_at.size(); i++)
+        EXPECT_EQUAL(timed[i].issue_at, issue_at[i]);
+
+    EXPECT(miopen::ScheduleTraceReplay({}, options).empty());
+}
+
+static void Buffers()
+{
+    auto conv = MakeConvRecord(0, 0);
+    // Padded rows take the space of their strides.
+    conv.tensors[2].strides = {262144, 4096, 64, 1};
+    conv.workspace          = 100;
+    const auto buffers =
+        miopen::GetTraceReplayBuffers({MakeConvRecord(0, 0), conv, MakeSoftmaxRecord(0, 0)});
+    EXPECT(buffers.tensors.size() == 3);
+    EXPECT_EQUAL(buffers.tensors[0], 16 * 64 * 56 * 56 * 2);
+    EXPECT_EQUAL(buffers.tensors[1], 64 * 64 * 3 * 3 * 2);
+    EXPECT_EQUAL(buffers.tensors[2], (15 * 262144 + 63 * 4096 + 55 * 64 + 56) * 2);
+    EXPECT_EQUAL(buffers.workspace, 4096);
+}
+
+static void Report()
+{
+    const auto conv    = MakeConvRecord(0, 2000);
+    const auto softmax = MakeSoftmaxRecord(0, 1000);
+    EXPECT_EQUAL(miopen::GetTraceRecordSignature(softmax),
+                 "miopenSoftmaxForward_V2 float 8x1000x1x1 8x1000x1x1 2 -1");
+    // Timing is not part of the signature.
+    EXPECT_EQUAL(miopen::GetTraceRecordSignature(conv),
+                 miopen::GetTraceRecordSignature(MakeConvRecord(5, 5)));
+
+    auto other_algo = conv;
+    other_algo.ints = {miopenConvolutionFwdAlgoGEMM};
+    EXPECT(miopen::GetTraceRecordSignature(conv) != miopen::GetTraceRecordSignature(other_algo));
+
+    miopen::TraceReplayReport report;
+    report.Add(softmax, 3);
+    report.Add(conv, 10);
+    report.Add(softmax, 5);
+    report.Add(conv, 30);
+    report.Add(other_algo, 7);
+
+    const auto stats = report.GetStats();
+    EXPECT(stats.size() == 3);
+    EXPECT_EQUAL(stats[0].signature, miopen::GetTraceRecordSignature(softmax));
+    EXPECT(stats[0].count == 2);
+    EXPECT_EQUAL(stats[0].mean, 4);
+    EXPECT_EQUAL(stats[0].min, 3);
+    EXPECT_EQUAL(stats[0].max, 5);
+    EXPECT_EQUAL(stats[0].recorded, 1);
+    EXPECT_EQUAL(stats[1].mean, 20);
+    EXPECT_EQUAL(stats[1].recorded, 2);
+    EXPECT(stats[2].count == 1);
+}
+
+int main()
+{
+    RoundTrip();
+    CorruptInput();
+    ExtendedRecord();
+    Version1();
+    Writer();
+    Schedule();
+    Buffers();
+    Report();
+}
@@ -36,6 +36,7 @@
 #include <miopen/tensor.hpp>
 #include <utility>
 
+#include "cpu_batchnorm.hpp"
 #include "driver.hpp"
 #include "get_handle.hpp"
 #include "tensor_holder.hpp"
@@ -46,8 +47,6 @@
 #include <cfloat>
 #include <iomanip>
 
-// Run CPU emulations in hierarchical reduction mode.
-//#define MIO_HEIRARCH_SEL 0
 #define MIO_BN_TEST_EXPAVGFACTOR 0.1
 #define MIO_BN_TEST_EPSILON 1e-5
 #define MIO_BN_USE_MIX_PREC 1
@@ -114,73 +113,20 @@ struct verify_forward_train_bn_per_activation
 
         auto saveMean   = tensor<U>{1, channels, height, width};
         auto saveInvVar = tensor<U>{1, channels, height, width};
-        const auto n    = double(n_batch);
-
-        par_for(channels, 1, [&](int cidx) {
-
-            double mean_accum     = 0.;
-            double variance_accum = 0.;
-            double elemStd        = 0.;
-            double elemInvVar     = 0.;
-            double inhat          = 0.;
-            double newRunMean     = 0.;
-            double adjust         = 0.;
-
-            // process the batch per channel
-            for(std::size_t row = 0; row < height; row++)
-            { // via rows
-                for(std::size_t column = 0; column < width; column++)
-                { // via columns
-
-                    mean_accum = 0.;
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        // #1 calculate the mean :: iterating through the stack of images in the
-                        // mini_batch
-                        mean_accum += input(bidx, cidx, row, column);
-                    }
-                    mean_accum /= n;
-
-                    elemStd = variance_accum = 0.;
-                    // #2 calculate the variances :: sigma^2 = (1/batch_mean) * sum( (x_i -
-                    // batch_mean)^2 )
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        elemStd = (input(bidx, cidx, row, column) -
-                                   mean_accum); // (x_i - mean) //this is reused but needs recalc
-                        variance_accum += elemStd * elemStd; // sum{ (x_i - mean)^2 }
-                    }                                        // end for(n)
-                    variance_accum /= n;                     // (1/N)*sum{ (x_i - mean)^2 }
-
-                    // #3 add epsilon for numeric stability, sqr_root, and invert
-                    elemInvVar = 1.0 / double(sqrt(variance_accum + epsilon));
-
-                    // #4 apply the normalization :: x_hat = (x_i - mean) / sqrt(variance_accum -
-                    // epsilon)
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    {                                                            // via mini_batch
-                        elemStd = (input(bidx, cidx, row, column) - mean_accum); // (x_i - mean)
-                        inhat   = elemStd * elemInvVar;
-                        // #5 Gamma and Beta adjust :: y_i = gamma*x_hat + beta
-                        out(bidx, cidx, row, column) =
-                            scale(0, cidx, row, column) * inhat + shift(0, cidx, row, column);
-                    } // end for(n_batch)
-
-                    newRunMean = runMean(0, cidx, row, column) * (1.0 - expAvgFactor);
-                    runMean(0, cidx, row, column) =
-                        mean_accum * expAvgFactor + newRunMean; // newMean*factor + tmp
-
-                    // var(n+1) = p * var(n-1) + (1 - p)*(b/b-1)*var(n)
-                    adjust = (n_batch == 1) ? variance_accum : (n / (n - 1.0)) * variance_accum;
-                    runVar(0, cidx, row, column) =
-                        (1 - expAvgFactor) * runVar(0, cidx, row, column) + expAvgFactor * adjust;
-
-                    saveMean(0, cidx, row, column)   = mean_accum;
-                    saveInvVar(0, cidx, row, column) = elemInvVar;
-
-                } // for (column)
-            }     // for (row)
-        });
+
+        cpu_bn_fwd_train(miopenBNPerActivation,
+                         epsilon,
+                         expAvgFactor,
+                         nc_view(input.desc),
+                         input.data.data(),
+                         nc_view(out.desc),
+                         out.data.data(),
+                         scale.data.data(),
+                         shift.data.data(),
+                         saveMean.data.data(),
+                         saveInvVar.data.data(),
+                         runMean.data.data(),
+                         runVar.data.data());
 
 #if(MIO_BN_TIME_EVERYTHING == 1)
         auto t_end = std::chrono::high_resolution_clock::now();
@@ -337,59 +283,16 @@ struct verify_forward_infer_bn_per_activation_recalc
         auto out = tensor<T>{n_batch, channels, height, width};
         std::fill(out.begin(), out.end(), 0);
 
-        const auto n = double(n_batch);
-
-        par_for(channels, 1, [&](int cidx) {
-
-            double elemStd        = 0.;
-            double elemInvVar     = 0.;
-            double mean_accum     = 0.;
-            double variance_accum = 0.;
-            double inhat          = 0.;
-
-            // process the batch per channel
-            for(std::size_t row = 0; row < height; row++)
-            { // via rows
-                for(std::size_t column = 0; column < width; column++)
-                { // via columns
-                    mean_accum = 0.;
-
-                    // #1 calculate the mean
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        // iterating through the stack of images in the mini_batch
-                        mean_accum += input(bidx, cidx, row, column);
-                    }
-                    mean_accum /= n;
-
-                    elemStd        = 0.;
-                    variance_accum = 0.;
-                    // #2 calculate the variances
-                    // sigma^2 = (1/batch_mean) * sum( (x_i - batch_mean)^2 )
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    {                                                          // via mini_batch
-                        elemStd = input(bidx, cidx, row, column) - mean_accum; // (x_i - mean)
-                        variance_accum += elemStd * elemStd; // sum{ (x_i - mean)^2 }
-                    }                                        // end for(n)
-                    variance_accum /= n;                     // (1/N)*sum{ (x_i - mean)^2 }
-
-                    // #3 add epsilon for numeric stability, sqr_root, and invert
-                    elemInvVar = 1.0 / double(sqrt(variance_accum + epsilon));
-
-                    // #4 apply the normalization
-                    // x_hat = (x_i - mean) / sqrt(variance_accum - epsilon)
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        // per (x-dims) channel load a block of data into LDS
-                        elemStd = input(bidx, cidx, row, column) - mean_accum; // (x_i - mean)
-                        inhat   = elemStd * elemInvVar;
-                        // #5 Gamma and Beta adjust // y_i = gamma*x_hat + beta
-                        out(bidx, cidx, row, column) =
-                            scale(0, cidx, row, column) * inhat + shift(0, cidx, row, column);
-                    } // end for(n_batchs)
-                }     // for (column)
-            }         // for (row)
-        });
+        cpu_bn_fwd_infer(miopenBNPerActivation,
+                         epsilon,
+                         nc_view(input.desc),
+                         input.data.data(),
+                         nc_view(out.desc),
+                         out.data.data(),
+                         scale.data.data(),
+                         shift.data.data(),
+                         static_cast<const U*>(nullptr),
+                         static_cast<const U*>(nullptr));
 
 #if(MIO_BN_TIME_EVERYTHING == 1)
         auto t_end = std::chrono::high_resolution_clock::now();
@@ -479,32 +382,16 @@ struct verify_forward_infer_bn_per_activation_use_est
         auto out = tensor<T>{n_batch, channels, height, width};
         std::fill(out.begin(), out.end(), 0);
 
-        par_for(channels, 1, [&](int cidx) {
-            double elemStd    = 0.;
-            double mean       = 0.;
-            double variance   = 0.;
-            double inhat      = 0.;
-            double elemInvVar = 0.;
-
-            // process the batch per channel
-            for(std::size_t row = 0; row < height; row++)
-            { // via rows
-                for(std::size_t column = 0; column < width; column++)
-                { // via columns
-                    mean       = estMean(0, cidx, row, column);
-                    variance   = estVar(0, cidx, row, column);
-                    elemInvVar = 1.0 / double(sqrt(variance + epsilon));
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    {                                                    // via mini_batch
-                        elemStd = input(bidx, cidx, row, column) - mean; // (x_i - mean)
-                        inhat   = elemStd * elemInvVar;
-                        // #5 Gamma and Beta adjust :: y_i = gamma*x_hat + beta
-                        out(bidx, cidx, row, column) =
-                            scale(0, cidx, row, column) * inhat + shift(0, cidx, row, column);
-                    } // end for(n_batchs)
-                }     // for (column)
-            }         // for (row)
-        });
+        cpu_bn_fwd_infer(miopenBNPerActivation,
+                         epsilon,
+                         nc_view(input.desc),
+                         input.data.data(),
+                         nc_view(out.desc),
+                         out.data.data(),
+                         scale.data.data(),
+                         shift.data.data(),
+                         estMean.data.data(),
+                         estVar.data.data());
 
 #if(MIO_BN_TIME_EVERYTHING == 1)
         auto t_end = std::chrono::high_resolution_clock::now();
@@ -603,60 +490,19 @@ struct verify_backward_bn_per_activation_use_saved
         auto dshift = tensor<U>{1, channels, height, width};
         std::fill(dshift.begin(), dshift.end(), 0);
 
-        const unsigned int in_cstride = height * width;
-        const auto n                  = double(n_batch);
-
-        par_for(channels, 1, [&](int cidx) {
-
-            double elemStd = 0.;
-            unsigned int xhat_index;
-            double mean       = 0.;
-            double elemInvVar = 0.;
-            double dyelem     = 0.;
-            double dxhat      = 0.;
-            double dxhathat   = 0.;
-            double tmp1       = 0.;
-            std::vector<double> xhat(n_batch * in_cstride);
-
-            // process the batch per channel
-            for(std::size_t row = 0; row < height; row++)
-            { // via rows
-                for(std::size_t column = 0; column < width; column++)
-                { // via columns
-                    dxhat    = 0.;
-                    dxhathat = 0.;
-
-                    mean       = savedMean(0, cidx, row, column);   // HxW elements
-                    elemInvVar = savedInvVar(0, cidx, row, column); // HxW elements
-
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        xhat_index = in_cstride * bidx + (width * row + column);
-                        // per (x-dims) channel load a block of data into LDS
-                        elemStd          = x_input(bidx, cidx, row, column) - mean; // (x_i - mean)
-                        xhat[xhat_index] = elemStd * elemInvVar;
-                        dyelem           = dy_input(bidx, cidx, row, column);
-                        dshift(0, cidx, row, column) += dyelem;
-                        dscale(0, cidx, row, column) += xhat[xhat_index] * dyelem;
-                        tmp1 = scale(0, cidx, row, column) * dyelem;
-                        dxhat += tmp1;
-                        dxhathat += tmp1 * xhat[xhat_index];
-
-                    } // end for(n_batchs)
-
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        xhat_index  = in_cstride * bidx + (width * row + column);
-                        tmp1        = xhat[xhat_index] * dxhathat + dxhat;
-                        double tmp2 = n_batch * (scale(0, cidx, row, column) *
-                                                 dy_input(bidx, cidx, row, column)) -
-                                      tmp1;
-                        double tmp3 = elemInvVar / (double(n));
-                        dx_out(bidx, cidx, row, column) = tmp3 * tmp2;
-                    } // end for(n_batchs)
-                }     // for (column)
-            }         // for (row)
-        });
+        cpu_bn_bwd(miopenBNPerActivation,
+                   MIO_BN_TEST_EPSILON,
+                   nc_view(x_input.desc),
+                   x_input.data.data(),
+                   nc_view(dy_input.desc),
+                   dy_input.data.data(),
+                   nc_view(dx_out.desc),
+                   dx_out.data.data(),
+                   scale.data.data(),
+                   dscale.data.data(),
+                   dshift.data.data(),
+                   savedMean.data.data(),
+                   savedInvVar.data.data());
 
 #if(MIO_BN_TIME_EVERYTHING == 1)
         auto t_end = std::chrono::high_resolution_clock::now();
@@ -779,81 +625,19 @@ struct verify_backward_bn_per_activation_recalc
         auto dshift = tensor<U>{1, channels, height, width};
         std::fill(dshift.begin(), dshift.end(), 0);
 
-        const unsigned int in_cstride = height * width;
-        const auto n                  = double(n_batch);
-
-        par_for(channels, 1, [&](int cidx) {
-
-            double elemStd = 0.;
-            unsigned int xhat_index;
-            double mean       = 0.;
-            double elemInvVar = 0.;
-            double dyelem     = 0.;
-            double variance   = 0.;
-            double dxhat      = 0.;
-            double dxhathat   = 0.;
-            double tmp1       = 0.;
-            std::vector<double> xhat(n_batch * in_cstride);
-
-            // process the batch per channel
-            for(std::size_t row = 0; row < height; row++)
-            { // via rows
-                for(std::size_t column = 0; column < width; column++)
-                { // via columns
-                    mean = 0.;
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        // #1 calculate the mean
-                        mean += x_input(bidx, cidx, row, column);
-                    }
-                    mean /= n;
-
-                    elemStd  = 0.;
-                    variance = 0.;
-                    // #2 calculate the variances
-                    // sigma^2 = (1/batch_mean) * sum( (x_i - batch_mean)^2 )
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        // per (x-dims) channel load a block of data into LDS
-                        elemStd = x_input(bidx, cidx, row, column) - mean; // (x_i - mean)
-                        variance += elemStd * elemStd;                     // sum{ (x_i - mean)^2 }
-                    }                                                      // end for(n)
-                    variance /= n; // (1/N)*sum{ (x_i - mean)^2 }
-
-                    // #3 add epsilon for numeric stability, sqr_root, and invert
-                    elemInvVar = 1.0 / double(sqrt(variance + epsilon));
-
-                    dxhat    = 0.;
-                    dxhathat = 0.;
-
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        xhat_index = in_cstride * bidx + (width * row + column);
-                        // per (x-dims) channel load a block of data into LDS
-                        elemStd          = x_input(bidx, cidx, row, column) - mean; // (x_i - mean)
-                        xhat[xhat_index] = elemStd * elemInvVar;
-                        dyelem           = dy_input(bidx, cidx, row, column);
-                        dshift(0, cidx, row, column) += dyelem;
-                        dscale(0, cidx, row, column) += xhat[xhat_index] * dyelem;
-                        tmp1 = scale(0, cidx, row, column) * dyelem;
-                        dxhat += tmp1;
-                        dxhathat += tmp1 * xhat[xhat_index];
-
-                    } // end for(n_batchs)
-
-                    for(std::size_t bidx = 0; bidx < n_batch; bidx++)
-                    { // via mini_batch
-                        xhat_index  = in_cstride * bidx + (width * row + column);
-                        tmp1        = xhat[xhat_index] * dxhathat + dxhat;
-                        double tmp2 = n_batch * (scale(0, cidx, row, column) *
-                                                 dy_input(bidx, cidx, row, column)) -
-                                      tmp1;
-                        double tmp3 = elemInvVar / double(n);
-                        dx_out(bidx, cidx, row, column) = tmp3 * tmp2;
-                    } // end for(n_batchs)
-                }     // for (column)
-            }         // for (row)
-        });
+        cpu_bn_bwd(miopenBNPerActivation,
+                   epsilon,
+                   nc_view(x_input.desc),
+                   x_input.data.data(),
+                   nc_view(dy_input.desc),
+                   dy_input.data.data(),
+                   nc_view(dx_out.desc),
+                   dx_out.data.data(),
+                   scale.data.data(),
+                   dscale.data.data(),
+                   dshift.data.data(),
+                   static_cast<const U*>(nullptr),
+                   static_cast<const U*>(nullptr));
 #if(MIO_BN_TIME_EVERYTHING == 1)
         auto t_end = std::chrono::high_resolution_clock::now();
 
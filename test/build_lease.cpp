@@ -0,0 +1,149 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/build_lease.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using std::chrono::milliseconds;
+using clock_type = std::chrono::steady_clock;
+
+static milliseconds Since(clock_type::time_point start)
+{
+    return std::chrono::duration_cast<milliseconds>(clock_type::now() - start);
+}
+
+// Runs a child process that takes the lease, signals it and keeps it for the time.
+static pid_t HoldInChild(const boost::filesystem::path& item, milliseconds hold, bool release)
+{
+    int fds[2];
+    EXPECT(pipe(fds) == 0);
+    const auto pid = fork();
+    if(pid == 0)
+    {
+        close(fds[0]);
+        auto lease      = new miopen::BuildLease{item, milliseconds{1000}};
+        const char held = lease->IsHeld() ? 1 : 0;
+        if(write(fds[1], &held, 1) != 1)
+            _exit(1);
+        std::this_thread::sleep_for(hold);
+        if(release)
+            delete lease;
+        // Otherwise the process ends like a crashed builder.
+        _exit(0);
+    }
+    close(fds[1]);
+    char held = 0;
+    EXPECT(read(fds[0], &held, 1) == 1);
+    EXPECT(held == 1);
+    close(fds[0]);
+    return pid;
+}
+
+static void Processes()
+{
+    const miopen::TmpDir dir{"miopen.test.build_lease"};
+    const auto item = dir.path / "program.o";
+
+    // The builder dies without releasing the lease, the waiter takes over.
+    auto start = clock_type::now();
+    auto pid   = HoldInChild(item, milliseconds{300}, false);
+    {
+        const miopen::BuildLease lease{item, milliseconds{10000}};
+        EXPECT(lease.IsHeld());
+        EXPECT(Since(start) >= milliseconds{300});
+    }
+    waitpid(pid, nullptr, 0);
+
+    // The builder hangs, the waiter gives up.
+    pid   = HoldInChild(item, milliseconds{10000}, true);
+    start = clock_type::now();
+    {
+        const miopen::BuildLease lease{item, milliseconds{200}};
+        EXPECT(!lease.IsHeld());
+        EXPECT(Since(start) >= milliseconds{200});
+    }
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+
+    // Nobody else builds it.
+    const miopen::BuildLease lease{item, milliseconds{1000}};
+    EXPECT(lease.IsHeld());
+}
+
+static void Threads()
+{
+    const miopen::TmpDir dir{"miopen.test.build_lease"};
+    const auto item  = dir.path / "program.o";
+    const auto other = dir.path / "other.o";
+
+    std::atomic<bool> held{false};
+    std::atomic<bool> released{false};
+    std::thread builder([&] {
+        miopen::BuildLease lease{item, milliseconds{1000}};
+        EXPECT(lease.IsHeld());
+        held = true;
+        std::this_thread::sleep_for(milliseconds{200});
+        // Moving keeps the lease.
+        const auto moved = std::move(lease);
+        EXPECT(moved.IsHeld());
+        std::this_thread::sleep_for(milliseconds{100});
+        released = true;
+    });
+    while(!held)
+        std::this_thread::yield();
+
+    // Other items are not blocked.
+    EXPECT(miopen::BuildLease(other, milliseconds{0}).IsHeld());
+
+    auto start = clock_type::now();
+    EXPECT(!miopen::BuildLease(item, milliseconds{50}).IsHeld());
+    EXPECT(Since(start) >= milliseconds{50});
+
+    {
+        const miopen::BuildLease lease{item, milliseconds{10000}};
+        EXPECT(lease.IsHeld());
+        EXPECT(released);
+    }
+    builder.join();
+
+    EXPECT(!miopen::BuildLease().IsHeld());
+}
+
+int main()
+{
+    // Before any thread is started.
+    Processes();
+    Threads();
+}
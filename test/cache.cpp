@@ -26,7 +26,16 @@
 
 #include <miopen/binary_cache.hpp>
 #include <miopen/kern_db.hpp>
+#include <miopen/load_file.hpp>
 #include <miopen/temp_file.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/write_file.hpp>
+#include <miopen/xxh3.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <ctime>
+#include <limits>
 
 #include <miopen/md5.hpp>
 #include "test.hpp"
@@ -143,10 +152,130 @@ void check_cache_str()
     CHECK(p.filename().string() == name + ".o");
 }
 
+#if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
+static boost::filesystem::path save_blob(const boost::filesystem::path& root,
+                                         const std::string& binary,
+                                         const std::string& device,
+                                         const std::string& args)
+{
+    const auto tmp = root / boost::filesystem::unique_path();
+    miopen::WriteFile(binary, tmp);
+    const auto entry = miopen::GetCacheFile(root, device, "kernel", args, false);
+    miopen::SaveCacheBlob(root, tmp, entry);
+    CHECK(!boost::filesystem::exists(tmp));
+    return entry;
+}
+
+void check_content_addressed()
+{
+    const miopen::TmpDir dir{"miopen.test.cache"};
+    const auto& root = dir.path;
+
+    // Identical binaries built with different args share one blob.
+    const auto entry_a = save_blob(root, "code", "gfx906", "-DA=1");
+    const auto entry_b = save_blob(root, "code", "gfx906", "-DB=1");
+    const auto entry_c = save_blob(root, "other code", "gfx908", "-DA=1");
+    CHECK(entry_a != entry_b);
+
+    const auto blob_a = miopen::LoadCacheBlob(root, entry_a);
+    CHECK(!blob_a.empty());
+    CHECK(miopen::LoadFile(blob_a) == "code");
+    CHECK(miopen::LoadCacheBlob(root, entry_b) == blob_a);
+    CHECK(miopen::LoadCacheBlob(root, entry_c) != blob_a);
+    CHECK(miopen::LoadFile(miopen::LoadCacheBlob(root, entry_c)) == "other code");
+
+    const auto missing = miopen::GetCacheFile(root, "gfx906", "kernel", "-DC=1", false);
+    CHECK(miopen::LoadCacheBlob(root, missing).empty());
+
+    // Storing the same binary again keeps the blob.
+    save_blob(root, "code", "gfx906", "-DA=1");
+    CHECK(miopen::LoadCacheBlob(root, entry_a) == blob_a);
+    const auto result = miopen::PruneBinaryCache(root, std::numeric_limits<std::uintmax_t>::max());
+    EXPECT(result.blobs == 2);
+    EXPECT(result.size == 14);
+}
+
+void check_prune()
+{
+    const miopen::TmpDir dir{"miopen.test.cache"};
+    const auto& root = dir.path;
+    const auto now   = std::time(nullptr);
+
+    const auto entry_old   = save_blob(root, std::string(100, 'a'), "gfx906", "-DA=1");
+    const auto entry_old2  = save_blob(root, std::string(100, 'a'), "gfx906", "-DA=2");
+    const auto entry_mid   = save_blob(root, std::string(200, 'b'), "gfx906", "-DB=1");
+    const auto entry_young = save_blob(root, std::string(300, 'c'), "gfx906", "-DC=1");
+    boost::filesystem::last_write_time(miopen::LoadCacheBlob(root, entry_old), now - 300);
+    boost::filesystem::last_write_time(miopen::LoadCacheBlob(root, entry_mid), now - 200);
+    boost::filesystem::last_write_time(miopen::LoadCacheBlob(root, entry_young), now - 100);
+
+    // A blob no entry refers to and an entry of a missing blob.
+    const auto unused = root / "blobs" / (miopen::xxh3("unused") + ".o");
+    miopen::WriteFile(std::string("unused"), unused);
+    boost::filesystem::last_write_time(unused, now - 3600);
+    const auto dangling = miopen::GetCacheFile(root, "gfx906", "kernel", "-DD=1", false);
+    boost::filesystem::create_directories(dangling.parent_path());
+    miopen::WriteFile(miopen::xxh3("missing"), dangling);
+
+    auto result = miopen::PruneBinaryCache(root, std::numeric_limits<std::uintmax_t>::max());
+    EXPECT(result.removed_blobs == 1);
+    EXPECT(result.removed_entries == 1);
+    EXPECT(result.blobs == 3);
+    EXPECT(result.size == 600);
+    CHECK(!boost::filesystem::exists(unused));
+    CHECK(!boost::filesystem::exists(dangling));
+
+    // The least recently used blob goes first, with all entries referring to it.
+    result = miopen::PruneBinaryCache(root, 550);
+    EXPECT(result.removed_blobs == 1);
+    EXPECT(result.removed_entries == 2);
+    EXPECT(result.blobs == 2);
+    EXPECT(result.size == 500);
+    CHECK(miopen::LoadCacheBlob(root, entry_old).empty());
+    CHECK(miopen::LoadCacheBlob(root, entry_old2).empty());
+    CHECK(!miopen::LoadCacheBlob(root, entry_mid).empty());
+
+    // Loading the blob made it the most recently used one.
+    result = miopen::PruneBinaryCache(root, 250);
+    EXPECT(result.blobs == 1);
+    CHECK(!miopen::LoadCacheBlob(root, entry_mid).empty());
+    CHECK(miopen::LoadCacheBlob(root, entry_young).empty());
+}
+
+void check_migrate()
+{
+    const miopen::TmpDir dir{"miopen.test.cache"};
+    const auto& root = dir.path;
+
+    // Binaries of the layout before the index, one of them is in the index already.
+    const auto entry_a = miopen::GetCacheFile(root, "gfx906", "kernel", "-DA=1", false);
+    const auto entry_b = save_blob(root, "new code", "gfx906", "-DB=1");
+    const auto old_a   = root / entry_a.parent_path().filename() / entry_a.filename();
+    const auto old_b   = root / entry_b.parent_path().filename() / entry_b.filename();
+    boost::filesystem::create_directories(old_a.parent_path());
+    boost::filesystem::create_directories(old_b.parent_path());
+    miopen::WriteFile(std::string("code"), old_a);
+    miopen::WriteFile(std::string("old code"), old_b);
+
+    const auto result = miopen::PruneBinaryCache(root, std::numeric_limits<std::uintmax_t>::max());
+    EXPECT(result.migrated_entries == 2);
+    EXPECT(result.blobs == 2);
+    CHECK(!boost::filesystem::exists(old_a.parent_path()));
+    CHECK(!boost::filesystem::exists(old_b.parent_path()));
+    CHECK(miopen::LoadFile(miopen::LoadCacheBlob(root, entry_a)) == "code");
+    CHECK(miopen::LoadFile(miopen::LoadCacheBlob(root, entry_b)) == "new code");
+}
+#endif
+
 int main()
 {
     check_cache_file();
     check_cache_str();
+#if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    check_content_addressed();
+    check_prune();
+    check_migrate();
+#endif
 
     check_bz2_compress();
     check_bz2_decompress();
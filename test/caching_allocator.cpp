@@ -0,0 +1,253 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/caching_allocator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <vector>
+
+using miopen::CachingAllocator;
+
+// Hands out fake addresses and checks that live buffers never overlap.
+struct MockDevice
+{
+    std::uintptr_t next       = 0x1000;
+    std::size_t capacity      = std::size_t{1} << 30;
+    std::size_t used          = 0;
+    std::size_t allocations   = 0;
+    std::size_t deallocations = 0;
+    std::map<std::uintptr_t, std::size_t> live;
+
+    static void* Allocate(void* context, std::size_t n)
+    {
+        auto& self = *static_cast<MockDevice*>(context);
+        if(self.used + n > self.capacity)
+            return nullptr;
+        const auto ptr = self.next;
+        self.next += n + 0x100;
+        self.used += n;
+        self.allocations++;
+        self.live.emplace(ptr, n);
+        return reinterpret_cast<void*>(ptr); // NOLINT
+    }
+
+    static void Deallocate(void* context, void* ptr)
+    {
+        auto& self = *static_cast<MockDevice*>(context);
+        const auto it = self.live.find(reinterpret_cast<std::uintptr_t>(ptr)); // NOLINT
+        EXPECT(it != self.live.end());
+        self.used -= it->second;
+        self.deallocations++;
+        self.live.erase(it);
+    }
+
+    miopen::Allocator GetAllocator() { return {Allocate, Deallocate, this}; }
+};
+
+// Buffers handed out by the pool, checked for overlap with every new one.
+struct Client
+{
+    miopen::Allocator allocator;
+    std::map<std::uintptr_t, std::size_t> held;
+
+    void* Get(std::size_t n)
+    {
+        auto ptr        = allocator.allocator(allocator.context, n);
+        const auto addr = reinterpret_cast<std::uintptr_t>(ptr); // NOLINT
+        const auto next = held.lower_bound(addr);
+        EXPECT(next == held.end() || addr + n <= next->first);
+        EXPECT(next == held.begin() || std::prev(next)->first + std::prev(next)->second <= addr);
+        held.emplace(addr, n);
+        return ptr;
+    }
+
+    void Put(void* ptr)
+    {
+        EXPECT(held.erase(reinterpret_cast<std::uintptr_t>(ptr)) == 1); // NOLINT
+        allocator.deallocator(allocator.context, ptr);
+    }
+};
+
+static void SizeClasses()
+{
+    EXPECT(CachingAllocator::SizeClass(1) == 512);
+    EXPECT(CachingAllocator::SizeClass(512) == 512);
+    EXPECT(CachingAllocator::SizeClass(513) == 1024);
+    EXPECT(CachingAllocator::SizeClass(1 << 20) == 1 << 20);
+    EXPECT(CachingAllocator::SizeClass((1 << 20) + 1) == 2 << 20);
+    EXPECT(CachingAllocator::SizeClass((4 << 20) + 1) == 6 << 20);
+}
+
+static void Reuse()
+{
+    MockDevice device;
+    CachingAllocator pool{device.GetAllocator(), 64 << 20};
+    Client client{pool.GetAllocator(), {}};
+
+    auto a = client.Get(1000);
+    auto b = client.Get(1000);
+    EXPECT(a != b);
+    client.Put(a);
+    // Same size class, served from the cache.
+    auto c = client.Get(600);
+    EXPECT(c == a);
+    // Other size class.
+    auto d = client.Get(100);
+    EXPECT(d != a);
+
+    auto stats = pool.GetStats();
+    EXPECT(stats.requests == 4);
+    EXPECT(stats.hits == 1);
+    EXPECT(stats.upstream_allocations == 3);
+    EXPECT(device.allocations == 3);
+    EXPECT(stats.bytes_in_use == 1024 + 1024 + 512);
+    EXPECT(stats.bytes_cached == 0);
+
+    client.Put(b);
+    client.Put(c);
+    client.Put(d);
+    stats = pool.GetStats();
+    EXPECT(stats.bytes_in_use == 0);
+    EXPECT(stats.bytes_cached == 1024 + 1024 + 512);
+    EXPECT(stats.peak_bytes_in_use == 1024 + 1024 + 512);
+    EXPECT(device.deallocations == 0);
+
+    pool.Trim();
+    EXPECT(device.deallocations == 3);
+    EXPECT(device.live.empty());
+}
+
+static void StreamOrdered()
+{
+    MockDevice device;
+    int streams[2];
+    CachingAllocator pool{device.GetAllocator(), 64 << 20, &streams[0]};
+    Client client{pool.GetAllocator(), {}};
+
+    auto a = client.Get(4096);
+    client.Put(a);
+    // Freed on the first stream, not handed out on the second one.
+    pool.SetStream(&streams[1]);
+    auto b = client.Get(4096);
+    EXPECT(b != a);
+    pool.SetStream(&streams[0]);
+    auto c = client.Get(4096);
+    EXPECT(c == a);
+    client.Put(b);
+    client.Put(c);
+    EXPECT(pool.GetStats().hits == 1);
+
+    // Freed after the stream changed, still reserved for the stream it was allocated on.
+    auto d = client.Get(8192);
+    pool.SetStream(&streams[1]);
+    client.Put(d);
+    auto e = client.Get(8192);
+    EXPECT(e != d);
+    pool.SetStream(&streams[0]);
+    auto f = client.Get(8192);
+    EXPECT(f == d);
+    client.Put(e);
+    client.Put(f);
+    EXPECT(pool.GetStats().hits == 2);
+}
+
+static void HighWaterMark()
+{
+    MockDevice device;
+    CachingAllocator pool{device.GetAllocator(), 4096};
+    Client client{pool.GetAllocator(), {}};
+
+    std::vector<void*> buffers;
+    for(int i = 0; i < 4; i++)
+        buffers.push_back(client.Get(2048));
+    for(auto ptr : buffers)
+        client.Put(ptr);
+
+    // The two buffers freed first are released.
+    EXPECT(pool.GetStats().bytes_cached == 4096);
+    EXPECT(device.deallocations == 2);
+    EXPECT(device.live.count(reinterpret_cast<std::uintptr_t>(buffers[3])) == 1); // NOLINT
+
+    // Larger than the cache, goes straight back.
+    client.Put(client.Get(8192));
+    EXPECT(device.deallocations == 3);
+    EXPECT(pool.GetStats().bytes_cached == 4096);
+}
+
+static void TrimOnFailure()
+{
+    MockDevice device;
+    device.capacity = 8 << 20;
+    CachingAllocator pool{device.GetAllocator(), 64 << 20};
+    Client client{pool.GetAllocator(), {}};
+
+    client.Put(client.Get(3 << 20));
+    client.Put(client.Get(1 << 20));
+    EXPECT(device.used == (4 << 20) + (1 << 20));
+
+    // Only fits after the cached buffers are released.
+    auto big = client.Get(6 << 20);
+    EXPECT(big != nullptr);
+    EXPECT(device.live.size() == 1);
+    EXPECT(pool.GetStats().bytes_cached == 0);
+
+    // Nothing left to release.
+    EXPECT(pool.Allocate(4 << 20) == nullptr);
+    client.Put(big);
+}
+
+static void Retire()
+{
+    MockDevice device;
+    std::vector<std::unique_ptr<CachingAllocator>> pools;
+    pools.push_back(std::make_unique<CachingAllocator>(device.GetAllocator(), 64 << 20));
+    Client client{pools.back()->GetAllocator(), {}};
+
+    auto a = client.Get(100);
+    client.Put(client.Get(100));
+    EXPECT(device.live.size() == 2);
+
+    // A buffer still in use after the pool was replaced is released when freed.
+    pools.back()->Retire();
+    EXPECT(device.live.size() == 1);
+    client.Put(a);
+    EXPECT(device.live.empty());
+}
+
+int main()
+{
+    SizeClasses();
+    Reuse();
+    StreamOrdered();
+    HighWaterMark();
+    TrimOnFailure();
+    Retire();
+}
@@ -0,0 +1,186 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/compile_scheduler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using miopen::CompileJobState;
+using miopen::CompileScheduler;
+using std::chrono::milliseconds;
+
+// Stands in for a compiler: records the builds and may block until released.
+struct StubCompiler
+{
+    std::mutex mutex;
+    std::vector<std::string> built;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+
+    std::function<void()> Build(const std::string& program, bool wait = false)
+    {
+        return [=]() {
+            const auto now = ++running;
+            auto seen      = max_running.load();
+            while(now > seen && !max_running.compare_exchange_weak(seen, now))
+            {
+            }
+            if(wait)
+                released.wait();
+            --running;
+            std::lock_guard<std::mutex> lock(mutex);
+            built.push_back(program);
+        };
+    }
+
+    std::vector<std::string> Built()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return built;
+    }
+};
+
+static void Priority()
+{
+    StubCompiler compiler;
+    CompileScheduler scheduler{1};
+
+    // Occupies the only thread while the other jobs are queued.
+    const auto blocker = scheduler.Submit({compiler.Build("blocker", true)});
+    while(blocker->GetState() != CompileJobState::Running)
+        std::this_thread::yield();
+    EXPECT(!blocker->WaitFor(milliseconds{1}));
+
+    const auto low    = scheduler.Submit({compiler.Build("low")});
+    const auto high   = scheduler.Submit({compiler.Build("high0"), compiler.Build("high1")}, 2);
+    const auto medium = scheduler.Submit({compiler.Build("medium")}, 1);
+    const auto raised = scheduler.Submit({compiler.Build("raised")});
+    scheduler.SetPriority(raised, 3);
+    EXPECT(low->GetState() == CompileJobState::Queued);
+
+    compiler.release.set_value();
+    for(const auto& job : {blocker, low, high, medium, raised})
+    {
+        job->Wait();
+        EXPECT(job->GetState() == CompileJobState::Done);
+        EXPECT(job->GetError() == nullptr);
+    }
+    EXPECT(compiler.Built() ==
+           std::vector<std::string>{"blocker", "raised", "high0", "high1", "medium", "low"});
+}
+
+static void Cancel()
+{
+    StubCompiler compiler;
+    CompileScheduler scheduler{1};
+
+    const auto running =
+        scheduler.Submit({compiler.Build("running", true), compiler.Build("next")});
+    while(running->GetState() != CompileJobState::Running)
+        std::this_thread::yield();
+    const auto queued = scheduler.Submit({compiler.Build("queued")});
+
+    queued->Cancel();
+    EXPECT(queued->IsReady());
+    EXPECT(queued->GetState() == CompileJobState::Cancelled);
+
+    // The running task finishes, the rest of its job is skipped.
+    running->Cancel();
+    EXPECT(!running->IsReady());
+    compiler.release.set_value();
+    running->Wait();
+    EXPECT(running->GetState() == CompileJobState::Cancelled);
+
+    EXPECT(scheduler.Submit({compiler.Build("after")})->WaitFor(milliseconds{10000}));
+    EXPECT(compiler.Built() == std::vector<std::string>{"running", "after"});
+
+    // Nothing to build.
+    const auto empty = scheduler.Submit({});
+    EXPECT(empty->IsReady());
+    EXPECT(empty->GetState() == CompileJobState::Done);
+}
+
+static void Failure()
+{
+    StubCompiler compiler;
+    CompileScheduler scheduler{1};
+
+    const auto job = scheduler.Submit({compiler.Build("first"),
+                                       []() { throw std::runtime_error("Build failed"); },
+                                       compiler.Build("skipped")});
+    job->Wait();
+    EXPECT(job->GetState() == CompileJobState::Failed);
+    EXPECT(throws([&]() { std::rethrow_exception(job->GetError()); }));
+    EXPECT(compiler.Built() == std::vector<std::string>{"first"});
+}
+
+static void Threads()
+{
+    StubCompiler compiler;
+    std::shared_ptr<miopen::CompileJob> job;
+    std::thread releaser;
+    {
+        CompileScheduler scheduler{3};
+        std::vector<std::function<void()>> tasks;
+        for(auto i = 0; i < 12; i++)
+            tasks.push_back(compiler.Build(std::to_string(i), true));
+        job = scheduler.Submit(tasks);
+
+        while(compiler.running.load() < 3)
+            std::this_thread::yield();
+        std::this_thread::sleep_for(milliseconds{10});
+        EXPECT(compiler.max_running.load() == 3);
+
+        // Destroying the scheduler skips the queued tasks and waits for the running ones.
+        releaser = std::thread([&]() {
+            std::this_thread::sleep_for(milliseconds{50});
+            compiler.release.set_value();
+        });
+    }
+    releaser.join();
+    EXPECT(job->IsReady());
+    EXPECT(job->GetState() == CompileJobState::Cancelled);
+    EXPECT(compiler.Built().size() == 3);
+    EXPECT(compiler.max_running.load() == 3);
+}
+
+int main()
+{
+    Priority();
+    Cancel();
+    Failure();
+    Threads();
+}
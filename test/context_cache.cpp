@@ -0,0 +1,154 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include "get_handle.hpp"
+#include <miopen/context_cache.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/env.hpp>
+
+#include <cstdlib>
+
+using miopen::ConvolutionProblemKey;
+using miopen::conv::Direction;
+
+static bool Same(const ConvolutionProblemKey& l, const ConvolutionProblemKey& r)
+{
+    return !(l < r) && !(r < l);
+}
+
+static void Keys()
+{
+    const miopen::TensorDescriptor x{miopenFloat, {2, 8, 7, 7}};
+    const miopen::TensorDescriptor w{miopenFloat, {4, 8, 3, 3}};
+    const miopen::TensorDescriptor y{miopenFloat, {2, 4, 5, 5}};
+    const miopen::ConvolutionDescriptor conv{{0, 0}, {1, 1}, {1, 1}};
+    const auto key = ConvolutionProblemKey{x, w, y, conv, Direction::Forward};
+
+    EXPECT(Same(key, ConvolutionProblemKey{x, w, y, conv, Direction::Forward}));
+    EXPECT(!Same(key, ConvolutionProblemKey{x, w, y, conv, Direction::BackwardData}));
+
+    const miopen::TensorDescriptor x_half{miopenHalf, {2, 8, 7, 7}};
+    EXPECT(!Same(key, ConvolutionProblemKey{x_half, w, y, conv, Direction::Forward}));
+
+    const miopen::TensorDescriptor x_nhwc{miopenFloat, {2, 8, 7, 7}, {392, 1, 56, 8}};
+    EXPECT(!Same(key, ConvolutionProblemKey{x_nhwc, w, y, conv, Direction::Forward}));
+
+    const miopen::ConvolutionDescriptor padded{{1, 1}, {1, 1}, {1, 1}};
+    EXPECT(!Same(key, ConvolutionProblemKey{x, w, y, padded, Direction::Forward}));
+
+    auto grouped        = conv;
+    grouped.group_count = 2;
+    EXPECT(!Same(key, ConvolutionProblemKey{x, w, y, grouped, Direction::Forward}));
+}
+
+static void Contexts()
+{
+    auto&& handle = get_handle();
+    const miopen::TensorDescriptor x{miopenFloat, {2, 8, 7, 7}};
+    const miopen::TensorDescriptor w{miopenFloat, {4, 8, 3, 3}};
+    const miopen::TensorDescriptor y{miopenFloat, {2, 4, 5, 5}};
+    const miopen::ConvolutionDescriptor conv{{0, 0}, {1, 1}, {1, 1}};
+
+    const auto cached = miopen::GetConvolutionContext(handle, x, w, y, conv, Direction::Forward);
+    EXPECT(cached == miopen::GetConvolutionContext(handle, x, w, y, conv, Direction::Forward));
+    EXPECT(cached != miopen::GetConvolutionContext(handle, x, w, y, conv, Direction::BackwardData));
+
+    const auto& ctx = cached->context;
+    EXPECT(&ctx.GetStream() == &handle);
+    EXPECT(ctx.direction.IsForward());
+    EXPECT_EQUAL(ctx.n_inputs, 8);
+    EXPECT_EQUAL(ctx.n_outputs, 4);
+    EXPECT(!ctx.general_compile_options.empty());
+    EXPECT_EQUAL(cached->network_config.ToString(), ctx.BuildConfKey().ToString());
+
+    // The environment detected for the problem is the one of the handle.
+    miopen::ExecutionContext other;
+    other.SetStream(&handle);
+    other.DetectRocm();
+    EXPECT(handle.GetContextCache().environment);
+    EXPECT_EQUAL(other.use_asm_kernels, ctx.use_asm_kernels);
+    EXPECT_EQUAL(other.use_binaries, ctx.use_binaries);
+    EXPECT_EQUAL(other.rmv.getValue(), ctx.rmv.getValue());
+}
+
+static void Reload()
+{
+    auto&& handle = get_handle();
+    const miopen::TensorDescriptor x{miopenFloat, {2, 8, 7, 7}};
+    const miopen::TensorDescriptor w{miopenFloat, {4, 8, 3, 3}};
+    const miopen::TensorDescriptor y{miopenFloat, {2, 4, 5, 5}};
+    const miopen::ConvolutionDescriptor conv{{0, 0}, {1, 1}, {1, 1}};
+    const auto before = miopen::GetConvolutionContext(handle, x, w, y, conv, Direction::Forward);
+
+    // The contexts follow the environment after a reload.
+    setenv("MIOPEN_DEBUG_GCN_ASM_KERNELS", "0", 1);
+    miopen::ReloadEnvironment();
+    const auto after = miopen::GetConvolutionContext(handle, x, w, y, conv, Direction::Forward);
+    EXPECT(before != after);
+    EXPECT(!after->context.use_asm_kernels);
+
+    unsetenv("MIOPEN_DEBUG_GCN_ASM_KERNELS");
+    miopen::ReloadEnvironment();
+    const auto restored = miopen::GetConvolutionContext(handle, x, w, y, conv, Direction::Forward);
+    EXPECT_EQUAL(restored->context.use_asm_kernels, before->context.use_asm_kernels);
+}
+
+static void WorkspaceSizes()
+{
+    auto&& handle = get_handle();
+    const miopen::TensorDescriptor x{miopenFloat, {2, 8, 7, 7}};
+    const miopen::TensorDescriptor w{miopenFloat, {4, 8, 3, 3}};
+    const miopen::TensorDescriptor y{miopenFloat, {2, 4, 5, 5}};
+    const miopen::ConvolutionDescriptor conv{{0, 0}, {1, 1}, {1, 1}};
+
+    // Only the Normal find mode memoizes the sizes.
+    setenv("MIOPEN_FIND_MODE", "NORMAL", 1);
+    miopen::ReloadEnvironment();
+    const auto size = conv.ForwardGetWorkSpaceSize(handle, w, x, y);
+
+    auto& sizes = handle.GetContextCache().workspace_sizes;
+    EXPECT(sizes.size() == 1);
+    const std::size_t planted = size + 1;
+    for(auto& entry : sizes)
+        entry.second = planted;
+    EXPECT_EQUAL(conv.ForwardGetWorkSpaceSize(handle, w, x, y), planted);
+
+    // A reload may change the MIOPEN_DEBUG_CONV_* switches the sizes depend on.
+    miopen::ReloadEnvironment();
+    EXPECT_EQUAL(conv.ForwardGetWorkSpaceSize(handle, w, x, y), size);
+
+    unsetenv("MIOPEN_FIND_MODE");
+    miopen::ReloadEnvironment();
+}
+
+int main()
+{
+    Keys();
+    Contexts();
+    Reload();
+    WorkspaceSizes();
+}
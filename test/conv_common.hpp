@@ -126,17 +126,6 @@ static inline bool is_gemm_workspace_valid(miopen::Handle& handle,
               convDesc.ForwardGetWorkSpaceSizeGEMM(wDesc, yDesc)));
 }
 
-struct scalar_gen_random_float
-{
-    double min_val = 0;
-    double max_val = 1;
-
-    double operator()() const
-    {
-        return min_val + (max_val - min_val) * double(std::rand()) / RAND_MAX;
-    }
-};
-
 struct scalar_gen_random_integer
 {
     unsigned long min_val = 1;
@@ -436,6 +425,30 @@ struct verify_forward_conv : conv_base<T, Tout>
                         std::cout << "WARNING: workspace size mismatch: " << selected.workspace_size
                                   << " != " << ws_size << std::endl;
                 }
+
+                {
+                    // The smallest workspace of the solutions is enough for one of them.
+                    const auto smallest = std::min_element(
+                        solutions.begin(), solutions.begin() + count, [](auto&& l, auto&& r) {
+                            return l.workspace_size < r.workspace_size;
+                        });
+                    auto within       = miopenConvSolution_t{};
+                    auto within_count = std::size_t{0};
+                    filter.GetForwardSolutions(handle,
+                                               weights.desc,
+                                               input.desc,
+                                               rout.desc,
+                                               1,
+                                               &within_count,
+                                               &within,
+                                               smallest->workspace_size);
+                    if(within_count != 1 || within.workspace_size > smallest->workspace_size)
+                    {
+                        std::cout << "FAILED: No solution within workspace of "
+                                  << smallest->workspace_size << std::endl;
+                        exit(-1);
+                    }
+                }
                 resize_workspace(handle, selected.workspace_size, ws, ws_dev);
 
                 filter.CompileForwardSolution(
@@ -1745,17 +1758,15 @@ struct conv_driver : test_driver
                     auto data_type    = input.desc.GetType();
                     std::size_t v_max = is_int8 ? 16 : (data_type == miopenHalf) ? 4 : 16;
 
-                    return gen_float ? scalar_gen_random_float{0, 1}()
-                                     : scalar_gen_random_integer{1, v_max}();
+                    return scalar_gen_random_integer{1, v_max}();
                 };
 
                 auto gen_sign_value = [=](auto... is) {
                     auto data_type    = input.desc.GetType();
                     std::size_t v_max = is_int8 ? 16 : (data_type == miopenHalf) ? 4 : 16;
 
-                    return gen_float ? scalar_gen_random_float{-1, 1}()
-                                     : scalar_gen_random_integer{1, v_max}() *
-                                           tensor_elem_gen_checkboard_sign{}(is...);
+                    return scalar_gen_random_integer{1, v_max}() *
+                           tensor_elem_gen_checkboard_sign{}(is...);
                 };
 
                 bool skip_forward =
@@ -1802,9 +1813,18 @@ struct conv_driver : test_driver
                     return;
                 }
 
-                input.generate(gen_positive_value);
-                output.generate(gen_positive_value);
-                weights.generate(gen_sign_value);
+                if(gen_float)
+                {
+                    input.generate_random(0, 1);
+                    output.generate_random(0, 1);
+                    weights.generate_random(-1, 1);
+                }
+                else
+                {
+                    input.generate(gen_positive_value);
+                    output.generate(gen_positive_value);
+                    weights.generate(gen_sign_value);
+                }
 
                 auto&& handle = get_handle();
 
@@ -1898,7 +1918,10 @@ struct conv_driver : test_driver
 
                 if(do_backward_weights && !skip_backward_weights)
                 {
-                    output.generate(gen_sign_value);
+                    if(gen_float)
+                        output.generate_random(-1, 1);
+                    else
+                        output.generate(gen_sign_value);
 
                     verify(verify_backward_weights_conv<T>{
                         input, weights, output, filter, stats, 0, search, immed});
@@ -0,0 +1,249 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include "cpu_conv.hpp"
+#include <miopen/find_solution.hpp>
+#include <miopen/problem_description.hpp>
+
+#include <sstream>
+
+using miopen::conv::Direction;
+
+static miopen::TensorDescriptor MakeDesc(const std::vector<std::size_t>& lens,
+                                         const std::string& layout)
+{
+    const std::string labels = lens.size() == 5 ? "NCDHW" : "NCHW";
+    return {miopenFloat, lens, miopen::GetPackedStrides(lens, labels, layout)};
+}
+
+static std::string Key(const miopen::conv::ProblemDescription& problem)
+{
+    std::ostringstream ss;
+    problem.Serialize(ss);
+    return ss.str();
+}
+
+static void Layouts()
+{
+    EXPECT(miopen::GetPackedStrides({2, 3, 4, 5}, "NCHW", "NCHW") ==
+           std::vector<std::size_t>({60, 20, 5, 1}));
+    EXPECT(miopen::GetPackedStrides({2, 3, 4, 5}, "NCHW", "NHWC") ==
+           std::vector<std::size_t>({60, 1, 15, 3}));
+    EXPECT(throws([] { miopen::GetPackedStrides({2, 3, 4, 5}, "NCHW", "NHWN"); }));
+
+    const auto nhwc = MakeDesc({2, 3, 4, 5}, "NHWC");
+    EXPECT(nhwc.IsPacked());
+    EXPECT_EQUAL(nhwc.GetLayout("NCHW"), "NHWC");
+    EXPECT(nhwc.IsPossibleLayout("NCHW", "NHWC"));
+    EXPECT(!nhwc.IsPossibleLayout("NCHW", "NCHW"));
+    EXPECT_EQUAL(MakeDesc({2, 3, 4, 5}, "NCHW").GetLayout("NCHW"), "NCHW");
+
+    // Padded rows still allow channels last addressing.
+    const miopen::TensorDescriptor padded{miopenFloat, {2, 3, 4, 5}, {80, 1, 20, 3}};
+    EXPECT(padded.IsPossibleLayout("NCHW", "NHWC"));
+
+    // With a single channel both orders address the same memory.
+    const auto one_channel = MakeDesc({2, 1, 4, 5}, "NHWC");
+    EXPECT(one_channel.IsPossibleLayout("NCHW", "NCHW"));
+    EXPECT(one_channel.IsPossibleLayout("NCHW", "NHWC"));
+}
+
+static miopen::conv::ProblemDescription MakeProblem(const std::vector<std::size_t>& in_lens,
+                                                    const std::vector<std::size_t>& wei_lens,
+                                                    const std::vector<std::size_t>& out_lens,
+                                                    const std::string& in_layout,
+                                                    const std::string& out_layout,
+                                                    std::string wei_layout = "")
+{
+    if(wei_layout.empty())
+        wei_layout = in_layout;
+    const auto spatial_dims = in_lens.size() - 2;
+    const std::vector<int> ones(spatial_dims, 1);
+    const std::vector<int> zeros(spatial_dims, 0);
+    const miopen::ConvolutionDescriptor conv{
+        spatial_dims, miopenConvolution, miopenPaddingDefault, ones, ones, ones, zeros};
+    return {MakeDesc(in_lens, in_layout),
+            MakeDesc(wei_lens, wei_layout),
+            MakeDesc(out_lens, out_layout),
+            conv,
+            Direction::Forward};
+}
+
+static void Problems()
+{
+    const auto nchw = MakeProblem({2, 4, 6, 6}, {8, 4, 3, 3}, {2, 8, 6, 6}, "NCHW", "NCHW");
+    const auto nhwc = MakeProblem({2, 4, 6, 6}, {8, 4, 3, 3}, {2, 8, 6, 6}, "NHWC", "NHWC");
+
+    EXPECT_EQUAL(nchw.GetInLayout(), "NCHW");
+    EXPECT(nchw.IsLayoutDefault());
+    EXPECT(!nchw.IsLayoutNHWC());
+    EXPECT_EQUAL(Key(nchw), "4-6-6-3x3-8-6-6-2-1x1-1x1-1x1-0-NCHW-FP32-F");
+
+    EXPECT_EQUAL(nhwc.GetInLayout(), "NHWC");
+    EXPECT_EQUAL(nhwc.GetOutLayout(), "NHWC");
+    EXPECT(!nhwc.IsLayoutDefault());
+    EXPECT(nhwc.IsLayoutNHWC());
+    EXPECT_EQUAL(Key(nhwc), "4-6-6-3x3-8-6-6-2-1x1-1x1-1x1-0-NHWC-FP32-F");
+    EXPECT(nhwc.BuildConfKey().ToString() != nchw.BuildConfKey().ToString());
+    EXPECT_EQUAL(nhwc.GetInSize(), nchw.GetInSize());
+
+    const miopen::ProblemDescription legacy{nhwc};
+    EXPECT_EQUAL(legacy.in_layout, "NHWC");
+    EXPECT(legacy.IsLayoutNHWC());
+    EXPECT(legacy.BuildConfKey().ToString() !=
+           miopen::ProblemDescription{nchw}.BuildConfKey().ToString());
+
+    const auto ndhwc =
+        MakeProblem({2, 4, 3, 6, 6}, {8, 4, 3, 3, 3}, {2, 8, 3, 6, 6}, "NDHWC", "NDHWC");
+    EXPECT_EQUAL(ndhwc.GetInLayout(), "NDHWC");
+    EXPECT(ndhwc.IsLayoutNHWC());
+
+    // Ambiguous tensors keep the keys they had before channels last problems were told apart.
+    const auto one_channel =
+        MakeProblem({2, 1, 6, 6}, {8, 1, 3, 3}, {2, 8, 6, 6}, "NHWC", "NCHW");
+    EXPECT(one_channel.IsLayoutDefault());
+
+    const auto mixed = MakeProblem({2, 4, 6, 6}, {8, 4, 3, 3}, {2, 8, 6, 6}, "NHWC", "NCHW");
+    EXPECT(!mixed.IsLayoutDefault());
+    EXPECT(!mixed.IsLayoutNHWC());
+    EXPECT_EQUAL(mixed.GetWeightsLayout(), "NHWC");
+
+    // Problems with different layouts of their tensors do not share keys with uniform ones.
+    const auto mixed_in =
+        MakeProblem({2, 4, 6, 6}, {8, 4, 3, 3}, {2, 8, 6, 6}, "NCHW", "NHWC", "NCHW");
+    const auto mixed_weights =
+        MakeProblem({2, 4, 6, 6}, {8, 4, 3, 3}, {2, 8, 6, 6}, "NHWC", "NHWC", "NCHW");
+    EXPECT_EQUAL(Key(mixed), "4-6-6-3x3-8-6-6-2-1x1-1x1-1x1-0-NHWCNHWCNCHW-FP32-F");
+    EXPECT_EQUAL(Key(mixed_weights), "4-6-6-3x3-8-6-6-2-1x1-1x1-1x1-0-NHWCNCHWNHWC-FP32-F");
+    EXPECT(!mixed_weights.IsLayoutNHWC());
+    for(const auto& problem : {mixed, mixed_in, mixed_weights})
+    {
+        for(const auto& uniform : {nchw, nhwc})
+        {
+            EXPECT(Key(problem) != Key(uniform));
+            EXPECT(problem.BuildConfKey().ToString() != uniform.BuildConfKey().ToString());
+            EXPECT(miopen::ProblemDescription{problem}.BuildConfKey().ToString() !=
+                   miopen::ProblemDescription{uniform}.BuildConfKey().ToString());
+        }
+    }
+    EXPECT(Key(mixed_in) != Key(mixed));
+}
+
+struct DefaultLayoutSolver
+{
+    bool IsApplicable(const miopen::ProblemDescription&) const { return true; }
+};
+
+struct ChannelsLastSolver
+{
+    bool IsLayoutSupported(const miopen::ProblemDescription& problem) const
+    {
+        return problem.IsLayoutNHWC();
+    }
+    bool IsApplicable(const miopen::ProblemDescription&) const { return true; }
+};
+
+static void Solvers()
+{
+    const miopen::ProblemDescription nchw{
+        MakeProblem({2, 4, 6, 6}, {8, 4, 3, 3}, {2, 8, 6, 6}, "NCHW", "NCHW")};
+    const miopen::ProblemDescription nhwc{
+        MakeProblem({2, 4, 6, 6}, {8, 4, 3, 3}, {2, 8, 6, 6}, "NHWC", "NHWC")};
+
+    EXPECT(miopen::solver::IsSolverApplicable(DefaultLayoutSolver{}, nchw));
+    EXPECT(!miopen::solver::IsSolverApplicable(DefaultLayoutSolver{}, nhwc));
+    EXPECT(!miopen::solver::IsSolverApplicable(ChannelsLastSolver{}, nchw));
+    EXPECT(miopen::solver::IsSolverApplicable(ChannelsLastSolver{}, nhwc));
+}
+
+// Values only depend on the indices, not on where the tensor stores them.
+static void Fill(tensor<float>& t, std::size_t seed)
+{
+    t.for_each([&](auto... is) {
+        std::size_t v               = seed;
+        const std::size_t indices[] = {0, static_cast<std::size_t>(is)...};
+        for(const auto i : indices)
+            v = v * 7 + i;
+        t(is...) = static_cast<float>(v % 11) - 5;
+    });
+}
+
+static void CheckEqual(const tensor<float>& x, const tensor<float>& y)
+{
+    x.for_each([&](auto... is) { EXPECT_EQUAL(x(is...), y(is...)); });
+}
+
+// The references give the same values for channels first and channels last tensors.
+static void References()
+{
+    const std::vector<int> pads      = {1, 0};
+    const std::vector<int> strides   = {2, 1};
+    const std::vector<int> dilations = {1, 2};
+    const std::size_t groups         = 2;
+
+    const std::vector<std::size_t> in_lens  = {2, 4, 7, 6};
+    const std::vector<std::size_t> wei_lens = {6, 2, 3, 2};
+    const std::vector<std::size_t> out_lens = {2, 6, 4, 4};
+
+    auto in_nchw  = make_conv_tensor<float>(in_lens, "NCHW");
+    auto in_nhwc  = make_conv_tensor<float>(in_lens, "NHWC");
+    auto wei_nchw = make_conv_tensor<float>(wei_lens, "NCHW");
+    auto wei_nhwc = make_conv_tensor<float>(wei_lens, "NHWC");
+    auto out_nchw = make_conv_tensor<float>(out_lens, "NCHW");
+    auto out_nhwc = make_conv_tensor<float>(out_lens, "NHWC");
+
+    Fill(in_nchw, 1);
+    Fill(in_nhwc, 1);
+    Fill(wei_nchw, 2);
+    Fill(wei_nhwc, 2);
+
+    cpu_convolution_forward(2, in_nchw, wei_nchw, out_nchw, pads, strides, dilations, groups);
+    cpu_convolution_forward(2, in_nhwc, wei_nhwc, out_nhwc, pads, strides, dilations, groups);
+    CheckEqual(out_nchw, out_nhwc);
+    EXPECT(out_nchw.data != out_nhwc.data);
+
+    Fill(out_nchw, 3);
+    Fill(out_nhwc, 3);
+
+    cpu_convolution_backward_data(2, in_nchw, wei_nchw, out_nchw, pads, strides, dilations, groups);
+    cpu_convolution_backward_data(2, in_nhwc, wei_nhwc, out_nhwc, pads, strides, dilations, groups);
+    CheckEqual(in_nchw, in_nhwc);
+
+    cpu_convolution_backward_weight(
+        2, in_nchw, wei_nchw, out_nchw, pads, strides, dilations, groups);
+    cpu_convolution_backward_weight(
+        2, in_nhwc, wei_nhwc, out_nhwc, pads, strides, dilations, groups);
+    CheckEqual(wei_nchw, wei_nhwc);
+}
+
+int main()
+{
+    Layouts();
+    Problems();
+    Solvers();
+    References();
+}
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_ACTIVATION_HPP
+#define GUARD_CPU_ACTIVATION_HPP
+
+#include "cpu_reference.hpp"
+
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// The mode is dispatched once per call, each plane then runs a loop without branches on it.
+template <class Tx, class Ty, class F>
+void cpu_activation_forward_impl(const nc_view& xv, const Tx* x, const nc_view& yv, Ty* y, F f)
+{
+    par_for_nc(xv.n, xv.c, [&](std::size_t ni, std::size_t ci) {
+        for_each_spatial(ni,
+                         ci,
+                         [&](std::size_t xi, std::size_t yi) {
+                             y[yi] = static_cast<Ty>(f(static_cast<double>(x[xi])));
+                         },
+                         xv,
+                         yv);
+    });
+}
+
+/// y = f(x), computed as the activation kernels do it (activation_functions.h).
+template <class Tx, class Ty>
+void cpu_activation_forward(miopenActivationMode_t mode,
+                            double alpha,
+                            double beta,
+                            double gamma,
+                            const nc_view& xv,
+                            const Tx* x,
+                            const nc_view& yv,
+                            Ty* y)
+{
+    auto run = [&](auto f) { cpu_activation_forward_impl(xv, x, yv, y, f); };
+    switch(mode)
+    {
+    case miopenActivationPASTHRU: run([](double v) { return v; }); break;
+    case miopenActivationLOGISTIC: run([](double v) { return 1 / (1 + std::exp(-v)); }); break;
+    case miopenActivationTANH: run([=](double v) { return beta * std::tanh(alpha * v); }); break;
+    case miopenActivationRELU: run([](double v) { return (v > 0) ? v : 0; }); break;
+    case miopenActivationSOFTRELU:
+        // log(1 + e^x) without overflow of e^x
+        run([](double v) {
+            return (v > 0) ? v + std::log1p(std::exp(-v)) : std::log1p(std::exp(v));
+        });
+        break;
+    case miopenActivationABS: run([](double v) { return std::abs(v); }); break;
+    case miopenActivationPOWER:
+        run([=](double v) {
+            const double arg = alpha + beta * v;
+            return arg <= std::numeric_limits<double>::epsilon() ? 0 : std::pow(arg, gamma);
+        });
+        break;
+    case miopenActivationCLIPPEDRELU:
+        run([=](double v) { return std::min(alpha, std::max(0.0, v)); });
+        break;
+    case miopenActivationLEAKYRELU: run([=](double v) { return (v > 0) ? v : v * alpha; }); break;
+    case miopenActivationELU:
+        run([=](double v) { return (v > 0) ? v : alpha * std::expm1(v); });
+        break;
+    }
+}
+
+template <class Ty, class Tdy, class Tx, class Tdx, class F>
+void cpu_activation_backward_impl(const nc_view& yv,
+                                  const Ty* y,
+                                  const nc_view& dyv,
+                                  const Tdy* dy,
+                                  const nc_view& xv,
+                                  const Tx* x,
+                                  const nc_view& dxv,
+                                  Tdx* dx,
+                                  F f)
+{
+    par_for_nc(xv.n, xv.c, [&](std::size_t ni, std::size_t ci) {
+        for_each_spatial(ni,
+                         ci,
+                         [&](std::size_t yi, std::size_t dyi, std::size_t xi, std::size_t dxi) {
+                             dx[dxi] = static_cast<Tdx>(f(static_cast<double>(dy[dyi]),
+                                                          static_cast<double>(x[xi]),
+                                                          static_cast<double>(y[yi])));
+                         },
+                         yv,
+                         dyv,
+                         xv,
+                         dxv);
+    });
+}
+
+/// dx = f'(dy, x, y), computed as the activation kernels do it (activation_functions.h).
+template <class Ty, class Tdy, class Tx, class Tdx>
+void cpu_activation_backward(miopenActivationMode_t mode,
+                             double alpha,
+                             double beta,
+                             double gamma,
+                             const nc_view& yv,
+                             const Ty* y,
+                             const nc_view& dyv,
+                             const Tdy* dy,
+                             const nc_view& xv,
+                             const Tx* x,
+                             const nc_view& dxv,
+                             Tdx* dx)
+{
+    auto run = [&](auto f) { cpu_activation_backward_impl(yv, y, dyv, dy, xv, x, dxv, dx, f); };
+    switch(mode)
+    {
+    case miopenActivationPASTHRU: run([](double g, double, double) { return g; }); break;
+    case miopenActivationLOGISTIC:
+        run([](double g, double, double v) { return g * v * (1 - v); });
+        break;
+    case miopenActivationTANH:
+        run([=](double g, double, double v) { return g * alpha * (beta - v * v / beta); });
+        break;
+    case miopenActivationRELU:
+        run([](double g, double u, double) { return (u > 0) ? g : 0; });
+        break;
+    case miopenActivationSOFTRELU:
+        run([](double g, double u, double) {
+            const double threshold = 50.;
+            const double expval    = std::exp(std::min(u, threshold));
+            return g * expval / (expval + 1.0);
+        });
+        break;
+    case miopenActivationABS:
+        run([](double g, double u, double) { return g * ((u > 0) ? 1 : -1); });
+        break;
+    case miopenActivationPOWER:
+        // The kernel scales y by gamma * beta and does not read dy.
+        run([=](double, double u, double v) {
+            const double arg = alpha + beta * u;
+            return arg <= std::numeric_limits<double>::epsilon() ? 0 : gamma * beta * v / arg;
+        });
+        break;
+    case miopenActivationCLIPPEDRELU:
+        run([=](double g, double u, double) { return (u > 0 && u <= alpha) ? g : 0; });
+        break;
+    case miopenActivationLEAKYRELU:
+        run([=](double g, double u, double) { return g * ((u > 0) ? 1 : alpha); });
+        break;
+    case miopenActivationELU:
+        run([=](double g, double u, double v) { return g * ((u > 0) ? 1 : v + alpha); });
+        break;
+    }
+}
+
+#endif
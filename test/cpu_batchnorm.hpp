@@ -0,0 +1,284 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_BATCHNORM_HPP
+#define GUARD_CPU_BATCHNORM_HPP
+
+#include "cpu_reference.hpp"
+
+#include <miopen/miopen.h>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Scale, bias and the statistics are packed: C values in spatial mode, C x D x H x W values in
+// per activation mode. Any of the optional outputs may be null.
+
+/// Number of normalization parameters of a tensor.
+inline std::size_t cpu_bn_params(miopenBatchNormMode_t mode, const nc_view& xv)
+{
+    return mode == miopenBNSpatial ? xv.c : xv.c * xv.spatial();
+}
+
+/// Number of elements normalized with each parameter.
+inline std::size_t cpu_bn_count(miopenBatchNormMode_t mode, const nc_view& xv)
+{
+    return mode == miopenBNSpatial ? xv.n * xv.spatial() : xv.n;
+}
+
+/// Sums of f(p, offset...) over the elements of every parameter p, one offset per view.
+template <class F, class... Views>
+std::vector<double>
+cpu_bn_sums(miopenBatchNormMode_t mode, F f, const nc_view& v, const Views&... vs)
+{
+    std::vector<double> sums(cpu_bn_params(mode, v), 0.0);
+    if(mode == miopenBNSpatial)
+    {
+        // Plane sums in parallel, then the images of each channel in a fixed order.
+        std::vector<double> planes(v.n * v.c);
+        par_for_nc(v.n, v.c, [&](std::size_t ni, std::size_t ci) {
+            planes[ni * v.c + ci] =
+                spatial_sum(ni, ci, [&](auto... offsets) { return f(ci, offsets...); }, v, vs...);
+        });
+        for(std::size_t ci = 0; ci < v.c; ci++)
+            sums[ci] =
+                pairwise_sum(v.n, [&](std::size_t ni) { return planes[ni * v.c + ci]; });
+        return sums;
+    }
+
+    // Every channel accumulates its whole plane of sums image by image, which vectorizes.
+    const auto spatial = v.spatial();
+    miopen::par_for(v.c, 1, [&](std::size_t ci) {
+        auto* acc = sums.data() + ci * spatial;
+        for(std::size_t ni = 0; ni < v.n; ni++)
+            for(std::size_t s = 0; s < spatial; s++)
+                acc[s] += f(ci * spatial + s,
+                            (v.offset(ni, ci) + v.spatial_offset(s)),
+                            (vs.offset(ni, ci) + vs.spatial_offset(s))...);
+    });
+    return sums;
+}
+
+/// Calls f(p, offset...) for every element, where p is the parameter of the element.
+template <class F, class... Views>
+void cpu_bn_for_each(miopenBatchNormMode_t mode, F f, const nc_view& v, const Views&... vs)
+{
+    const auto spatial = v.spatial();
+    par_for_nc(v.n, v.c, [&](std::size_t ni, std::size_t ci) {
+        if(mode == miopenBNSpatial)
+        {
+            for_each_spatial(ni, ci, [&](auto... offsets) { f(ci, offsets...); }, v, vs...);
+            return;
+        }
+        for(std::size_t s = 0; s < spatial; s++)
+            f(ci * spatial + s,
+              (v.offset(ni, ci) + v.spatial_offset(s)),
+              (vs.offset(ni, ci) + vs.spatial_offset(s))...);
+    });
+}
+
+/// Mean and biased variance of the batch, the variance is computed around the mean.
+template <class Tx>
+void cpu_bn_statistics(miopenBatchNormMode_t mode,
+                       const nc_view& xv,
+                       const Tx* x,
+                       std::vector<double>& mean,
+                       std::vector<double>& variance)
+{
+    const auto count = static_cast<double>(cpu_bn_count(mode, xv));
+    mean = cpu_bn_sums(mode, [&](std::size_t, std::size_t xi) { return double(x[xi]); }, xv);
+    for(auto& m : mean)
+        m /= count;
+    variance = cpu_bn_sums(mode,
+                           [&](std::size_t p, std::size_t xi) {
+                               const auto d = double(x[xi]) - mean[p];
+                               return d * d;
+                           },
+                           xv);
+    for(auto& v : variance)
+        v /= count;
+}
+
+template <class Tx, class Ty, class Tp, class Tbias>
+void cpu_bn_normalize(miopenBatchNormMode_t mode,
+                      const nc_view& xv,
+                      const Tx* x,
+                      const nc_view& yv,
+                      Ty* y,
+                      const Tp* scale,
+                      const Tbias* bias,
+                      const std::vector<double>& mean,
+                      const std::vector<double>& inv_var)
+{
+    cpu_bn_for_each(mode,
+                    [&](std::size_t p, std::size_t xi, std::size_t yi) {
+                        const auto xhat = (double(x[xi]) - mean[p]) * inv_var[p];
+                        y[yi] = static_cast<Ty>(double(scale[p]) * xhat + double(bias[p]));
+                    },
+                    xv,
+                    yv);
+}
+
+inline std::vector<double> cpu_bn_inv_std(const std::vector<double>& variance, double epsilon)
+{
+    std::vector<double> inv_var(variance.size());
+    for(std::size_t p = 0; p < variance.size(); p++)
+        inv_var[p] = 1.0 / std::sqrt(variance[p] + epsilon);
+    return inv_var;
+}
+
+/// Training forward pass. The running statistics are updated with exp_avg_factor, the running
+/// variance uses the unbiased estimate.
+template <class Tx, class Ty, class Tp, class Ts>
+void cpu_bn_fwd_train(miopenBatchNormMode_t mode,
+                      double epsilon,
+                      double exp_avg_factor,
+                      const nc_view& xv,
+                      const Tx* x,
+                      const nc_view& yv,
+                      Ty* y,
+                      const Tp* scale,
+                      const Tp* bias,
+                      Ts* save_mean,
+                      Ts* save_inv_var,
+                      Ts* running_mean,
+                      Ts* running_var)
+{
+    std::vector<double> mean;
+    std::vector<double> variance;
+    cpu_bn_statistics(mode, xv, x, mean, variance);
+    const auto inv_var = cpu_bn_inv_std(variance, epsilon);
+    cpu_bn_normalize(mode, xv, x, yv, y, scale, bias, mean, inv_var);
+
+    const auto count = cpu_bn_count(mode, xv);
+    const auto unbias =
+        count == 1 ? 1.0 : static_cast<double>(count) / static_cast<double>(count - 1);
+    for(std::size_t p = 0; p < mean.size(); p++)
+    {
+        if(save_mean != nullptr)
+            save_mean[p] = static_cast<Ts>(mean[p]);
+        if(save_inv_var != nullptr)
+            save_inv_var[p] = static_cast<Ts>(inv_var[p]);
+        if(running_mean != nullptr)
+            running_mean[p] = static_cast<Ts>(mean[p] * exp_avg_factor +
+                                              double(running_mean[p]) * (1 - exp_avg_factor));
+        if(running_var != nullptr)
+            running_var[p] = static_cast<Ts>((1 - exp_avg_factor) * double(running_var[p]) +
+                                             exp_avg_factor * unbias * variance[p]);
+    }
+}
+
+/// Inference forward pass with the estimated statistics, or with the statistics of the batch
+/// when est_mean is null.
+template <class Tx, class Ty, class Tp, class Ts>
+void cpu_bn_fwd_infer(miopenBatchNormMode_t mode,
+                      double epsilon,
+                      const nc_view& xv,
+                      const Tx* x,
+                      const nc_view& yv,
+                      Ty* y,
+                      const Tp* scale,
+                      const Tp* bias,
+                      const Ts* est_mean,
+                      const Ts* est_var)
+{
+    std::vector<double> mean;
+    std::vector<double> variance;
+    if(est_mean == nullptr)
+    {
+        cpu_bn_statistics(mode, xv, x, mean, variance);
+    }
+    else
+    {
+        const auto params = cpu_bn_params(mode, xv);
+        mean.assign(est_mean, est_mean + params);
+        variance.assign(est_var, est_var + params);
+    }
+    cpu_bn_normalize(mode, xv, x, yv, y, scale, bias, mean, cpu_bn_inv_std(variance, epsilon));
+}
+
+/// Backward pass with the saved statistics, or with the statistics of the batch when saved_mean
+/// is null. dscale and dbias are assigned, not accumulated.
+template <class Tx, class Tdy, class Tdx, class Tp, class Tds, class Ts>
+void cpu_bn_bwd(miopenBatchNormMode_t mode,
+                double epsilon,
+                const nc_view& xv,
+                const Tx* x,
+                const nc_view& dyv,
+                const Tdy* dy,
+                const nc_view& dxv,
+                Tdx* dx,
+                const Tp* scale,
+                Tds* dscale,
+                Tds* dbias,
+                const Ts* saved_mean,
+                const Ts* saved_inv_var)
+{
+    std::vector<double> mean;
+    std::vector<double> inv_var;
+    if(saved_mean == nullptr)
+    {
+        std::vector<double> variance;
+        cpu_bn_statistics(mode, xv, x, mean, variance);
+        inv_var = cpu_bn_inv_std(variance, epsilon);
+    }
+    else
+    {
+        const auto params = cpu_bn_params(mode, xv);
+        mean.assign(saved_mean, saved_mean + params);
+        inv_var.assign(saved_inv_var, saved_inv_var + params);
+    }
+
+    const auto db = cpu_bn_sums(
+        mode, [&](std::size_t, std::size_t, std::size_t dyi) { return double(dy[dyi]); }, xv, dyv);
+    const auto ds = cpu_bn_sums(mode,
+                                [&](std::size_t p, std::size_t xi, std::size_t dyi) {
+                                    const auto xhat = (double(x[xi]) - mean[p]) * inv_var[p];
+                                    return xhat * double(dy[dyi]);
+                                },
+                                xv,
+                                dyv);
+
+    // dx = scale / sqrt(var + eps) / M * (M * dy - sum(dy) - xhat * sum(xhat * dy))
+    const auto count = static_cast<double>(cpu_bn_count(mode, xv));
+    cpu_bn_for_each(mode,
+                    [&](std::size_t p, std::size_t xi, std::size_t dyi, std::size_t dxi) {
+                        const auto xhat = (double(x[xi]) - mean[p]) * inv_var[p];
+                        const auto g    = count * double(dy[dyi]) - db[p] - xhat * ds[p];
+                        dx[dxi] = static_cast<Tdx>(double(scale[p]) * inv_var[p] / count * g);
+                    },
+                    xv,
+                    dyv,
+                    dxv);
+
+    for(std::size_t p = 0; p < db.size(); p++)
+    {
+        dscale[p] = static_cast<Tds>(ds[p]);
+        dbias[p]  = static_cast<Tds>(db[p]);
+    }
+}
+
+#endif
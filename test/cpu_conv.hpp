@@ -32,6 +32,7 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <string>
 #include <miopen/miopen.h>
 #include <miopen/tensor.hpp>
 #include <utility>
@@ -46,6 +47,15 @@ static constexpr auto make_array(T x, Ts... xs)
     return std::array<T, 1 + sizeof...(Ts)>{{x, xs...}};
 }
 
+// The references index the tensors through their descriptors, so the activations and the
+// weights may be stored in any layout, e.g. channels last tensors made by this function.
+template <class T>
+tensor<T> make_conv_tensor(const std::vector<std::size_t>& lens, const std::string& layout)
+{
+    const std::string labels = lens.size() == 5 ? "NCDHW" : "NCHW";
+    return tensor<T>{lens, miopen::GetPackedStrides(lens, labels, layout)};
+}
+
 template <std::size_t ConvDim, typename Tin, typename Twei, typename Tout, typename Range>
 void cpu_convolution_forward_impl(const tensor<Tin>& in,
                                   const tensor<Twei>& wei,
@@ -0,0 +1,280 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_CTC_HPP
+#define GUARD_CPU_CTC_HPP
+
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Host CTC loss. Every batch element is a separate task on the host threads. The log softmax
+// is fused into the loss: only the normalizer of each time step is stored, the log
+// probabilities are recomputed where they are read. The label lattice updates are branch free
+// loops over contiguous arrays, so they vectorize.
+
+/// Log probabilities are clamped to this value, as in the CTC kernels.
+constexpr double cpu_ctc_cutoff = -1e20;
+
+/// Strides of a T x N x C tensor of probabilities or gradients.
+struct ctc_strides
+{
+    std::size_t t = 0;
+    std::size_t n = 0;
+    std::size_t c = 1;
+
+    std::size_t index(std::size_t ti, std::size_t ni, std::size_t ci) const
+    {
+        return ti * t + ni * n + ci * c;
+    }
+};
+
+inline double cpu_ctc_logaddexp(double a, double b)
+{
+    const auto m = std::max(a, b);
+    return m + std::log(std::exp(a - m) + std::exp(b - m));
+}
+
+inline double cpu_ctc_logaddexp(double a, double b, double c)
+{
+    const auto m = std::max(a, std::max(b, c));
+    return m + std::log(std::exp(a - m) + std::exp(b - m) + std::exp(c - m));
+}
+
+/// Loss and gradient of batch element b. grad is indexed by class and written for the time
+/// steps of the sequence, the remaining time steps are zeroed. A sequence without time steps
+/// has no alignment, its loss is the clamped infinity -cpu_ctc_cutoff and its gradient is zero.
+template <class Tp, class Tg>
+double cpu_ctc_sequence(std::size_t b,
+                        std::size_t max_time,
+                        std::size_t class_sz,
+                        const ctc_strides& ps,
+                        const Tp* probs,
+                        const int* label,
+                        int label_length,
+                        int input_length,
+                        const ctc_strides& gs,
+                        Tg* grads,
+                        int blank,
+                        bool apply_softmax)
+{
+    if(input_length <= 0)
+    {
+        for(std::size_t t = 0; t < max_time; t++)
+            for(std::size_t k = 0; k < class_sz; k++)
+                grads[gs.index(t, b, k)] = Tg(0);
+        return -cpu_ctc_cutoff;
+    }
+
+    const auto t_len = static_cast<std::size_t>(input_length);
+    const auto s_len = static_cast<std::size_t>(2 * label_length + 1);
+
+    std::vector<int> lp(s_len, blank);
+    int repeat = 0;
+    for(int i = 0; i < label_length; i++)
+    {
+        lp[2 * i + 1] = label[i];
+        if(i > 0 && label[i] == label[i - 1])
+            repeat++;
+    }
+    // Without spare time steps the paths can neither start nor end with a blank.
+    const bool tight = label_length + repeat == input_length;
+
+    // Normalizer of every time step, the log softmax is x - norm.
+    std::vector<double> norm(t_len, 0.0);
+    if(apply_softmax)
+    {
+        for(std::size_t t = 0; t < t_len; t++)
+        {
+            const auto* row = probs + ps.index(t, b, 0);
+            double m        = row[0];
+            for(std::size_t k = 1; k < class_sz; k++)
+                m = std::max(m, double(row[k * ps.c]));
+            double sum = 0;
+            for(std::size_t k = 0; k < class_sz; k++)
+                sum += std::exp(double(row[k * ps.c]) - m);
+            norm[t] = m + std::log(sum);
+        }
+    }
+    auto logp = [&](std::size_t t, std::size_t k) {
+        return std::max(double(probs[ps.index(t, b, k)]) - norm[t], cpu_ctc_cutoff);
+    };
+
+    // skip_a[s]: state s can be entered from s - 2, skip_b[s]: state s can go on to s + 2.
+    std::vector<char> skip_a(s_len, 0);
+    std::vector<char> skip_b(s_len, 0);
+    for(std::size_t s = 0; s < s_len; s++)
+    {
+        skip_a[s] = s >= 2 && lp[s] != blank && lp[s] != lp[s - 2];
+        skip_b[s] = s + 2 < s_len && lp[s] != blank && lp[s] != lp[s + 2];
+    }
+
+    // Rows of alpha have two leading cells of padding, so state s reads s - 1 and s - 2
+    // without branches.
+    const auto a_row = s_len + 2;
+    std::vector<double> alpha(t_len * a_row, cpu_ctc_cutoff);
+    std::vector<double> emit(s_len);
+    for(std::size_t t = 0; t < t_len; t++)
+    {
+        for(std::size_t s = 0; s < s_len; s++)
+            emit[s] = logp(t, lp[s]);
+        double* cur = alpha.data() + t * a_row + 2;
+        if(t == 0)
+        {
+            cur[0] = tight ? cpu_ctc_cutoff : emit[0];
+            if(s_len > 1)
+                cur[1] = emit[1];
+            continue;
+        }
+        // prev[s + 2] is state s of the previous time step.
+        const double* prev = cur - 2 - a_row;
+        for(std::size_t s = 0; s < s_len; s++)
+        {
+            const auto from_skip = skip_a[s] ? prev[s] : cpu_ctc_cutoff;
+            cur[s]               = std::max(
+                cpu_ctc_logaddexp(prev[s + 2], prev[s + 1], from_skip) + emit[s], cpu_ctc_cutoff);
+        }
+    }
+
+    const double* last = alpha.data() + (t_len - 1) * a_row + 2;
+    const auto lx = s_len > 1 ? cpu_ctc_logaddexp(last[s_len - 1], last[s_len - 2]) : last[0];
+
+    // beta runs backward in time in two rows with two trailing cells of padding. The gradient of
+    // each time step is formed as soon as its beta is known.
+    std::vector<double> beta0(s_len + 2, cpu_ctc_cutoff);
+    std::vector<double> beta1(s_len + 2, cpu_ctc_cutoff);
+    std::vector<double> occupancy(class_sz, 0.0);
+    for(std::size_t tr = 0; tr < t_len; tr++)
+    {
+        const auto t = t_len - 1 - tr;
+        for(std::size_t s = 0; s < s_len; s++)
+            emit[s] = logp(t, lp[s]);
+        auto& cur  = tr % 2 == 0 ? beta0 : beta1;
+        auto& next = tr % 2 == 0 ? beta1 : beta0;
+        if(tr == 0)
+        {
+            cur[s_len - 1] = tight ? cpu_ctc_cutoff : emit[s_len - 1];
+            if(s_len > 1)
+                cur[s_len - 2] = emit[s_len - 2];
+        }
+        else
+        {
+            for(std::size_t s = 0; s < s_len; s++)
+            {
+                const auto from_skip = skip_b[s] ? next[s + 2] : cpu_ctc_cutoff;
+                cur[s]               = std::max(
+                    cpu_ctc_logaddexp(next[s], next[s + 1], from_skip) + emit[s], cpu_ctc_cutoff);
+            }
+        }
+
+        // alpha * beta of the states, summed per class relative to the largest one.
+        const double* a = alpha.data() + t * a_row + 2;
+        double m        = cpu_ctc_cutoff;
+        for(std::size_t s = 0; s < s_len; s++)
+            m = std::max(m, a[s] + cur[s]);
+        for(std::size_t s = 0; s < s_len; s++)
+            occupancy[lp[s]] += std::exp(a[s] + cur[s] - m);
+
+        // Classes outside of the label only see the softmax.
+        auto* g = grads + gs.index(t, b, 0);
+        if(apply_softmax)
+        {
+            for(std::size_t k = 0; k < class_sz; k++)
+                g[k * gs.c] = Tg(std::exp(logp(t, k)));
+        }
+        else
+        {
+            for(std::size_t k = 0; k < class_sz; k++)
+                g[k * gs.c] = Tg(0);
+        }
+
+        for(std::size_t s = 0; s < s_len; s++)
+        {
+            const auto k = static_cast<std::size_t>(lp[s]);
+            if(occupancy[k] < 0)
+                continue;
+            const auto log_occ = occupancy[k] > 0 ? m + std::log(occupancy[k]) : cpu_ctc_cutoff;
+            const auto p       = logp(t, k);
+            if(apply_softmax)
+                g[k * gs.c] = Tg(std::exp(p) -
+                                 std::exp(std::max(log_occ - p - lx, cpu_ctc_cutoff)));
+            else
+                g[k * gs.c] = Tg(-std::exp(std::max(log_occ - 2 * p - lx, cpu_ctc_cutoff)));
+            occupancy[k] = -1;
+        }
+        for(std::size_t s = 0; s < s_len; s++)
+            occupancy[lp[s]] = 0;
+    }
+
+    for(std::size_t t = t_len; t < max_time; t++)
+        for(std::size_t k = 0; k < class_sz; k++)
+            grads[gs.index(t, b, k)] = Tg(0);
+
+    return -lx;
+}
+
+/// CTC loss of a T x N x C batch of probabilities with the gradient with respect to them. The
+/// probabilities are logits when apply_softmax is set and log probabilities otherwise. Labels
+/// are packed one sequence after the other. The blank label is clamped to [0, C).
+template <class Tp, class Tl, class Tg>
+void cpu_ctc_loss(std::size_t max_time,
+                  std::size_t batch_size,
+                  std::size_t class_sz,
+                  const ctc_strides& ps,
+                  const Tp* probs,
+                  const int* labels,
+                  const int* label_lengths,
+                  const int* input_lengths,
+                  Tl* losses,
+                  const ctc_strides& gs,
+                  Tg* grads,
+                  int blank,
+                  bool apply_softmax)
+{
+    blank = std::min(std::max(blank, 0), static_cast<int>(class_sz) - 1);
+    std::vector<std::size_t> label_offsets(batch_size, 0);
+    for(std::size_t b = 1; b < batch_size; b++)
+        label_offsets[b] = label_offsets[b - 1] + label_lengths[b - 1];
+
+    miopen::par_for(batch_size, 1, [&](std::size_t b) {
+        losses[b] = Tl(cpu_ctc_sequence(b,
+                                        max_time,
+                                        class_sz,
+                                        ps,
+                                        probs,
+                                        labels + label_offsets[b],
+                                        label_lengths[b],
+                                        input_lengths[b],
+                                        gs,
+                                        grads,
+                                        blank,
+                                        apply_softmax));
+    });
+}
+
+#endif
@@ -0,0 +1,233 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_LRN_HPP
+#define GUARD_CPU_LRN_HPP
+
+#include "cpu_reference.hpp"
+
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/// Window of the local response normalization: element i is normalized over
+/// [i - before, i + after] in forward and over [i - after, i + before] in backward.
+struct lrn_window
+{
+    int before;
+    int after;
+
+    explicit lrn_window(unsigned int n)
+        : before(static_cast<int>((n - 1) / 2)), after(static_cast<int>(n / 2))
+    {
+    }
+};
+
+/// Sums src over the (before + 1 + after)^2 window around each element of an h x w plane, first
+/// along the rows and then along the columns.
+inline void lrn_box_sum(const std::vector<double>& src,
+                        std::vector<double>& dst,
+                        std::size_t h,
+                        std::size_t w,
+                        int before,
+                        int after)
+{
+    std::vector<double> rows(h * w);
+    const auto ih = static_cast<int>(h);
+    const auto iw = static_cast<int>(w);
+    for(int r = 0; r < ih; r++)
+    {
+        for(int col = 0; col < iw; col++)
+        {
+            const auto lo = std::max(col - before, 0);
+            const auto hi = std::min(col + after + 1, iw);
+            double acc    = 0;
+            for(int k = lo; k < hi; k++)
+                acc += src[r * w + k];
+            rows[r * w + col] = acc;
+        }
+    }
+    std::fill(dst.begin(), dst.end(), 0.0);
+    for(int r = 0; r < ih; r++)
+    {
+        const auto lo = std::max(r - before, 0);
+        const auto hi = std::min(r + after + 1, ih);
+        for(int k = lo; k < hi; k++)
+            for(std::size_t col = 0; col < w; col++)
+                dst[r * w + col] += rows[k * w + col];
+    }
+}
+
+/// y = x * scale^-beta, scale = K + alpha / area * sum(x^2) over the window. The scale is stored
+/// in the layout of y when a buffer is given, the backward pass reads it.
+template <class Tx, class Ty, class Tscale = double>
+void cpu_lrn_forward(miopenLRNMode_t mode,
+                     unsigned int n,
+                     double alpha,
+                     double beta,
+                     double k,
+                     const nc_view& xv,
+                     const Tx* x,
+                     const nc_view& yv,
+                     Ty* y,
+                     Tscale* scale = nullptr)
+{
+    const lrn_window win{n};
+    const bool across        = mode == miopenLRNCrossChannel;
+    const auto area          = across ? static_cast<double>(n) : static_cast<double>(n) * n;
+    const auto alphaoverarea = alpha / area;
+    const auto spatial       = xv.spatial();
+
+    par_for_nc(xv.n, xv.c, [&](std::size_t ni, std::size_t ci) {
+        std::vector<double> squares(spatial);
+        std::vector<double> sum(spatial, 0.0);
+        auto load_squares = [&](std::size_t cj) {
+            const auto base = xv.offset(ni, cj);
+            for(std::size_t s = 0; s < spatial; s++)
+            {
+                const auto v = static_cast<double>(x[base + xv.spatial_offset(s)]);
+                squares[s]   = v * v;
+            }
+        };
+
+        if(across)
+        {
+            const auto lo = std::max<int>(static_cast<int>(ci) - win.before, 0);
+            const auto hi = std::min<int>(static_cast<int>(ci) + win.after + 1, xv.c);
+            for(int cj = lo; cj < hi; cj++)
+            {
+                load_squares(cj);
+                for(std::size_t s = 0; s < spatial; s++)
+                    sum[s] += squares[s];
+            }
+        }
+        else
+        {
+            load_squares(ci);
+            // Depth slices are normalized independently.
+            const auto plane = xv.h * xv.w;
+            std::vector<double> src(plane);
+            std::vector<double> dst(plane);
+            for(std::size_t di = 0; di < xv.d; di++)
+            {
+                std::copy_n(squares.begin() + di * plane, plane, src.begin());
+                lrn_box_sum(src, dst, xv.h, xv.w, win.before, win.after);
+                std::copy_n(dst.begin(), plane, sum.begin() + di * plane);
+            }
+        }
+
+        const auto x_base = xv.offset(ni, ci);
+        const auto y_base = yv.offset(ni, ci);
+        for(std::size_t s = 0; s < spatial; s++)
+        {
+            const auto sc = k + alphaoverarea * sum[s];
+            const auto yi = y_base + yv.spatial_offset(s);
+            y[yi] = static_cast<Ty>(static_cast<double>(x[x_base + xv.spatial_offset(s)]) *
+                                    std::pow(sc, -beta));
+            if(scale != nullptr)
+                scale[yi] = static_cast<Tscale>(sc);
+        }
+    });
+}
+
+/// dx = scale^-beta * dy - 2 * alpha * beta / area * x * sum(y * dy / scale) over the window.
+/// scale is the one of the forward pass, in the layout of dy.
+template <class Ty, class Tdy, class Tx, class Tscale, class Tdx>
+void cpu_lrn_backward(miopenLRNMode_t mode,
+                      unsigned int n,
+                      double alpha,
+                      double beta,
+                      const nc_view& yv,
+                      const Ty* y,
+                      const nc_view& dyv,
+                      const Tdy* dy,
+                      const nc_view& xv,
+                      const Tx* x,
+                      const Tscale* scale,
+                      const nc_view& dxv,
+                      Tdx* dx)
+{
+    const lrn_window win{n};
+    const bool across  = mode == miopenLRNCrossChannel;
+    const auto area    = across ? static_cast<double>(n) : static_cast<double>(n) * n;
+    const auto ratio   = 2 * alpha * beta / area;
+    const auto spatial = xv.spatial();
+
+    par_for_nc(xv.n, xv.c, [&](std::size_t ni, std::size_t ci) {
+        std::vector<double> ratios(spatial);
+        std::vector<double> sum(spatial, 0.0);
+        auto load_ratios = [&](std::size_t cj) {
+            const auto y_base  = yv.offset(ni, cj);
+            const auto dy_base = dyv.offset(ni, cj);
+            for(std::size_t s = 0; s < spatial; s++)
+            {
+                const auto dyi = dy_base + dyv.spatial_offset(s);
+                ratios[s]      = static_cast<double>(y[y_base + yv.spatial_offset(s)]) *
+                            static_cast<double>(dy[dyi]) / static_cast<double>(scale[dyi]);
+            }
+        };
+
+        if(across)
+        {
+            const auto lo = std::max<int>(static_cast<int>(ci) - win.after, 0);
+            const auto hi = std::min<int>(static_cast<int>(ci) + win.before + 1, xv.c);
+            for(int cj = lo; cj < hi; cj++)
+            {
+                load_ratios(cj);
+                for(std::size_t s = 0; s < spatial; s++)
+                    sum[s] += ratios[s];
+            }
+        }
+        else
+        {
+            load_ratios(ci);
+            const auto plane = xv.h * xv.w;
+            std::vector<double> src(plane);
+            std::vector<double> dst(plane);
+            for(std::size_t di = 0; di < xv.d; di++)
+            {
+                std::copy_n(ratios.begin() + di * plane, plane, src.begin());
+                lrn_box_sum(src, dst, xv.h, xv.w, win.after, win.before);
+                std::copy_n(dst.begin(), plane, sum.begin() + di * plane);
+            }
+        }
+
+        const auto x_base  = xv.offset(ni, ci);
+        const auto dy_base = dyv.offset(ni, ci);
+        const auto dx_base = dxv.offset(ni, ci);
+        for(std::size_t s = 0; s < spatial; s++)
+        {
+            const auto dyi = dy_base + dyv.spatial_offset(s);
+            const auto sc  = static_cast<double>(scale[dyi]);
+            const auto xs  = static_cast<double>(x[x_base + xv.spatial_offset(s)]);
+            dx[dx_base + dxv.spatial_offset(s)] = static_cast<Tdx>(
+                std::pow(sc, -beta) * static_cast<double>(dy[dyi]) - ratio * xs * sum[s]);
+        }
+    });
+}
+
+#endif
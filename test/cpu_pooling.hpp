@@ -0,0 +1,194 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_POOLING_HPP
+#define GUARD_CPU_POOLING_HPP
+
+#include "cpu_reference.hpp"
+
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+/// Pooling window over D, H and W. Windows of 2D pooling have depth 1.
+struct cpu_pooling_params
+{
+    miopenPoolingMode_t mode;
+    std::array<int, 3> lens{{1, 1, 1}};
+    std::array<int, 3> strides{{1, 1, 1}};
+    std::array<int, 3> pads{{0, 0, 0}};
+
+    /// lens, strides and pads of the spatial dimensions, as in the pooling descriptor.
+    cpu_pooling_params(miopenPoolingMode_t m,
+                       const std::vector<int>& plens,
+                       const std::vector<int>& pstrides,
+                       const std::vector<int>& ppads)
+        : mode(m)
+    {
+        const auto first = 3 - plens.size();
+        std::copy(plens.begin(), plens.end(), lens.begin() + first);
+        std::copy(pstrides.begin(), pstrides.end(), strides.begin() + first);
+        std::copy(ppads.begin(), ppads.end(), pads.begin() + first);
+    }
+
+    /// Part of the window of output position o along dimension i that lies inside the input.
+    void clip(int i, int o, int len, int& begin, int& end) const
+    {
+        begin = o * strides[i] - pads[i];
+        end   = std::min(begin + lens[i], len);
+        begin = std::max(begin, 0);
+    }
+
+    int pool_size(const std::array<int, 3>& begin, const std::array<int, 3>& end) const
+    {
+        if(mode == miopenPoolingAverageInclusive)
+            return lens[0] * lens[1] * lens[2];
+        int size = 1;
+        for(int i = 0; i < 3; i++)
+            size *= std::max(end[i] - begin[i], 1);
+        return size;
+    }
+};
+
+/// Value of argmax for outputs whose window does not overlap the input.
+constexpr std::size_t cpu_pooling_no_index = std::numeric_limits<std::size_t>::max();
+
+/// Max or average over the windows. For max pooling argmax, when given, receives the position of
+/// the maximum in its input plane, d * H * W + h * W + w, at the offset of the output in y.
+/// Max pooling windows that lie in the padding give the lowest value of Ty, as on the GPU.
+template <class Tx, class Ty>
+void cpu_pooling_forward(const cpu_pooling_params& p,
+                         const nc_view& xv,
+                         const Tx* x,
+                         const nc_view& yv,
+                         Ty* y,
+                         std::size_t* argmax = nullptr)
+{
+    const std::array<int, 3> in_lens{
+        {static_cast<int>(xv.d), static_cast<int>(xv.h), static_cast<int>(xv.w)}};
+    const bool max_mode = p.mode == miopenPoolingMax;
+    const auto lowest   = static_cast<double>(std::numeric_limits<Ty>::lowest());
+
+    par_for_nc(yv.n, yv.c, [&](std::size_t ni, std::size_t ci) {
+        const auto x_base = xv.offset(ni, ci);
+        for(std::size_t od = 0; od < yv.d; od++)
+        {
+            for(std::size_t oh = 0; oh < yv.h; oh++)
+            {
+                for(std::size_t ow = 0; ow < yv.w; ow++)
+                {
+                    std::array<int, 3> begin{};
+                    std::array<int, 3> end{};
+                    const std::array<std::size_t, 3> out_pos{{od, oh, ow}};
+                    for(int i = 0; i < 3; i++)
+                        p.clip(i, out_pos[i], in_lens[i], begin[i], end[i]);
+
+                    double acc        = max_mode ? lowest : 0.0;
+                    std::size_t index = cpu_pooling_no_index;
+                    for(int d = begin[0]; d < end[0]; d++)
+                    {
+                        for(int h = begin[1]; h < end[1]; h++)
+                        {
+                            const auto row = x_base + d * xv.d_stride + h * xv.h_stride;
+                            for(int w = begin[2]; w < end[2]; w++)
+                            {
+                                const auto v = static_cast<double>(x[row + w * xv.w_stride]);
+                                if(!max_mode)
+                                    acc += v;
+                                else if(v > acc)
+                                {
+                                    acc   = v;
+                                    index = (d * xv.h + h) * xv.w + w;
+                                }
+                            }
+                        }
+                    }
+
+                    const auto yi = yv.index(ni, ci, od, oh, ow);
+                    y[yi] = static_cast<Ty>(max_mode ? acc : acc / p.pool_size(begin, end));
+                    if(max_mode && argmax != nullptr)
+                        argmax[yi] = index;
+                }
+            }
+        }
+    });
+}
+
+/// Gradient of cpu_pooling_forward. For max pooling argmax holds the input position of every
+/// output, at the offset of the output in dy, as written by cpu_pooling_forward.
+template <class Tdy, class Tdx>
+void cpu_pooling_backward(const cpu_pooling_params& p,
+                          const nc_view& dyv,
+                          const Tdy* dy,
+                          const nc_view& dxv,
+                          Tdx* dx,
+                          const std::size_t* argmax = nullptr)
+{
+    const std::array<int, 3> in_lens{
+        {static_cast<int>(dxv.d), static_cast<int>(dxv.h), static_cast<int>(dxv.w)}};
+    const bool max_mode = p.mode == miopenPoolingMax;
+
+    par_for_nc(dxv.n, dxv.c, [&](std::size_t ni, std::size_t ci) {
+        std::vector<double> grad(dxv.spatial(), 0.0);
+        for(std::size_t od = 0; od < dyv.d; od++)
+        {
+            for(std::size_t oh = 0; oh < dyv.h; oh++)
+            {
+                for(std::size_t ow = 0; ow < dyv.w; ow++)
+                {
+                    const auto dyi = dyv.index(ni, ci, od, oh, ow);
+                    const auto g   = static_cast<double>(dy[dyi]);
+                    if(max_mode)
+                    {
+                        if(argmax[dyi] != cpu_pooling_no_index)
+                            grad[argmax[dyi]] += g;
+                        continue;
+                    }
+
+                    std::array<int, 3> begin{};
+                    std::array<int, 3> end{};
+                    const std::array<std::size_t, 3> out_pos{{od, oh, ow}};
+                    for(int i = 0; i < 3; i++)
+                        p.clip(i, out_pos[i], in_lens[i], begin[i], end[i]);
+                    const auto share = g / p.pool_size(begin, end);
+                    for(int d = begin[0]; d < end[0]; d++)
+                        for(int h = begin[1]; h < end[1]; h++)
+                            for(int w = begin[2]; w < end[2]; w++)
+                                grad[(d * dxv.h + h) * dxv.w + w] += share;
+                }
+            }
+        }
+
+        const auto dx_base = dxv.offset(ni, ci);
+        for(std::size_t s = 0; s < grad.size(); s++)
+            dx[dx_base + dxv.spatial_offset(s)] = static_cast<Tdx>(grad[s]);
+    });
+}
+
+#endif
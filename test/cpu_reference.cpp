@@ -0,0 +1,503 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include "../driver/ctc_gpu_emulator.hpp"
+#include "cpu_activation.hpp"
+#include "cpu_batchnorm.hpp"
+#include "cpu_ctc.hpp"
+#include "cpu_pooling.hpp"
+#include "cpu_softmax.hpp"
+
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+static bool near(double x, double y, double tolerance = 1e-6)
+{
+    return std::abs(x - y) <= tolerance * std::max(1.0, std::abs(y));
+}
+
+static void PairwiseSum()
+{
+    EXPECT_EQUAL(pairwise_sum(0, [](std::size_t) { return 1.0; }), 0.0);
+    EXPECT_EQUAL(pairwise_sum(1000, [](std::size_t i) { return double(i); }), 499500.0);
+    EXPECT_EQUAL(pairwise_sum(10, [](std::size_t i) { return double(i); }, 5), 95.0);
+
+    // Adding a million tenths one by one drifts by about 1e-6, pairwise stays within 1e-9.
+    const auto tenths = pairwise_sum(1000000, [](std::size_t) { return 0.1; });
+    EXPECT(std::abs(tenths - 100000.0) < 1e-9);
+}
+
+static void Views()
+{
+    const nc_view packed(2, 3, 1, 4, 5);
+    EXPECT_EQUAL(packed.spatial(), 20);
+    EXPECT(packed.packed_spatial());
+    EXPECT_EQUAL(packed.index(1, 2, 0, 3, 4), 119);
+
+    // NHWC: the channels are the innermost dimension.
+    const miopen::TensorDescriptor nhwc{miopenFloat, {2, 3, 4, 5}, {60, 1, 15, 3}};
+    const nc_view view(nhwc);
+    EXPECT_EQUAL(view.d, 1);
+    EXPECT_EQUAL(view.w_stride, 3);
+    EXPECT(!view.packed_spatial());
+    EXPECT_EQUAL(view.index(1, 2, 0, 3, 4), nhwc.GetIndex({1, 2, 3, 4}));
+    EXPECT(view.same_lengths(packed));
+
+    const nc_view flat(miopen::TensorDescriptor{miopenFloat, {6, 7}});
+    EXPECT_EQUAL(flat.c, 7);
+    EXPECT_EQUAL(flat.spatial(), 1);
+}
+
+static void Activation()
+{
+    // The same values in NCHW and NHWC give the same results at the same positions.
+    const miopen::TensorDescriptor nchw{miopenFloat, {2, 3, 4, 5}};
+    const miopen::TensorDescriptor nhwc{miopenFloat, {2, 3, 4, 5}, {60, 1, 15, 3}};
+    std::vector<float> x(120);
+    std::vector<float> x_nhwc(120);
+    for(std::size_t i = 0; i < x.size(); i++)
+        x[i] = float(i % 17) - 8.0f;
+    const nc_view a(nchw);
+    const nc_view b(nhwc);
+    for(std::size_t ni = 0; ni < 2; ni++)
+        for(std::size_t ci = 0; ci < 3; ci++)
+            for(std::size_t s = 0; s < 20; s++)
+                x_nhwc[b.offset(ni, ci) + b.spatial_offset(s)] =
+                    x[a.offset(ni, ci) + a.spatial_offset(s)];
+
+    std::vector<float> y(120);
+    std::vector<float> y_nhwc(120);
+    cpu_activation_forward(miopenActivationLEAKYRELU, 0.5, 0, 0, a, x.data(), a, y.data());
+    cpu_activation_forward(
+        miopenActivationLEAKYRELU, 0.5, 0, 0, b, x_nhwc.data(), b, y_nhwc.data());
+    for(std::size_t i = 0; i < x.size(); i++)
+        EXPECT_EQUAL(y[i], x[i] > 0 ? x[i] : 0.5f * x[i]);
+    EXPECT_EQUAL(y_nhwc[b.index(1, 2, 0, 3, 4)], y[a.index(1, 2, 0, 3, 4)]);
+
+    // The backward pass of RELU passes the gradient where the input is positive.
+    std::vector<float> dy(120, 2.0f);
+    std::vector<float> dx(120);
+    cpu_activation_forward(miopenActivationRELU, 0, 0, 0, a, x.data(), a, y.data());
+    cpu_activation_backward(
+        miopenActivationRELU, 0, 0, 0, a, y.data(), a, dy.data(), a, x.data(), a, dx.data());
+    for(std::size_t i = 0; i < x.size(); i++)
+        EXPECT_EQUAL(dx[i], x[i] > 0 ? 2.0f : 0.0f);
+}
+
+static void Softmax()
+{
+    const nc_view v(2, 4, 1, 2, 3);
+    std::vector<float> x(v.n * v.n_stride);
+    std::iota(x.begin(), x.end(), -20.0f);
+    std::vector<float> y(x.size());
+    cpu_softmax_forward(
+        MIOPEN_SOFTMAX_ACCURATE, MIOPEN_SOFTMAX_MODE_CHANNEL, 1, 0, v, x.data(), v, y.data());
+
+    for(std::size_t ni = 0; ni < v.n; ni++)
+    {
+        for(std::size_t s = 0; s < v.spatial(); s++)
+        {
+            double sum = 0;
+            for(std::size_t ci = 0; ci < v.c; ci++)
+                sum += y[v.offset(ni, ci) + s];
+            EXPECT(near(sum, 1.0));
+        }
+    }
+    // The channels are 6 apart, so their ratio is exp(6).
+    EXPECT(near(y[v.index(0, 3, 0, 0, 0)] / y[v.index(0, 2, 0, 0, 0)], std::exp(6.0)));
+
+    // The gradient of the sum of the outputs is zero.
+    std::vector<float> dy(x.size(), 1.0f);
+    std::vector<float> dx(x.size(), 5.0f);
+    cpu_softmax_backward(MIOPEN_SOFTMAX_ACCURATE,
+                         MIOPEN_SOFTMAX_MODE_CHANNEL,
+                         1,
+                         0,
+                         v,
+                         y.data(),
+                         v,
+                         dy.data(),
+                         v,
+                         dx.data());
+    for(auto g : dx)
+        EXPECT(std::abs(g) < 1e-6);
+}
+
+static void Pooling()
+{
+    // 4 x 4 plane with 2 x 2 windows at stride 2 and padding 1.
+    const cpu_pooling_params max_params{miopenPoolingMax, {2, 2}, {2, 2}, {1, 1}};
+    const nc_view xv(1, 1, 1, 4, 4);
+    const nc_view yv(1, 1, 1, 3, 3);
+    std::vector<float> x(16);
+    std::iota(x.begin(), x.end(), 0.0f);
+    std::vector<float> y(9);
+    std::vector<std::size_t> argmax(9);
+    cpu_pooling_forward(max_params, xv, x.data(), yv, y.data(), argmax.data());
+    EXPECT(y == std::vector<float>({0, 2, 3, 8, 10, 11, 12, 14, 15}));
+    EXPECT_EQUAL(argmax[4], 10);
+
+    std::vector<float> dy(9, 1.0f);
+    std::vector<float> dx(16, -1.0f);
+    cpu_pooling_backward(max_params, yv, dy.data(), xv, dx.data(), argmax.data());
+    EXPECT_EQUAL(std::accumulate(dx.begin(), dx.end(), 0.0f), 9.0f);
+    EXPECT_EQUAL(dx[10], 1.0f);
+    EXPECT_EQUAL(dx[5], 0.0f);
+
+    // Average pooling divides by the part of the window inside the input, the inclusive mode
+    // by the whole window.
+    const cpu_pooling_params avg_params{miopenPoolingAverage, {2, 2}, {2, 2}, {1, 1}};
+    const cpu_pooling_params inclusive_params{
+        miopenPoolingAverageInclusive, {2, 2}, {2, 2}, {1, 1}};
+    cpu_pooling_forward(avg_params, xv, x.data(), yv, y.data());
+    EXPECT_EQUAL(y[0], 0.0f);
+    EXPECT_EQUAL(y[1], 1.5f);
+    EXPECT_EQUAL(y[4], 7.5f);
+    cpu_pooling_forward(inclusive_params, xv, x.data(), yv, y.data());
+    EXPECT_EQUAL(y[1], 0.75f);
+
+    cpu_pooling_backward(avg_params, yv, dy.data(), xv, dx.data());
+    EXPECT(near(std::accumulate(dx.begin(), dx.end(), 0.0), 9.0));
+    EXPECT_EQUAL(dx[0], 1.0f);
+    EXPECT_EQUAL(dx[5], 0.25f);
+}
+
+static void BatchNorm(miopenBatchNormMode_t mode)
+{
+    const nc_view v(4, 2, 1, 3, 3);
+    const auto params = cpu_bn_params(mode, v);
+    std::vector<float> x(v.n * v.n_stride);
+    for(std::size_t i = 0; i < x.size(); i++)
+        x[i] = float((i * 7) % 11) + 0.5f * float(i % 3);
+    std::vector<float> y(x.size());
+    std::vector<float> scale(params, 1.0f);
+    std::vector<float> bias(params, 0.0f);
+    std::vector<float> mean(params);
+    std::vector<float> inv_var(params);
+    std::vector<float> running_mean(params, 0.0f);
+    std::vector<float> running_var(params, 1.0f);
+    cpu_bn_fwd_train(mode,
+                     0.0,
+                     1.0,
+                     v,
+                     x.data(),
+                     v,
+                     y.data(),
+                     scale.data(),
+                     bias.data(),
+                     mean.data(),
+                     inv_var.data(),
+                     running_mean.data(),
+                     running_var.data());
+
+    // Every parameter normalizes its elements to zero mean and unit variance.
+    const auto count = cpu_bn_count(mode, v);
+    const auto sum   = cpu_bn_sums(mode, [&](std::size_t, std::size_t i) { return y[i]; }, v);
+    const auto sum2 =
+        cpu_bn_sums(mode, [&](std::size_t, std::size_t i) { return double(y[i]) * y[i]; }, v);
+    for(std::size_t p = 0; p < params; p++)
+    {
+        EXPECT(std::abs(sum[p]) < 1e-4);
+        EXPECT(near(sum2[p] / count, 1.0, 1e-4));
+        EXPECT_EQUAL(running_mean[p], mean[p]);
+        // The running variance is unbiased.
+        const auto variance = 1.0 / (double(inv_var[p]) * inv_var[p]);
+        EXPECT(near(running_var[p], variance * count / (count - 1), 1e-4));
+    }
+
+    // The inference pass with the batch statistics gives the same result.
+    std::vector<float> y_infer(x.size());
+    cpu_bn_fwd_infer(mode,
+                     0.0,
+                     v,
+                     x.data(),
+                     v,
+                     y_infer.data(),
+                     scale.data(),
+                     bias.data(),
+                     static_cast<const float*>(nullptr),
+                     static_cast<const float*>(nullptr));
+    for(std::size_t i = 0; i < x.size(); i++)
+        EXPECT(near(y_infer[i], y[i], 1e-5));
+
+    // dy = y is the gradient of sum(y^2) / 2, which does not depend on x after normalization.
+    std::vector<float> dx(x.size());
+    std::vector<float> dscale(params);
+    std::vector<float> dbias(params);
+    cpu_bn_bwd(mode,
+               0.0,
+               v,
+               x.data(),
+               v,
+               y.data(),
+               v,
+               dx.data(),
+               scale.data(),
+               dscale.data(),
+               dbias.data(),
+               mean.data(),
+               inv_var.data());
+    for(std::size_t p = 0; p < params; p++)
+    {
+        EXPECT(std::abs(dbias[p]) < 1e-4);
+        EXPECT(near(dscale[p], count, 1e-4));
+    }
+    for(auto g : dx)
+        EXPECT(std::abs(g) < 1e-4);
+}
+
+static void Ctc()
+{
+    // Two time steps of log probabilities for one label: the paths are 11, 01 and 10.
+    const std::vector<double> log_probs = {
+        std::log(0.4), std::log(0.6), std::log(0.3), std::log(0.7)};
+    const ctc_strides strides{2, 2, 1};
+    const int label        = 1;
+    const int label_length = 1;
+    const int input_length = 2;
+    double loss            = 0;
+    std::vector<double> grad(4);
+    cpu_ctc_loss(2,
+                 1,
+                 2,
+                 strides,
+                 log_probs.data(),
+                 &label,
+                 &label_length,
+                 &input_length,
+                 &loss,
+                 strides,
+                 grad.data(),
+                 0,
+                 false);
+    EXPECT(near(loss, -std::log(0.6 * 0.7 + 0.4 * 0.7 + 0.6 * 0.3)));
+
+    // Sequences without time steps, with and without a label, have no alignment.
+    {
+        const std::vector<int> empty_labels        = {1};
+        const std::vector<int> empty_label_lengths = {0, 1};
+        const std::vector<int> empty_lengths       = {0, 0};
+        const ctc_strides empty_layout{4, 2, 1};
+        const std::vector<double> empty_probs(8, 0.0);
+        std::vector<double> losses(2);
+        std::vector<double> grads(8, 1.0);
+        cpu_ctc_loss(2,
+                     2,
+                     2,
+                     empty_layout,
+                     empty_probs.data(),
+                     empty_labels.data(),
+                     empty_label_lengths.data(),
+                     empty_lengths.data(),
+                     losses.data(),
+                     empty_layout,
+                     grads.data(),
+                     0,
+                     true);
+        for(auto l : losses)
+            EXPECT_EQUAL(l, -cpu_ctc_cutoff);
+        for(auto g : grads)
+            EXPECT_EQUAL(g, 0.0);
+    }
+
+    // With the softmax applied the gradient is the derivative of the loss by the logits. Two
+    // sequences share the batch, the second one has a repeated label and a blank of 3.
+    const std::size_t max_time = 7;
+    const std::size_t batch    = 2;
+    const std::size_t classes  = 4;
+    const ctc_strides layout{batch * classes, classes, 1};
+    std::vector<double> logits(max_time * batch * classes);
+    for(std::size_t i = 0; i < logits.size(); i++)
+        logits[i] = std::sin(0.7 * i) * 2;
+    const std::vector<int> labels        = {1, 2, 2, 1, 1};
+    const std::vector<int> label_lengths = {2, 3};
+    const std::vector<int> input_lengths = {5, 7};
+    auto losses_of                       = [&](const std::vector<double>& x, int blank) {
+        std::vector<double> losses(batch);
+        std::vector<double> unused(x.size());
+        cpu_ctc_loss(max_time,
+                     batch,
+                     classes,
+                     layout,
+                     x.data(),
+                     labels.data(),
+                     label_lengths.data(),
+                     input_lengths.data(),
+                     losses.data(),
+                     layout,
+                     unused.data(),
+                     blank,
+                     true);
+        return losses;
+    };
+
+    for(int blank : {0, 3})
+    {
+        std::vector<double> losses(batch);
+        std::vector<double> grads(logits.size(), 1.0);
+        cpu_ctc_loss(max_time,
+                     batch,
+                     classes,
+                     layout,
+                     logits.data(),
+                     labels.data(),
+                     label_lengths.data(),
+                     input_lengths.data(),
+                     losses.data(),
+                     layout,
+                     grads.data(),
+                     blank,
+                     true);
+        for(std::size_t i = 0; i < logits.size(); i++)
+        {
+            const auto b = i / classes % batch;
+            auto x       = logits;
+            x[i] += 1e-5;
+            const auto up = losses_of(x, blank)[b];
+            x[i] -= 2e-5;
+            const auto down = losses_of(x, blank)[b];
+            EXPECT(std::abs((up - down) / 2e-5 - grads[i]) < 1e-5);
+        }
+    }
+}
+
+// The host engine agrees with the emulator of the CTC kernels the driver verified against.
+static void CtcEmulator()
+{
+    std::mt19937 gen{47};
+    auto uniform = [&](int lo, int hi) { return std::uniform_int_distribution<int>{lo, hi}(gen); };
+
+    for(int problem = 0; problem < 40; problem++)
+    {
+        const bool apply_softmax = problem % 2 == 0;
+        const int batch          = uniform(1, 4);
+        const int classes        = uniform(3, 8);
+        const int blank          = uniform(0, classes - 1);
+
+        std::vector<int> labels;
+        std::vector<int> label_lengths(batch);
+        std::vector<int> input_lengths(batch);
+        for(int b = 0; b < batch; b++)
+        {
+            label_lengths[b] = uniform(1, 5);
+            int repeat       = 0;
+            for(int i = 0; i < label_lengths[b]; i++)
+            {
+                // Every other problem repeats labels often.
+                auto label = uniform(0, classes - 2);
+                if(label >= blank)
+                    label++;
+                if(i > 0 && problem % 4 < 2 && uniform(0, 1) == 0)
+                    label = labels.back();
+                if(i > 0 && label == labels.back())
+                    repeat++;
+                labels.push_back(label);
+            }
+            // The first sequence has no spare time steps.
+            const auto tight = label_lengths[b] + repeat;
+            input_lengths[b] = b == 0 ? tight : uniform(tight, tight + 6);
+        }
+        const auto max_time = *std::max_element(input_lengths.begin(), input_lengths.end());
+
+        std::normal_distribution<double> dist{0, 2};
+        std::vector<double> probs(std::size_t(max_time) * batch * classes);
+        for(auto& x : probs)
+            x = dist(gen);
+        if(!apply_softmax)
+        {
+            // Log probabilities: the log softmax of every time step.
+            for(std::size_t row = 0; row < probs.size(); row += classes)
+            {
+                double sum = 0;
+                for(int k = 0; k < classes; k++)
+                    sum += std::exp(probs[row + k]);
+                for(int k = 0; k < classes; k++)
+                    probs[row + k] -= std::log(sum);
+            }
+        }
+
+        const ctc_strides strides{std::size_t(batch * classes), std::size_t(classes), 1};
+        std::vector<double> losses(batch);
+        std::vector<double> grads(probs.size());
+        cpu_ctc_loss(max_time,
+                     batch,
+                     classes,
+                     strides,
+                     probs.data(),
+                     labels.data(),
+                     label_lengths.data(),
+                     input_lengths.data(),
+                     losses.data(),
+                     strides,
+                     grads.data(),
+                     blank,
+                     apply_softmax);
+
+        std::vector<int> desc = {max_time, batch, classes, batch * classes, classes, 1};
+        auto grads_desc       = desc;
+        const auto max_label  = *std::max_element(label_lengths.begin(), label_lengths.end());
+        const auto s_len      = 2 * max_label + 1;
+        std::vector<double> emulated_losses(batch);
+        std::vector<double> emulated_grads(probs.size());
+        std::vector<double> workspace(4 * batch + labels.size() + batch * s_len +
+                                      probs.size() + max_time * batch * s_len);
+        std::vector<double> beta_losses(batch);
+        RunCTCLossGPUEmulator(desc,
+                              probs,
+                              labels.data(),
+                              label_lengths.data(),
+                              input_lengths.data(),
+                              emulated_losses,
+                              grads_desc,
+                              emulated_grads,
+                              workspace,
+                              beta_losses,
+                              blank,
+                              apply_softmax);
+
+        for(int b = 0; b < batch; b++)
+            EXPECT(near(losses[b], emulated_losses[b]));
+        // The emulator keeps the log likelihood in a float for the gradient.
+        for(std::size_t i = 0; i < grads.size(); i++)
+            EXPECT(near(grads[i], emulated_grads[i], 1e-5));
+    }
+}
+
+int main()
+{
+    PairwiseSum();
+    Views();
+    Activation();
+    Softmax();
+    Pooling();
+    BatchNorm(miopenBNSpatial);
+    BatchNorm(miopenBNPerActivation);
+    Ctc();
+    CtcEmulator();
+}
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_REFERENCE_HPP
+#define GUARD_CPU_REFERENCE_HPP
+
+#include <miopen/errors.hpp>
+#include <miopen/par_for.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+
+// Host references shared by the tests and the driver. They work on raw buffers described by
+// nc_view, so they can be called with tensor<T>::data as well as with the driver's host vectors.
+// All of them accumulate in double and run N x C planes on the host threads.
+
+/// N x C x D x H x W view of a host buffer. 4D tensors have depth 1, 2D tensors are N x C.
+struct nc_view
+{
+    std::size_t n        = 1;
+    std::size_t c        = 1;
+    std::size_t d        = 1;
+    std::size_t h        = 1;
+    std::size_t w        = 1;
+    std::size_t n_stride = 0;
+    std::size_t c_stride = 0;
+    std::size_t d_stride = 0;
+    std::size_t h_stride = 0;
+    std::size_t w_stride = 1;
+
+    nc_view() = default;
+
+    /// Packed NCDHW buffer.
+    nc_view(std::size_t pn, std::size_t pc, std::size_t pd, std::size_t ph, std::size_t pw)
+        : n(pn), c(pc), d(pd), h(ph), w(pw)
+    {
+        h_stride = w;
+        d_stride = h * w;
+        c_stride = d * h * w;
+        n_stride = c * c_stride;
+    }
+
+    explicit nc_view(const miopen::TensorDescriptor& desc)
+    {
+        const auto& lens    = desc.GetLengths();
+        const auto& strides = desc.GetStrides();
+        if(lens.size() < 2 || lens.size() > 5)
+            MIOPEN_THROW("Host references support 2D to 5D tensors");
+        n        = lens[0];
+        c        = lens[1];
+        n_stride = strides[0];
+        c_stride = strides[1];
+        // Missing spatial dimensions are leading ones of length 1.
+        std::size_t* spatial_lens[]    = {&d, &h, &w};
+        std::size_t* spatial_strides[] = {&d_stride, &h_stride, &w_stride};
+        const auto first               = 3 - (lens.size() - 2);
+        for(std::size_t i = 2; i < lens.size(); i++)
+        {
+            *spatial_lens[first + i - 2]    = lens[i];
+            *spatial_strides[first + i - 2] = strides[i];
+        }
+    }
+
+    std::size_t spatial() const { return d * h * w; }
+
+    /// Spatial elements are contiguous, loops over them have stride one.
+    bool packed_spatial() const
+    {
+        return (w == 1 || w_stride == 1) && (h == 1 || h_stride == w) &&
+               (d == 1 || d_stride == h * w);
+    }
+
+    std::size_t offset(std::size_t ni, std::size_t ci) const
+    {
+        return ni * n_stride + ci * c_stride;
+    }
+
+    std::size_t
+    index(std::size_t ni, std::size_t ci, std::size_t di, std::size_t hi, std::size_t wi) const
+    {
+        return offset(ni, ci) + di * d_stride + hi * h_stride + wi * w_stride;
+    }
+
+    /// Offset of spatial element s, where s enumerates D x H x W in row major order.
+    std::size_t spatial_offset(std::size_t s) const
+    {
+        if(packed_spatial())
+            return s;
+        return s / (h * w) * d_stride + s / w % h * h_stride + s % w * w_stride;
+    }
+
+    bool same_lengths(const nc_view& v) const
+    {
+        return n == v.n && c == v.c && d == v.d && h == v.h && w == v.w;
+    }
+};
+
+inline bool all_packed_spatial(std::initializer_list<bool> packed)
+{
+    return std::all_of(packed.begin(), packed.end(), [](bool p) { return p; });
+}
+
+/// Calls f(offset...) for every spatial element of plane (ni, ci), one offset per view. The views
+/// must have the same spatial lengths. Packed views get a stride one loop, which vectorizes.
+template <class F, class... Views>
+void for_each_spatial(std::size_t ni, std::size_t ci, F f, const nc_view& v, const Views&... vs)
+{
+    const auto count = v.spatial();
+    if(all_packed_spatial({v.packed_spatial(), vs.packed_spatial()...}))
+    {
+        const auto base = v.offset(ni, ci);
+        for(std::size_t s = 0; s < count; s++)
+            f(base + s, (vs.offset(ni, ci) + s)...);
+    }
+    else
+    {
+        for(std::size_t s = 0; s < count; s++)
+            f(v.offset(ni, ci) + v.spatial_offset(s),
+              (vs.offset(ni, ci) + vs.spatial_offset(s))...);
+    }
+}
+
+/// Sum of f(i) for i in [0, n). The halves are summed separately down to short blocks, so the
+/// rounding error grows with log(n) rather than n.
+template <class F>
+double pairwise_sum(std::size_t n, F f, std::size_t first = 0)
+{
+    constexpr std::size_t block = 64;
+    if(n <= block)
+    {
+        double acc = 0;
+        for(std::size_t i = first; i < first + n; i++)
+            acc += f(i);
+        return acc;
+    }
+    const auto half = n / 2;
+    return pairwise_sum(half, f, first) + pairwise_sum(n - half, f, first + half);
+}
+
+/// Pairwise sum of f(offset...) over the spatial elements of plane (ni, ci).
+template <class F, class... Views>
+double spatial_sum(std::size_t ni, std::size_t ci, F f, const nc_view& v, const Views&... vs)
+{
+    if(all_packed_spatial({v.packed_spatial(), vs.packed_spatial()...}))
+    {
+        const auto base = v.offset(ni, ci);
+        return pairwise_sum(v.spatial(),
+                            [&](std::size_t s) { return f(base + s, (vs.offset(ni, ci) + s)...); });
+    }
+    return pairwise_sum(v.spatial(), [&](std::size_t s) {
+        return f(v.offset(ni, ci) + v.spatial_offset(s),
+                 (vs.offset(ni, ci) + vs.spatial_offset(s))...);
+    });
+}
+
+/// Runs f(ni, ci) for all planes of an n x c tensor on the host threads.
+template <class F>
+void par_for_nc(std::size_t n, std::size_t c, F f)
+{
+    miopen::par_for(n * c, 1, [&](std::size_t i) { f(i / c, i % c); });
+}
+
+#endif
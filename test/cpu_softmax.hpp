@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_SOFTMAX_HPP
+#define GUARD_CPU_SOFTMAX_HPP
+
+#include "cpu_reference.hpp"
+
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Softmax reduces over C x H x W per image in instance mode and over C per pixel in channel
+// mode. Both are computed for a group of pixels of one image at a time, with the loops over the
+// channels outside and the loops over the pixels of the group inside.
+struct softmax_groups
+{
+    std::size_t size;  // pixels per group
+    std::size_t count; // groups per image
+
+    softmax_groups(const nc_view& v, miopenSoftmaxMode_t mode)
+    {
+        constexpr std::size_t tile = 256;
+        size  = mode == MIOPEN_SOFTMAX_MODE_INSTANCE ? v.spatial() : std::min(v.spatial(), tile);
+        count = (v.spatial() + size - 1) / size;
+    }
+};
+
+/// y = alpha * softmax(x) + beta * y. The exponents are shifted by the maximum for all
+/// algorithms, which gives the exact result of the fast one as long as it does not overflow.
+template <class Tx, class Ty>
+void cpu_softmax_forward(miopenSoftmaxAlgorithm_t algo,
+                         miopenSoftmaxMode_t mode,
+                         double alpha,
+                         double beta,
+                         const nc_view& xv,
+                         const Tx* x,
+                         const nc_view& yv,
+                         Ty* y)
+{
+    const softmax_groups groups{xv, mode};
+
+    miopen::par_for(xv.n * groups.count, 1, [&](std::size_t i) {
+        const auto ni    = i / groups.count;
+        const auto first = i % groups.count * groups.size;
+        const auto size  = std::min(groups.size, xv.spatial() - first);
+
+        std::vector<double> shifted(xv.c * size);
+        std::vector<double> max_val(size, std::numeric_limits<double>::lowest());
+        for(std::size_t ci = 0; ci < xv.c; ci++)
+        {
+            const auto base = xv.offset(ni, ci);
+            for(std::size_t s = 0; s < size; s++)
+            {
+                const auto v = static_cast<double>(x[base + xv.spatial_offset(first + s)]);
+                shifted[ci * size + s] = v;
+                max_val[s]             = std::max(max_val[s], v);
+            }
+        }
+        if(mode == MIOPEN_SOFTMAX_MODE_INSTANCE)
+            std::fill(
+                max_val.begin(), max_val.end(), *std::max_element(max_val.begin(), max_val.end()));
+
+        // sum[s] = sum over the channels of exp(x - max)
+        std::vector<double> exps(xv.c * size);
+        std::vector<double> sum(size, 0.0);
+        for(std::size_t ci = 0; ci < xv.c; ci++)
+        {
+            for(std::size_t s = 0; s < size; s++)
+            {
+                shifted[ci * size + s] -= max_val[s];
+                exps[ci * size + s] = std::exp(shifted[ci * size + s]);
+                sum[s] += exps[ci * size + s];
+            }
+        }
+        if(mode == MIOPEN_SOFTMAX_MODE_INSTANCE)
+        {
+            const auto total = pairwise_sum(size, [&](std::size_t s) { return sum[s]; });
+            std::fill(sum.begin(), sum.end(), total);
+        }
+
+        for(std::size_t ci = 0; ci < yv.c; ci++)
+        {
+            const auto base = yv.offset(ni, ci);
+            for(std::size_t s = 0; s < size; s++)
+            {
+                const auto res = algo == MIOPEN_SOFTMAX_LOG
+                                     ? shifted[ci * size + s] - std::log(sum[s])
+                                     : exps[ci * size + s] / sum[s];
+                auto& out = y[base + yv.spatial_offset(first + s)];
+                out       = static_cast<Ty>(alpha * res + beta * static_cast<double>(out));
+            }
+        }
+    });
+}
+
+/// dx = alpha * dsoftmax(y, dy) + beta * dx, where y is the output of the forward pass.
+template <class Ty, class Tdy, class Tdx>
+void cpu_softmax_backward(miopenSoftmaxAlgorithm_t algo,
+                          miopenSoftmaxMode_t mode,
+                          double alpha,
+                          double beta,
+                          const nc_view& yv,
+                          const Ty* y,
+                          const nc_view& dyv,
+                          const Tdy* dy,
+                          const nc_view& dxv,
+                          Tdx* dx)
+{
+    const softmax_groups groups{yv, mode};
+    const bool log = algo == MIOPEN_SOFTMAX_LOG;
+
+    miopen::par_for(yv.n * groups.count, 1, [&](std::size_t i) {
+        const auto ni    = i / groups.count;
+        const auto first = i % groups.count * groups.size;
+        const auto size  = std::min(groups.size, yv.spatial() - first);
+
+        auto y_at = [&](std::size_t ci, std::size_t s) {
+            return static_cast<double>(y[yv.offset(ni, ci) + yv.spatial_offset(first + s)]);
+        };
+        auto dy_at = [&](std::size_t ci, std::size_t s) {
+            return static_cast<double>(dy[dyv.offset(ni, ci) + dyv.spatial_offset(first + s)]);
+        };
+
+        // dot[s] = sum over the channels of dy for log softmax and of y * dy otherwise
+        std::vector<double> dot(size, 0.0);
+        for(std::size_t ci = 0; ci < yv.c; ci++)
+            for(std::size_t s = 0; s < size; s++)
+                dot[s] += log ? dy_at(ci, s) : y_at(ci, s) * dy_at(ci, s);
+        if(mode == MIOPEN_SOFTMAX_MODE_INSTANCE)
+        {
+            const auto total = pairwise_sum(size, [&](std::size_t s) { return dot[s]; });
+            std::fill(dot.begin(), dot.end(), total);
+        }
+
+        for(std::size_t ci = 0; ci < dxv.c; ci++)
+        {
+            const auto base = dxv.offset(ni, ci);
+            for(std::size_t s = 0; s < size; s++)
+            {
+                const auto res = log ? dy_at(ci, s) - dot[s] * std::exp(y_at(ci, s))
+                                     : y_at(ci, s) * (dy_at(ci, s) - dot[s]);
+                auto& out = dx[base + dxv.spatial_offset(first + s)];
+                out       = static_cast<Tdx>(alpha * res + beta * static_cast<double>(out));
+            }
+        }
+    });
+}
+
+#endif
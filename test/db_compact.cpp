@@ -0,0 +1,212 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/db_compact.hpp>
+#include <miopen/temp_file.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/problem_description.hpp>
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static void WriteFile(const std::string& path, const std::string& content)
+{
+    std::ofstream file{path};
+    file << content;
+}
+
+static std::string ReadFile(const std::string& path)
+{
+    std::ifstream file{path};
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+static miopen::DbEntryCheck
+Check(const std::string&, const std::string& id, const std::string& values)
+{
+    if(id.find("unknown") == 0)
+        return miopen::DbEntryCheck::UnknownSolver;
+    if(values == "bad")
+        return miopen::DbEntryCheck::InvalidValues;
+    return miopen::DbEntryCheck::Valid;
+}
+
+static const std::string system_db = "k1=a:1;b:2\n"
+                                     "k2=a:bad\n"
+                                     "k1=c:3\n"
+                                     "garbage\n"
+                                     "k3=x:5;y;unknown0:6\n";
+static const std::string user_db   = "k1=d:8;a:7\n";
+
+static void MergePerfDb()
+{
+    const miopen::TmpDir dir{"db_compact"};
+    const auto path   = (dir.path / "system.txt").string();
+    const auto user   = (dir.path / "user.txt").string();
+    const auto output = (dir.path / "out" / "compact.txt").string();
+    WriteFile(path, system_db);
+    WriteFile(user, user_db);
+
+    const auto result = miopen::CompactTextDb(path, {user}, output, true, Check);
+    EXPECT(result.records == 2);
+    EXPECT(result.entries == 4);
+    EXPECT(result.merged == 2);
+    EXPECT(result.shadowed == 2);
+    EXPECT(result.unknown_solvers == 1);
+    EXPECT(result.invalid_values == 1);
+    EXPECT(result.malformed == 2);
+    EXPECT(result.size_before == system_db.size() + user_db.size());
+
+    // User values take priority, the records are sorted.
+    const auto expected = std::string{"k1=a:7;b:2;d:8\nk3=x:5\n"};
+    EXPECT_EQUAL(ReadFile(output), expected);
+    EXPECT(result.size_after == expected.size());
+    EXPECT_EQUAL(ReadFile(path), system_db);
+
+    const auto keys = miopen::GetTextDbKeys(output);
+    EXPECT(keys.size() == 2);
+    EXPECT_EQUAL(keys[0], "k1");
+    EXPECT(miopen::MeasureTextDbLookups(output, keys) >= 0);
+    EXPECT(!miopen::IsSQLiteDb(output));
+}
+
+static void MergeFindDb()
+{
+    const miopen::TmpDir dir{"db_compact"};
+    const auto path = (dir.path / "system.txt").string();
+    const auto user = (dir.path / "user.txt").string();
+    WriteFile(path, system_db);
+    WriteFile(user, user_db);
+
+    // Records of the find-db are not combined.
+    const auto result = miopen::CompactTextDb(path, {user}, path, false, Check);
+    EXPECT(result.records == 2);
+    EXPECT(result.entries == 3);
+    EXPECT(result.shadowed == 3);
+    EXPECT_EQUAL(ReadFile(path), "k1=a:7;d:8\nk3=x:5\n");
+}
+
+static void DryRun()
+{
+    const miopen::TmpDir dir{"db_compact"};
+    const auto path   = (dir.path / "system.txt").string();
+    const auto output = (dir.path / "compact.txt").string();
+    WriteFile(path, system_db);
+
+    const auto result = miopen::CompactTextDb(path, {}, output, true, Check, true);
+    EXPECT(result.records == 2);
+    EXPECT(result.size_after == std::string{"k1=a:1;b:2\nk3=x:5\n"}.size());
+    EXPECT(!boost::filesystem::exists(output));
+
+    // A missing db is created from the merged ones.
+    const auto missing = (dir.path / "missing.txt").string();
+    miopen::CompactTextDb(missing, {path}, missing, true, Check);
+    EXPECT_EQUAL(ReadFile(missing), "k1=a:1;b:2\nk3=x:5\n");
+}
+
+#if MIOPEN_ENABLE_SQLITE
+struct Values
+{
+    std::string value;
+    void Serialize(std::ostream& stream) const { stream << value; }
+    bool Deserialize(const std::string& str)
+    {
+        value = str;
+        return true;
+    }
+};
+
+static miopen::ProblemDescription MakeProblem(int channels)
+{
+    miopen::ProblemDescription problem{miopen::conv::Direction::Forward};
+    problem.in_data_type      = miopenFloat;
+    problem.out_data_type     = miopenFloat;
+    problem.weights_data_type = miopenFloat;
+    problem.n_inputs          = channels;
+    return problem;
+}
+
+static std::string Load(miopen::SQLitePerfDb& db, int channels, const std::string& id)
+{
+    Values values;
+    return db.Load(MakeProblem(channels), id, values) ? values.value : "";
+}
+
+static void MergeSQLitePerfDb()
+{
+    const miopen::TmpDir dir{"db_compact"};
+    const auto path = (dir.path / "system.db").string();
+    const auto user = (dir.path / "user.udb").string();
+    {
+        miopen::SQLitePerfDb db{path, false, "gfx906", 64};
+        db.Update(MakeProblem(1), "a", Values{"1"});
+        db.Update(MakeProblem(1), "unknown0", Values{"2"});
+        db.Update(MakeProblem(2), "a", Values{"bad"});
+        db.Update(MakeProblem(3), "a", Values{"3"});
+        miopen::SQLitePerfDb user_db{user, false, "gfx906", 64};
+        user_db.Update(MakeProblem(3), "b", Values{"4"});
+        user_db.Update(MakeProblem(1), "a", Values{"5"});
+    }
+    EXPECT(miopen::IsSQLiteDb(path));
+
+    const auto dry = miopen::CompactSQLitePerfDb(path, {user}, path, Check, true);
+    EXPECT(dry.entries == 3);
+
+    const auto result = miopen::CompactSQLitePerfDb(path, {user}, path, Check);
+    EXPECT(result.records == 2);
+    EXPECT(result.entries == 3);
+    EXPECT(result.merged == 2);
+    EXPECT(result.unknown_solvers == 1);
+    EXPECT(result.invalid_values == 1);
+
+    miopen::SQLitePerfDb db{path, false, "gfx906", 64};
+    EXPECT_EQUAL(Load(db, 1, "a"), "5");
+    EXPECT_EQUAL(Load(db, 1, "unknown0"), "");
+    EXPECT_EQUAL(Load(db, 2, "a"), "");
+    EXPECT_EQUAL(Load(db, 3, "a"), "3");
+    EXPECT_EQUAL(Load(db, 3, "b"), "4");
+}
+#endif
+
+int main()
+{
+    MergePerfDb();
+    MergeFindDb();
+    DryRun();
+#if MIOPEN_ENABLE_SQLITE
+    MergeSQLitePerfDb();
+#endif
+}
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/md5.hpp>
+#include <miopen/xxh3.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+static std::string Pattern(std::size_t size)
+{
+    std::string data(size, '\0');
+    for(std::size_t i = 0; i < size; i++)
+        data[i] = static_cast<char>(i * 31 + 7);
+    return data;
+}
+
+static void Md5()
+{
+    EXPECT_EQUAL(miopen::md5(""), "d41d8cd98f00b204e9800998ecf8427e");
+    EXPECT_EQUAL(miopen::md5("abc"), "900150983cd24fb0d6963f7d28e17f72");
+
+    const auto data = Pattern(1000);
+    miopen::Md5 hash;
+    for(std::size_t i = 0; i < data.size(); i += 37)
+        hash.Update(data.data() + i, std::min<std::size_t>(37, data.size() - i));
+    EXPECT_EQUAL(miopen::ToHex(hash.Final()), miopen::md5(data));
+}
+
+static void Xxh3()
+{
+    // Reference values of XXH3_128bits(), one for every input size class.
+    const std::vector<std::pair<std::size_t, std::string>> expected = {
+        {0, "99aa06d3014798d86001c324468d497f"},
+        {1, "495b62073ef70ca44c5cca45d0f4811f"},
+        {3, "46f66cb93538156515f7093b173d005c"},
+        {4, "7fefeeffb4d0eab3b987ca5d9241572a"},
+        {8, "803c675a846cc6c256bb836ceb6d4baa"},
+        {9, "d46556872d230f224376673580310154"},
+        {16, "650fe308c566747df853dd94614dfa07"},
+        {17, "18217300b5132d5a78c349fe81b2f26c"},
+        {128, "b4f87b99d2db8a511e04fad9f0cacb4d"},
+        {129, "6881633650cd8924c51bc887976aef63"},
+        {240, "de57aab31e77a2ff93e173833f75ab66"},
+        {241, "92b991a7192f3f080b3b630948ce4a00"},
+        {1024, "4c17271c906df79223bc880ebf0d29c6"},
+        {1025, "70a4eb1b9691d77fc09fdfbc398c7d82"},
+        {4099, "c9f569d64a2cdf4c8289fd6cadd0c49e"},
+    };
+    EXPECT_EQUAL(miopen::xxh3("abc"), "06b05ab6733a618578af5f94892f3950");
+
+    const auto data = Pattern(4099);
+    for(const auto& item : expected)
+    {
+        const auto size = item.first;
+        EXPECT_EQUAL(miopen::xxh3(data.substr(0, size)), item.second);
+
+        // The result does not depend on how the input is split.
+        for(const std::size_t piece : {1, 7, 64, 65, 300})
+        {
+            miopen::Xxh3 hash;
+            for(std::size_t i = 0; i < size; i += piece)
+            {
+                hash.Update(data.data() + i, std::min(piece, size - i));
+                hash.Final();
+            }
+            EXPECT_EQUAL(miopen::ToHex(hash.Final()), item.second);
+        }
+    }
+}
+
+int main()
+{
+    Md5();
+    Xxh3();
+}
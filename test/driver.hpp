@@ -31,11 +31,13 @@
 #include "tensor_holder.hpp"
 #include "test.hpp"
 #include "verify.hpp"
+#include "verification_cache.hpp"
 
 #include <functional>
 #include <deque>
 #include <half.hpp>
 #include <type_traits>
+#include <utility>
 #include <boost/filesystem.hpp>
 #include <miopen/functional.hpp>
 #include <miopen/expanduser.hpp>
@@ -159,8 +161,10 @@ struct test_driver
     std::string program_name;
     std::deque<argument> arguments;
     std::unordered_map<std::string, std::size_t> argument_index;
-    int cache_version      = 1;
+    int cache_version      = 2;
     std::string cache_path = compute_cache_path();
+    int cache_size_limit   = 16384;
+    bool cache_compress    = false;
     miopenDataType_t type  = miopenFloat;
     bool full_set          = false;
     bool verbose           = false;
@@ -198,6 +202,13 @@ struct test_driver
         v(rethrow, {"--rethrow"}, "Rethrow any exceptions found during verify");
         v(cache_path, {"--verification-cache", "-C"}, "Path to verification cache");
         v(disabled_cache, {"--disable-verification-cache"}, "Disable verification cache");
+        v(cache_size_limit,
+          {"--verification-cache-size"},
+          "Size limit of verification cache in MiB, least recently used entries are evicted "
+          "above it. 0 means unlimited.");
+        v(cache_compress,
+          {"--verification-cache-compress"},
+          "Compress verification cache entries");
         v(dry_run, {"--dry-run"}, "Dry run. Does not run the test, just prints the command.");
         v(config_iter_start,
           {"--config-iter-start", "-i"},
@@ -659,25 +670,37 @@ struct test_driver
         if(is_cache_disabled())
             return cpu_async(v, xs...);
         auto key = miopen::get_type_name<V>() + "-" + miopen::md5(get_command_args());
-        auto p =
+        verification_cache cache;
+        cache.dir =
             boost::filesystem::path{miopen::ExpandUser(cache_path)} / std::to_string(cache_version);
-        if(!boost::filesystem::exists(p))
-            boost::filesystem::create_directories(p);
-        auto f = p / key;
-        if(boost::filesystem::exists(f) and not retry)
+        cache.max_size = std::uintmax_t(std::max(cache_size_limit, 0)) << 20;
+        cache.compress = cache_compress;
+        if(!boost::filesystem::exists(cache.dir))
+            boost::filesystem::create_directories(cache.dir);
+        if(cache.contains(key) and not retry)
         {
             miss = false;
-            return detach_async([=] {
-                result_type result;
-                load(f.string(), result);
-                return result;
+            auto entry = detach_async([=] {
+                auto loaded  = std::make_pair(false, result_type{});
+                loaded.first = cache.load(key, loaded.second);
+                return loaded;
+            });
+            // The entry may be corrupt or evicted by another worker after contains().
+            return then(std::move(entry), [=, &v, &xs...](auto loaded) {
+                if(loaded.first)
+                    return loaded.second;
+                std::cout << "Verification cache entry " << key << " is unreadable, recomputing"
+                          << std::endl;
+                auto data = cpu_async(v, xs...).get();
+                cache.save(key, data);
+                return data;
             });
         }
         else
         {
             miss = true;
             return then(cpu_async(v, xs...), [=](auto data) {
-                save(f.string(), data);
+                cache.save(key, data);
                 return data;
             });
         }
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/env.hpp>
+#include <miopen/find_controls.hpp>
+
+#include <cstdlib>
+#include <string>
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_TEST_ENV_FLAG)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_TEST_ENV_VALUE)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_TEST_ENV_STRING)
+
+static void Flags()
+{
+    unsetenv("MIOPEN_TEST_ENV_FLAG");
+    miopen::ReloadEnvironment();
+    EXPECT(!miopen::IsEnabled(MIOPEN_TEST_ENV_FLAG{}));
+    EXPECT(!miopen::IsDisabled(MIOPEN_TEST_ENV_FLAG{}));
+
+    // The values are read once, changes show after a reload.
+    setenv("MIOPEN_TEST_ENV_FLAG", "1", 1);
+    EXPECT(!miopen::IsEnabled(MIOPEN_TEST_ENV_FLAG{}));
+    miopen::ReloadEnvironment();
+    EXPECT(miopen::IsEnabled(MIOPEN_TEST_ENV_FLAG{}));
+    EXPECT(!miopen::IsDisabled(MIOPEN_TEST_ENV_FLAG{}));
+
+    setenv("MIOPEN_TEST_ENV_FLAG", "disable", 1);
+    miopen::ReloadEnvironment();
+    EXPECT(!miopen::IsEnabled(MIOPEN_TEST_ENV_FLAG{}));
+    EXPECT(miopen::IsDisabled(MIOPEN_TEST_ENV_FLAG{}));
+    unsetenv("MIOPEN_TEST_ENV_FLAG");
+}
+
+static void Values()
+{
+    unsetenv("MIOPEN_TEST_ENV_VALUE");
+    miopen::ReloadEnvironment();
+    EXPECT_EQUAL(miopen::Value(MIOPEN_TEST_ENV_VALUE{}, 7), 7);
+
+    setenv("MIOPEN_TEST_ENV_VALUE", "0x10", 1);
+    EXPECT_EQUAL(miopen::Value(MIOPEN_TEST_ENV_VALUE{}, 7), 7);
+    miopen::ReloadEnvironment();
+    EXPECT_EQUAL(miopen::Value(MIOPEN_TEST_ENV_VALUE{}, 7), 16);
+    unsetenv("MIOPEN_TEST_ENV_VALUE");
+}
+
+static void Strings()
+{
+    setenv("MIOPEN_TEST_ENV_STRING", "first", 1);
+    miopen::ReloadEnvironment();
+    const char* const first = miopen::GetStringEnv(MIOPEN_TEST_ENV_STRING{});
+    EXPECT(first != nullptr && std::string{first} == "first");
+
+    // The string read before the reload stays valid.
+    setenv("MIOPEN_TEST_ENV_STRING", "second", 1);
+    miopen::ReloadEnvironment();
+    const char* const second = miopen::GetStringEnv(MIOPEN_TEST_ENV_STRING{});
+    EXPECT(second != nullptr && std::string{second} == "second");
+    EXPECT_EQUAL(std::string{first}, "first");
+
+    unsetenv("MIOPEN_TEST_ENV_STRING");
+    miopen::ReloadEnvironment();
+    EXPECT(miopen::GetStringEnv(MIOPEN_TEST_ENV_STRING{}) == nullptr);
+}
+
+static void FindControls()
+{
+    setenv("MIOPEN_FIND_MODE", "FAST", 1);
+    miopen::ReloadEnvironment();
+    EXPECT(miopen::FindMode{}.IsFast());
+
+    setenv("MIOPEN_FIND_MODE", "NORMAL", 1);
+    EXPECT(miopen::FindMode{}.IsFast());
+    miopen::ReloadEnvironment();
+    EXPECT(!miopen::FindMode{}.IsFast());
+    unsetenv("MIOPEN_FIND_MODE");
+
+    setenv("MIOPEN_DEBUG_FIND_ONLY_SOLVER", "gemm", 1);
+    miopen::ReloadEnvironment();
+    EXPECT(miopen::GetEnvFindOnlySolver() == miopen::solver::Id::gemm());
+    unsetenv("MIOPEN_DEBUG_FIND_ONLY_SOLVER");
+    miopen::ReloadEnvironment();
+    EXPECT(!miopen::GetEnvFindOnlySolver().IsValid());
+}
+
+int main()
+{
+    Flags();
+    Values();
+    Strings();
+    FindControls();
+}
@@ -0,0 +1,225 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include "get_handle.hpp"
+#include <miopen/any_solver.hpp>
+#include <miopen/config.h>
+#include <miopen/context_cache.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/db.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/problem_description.hpp>
+#include <miopen/solver.hpp>
+#include <miopen/temp_file.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+using miopen::conv::Direction;
+
+static void WriteFile(const std::string& path, const std::string& content)
+{
+    std::ofstream file{path};
+    file << content;
+}
+
+static bool HasValues(const miopen::DbRecord& record, const std::string& id)
+{
+    miopen::FindDbData data;
+    return record.GetValues(id, data);
+}
+
+static miopen::DbRecord MakeRecord(const miopen::ProblemDescription& problem,
+                                   const std::string& algorithm,
+                                   const std::string& solver,
+                                   float time)
+{
+    miopen::DbRecord record{problem};
+    record.SetValues(
+        algorithm,
+        miopen::FindDbData{solver, time, 0, miopen::FindDbKCacheKey::MakeUnused(algorithm)});
+    return record;
+}
+
+static void TextDbRecords()
+{
+    const miopen::TmpDir dir{"find_db_prefetch"};
+    const auto system = (dir.path / "system.txt").string();
+    const auto user   = (dir.path / "user.txt").string();
+    WriteFile(system,
+              "k1=a:1,0,0,a,<unused>\n"
+              "garbage\n"
+              "k2=b:2,0,0,b,<unused>\n"
+              "k1=c:3,0,0,c,<unused>\n"
+              "k3=\n");
+    WriteFile(user, "k1=d:4,0,0,d,<unused>\n");
+
+    auto db            = miopen::PlainTextDb{system, true};
+    const auto records = db.FindRecords({"k3", "k1", "k4", "k2", "k1"});
+    EXPECT(records.size() == 2);
+    // The first line of a key is used, like by FindRecord().
+    EXPECT(HasValues(records.at("k1"), "a"));
+    EXPECT(!HasValues(records.at("k1"), "c"));
+    EXPECT(HasValues(records.at("k2"), "b"));
+    EXPECT(db.FindRecords({}).empty());
+
+#if !MIOPEN_DISABLE_USERDB
+    // The user record of a key replaces the installed one.
+    auto find_db      = miopen::FindDb{system, user};
+    const auto merged  = find_db.FindRecords({"k1", "k2"});
+    EXPECT(merged.size() == 2);
+    EXPECT(HasValues(merged.at("k1"), "d"));
+    EXPECT(!HasValues(merged.at("k1"), "a"));
+    EXPECT(HasValues(merged.at("k2"), "b"));
+#endif
+}
+
+static void Prefetch()
+{
+    auto&& handle = get_handle();
+    const miopen::TensorDescriptor x{miopenFloat, {2, 8, 7, 7}};
+    const miopen::TensorDescriptor w{miopenFloat, {4, 8, 3, 3}};
+    const miopen::TensorDescriptor y{miopenFloat, {2, 4, 5, 5}};
+    const miopen::ConvolutionDescriptor conv{{0, 0}, {1, 1}, {1, 1}};
+
+    const auto forward   = miopen::ProblemDescription{x, w, y, conv, Direction::Forward};
+    const auto backward  = miopen::ProblemDescription{x, w, y, conv, Direction::BackwardData};
+    const auto weights   = miopen::ProblemDescription{x, w, y, conv, Direction::BackwardWeights};
+    const auto algorithm = std::string{"miopenConvolutionFwdAlgoDirect"};
+
+    const miopen::TempFile file{"miopen.test.find_db_prefetch"};
+    miopen::testing_find_db_path_override() = file.Path();
+    {
+        auto db = miopen::PlainTextDb{file.Path()};
+        EXPECT(db.StoreRecord(MakeRecord(forward, algorithm, "ConvOclDirectFwd", 0.5f)));
+        EXPECT(db.StoreRecord(MakeRecord(
+            backward, "miopenConvolutionBwdDataAlgoDirect", "ConvOclDirectFwd", 0.7f)));
+    }
+
+    const auto problems = std::vector<miopen::ProblemDescription>{forward, backward, weights};
+    EXPECT(miopen::FindDbRecord::Prefetch(handle, problems) == 2);
+
+    // The records come from memory now, also the lack of one.
+    WriteFile(file.Path(), "");
+    {
+        const miopen::FindDbRecord record{handle, forward};
+        EXPECT(!record.empty());
+        EXPECT_EQUAL(record.begin()->first, algorithm);
+        EXPECT_EQUAL(record.begin()->second.solver_id, "ConvOclDirectFwd");
+        EXPECT(!miopen::FindDbRecord{handle, backward}.empty());
+        EXPECT(miopen::FindDbRecord{handle, weights}.empty());
+    }
+
+#if !MIOPEN_DISABLE_USERDB
+    // Storing the user record of a problem drops the prefetched one.
+    const auto loaded = miopen::UserFindDbRecord::TryLoad(
+        handle, forward, [&](miopen::DbRecord& record) {
+            record.SetValues("miopenConvolutionFwdAlgoGEMM",
+                             miopen::FindDbData{"gemm",
+                                                1.0f,
+                                                0,
+                                                miopen::FindDbKCacheKey::MakeUnused("gemm")});
+        });
+    EXPECT(loaded.size() == 1);
+    {
+        const miopen::FindDbRecord record{handle, forward};
+        EXPECT(!record.empty());
+        EXPECT_EQUAL(record.begin()->second.solver_id, "gemm");
+        EXPECT(!miopen::FindDbRecord{handle, backward}.empty());
+    }
+#endif
+
+    miopen::testing_find_db_path_override() = boost::none;
+}
+
+struct WarmUpCase
+{
+    Direction direction;
+    std::string algorithm;
+    std::string solver;
+};
+
+static void WarmUp()
+{
+    auto&& handle = get_handle();
+    const miopen::TensorDescriptor x{miopenFloat, {2, 8, 7, 7}};
+    const miopen::TensorDescriptor w{miopenFloat, {4, 8, 3, 3}};
+    const miopen::TensorDescriptor y{miopenFloat, {2, 4, 5, 5}};
+    const miopen::ConvolutionDescriptor conv{{0, 0}, {1, 1}, {1, 1}};
+
+    const auto cases = std::vector<WarmUpCase>{
+        {Direction::Forward, "miopenConvolutionFwdAlgoDirect", "ConvOclDirectFwd"},
+        {Direction::BackwardData, "miopenConvolutionBwdDataAlgoDirect", "ConvOclDirectFwd"},
+        {Direction::BackwardWeights, "miopenConvolutionBwdWeightsAlgoDirect", "ConvOclBwdWrW53"}};
+
+    const miopen::TempFile file{"miopen.test.find_db_prefetch"};
+    miopen::testing_find_db_path_override() = file.Path();
+
+    auto problems = std::vector<miopen::conv::ProblemDescription>{};
+    {
+        auto db = miopen::PlainTextDb{file.Path()};
+        for(const auto& c : cases)
+        {
+            // The immediate mode calls look the records up by x, w and y in every direction.
+            const auto problem = miopen::ProblemDescription{x, w, y, conv, c.direction};
+            EXPECT(db.StoreRecord(MakeRecord(problem, c.algorithm, c.solver, 0.5f)));
+
+            // The input of a backward problem is dy.
+            const auto forward = c.direction == Direction::Forward;
+            problems.emplace_back(forward ? x : y, w, forward ? y : x, conv, c.direction);
+            problems.push_back(problems.back());
+        }
+    }
+    EXPECT(miopen::PrefetchConvolutions(handle, problems) == cases.size());
+
+    WriteFile(file.Path(), "");
+    for(const auto& c : cases)
+    {
+        const miopen::FindDbRecord record{
+            handle, miopen::ProblemDescription{x, w, y, conv, c.direction}};
+        EXPECT(!record.empty());
+        EXPECT_EQUAL(record.begin()->first, c.algorithm);
+        EXPECT_EQUAL(record.begin()->second.solver_id, c.solver);
+
+        // The invoker of the chosen solution is ready for the immediate mode call.
+        const auto cached    = miopen::GetConvolutionContext(handle, x, w, y, conv, c.direction);
+        const auto solver_id = miopen::solver::Id{c.solver};
+        if(solver_id.GetSolver().IsApplicable(cached->context))
+            EXPECT(handle.GetInvoker(cached->network_config, solver_id));
+    }
+
+    miopen::testing_find_db_path_override() = boost::none;
+}
+
+int main()
+{
+    TextDbRecords();
+    Prefetch();
+    WarmUp();
+}
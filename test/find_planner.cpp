@@ -0,0 +1,210 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/find_planner.hpp>
+
+#include <sstream>
+#include <string>
+
+using miopen::conv::Direction;
+using miopen::conv::ProblemDescription;
+
+static const std::string driver_line =
+    "./bin/MIOpenDriver conv -n 32 -c 64 -H 56 -W 56 -k 128 -y 3 -x 3 -p 1 -q 1 -u 2 -v 2 -t 1";
+
+static std::string ToString(const ProblemDescription& problem)
+{
+    std::ostringstream ss;
+    ss << problem;
+    return ss.str();
+}
+
+// The find-db key of a problem has to give back the same problem.
+static void CheckRoundTrip(const ProblemDescription& problem)
+{
+    const auto parsed = miopen::ParseFindPlanLine(ToString(problem));
+    EXPECT(parsed.size() == 1);
+    EXPECT_EQUAL(ToString(parsed[0]), ToString(problem));
+    EXPECT_EQUAL(miopen::GetFindPlanKey(parsed[0]), miopen::GetFindPlanKey(problem));
+}
+
+static void DriverCommandLine()
+{
+    const auto forward = miopen::ParseFindPlanLine(driver_line + " -F 1");
+    EXPECT(forward.size() == 1);
+    EXPECT(forward[0].GetDirection() == Direction::Forward);
+    EXPECT_EQUAL(ToString(forward[0]), "64-56-56-3x3-128-28-28-32-1x1-2x2-1x1-0-NCHW-FP32-F");
+
+    // All directions by default, the backward problems go from the output to the input.
+    const auto all = miopen::ParseFindPlanLine(driver_line);
+    EXPECT(all.size() == 3);
+    EXPECT(all[1].GetDirection() == Direction::BackwardData);
+    EXPECT(all[2].GetDirection() == Direction::BackwardWeights);
+    EXPECT_EQUAL(ToString(all[1]), "128-28-28-3x3-64-56-56-32-1x1-2x2-1x1-0-NCHW-FP32-B");
+    EXPECT_EQUAL(ToString(all[2]), "128-28-28-3x3-64-56-56-32-1x1-2x2-1x1-0-NCHW-FP32-W");
+
+    const auto wrw = miopen::ParseFindPlanLine(
+        "MIOpenDriver convfp16 --batchsize 8 --in_channels 16 --in_h 14 --in_w 14 "
+        "--out_channels 32 --fil_h 1 --fil_w 1 --forw 4");
+    EXPECT(wrw.size() == 1);
+    EXPECT_EQUAL(ToString(wrw[0]), "32-14-14-1x1-16-14-14-8-0x0-1x1-1x1-0-NCHW-FP16-W");
+
+    const auto same =
+        miopen::ParseFindPlanLine("conv -n 1 -c 3 -H 7 -W 8 -k 4 -y 3 -x 3 -u 2 -v 2 -z same -F 1");
+    EXPECT_EQUAL(same[0].GetPadH(), 1);
+    EXPECT_EQUAL(same[0].GetPadW(), 0);
+
+    // Int8 convolutions output floats and have no backward directions.
+    const auto int8 = miopen::ParseFindPlanLine("convint8 -n 2 -c 8 -H 8 -W 8 -k 8 -y 1 -x 1");
+    EXPECT(int8.size() == 1);
+    EXPECT_EQUAL(ToString(int8[0]), "8-8-8-1x1-8-8-8-2-0x0-1x1-1x1-0-NCHW-INT8INT8FP32-F");
+
+    const auto grouped = miopen::ParseFindPlanLine(
+        "conv -_ 3 -n 2 -c 8 -! 4 -H 8 -W 8 -k 16 -@ 1 -y 3 -x 3 -p 1 -q 1 -g 4 -F 3");
+    EXPECT(grouped.size() == 2);
+    EXPECT_EQUAL(ToString(grouped[0]),
+                 "8-4-8-8-1x3x3-16-4-8-8-2-0x1x1-1x1x1-1x1x1-0-NCHW-FP32-F_g4");
+
+    for(const auto& problems : {forward, all, wrw, same, int8, grouped})
+        for(const auto& problem : problems)
+            CheckRoundTrip(problem);
+}
+
+static void Transposed()
+{
+    // A transposed convolution is solved as the backward data pass of the convolution from
+    // its output to its input.
+    const auto trans = miopen::ParseFindPlanLine(
+        "conv -m trans -n 4 -c 16 -H 7 -W 7 -k 8 -y 2 -x 2 -u 2 -v 2 -F 1");
+    const auto conv =
+        miopen::ParseFindPlanLine("conv -n 4 -c 8 -H 14 -W 14 -k 16 -y 2 -x 2 -u 2 -v 2 -F 2");
+    EXPECT(trans.size() == 1);
+    EXPECT(trans[0].GetDirection() == Direction::BackwardData);
+    EXPECT_EQUAL(ToString(trans[0]), ToString(conv[0]));
+    EXPECT_EQUAL(miopen::GetFindPlanKey(trans[0]), miopen::GetFindPlanKey(conv[0]));
+}
+
+static void Malformed()
+{
+    for(const auto& line : {"conv -n",
+                            "conv -n x",
+                            "conv -n 1 -c 3 -g 2",
+                            "conv -m diagonal",
+                            "resnet50",
+                            "64-56-56-3x3-128-28-28-32-1x1-2x2-1x1-0-NHWC-FP32-F",
+                            "64-56-56-3x3-128-28-28-32-1x1-2x2-1x1-0-NCHW-FP64-F",
+                            "64-56-56-3x3-128-28-28-32-1x1-2x2-1x1-0-NCHW-FP32-X"})
+        CHECK(throws([&] { miopen::ParseFindPlanLine(line); }));
+}
+
+static void Deduplicate()
+{
+    std::istringstream input("# first block\n" + driver_line + " -F 1\n  " + driver_line +
+                             "  -F 1 \n"
+                             "64-56-56-3x3-128-28-28-32-1x1-2x2-1x1-0-NCHW-FP32-F\n"
+                             "\n" +
+                             driver_line + "\n");
+    const auto plan = miopen::ReadFindPlan(input);
+    EXPECT(plan.total == 6);
+    EXPECT(plan.problems.size() == 3);
+    EXPECT(plan.problems[0].uses == 4);
+    EXPECT(plan.problems[1].uses == 1);
+    EXPECT(plan.problems[0].problem.GetDirection() == Direction::Forward);
+    EXPECT(plan.problems[2].problem.GetDirection() == Direction::BackwardWeights);
+    // Backward data and weights share the key of the configuration.
+    EXPECT(plan.problems[1].key != plan.problems[2].key);
+
+    std::istringstream bad(driver_line + "\nconv -n\n");
+    bool reported = false;
+    try
+    {
+        miopen::ReadFindPlan(bad);
+    }
+    catch(const miopen::Exception& ex)
+    {
+        reported = std::string(ex.what()).find("Line 2") != std::string::npos;
+    }
+    EXPECT(reported);
+}
+
+static miopen::solver::KernelInfo MakeKernel(const std::string& file, const std::string& options)
+{
+    miopen::solver::KernelInfo kernel;
+    kernel.kernel_file  = file;
+    kernel.kernel_name  = file;
+    kernel.comp_options = options;
+    return kernel;
+}
+
+static void Jobs()
+{
+    std::istringstream input(driver_line + "\n" + driver_line + " -c 32\n");
+    const auto plan = miopen::ReadFindPlan(input);
+    EXPECT(plan.problems.size() == 6);
+
+    // A kernel shared by all problems, one per direction and one per input channel count.
+    std::size_t calls = 0;
+    const auto jobs   = miopen::MakeFindPlanJobs(plan, [&](const ProblemDescription& problem) {
+        calls++;
+        const auto direction = std::to_string(static_cast<int>(problem.GetDirection()));
+        const auto channels  = std::to_string(problem.GetInChannels());
+
+        std::vector<miopen::solver::ConvSolution> solutions(3);
+        solutions[0].construction_params = {MakeKernel("common.cl", ""),
+                                            MakeKernel("direction.cl", "-DDIR=" + direction)};
+        solutions[1].construction_params = {MakeKernel("channels.cl", "-DC=" + channels)};
+        solutions[2].status              = miopenStatusNotImplemented;
+        solutions[2].construction_params = {MakeKernel("unused.cl", "")};
+        return solutions;
+    });
+
+    EXPECT(calls == 6);
+    EXPECT(jobs.solutions.size() == 6);
+    EXPECT(jobs.GetAllSolutions().size() == 18);
+
+    // Input channels: 64 forward, 128 backward, 32 forward, 128 backward.
+    EXPECT(jobs.programs.size() == 1 + 3 + 3);
+    EXPECT_EQUAL(jobs.programs[0].kernel.kernel_file, "common.cl");
+    EXPECT(jobs.programs[0].problems.size() == 6);
+    for(const auto& program : jobs.programs)
+    {
+        EXPECT(program.kernel.kernel_file != "unused.cl");
+        if(program.kernel.comp_options == "-DDIR=0")
+            EXPECT(program.problems == (std::vector<std::size_t>{0, 3}));
+        if(program.kernel.comp_options == "-DC=128")
+            EXPECT(program.problems == (std::vector<std::size_t>{1, 2, 4, 5}));
+    }
+}
+
+int main()
+{
+    DriverCommandLine();
+    Transposed();
+    Malformed();
+    Deduplicate();
+    Jobs();
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/errors.hpp>
+#include <miopen/kern_db.hpp>
+#include <miopen/kernel_cache_builder.hpp>
+#include <miopen/temp_file.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using miopen::KernelCacheProgram;
+
+static miopen::solver::KernelInfo MakeKernel(const std::string& file, const std::string& options)
+{
+    miopen::solver::KernelInfo kernel;
+    kernel.kernel_file  = file;
+    kernel.kernel_name  = "kernel";
+    kernel.comp_options = options;
+    return kernel;
+}
+
+// Stands in for the compiler, the code object is made of the program.
+static std::string StubCompile(const KernelCacheProgram& program, const std::string& device)
+{
+    if(program.name == "broken.cl")
+        MIOPEN_THROW("Build failed");
+    return device + ":" + program.name + program.args;
+}
+
+static void Targets()
+{
+    const auto target = miopen::ParseKernelCacheTarget("gfx906:60");
+    EXPECT_EQUAL(target.device, "gfx906");
+    EXPECT(target.num_cu == 60);
+    EXPECT_EQUAL(miopen::GetKernelCacheFileName(target), "gfx906_60.kdb");
+    EXPECT_EQUAL(miopen::GetKernelCacheFileName({"gfx908", 120}), "gfx90878.kdb");
+
+    // Names of the runtime are mapped like for a device.
+    EXPECT_EQUAL(miopen::ParseKernelCacheTarget("Vega10:64").device, "gfx900");
+
+    for(const auto* spec : {"gfx906", "gfx906:", ":60", "gfx906:6x", "gfx906:0"})
+        EXPECT(throws([&] { miopen::ParseKernelCacheTarget(spec); }));
+}
+
+static void Programs()
+{
+    const auto programs = miopen::GetKernelCachePrograms({MakeKernel("a.cl", "-DA=1"),
+                                                          MakeKernel("b.s", ""),
+                                                          MakeKernel("a.cl", " -DA=1"),
+                                                          MakeKernel("a.cl", "-DA=2")},
+                                                         "gfx906");
+    // Options are normalized like the ones of the handle, so the first and the third kernel
+    // share their program.
+    EXPECT(programs.size() == 3);
+    EXPECT_EQUAL(programs[0].name, "a.cl");
+    EXPECT_EQUAL(programs[0].args, " -DA=1 -mcpu=gfx906");
+    EXPECT_EQUAL(programs[1].name, "b.s");
+    EXPECT_EQUAL(programs[1].args, " -mcpu=gfx906");
+    EXPECT_EQUAL(programs[2].args, " -DA=2 -mcpu=gfx906");
+}
+
+static void Build()
+{
+    const miopen::TempFile file{"miopen.test.kernel_cache_builder"};
+    const auto target = miopen::ParseKernelCacheTarget("gfx906:60");
+
+    std::vector<miopen::solver::KernelInfo> kernels;
+    for(auto i = 0; i < 16; i++)
+        kernels.push_back(MakeKernel("conv.cl", "-DN=" + std::to_string(i)));
+    kernels.push_back(MakeKernel("broken.cl", ""));
+    const auto programs = miopen::GetKernelCachePrograms(kernels, target.device);
+
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+    const auto compile = [&](const KernelCacheProgram& program, const std::string& device) {
+        const auto now = ++running;
+        auto seen      = max_running.load();
+        while(now > seen && !max_running.compare_exchange_weak(seen, now))
+        {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        --running;
+        return StubCompile(program, device);
+    };
+
+    const auto result = miopen::BuildKernelCache(file, target, programs, compile, 3);
+    EXPECT(result.built == 16);
+    EXPECT(result.present == 0);
+    EXPECT(result.failed.size() == 1);
+    EXPECT_EQUAL(result.failed[0].name, "broken.cl");
+    EXPECT(max_running.load() <= 3);
+
+    // The records are found by the binary cache of a handle of the target.
+    miopen::KernDb db{file, false, target.device, target.num_cu};
+    const miopen::KernelConfig cfg{"conv.cl.o", " -DN=5 -mcpu=gfx906", ""};
+    const auto record = db.FindRecordUnsafe(cfg);
+    EXPECT(record);
+    EXPECT_EQUAL(record.get(), "gfx906:conv.cl -DN=5 -mcpu=gfx906");
+
+    // Only the missing programs are built again.
+    std::atomic<int> compiled{0};
+    const auto again = miopen::BuildKernelCache(
+        file,
+        target,
+        programs,
+        [&](const KernelCacheProgram& program, const std::string& device) {
+            ++compiled;
+            return StubCompile(program, device);
+        },
+        3);
+    EXPECT(again.present == 16);
+    EXPECT(again.built == 0);
+    EXPECT(again.failed.size() == 1);
+    EXPECT(compiled.load() == 1);
+}
+
+int main()
+{
+    Targets();
+    Programs();
+    Build();
+}
@@ -0,0 +1,189 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/db.hpp>
+#include <miopen/perf_db_snapshot.hpp>
+#include <miopen/temp_file.hpp>
+
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+struct Problem
+{
+    int size;
+    void Serialize(std::ostream& stream) const { stream << "problem" << size; }
+};
+
+struct Values
+{
+    std::string value;
+    void Serialize(std::ostream& stream) const { stream << value; }
+    bool Deserialize(const std::string& str)
+    {
+        value = str;
+        return true;
+    }
+};
+
+// Counts the record reads and writes of the db.
+struct CountingDb
+{
+    miopen::PlainTextDb inner;
+    int finds  = 0;
+    int writes = 0;
+
+    CountingDb(const std::string& path) : inner(path) {}
+
+    boost::optional<miopen::DbRecord> FindRecord(const Problem& problem)
+    {
+        ++finds;
+        return inner.FindRecord(problem);
+    }
+
+    template <class V>
+    bool Update(const Problem& problem, const std::string& id, const V& values)
+    {
+        ++writes;
+        return bool(inner.Update(problem, id, values));
+    }
+
+    bool UpdateRecord(miopen::DbRecord& record)
+    {
+        ++writes;
+        return inner.UpdateRecord(record);
+    }
+
+    bool Remove(const Problem& problem, const std::string& id) { return inner.Remove(problem, id); }
+};
+
+static std::string LoadFromDb(CountingDb& db, const Problem& problem, const std::string& id)
+{
+    Values values;
+    return db.inner.Load(problem, id, values) ? values.value : "";
+}
+
+static void ReadOnce()
+{
+    const miopen::TempFile file{"miopen.test.perf_db_snapshot"};
+    CountingDb db{file};
+    const Problem problem{1};
+    db.Update(problem, "solver0", Values{"a"});
+    db.Update(problem, "solver1", Values{"b"});
+
+    miopen::PerfDbSnapshot<CountingDb, Problem> snapshot{db, problem};
+    EXPECT_EQUAL(db.finds, 0);
+
+    Values values;
+    CHECK(snapshot.Load(problem, "solver0", values));
+    EXPECT_EQUAL(values.value, "a");
+    CHECK(snapshot.Load(problem, "solver1", values));
+    EXPECT_EQUAL(values.value, "b");
+    CHECK(!snapshot.Load(problem, "solver2", values));
+    EXPECT_EQUAL(db.finds, 1);
+
+    CHECK(snapshot.Flush());
+    EXPECT_EQUAL(LoadFromDb(db, problem, "solver0"), "a");
+}
+
+static void StagedWrites()
+{
+    const miopen::TempFile file{"miopen.test.perf_db_snapshot"};
+    CountingDb db{file};
+    const Problem problem{2};
+    db.Update(problem, "solver0", Values{"a"});
+
+    miopen::PerfDbSnapshot<CountingDb, Problem> snapshot{db, problem};
+    CHECK(snapshot.Update(problem, "solver1", Values{"b"}));
+    CHECK(snapshot.Update(problem, "solver1", Values{"c"}));
+    CHECK(snapshot.Remove(problem, "solver0"));
+    CHECK(!snapshot.Remove(problem, "solver3"));
+
+    // The snapshot sees its changes, the db gets them on Flush().
+    Values values;
+    CHECK(snapshot.Load(problem, "solver1", values));
+    EXPECT_EQUAL(values.value, "c");
+    CHECK(!snapshot.Load(problem, "solver0", values));
+    EXPECT_EQUAL(LoadFromDb(db, problem, "solver0"), "a");
+    EXPECT_EQUAL(LoadFromDb(db, problem, "solver1"), "");
+
+    CHECK(snapshot.Update(problem, "solver2", Values{"d"}));
+    db.writes = 0;
+    CHECK(snapshot.Flush());
+    EXPECT_EQUAL(LoadFromDb(db, problem, "solver0"), "");
+    EXPECT_EQUAL(LoadFromDb(db, problem, "solver1"), "c");
+    EXPECT_EQUAL(LoadFromDb(db, problem, "solver2"), "d");
+    EXPECT_EQUAL(db.finds, 1);
+    // The updates are written as one record.
+    EXPECT_EQUAL(db.writes, 1);
+
+    // Other problems are not touched.
+    EXPECT_EQUAL(LoadFromDb(db, Problem{1}, "solver1"), "");
+}
+
+static void FailedRemove()
+{
+    const miopen::TempFile file{"miopen.test.perf_db_snapshot"};
+    CountingDb db{file};
+    const Problem problem{3};
+    db.Update(problem, "solver0", Values{"a"});
+
+    miopen::PerfDbSnapshot<CountingDb, Problem> snapshot{db, problem};
+    CHECK(snapshot.Remove(problem, "solver0"));
+    // Removed behind the back of the snapshot, its own remove fails.
+    CHECK(db.Remove(problem, "solver0"));
+    CHECK(!snapshot.Flush());
+    // Nothing is left to write.
+    CHECK(snapshot.Flush());
+}
+
+static void FlushOnThrow()
+{
+    const miopen::TempFile file{"miopen.test.perf_db_snapshot"};
+    CountingDb db{file};
+    const Problem problem{4};
+
+    try
+    {
+        miopen::PerfDbSnapshot<CountingDb, Problem> snapshot{db, problem};
+        CHECK(snapshot.Update(problem, "solver0", Values{"a"}));
+        throw std::runtime_error("solver failed");
+    }
+    catch(const std::runtime_error&)
+    {
+    }
+
+    EXPECT_EQUAL(LoadFromDb(db, problem, "solver0"), "a");
+}
+
+int main()
+{
+    ReadOnce();
+    StagedWrites();
+    FailedRemove();
+    FlushOnThrow();
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#include "test.hpp"
+#include <miopen/philox.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+static std::vector<std::uint32_t>
+Block(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter)
+{
+    std::uint32_t out[miopen::Philox4x32::lanes][miopen::Philox4x32::batch];
+    miopen::Philox4x32{seed, stream}.Generate(counter, 1, out);
+    return {out[0][0], out[1][0], out[2][0], out[3][0]};
+}
+
+// Known answers of the Random123 reference implementation.
+static void KnownAnswers()
+{
+    EXPECT(Block(0, 0, 0) ==
+           std::vector<std::uint32_t>({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT(Block(~0ull, ~0ull, ~0ull) ==
+           std::vector<std::uint32_t>({0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT(Block(0x299f31d0a4093822ull, 0x0370734413198a2eull, 0x85a308d3243f6a88ull) ==
+           std::vector<std::uint32_t>({0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+static void FillIsIndependentOfSplit()
+{
+    const miopen::Philox4x32 rng{42, 3};
+    const auto identity = [](float u) { return u; };
+    const std::size_t n = 300001;
+
+    std::vector<float> expected(n);
+    for(std::size_t i = 0; i < n; i++)
+        expected[i] = rng.Uniform(i);
+
+    std::vector<float> serial(n);
+    miopen::RandomFill(rng, serial.data(), n, identity);
+    EXPECT(serial == expected);
+
+    std::vector<float> parallel(n);
+    miopen::ParRandomFill(rng, parallel.data(), n, identity);
+    EXPECT(parallel == expected);
+
+    // Unaligned pieces, which start and end within a counter.
+    std::vector<float> pieces(n);
+    for(std::size_t begin = 0, len = 1; begin < n; begin += len, len = len * 3 + 1)
+    {
+        const auto count = std::min(len, n - begin);
+        miopen::RandomFill(rng, pieces.data() + begin, count, identity, begin);
+    }
+    EXPECT(pieces == expected);
+
+    EXPECT(std::all_of(expected.begin(), expected.end(), [](float u) { return u >= 0 && u < 1; }));
+}
+
+static void StreamsDiffer()
+{
+    const auto a = miopen::Philox4x32{7, 0}.Uniform(5);
+    EXPECT(a == miopen::Philox4x32{7, 0}.Uniform(5));
+    EXPECT(a != miopen::Philox4x32{7, 1}.Uniform(5));
+    EXPECT(a != miopen::Philox4x32{8, 0}.Uniform(5));
+}
+
+int main()
+{
+    KnownAnswers();
+    FillIsIndependentOfSplit();
+    StreamsDiffer();
+}
@@ -46,6 +46,7 @@
 #include "tensor_holder.hpp"
 #include "verify.hpp"
 #include "cpu_conv.hpp"
+#include "cpu_pooling.hpp"
 
 #define TEST_PADDING_MODE 0
 
@@ -61,41 +62,10 @@ tensor<T> get_output_tensor(const miopen::PoolingDescriptor& filter, const tenso
     return tensor<T>{filter.GetForwardOutputTensor(input.desc)};
 }
 
-template <class T>
-struct pooling_operators
+inline cpu_pooling_params get_cpu_pooling_params(const miopen::PoolingDescriptor& filter)
 {
-    miopen::PoolingDescriptor filter;
-    pooling_operators(miopen::PoolingDescriptor f) : filter(f) {}
-
-    double start() const
-    {
-        if(filter.GetMode() == miopenPoolingMax)
-            return std::numeric_limits<T>::lowest();
-        else
-            return 0.0;
-    }
-
-    double operator()(double x, double y) const
-    {
-        if(filter.GetMode() == miopenPoolingMax)
-        {
-            double m = std::max(x, y);
-            return (m);
-        }
-        else
-            return x + y;
-    }
-
-    double final(double x, double y)
-    {
-        if(filter.GetMode() == miopenPoolingMax)
-        {
-            return (x);
-        }
-        else
-            return x / y;
-    }
-};
+    return {filter.GetMode(), filter.GetLengths(), filter.GetStrides(), filter.GetPads()};
+}
 
 template <int SptDim>
 struct verify_forward_pooling
@@ -105,66 +75,11 @@ struct verify_forward_pooling
     cpu(const tensor<T>& input, const miopen::PoolingDescriptor& filter, std::vector<Index>&) const
     {
         auto out = get_output_tensor(filter, input);
-
-        std::array<int, SptDim> in_dim{};
-        std::copy_n(input.desc.GetLengths().begin() + 2, SptDim, in_dim.begin());
-        std::array<int, SptDim> strides{};
-        std::copy_n(filter.GetStrides().begin(), SptDim, strides.begin());
-        std::array<int, SptDim> pads{};
-        std::copy_n(filter.GetPads().begin(), SptDim, pads.begin());
-        std::array<int, SptDim> kers{};
-        std::copy_n(filter.GetLengths().begin(), SptDim, kers.begin());
-        auto op = pooling_operators<T>{filter};
-
-        int b_n = out.desc.GetLengths()[0];
-        int k_n = out.desc.GetLengths()[1];
-        std::array<int, SptDim> out_spatial_len{};
-        std::copy_n(out.desc.GetLengths().begin() + 2, SptDim, out_spatial_len.begin());
-
-        auto par_ford_out =
-            miopen::unpacker(miopen::prepender(par_ford, b_n, k_n))(out_spatial_len);
-
-        par_ford_out([&](int o, int w, auto... out_spatial_id_pack) {
-            auto out_spatial_id = make_array(out_spatial_id_pack...);
-
-            std::array<int, SptDim> start_idx{};
-            std::array<int, SptDim> win_sz{};
-            for(int i = 0; i < SptDim; ++i)
-            {
-                start_idx[i] = out_spatial_id[i] * strides[i] - pads[i];
-                int end_idx  = start_idx[i] + kers[i];
-                end_idx      = std::min(end_idx, in_dim[i]);
-                start_idx[i] = std::max(start_idx[i], 0);
-                win_sz[i]    = end_idx - start_idx[i];
-                win_sz[i]    = std::max(win_sz[i], 1);
-            }
-
-            int pool_size =
-                filter.GetMode() == miopenPoolingAverageInclusive
-                    ? std::accumulate(kers.begin(), kers.end(), 1, std::multiplies<int>())
-                    : std::accumulate(win_sz.begin(), win_sz.end(), 1, std::multiplies<int>());
-
-            double acc = op.start();
-            miopen::unpacker(ford)(win_sz)([&](auto... in_spatial_id_pack) {
-                auto in_spatial_id = make_array(in_spatial_id_pack...);
-                std::array<std::size_t, SptDim + 2> idx{};
-                idx[0] = o;
-                idx[1] = w;
-
-                bool in_cmp_idx = true;
-                for(int i = 0; i < SptDim; ++i)
-                {
-                    idx[i + 2] = start_idx[i] + in_spatial_id[i];
-                    in_cmp_idx &= (in_dim[i] > idx[i + 2]);
-                }
-
-                if(in_cmp_idx)
-                {
-                    acc = op(acc, input(idx));
-                }
-            });
-            out(o, w, out_spatial_id_pack...) = T(op.final(acc, pool_size));
-        });
+        cpu_pooling_forward(get_cpu_pooling_params(filter),
+                            nc_view(input.desc),
+                            input.data.data(),
+                            nc_view(out.desc),
+                            out.data.data());
         return out;
     }
 
@@ -237,19 +152,15 @@ struct verify_backward_pooling
                   bool verify_index) const
     {
         auto dinput = input;
-        std::vector<T> din_vec(input.desc.GetElementSpace(), T(0));
         CHECK(dout.desc == out.desc);
         std::array<int, SptDim + 2> in_dim{};
         std::copy_n(input.desc.GetLengths().begin(), SptDim + 2, in_dim.begin());
-        std::array<int, SptDim + 2> in_str{};
-        std::copy_n(input.desc.GetStrides().begin(), SptDim + 2, in_str.begin());
         std::array<int, SptDim> strides{};
         std::copy_n(filter.GetStrides().begin(), SptDim, strides.begin());
         std::array<int, SptDim> pads{};
         std::copy_n(filter.GetPads().begin(), SptDim, pads.begin());
         std::array<int, SptDim> kers{};
         std::copy_n(filter.GetLengths().begin(), SptDim, kers.begin());
-        auto ford_ker = miopen::unpacker(ford)(kers);
 
         int out_n = out.desc.GetLengths()[0];
         int out_c = out.desc.GetLengths()[1];
@@ -257,11 +168,16 @@ struct verify_backward_pooling
         std::copy_n(out.desc.GetLengths().begin() + 2, SptDim, out_spatial_len.begin());
         auto ford_out = miopen::unpacker(ford)(out_spatial_len);
 
-        par_ford(out_n, out_c)([&](int o, int w) {
-            if(filter.GetMode() == miopenPoolingMax)
-            {
+        // Position of the maximum of every output in its input plane, decoded from the indices
+        // written by the GPU.
+        std::vector<std::size_t> argmax;
+        if(filter.GetMode() == miopenPoolingMax)
+        {
+            argmax.resize(dout.desc.GetElementSpace(), cpu_pooling_no_index);
+            par_ford(out_n, out_c)([&](int o, int w) {
                 ford_out([&](auto... out_spatial_id_pack) {
-                    auto mx_idx = indices.at(dout.desc.GetIndex(o, w, out_spatial_id_pack...));
+                    const auto dout_idx = dout.desc.GetIndex(o, w, out_spatial_id_pack...);
+                    auto mx_idx         = indices.at(dout_idx);
                     std::array<std::size_t, SptDim + 2> idx{};
                     bool in_cmp_idx = true;
                     if(use_global_index)
@@ -304,74 +220,21 @@ struct verify_backward_pooling
                             CHECK(
                                 miopen::float_equal(input(idx), out(o, w, out_spatial_id_pack...)));
                         }
-                        std::size_t din_idx = 0;
-                        for(int i = 0; i < SptDim + 2; i++)
-                        {
-                            din_idx += idx[i] * in_str[i];
-                        }
-                        din_vec.at(din_idx) += dout(o, w, out_spatial_id_pack...);
-                    }
-                });
-            }
-            else
-            {
-                ford_out([&](auto... out_spatial_id_pack) {
-                    auto out_spatial_id = make_array(out_spatial_id_pack...);
-
-                    std::array<int, SptDim> start_idx{};
-                    std::array<int, SptDim> win_sz{};
-                    for(int i = 0; i < SptDim; ++i)
-                    {
-                        start_idx[i] = out_spatial_id[i] * strides[i] - pads[i];
-                        int end_idx  = start_idx[i] + kers[i];
-                        end_idx      = std::min(end_idx, in_dim[i + 2]);
-                        win_sz[i]    = end_idx - std::max(start_idx[i], 0);
-                        win_sz[i]    = std::max(win_sz[i], 1);
+                        std::size_t plane_idx = 0;
+                        for(int i = 0; i < SptDim; i++)
+                            plane_idx = plane_idx * in_dim[i + 2] + idx[i + 2];
+                        argmax[dout_idx] = plane_idx;
                     }
-
-                    int pool_size =
-                        filter.GetMode() == miopenPoolingAverageInclusive
-                            ? std::accumulate(kers.begin(), kers.end(), 1, std::multiplies<int>())
-                            : std::accumulate(
-                                  win_sz.begin(), win_sz.end(), 1, std::multiplies<int>());
-
-                    ford_ker([&](auto... ker_id_pack) {
-                        auto ker_id = make_array(ker_id_pack...);
-
-                        bool in_cmp_idx = true;
-                        std::array<int, SptDim + 2> in_idx{};
-                        in_idx[0] = o;
-                        in_idx[1] = w;
-                        for(int i = 0; i < SptDim; ++i)
-                        {
-                            in_idx[i + 2] = start_idx[i] + ker_id[i];
-                            in_cmp_idx &= (in_dim[i + 2] > in_idx[i + 2] && in_idx[i + 2] >= 0);
-                        }
-
-                        if(in_cmp_idx)
-                        {
-                            std::size_t din_idx = 0;
-                            for(int i = 0; i < SptDim + 2; i++)
-                            {
-                                din_idx += in_idx[i] * in_str[i];
-                            }
-
-                            din_vec.at(din_idx) += dout(o, w, out_spatial_id_pack...) / pool_size;
-                        }
-                    });
                 });
-            }
-        });
+            });
+        }
 
-        miopen::unpacker(ford)(in_dim)([&](auto... in_id_pack) {
-            auto in_id          = make_array(in_id_pack...);
-            std::size_t din_idx = 0;
-            for(int i = 0; i < SptDim + 2; i++)
-            {
-                din_idx += in_id[i] * in_str[i];
-            }
-            dinput(in_id_pack...) = din_vec.at(din_idx);
-        });
+        cpu_pooling_backward(get_cpu_pooling_params(filter),
+                             nc_view(dout.desc),
+                             dout.data.data(),
+                             nc_view(dinput.desc),
+                             dinput.data.data(),
+                             argmax.data());
         return dinput;
     }
 
@@ -0,0 +1,255 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/rnn_plan.hpp>
+
+#include <algorithm>
+
+using miopen::RNNPlanBuffer;
+using miopen::RNNPlanKey;
+using miopen::RNNPlanPass;
+
+static RNNPlanKey MakeKey(RNNPlanPass pass,
+                          miopenRNNMode_t mode,
+                          bool bidirectional,
+                          int layers,
+                          int in_h,
+                          int hy_h,
+                          std::vector<int> in_n,
+                          bool batched_gemm = false)
+{
+    const int hidden_tensors  = mode == miopenLSTM ? 4 : mode == miopenGRU ? 3 : 1;
+    const int workspace_scale = mode == miopenLSTM ? 6 : mode == miopenGRU ? 4 : 1;
+    const int hy_n            = *std::max_element(in_n.begin(), in_n.end());
+    return {pass,
+            mode,
+            bidirectional,
+            layers,
+            hidden_tensors,
+            workspace_scale,
+            miopenFloat,
+            in_h,
+            hy_h,
+            hy_n,
+            std::move(in_n),
+            batched_gemm};
+}
+
+// The GEMM records have to be stored in the order the pass visits the cells.
+static void CheckOrder(const miopen::RNNLaunchPlan& plan)
+{
+    const bool backward = plan.key.pass == RNNPlanPass::BackwardData;
+    std::size_t next    = 0;
+    for(int l = 0; l < plan.key.layers; l++)
+    {
+        for(int t = 0; t < plan.seq_len; t++)
+        {
+            for(int ri = 0; ri < plan.bi; ri++)
+            {
+                const int li     = backward ? plan.key.layers - 1 - l : l;
+                const int ti     = backward ? plan.seq_len - 1 - t : t;
+                const auto& step = plan.Step(li, ti, ri);
+                EXPECT_EQUAL(step.gemm_begin, next);
+                EXPECT(step.gemm_end >= step.gemm_begin);
+                next = step.gemm_end;
+            }
+        }
+    }
+    EXPECT_EQUAL(next, plan.gemms.size());
+}
+
+static void ForwardUnidirectional()
+{
+    const auto plan = miopen::BuildRNNLaunchPlan(
+        MakeKey(RNNPlanPass::ForwardInference, miopenRNNTANH, false, 2, 8, 16, {4, 3, 3, 1}));
+    CheckOrder(plan);
+
+    EXPECT_EQUAL(plan.batch_n, 11);
+    EXPECT_EQUAL(plan.hy_stride, 16);
+    EXPECT_EQUAL(plan.hid_off, 0);
+    // One GEMM per cell: from hx at the first time step, from the previous one afterwards.
+    EXPECT(plan.gemms.size() == 8);
+
+    const auto& first = plan.gemms[0];
+    EXPECT(first.a == RNNPlanBuffer::Hx);
+    EXPECT_EQUAL(first.a_offset, 0);
+    EXPECT_EQUAL(first.b_offset, 8 * 16);
+    EXPECT_EQUAL(first.c_offset, 0);
+    EXPECT_EQUAL(first.desc.m, 4);
+    EXPECT_EQUAL(first.desc.n, 16);
+    EXPECT_EQUAL(first.desc.k, 16);
+    EXPECT(first.desc.transB);
+
+    const auto& step = plan.Step(0, 1, 0);
+    EXPECT_EQUAL(step.cur_time, 1);
+    EXPECT_EQUAL(step.offset, 4 * 16);
+    const auto& gemm = plan.gemms[step.gemm_begin];
+    EXPECT(step.gemm_end - step.gemm_begin == 1);
+    EXPECT(gemm.a == RNNPlanBuffer::Work);
+    EXPECT_EQUAL(gemm.a_offset, 0);
+    EXPECT_EQUAL(gemm.c_offset, 4 * 16);
+    EXPECT_EQUAL(gemm.desc.m, 3);
+    EXPECT_EQUAL(gemm.desc.lda, 16);
+
+    EXPECT_EQUAL(plan.Step(0, 3, 0).offset, 10 * 16);
+    EXPECT_EQUAL(plan.gemms[plan.Step(0, 3, 0).gemm_begin].desc.m, 1);
+
+    // The second layer reads its own part of hx and of the weights.
+    const auto& layer1 = plan.gemms[plan.Step(1, 0, 0).gemm_begin];
+    EXPECT_EQUAL(layer1.a_offset, 4 * 16);
+    EXPECT_EQUAL(layer1.b_offset, 8 * 16 + 32 * 16);
+    EXPECT_EQUAL(layer1.c_offset, 11 * 16);
+}
+
+static void ForwardBidirectional()
+{
+    const auto plan = miopen::BuildRNNLaunchPlan(
+        MakeKey(RNNPlanPass::ForwardInference, miopenLSTM, true, 1, 5, 4, {3, 2, 2, 1}));
+    CheckOrder(plan);
+
+    EXPECT_EQUAL(plan.hy_stride, 48);
+    EXPECT_EQUAL(plan.wei_len, 16);
+    EXPECT_EQUAL(plan.hid_off, 40);
+    EXPECT(plan.gemms.size() == 10);
+    EXPECT_EQUAL(std::count_if(plan.gemms.begin(),
+                               plan.gemms.end(),
+                               [](auto&& g) { return g.a == RNNPlanBuffer::Hx; }),
+                 4);
+
+    // The reverse direction moves from 1 to 2 sequences, the new one starts from hx.
+    const auto& step = plan.Step(0, 1, 1);
+    EXPECT_EQUAL(step.cur_time, 2);
+    EXPECT_EQUAL(step.use_time, 3);
+    EXPECT_EQUAL(step.offset, 5 * 48);
+    EXPECT(step.gemm_end - step.gemm_begin == 2);
+
+    const auto& from_hx = plan.gemms[step.gemm_begin];
+    EXPECT(from_hx.a == RNNPlanBuffer::Hx);
+    EXPECT_EQUAL(from_hx.desc.m, 1);
+    EXPECT_EQUAL(from_hx.a_offset, 3 * 4 + 4);
+    EXPECT_EQUAL(from_hx.c_offset, 5 * 48 + 16 + 48);
+
+    const auto& from_prev = plan.gemms[step.gemm_begin + 1];
+    EXPECT(from_prev.a == RNNPlanBuffer::Work);
+    EXPECT_EQUAL(from_prev.desc.m, 1);
+    EXPECT_EQUAL(from_prev.a_offset, 7 * 48 + 40 + 4);
+    EXPECT_EQUAL(from_prev.c_offset, 5 * 48 + 16);
+}
+
+static void ForwardTraining()
+{
+    const auto plan = miopen::BuildRNNLaunchPlan(
+        MakeKey(RNNPlanPass::ForwardTraining, miopenRNNRELU, false, 2, 8, 16, {4, 3, 3, 1}));
+    CheckOrder(plan);
+    // Vanilla RNN training stores the activations after all pre-activations.
+    EXPECT_EQUAL(plan.hid_off, 2 * 11 * 16);
+    EXPECT_EQUAL(plan.gemms[plan.Step(0, 1, 0).gemm_begin].a_offset, 2 * 11 * 16);
+}
+
+static void BackwardData()
+{
+    const auto plan = miopen::BuildRNNLaunchPlan(
+        MakeKey(RNNPlanPass::BackwardData, miopenRNNTANH, false, 1, 8, 16, {4, 3, 3, 1}));
+    CheckOrder(plan);
+
+    // The last time step has no successor to propagate from.
+    EXPECT(plan.gemms.size() == 3);
+    EXPECT(plan.Step(0, 3, 0).gemm_end - plan.Step(0, 3, 0).gemm_begin == 0);
+    EXPECT_EQUAL(plan.gemms[0].desc.m, 1);
+    EXPECT_EQUAL(plan.gemms[2].desc.m, 3);
+
+    const auto& gemm = plan.gemms[2];
+    EXPECT(!gemm.desc.transB);
+    EXPECT_EQUAL(gemm.desc.n, 16);
+    EXPECT_EQUAL(gemm.desc.k, 16);
+    EXPECT_EQUAL(gemm.a_offset, 4 * 16);
+    EXPECT_EQUAL(gemm.b_offset, 8 * 16);
+    EXPECT_EQUAL(gemm.c_offset, 0);
+}
+
+static void ForwardBatched()
+{
+    const auto plan = miopen::BuildRNNLaunchPlan(
+        MakeKey(RNNPlanPass::ForwardInference, miopenLSTM, true, 1, 5, 4, {2, 2, 2}, true));
+    CheckOrder(plan);
+
+    // Both directions of the first two time steps share one launch, the last one does not
+    // have a common stride direction.
+    EXPECT(plan.gemms.size() == 4);
+    EXPECT(plan.Step(0, 0, 1).gemm_end == plan.Step(0, 0, 1).gemm_begin);
+    EXPECT(plan.Step(0, 2, 1).gemm_end - plan.Step(0, 2, 1).gemm_begin == 1);
+
+    const auto& from_hx = plan.gemms[plan.Step(0, 0, 0).gemm_begin];
+    EXPECT(from_hx.a == RNNPlanBuffer::Hx);
+    EXPECT_EQUAL(from_hx.desc.batch_count, 2);
+    EXPECT_EQUAL(from_hx.a_offset, 0);
+    EXPECT_EQUAL(from_hx.c_offset, 0);
+    EXPECT_EQUAL(from_hx.desc.strideA, 2 * 4);
+    EXPECT_EQUAL(from_hx.desc.strideB, 16 * 4);
+    EXPECT_EQUAL(from_hx.desc.strideC, 4 * 48 + 16);
+
+    const auto& from_prev = plan.gemms[plan.Step(0, 1, 0).gemm_begin];
+    EXPECT(from_prev.a == RNNPlanBuffer::Work);
+    EXPECT_EQUAL(from_prev.desc.batch_count, 2);
+    EXPECT_EQUAL(from_prev.a_offset, 40);
+    EXPECT_EQUAL(from_prev.desc.strideA, 4 * 48 + 4);
+    EXPECT_EQUAL(from_prev.desc.strideC, 16);
+
+    EXPECT_EQUAL(plan.gemms[plan.Step(0, 2, 0).gemm_begin].desc.batch_count, 1);
+
+    // The backward pass keeps the directions apart.
+    const auto backward = miopen::BuildRNNLaunchPlan(
+        MakeKey(RNNPlanPass::BackwardData, miopenLSTM, true, 1, 5, 4, {2, 2, 2}, true));
+    CheckOrder(backward);
+    EXPECT(std::all_of(backward.gemms.begin(), backward.gemms.end(), [](auto&& g) {
+        return g.desc.batch_count == 1;
+    }));
+}
+
+static void Cache()
+{
+    const auto key =
+        MakeKey(RNNPlanPass::ForwardInference, miopenGRU, true, 2, 8, 16, {2, 2, 1});
+
+    const auto plan = miopen::GetRNNLaunchPlan(key);
+    EXPECT(plan == miopen::GetRNNLaunchPlan(key));
+    EXPECT(plan->key == key);
+
+    auto other = key;
+    other.in_n = {2, 1, 1};
+    EXPECT(plan != miopen::GetRNNLaunchPlan(other));
+}
+
+int main()
+{
+    ForwardUnidirectional();
+    ForwardBidirectional();
+    ForwardTraining();
+    BackwardData();
+    ForwardBatched();
+    Cache();
+}
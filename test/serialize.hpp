@@ -61,6 +61,14 @@ auto serialize(std::ostream& os, const T& x)
         serialize(os, y);
 }
 
+template <class T>
+std::enable_if_t<is_trivial_serializable<T>{}> serialize(std::ostream& os, const std::vector<T>& x)
+{
+    std::size_t n = x.size();
+    serialize(os, n);
+    os.write(reinterpret_cast<const char*>(x.data()), sizeof(T) * n);
+}
+
 template <class... Ts>
 std::enable_if_t<not is_trivial_serializable<std::tuple<Ts...>>{}>
 serialize(std::ostream& os, const std::tuple<Ts...>& t)
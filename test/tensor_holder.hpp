@@ -28,11 +28,13 @@
 
 #include "ford.hpp"
 #include "network_data.hpp"
+#include "serialize.hpp"
 #include <miopen/tensor.hpp>
 #include <miopen/functional.hpp>
 #include <miopen/type_name.hpp>
 #include <miopen/each_args.hpp>
 #include <miopen/bfloat16.hpp>
+#include <miopen/philox.hpp>
 
 #include <half.hpp>
 #include <iomanip>
@@ -117,6 +119,11 @@ struct tensor
     {
     }
 
+    tensor(const miopen::TensorDims& dims)
+        : desc(miopen_type<T>{}, dims), data(desc.GetElementSize())
+    {
+    }
+
     template <class X>
     tensor(const std::vector<X>& dims, const std::vector<X>& strides)
         : desc(miopen_type<T>{}, dims, strides), data(desc.GetElementSize())
@@ -124,6 +131,12 @@ struct tensor
         assert(dims.size() == strides.size());
     }
 
+    tensor(const miopen::TensorDims& dims, const miopen::TensorDims& strides)
+        : desc(miopen_type<T>{}, dims, strides), data(desc.GetElementSize())
+    {
+        assert(dims.size() == strides.size());
+    }
+
     tensor(std::size_t n, std::size_t c, std::size_t h, std::size_t w)
         : desc(miopen_type<T>{}, {n, c, h, w}), data(n * c * h * w)
     {
@@ -158,8 +171,21 @@ struct tensor
         return std::move(*this);
     }
 
-    template <class G>
-    void generate_impl(G g)
+    /// Fills the tensor with values uniformly distributed in [min_val, max_val) on all host
+    /// threads. Like generate(), the values only depend on the lengths of the tensor.
+    tensor& generate_random(double min_val, double max_val) &
+    {
+        this->generate_random_impl(min_val, max_val);
+        return *this;
+    }
+
+    tensor&& generate_random(double min_val, double max_val) &&
+    {
+        this->generate_random_impl(min_val, max_val);
+        return std::move(*this);
+    }
+
+    std::size_t generate_seed() const
     {
         auto seed = std::accumulate(desc.GetLengths().begin(),
                                     desc.GetLengths().end(),
@@ -170,7 +196,21 @@ struct tensor
                                     });
         seed ^= data.size();
         seed ^= desc.GetLengths().size();
-        std::srand(seed);
+        return seed;
+    }
+
+    void generate_random_impl(double min_val, double max_val)
+    {
+        miopen::ParRandomFill(
+            miopen::Philox4x32{generate_seed()}, data.data(), data.size(), [=](float u) {
+                return miopen::cast_to<T>()(min_val + (max_val - min_val) * u);
+            });
+    }
+
+    template <class G>
+    void generate_impl(G g)
+    {
+        std::srand(generate_seed());
         auto iterator = data.begin();
         auto assign   = [&](T x) {
             assert(iterator < data.end());
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tmp_dir.hpp>
+
+#include "test.hpp"
+#include "verification_cache.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <tuple>
+#include <vector>
+
+static std::vector<float> make_data(std::size_t n, bool compressible)
+{
+    std::vector<float> v(n);
+    for(std::size_t i = 0; i < n; i++)
+        v[i] = compressible ? float(i % 7) : float((i * 2654435761u) % 1000003) / 3.0f;
+    return v;
+}
+
+static verification_cache make_cache(const miopen::TmpDir& tmp)
+{
+    verification_cache cache;
+    cache.dir        = tmp.path;
+    cache.chunk_size = 1000; // several chunks, not a multiple of sizeof(float)
+    return cache;
+}
+
+void check_round_trip(bool compress, bool compressible)
+{
+    miopen::TmpDir tmp{"verification_cache"};
+    auto cache     = make_cache(tmp);
+    cache.compress = compress;
+
+    const auto data = make_data(12345, compressible);
+    const auto tup  = std::make_tuple(data, std::vector<double>{1.0, 2.0}, 42);
+    cache.save("vector", data);
+    cache.save("tuple", tup);
+    EXPECT(cache.contains("vector"));
+    EXPECT(!cache.contains("missing"));
+
+    std::vector<float> data_out;
+    EXPECT(cache.load("vector", data_out));
+    EXPECT(data_out == data);
+
+    decltype(std::make_tuple(data, std::vector<double>{}, 0)) tup_out;
+    EXPECT(cache.load("tuple", tup_out));
+    EXPECT(tup_out == tup);
+
+    std::vector<float> none;
+    EXPECT(!cache.load("missing", none));
+
+    if(compress && compressible)
+        EXPECT(boost::filesystem::file_size(cache.entry_path("vector")) <
+               data.size() * sizeof(float));
+}
+
+void check_empty()
+{
+    miopen::TmpDir tmp{"verification_cache"};
+    auto cache = make_cache(tmp);
+    cache.save("empty", std::vector<float>{});
+    std::vector<float> out{1.0f};
+    EXPECT(cache.load("empty", out));
+    EXPECT(out.empty());
+}
+
+void check_corrupt()
+{
+    miopen::TmpDir tmp{"verification_cache"};
+    auto cache      = make_cache(tmp);
+    const auto data = make_data(4096, false);
+    cache.save("entry", data);
+
+    // Old-format or truncated entries must be reported as misses, not crash.
+    const auto size = boost::filesystem::file_size(cache.entry_path("entry"));
+    boost::filesystem::resize_file(cache.entry_path("entry"), size / 2);
+    std::vector<float> out;
+    EXPECT(!cache.load("entry", out));
+
+    {
+        std::ofstream os{cache.entry_path("entry").string()};
+        os << "garbage";
+    }
+    EXPECT(!cache.load("entry", out));
+}
+
+void check_eviction()
+{
+    miopen::TmpDir tmp{"verification_cache"};
+    auto cache      = make_cache(tmp);
+    const auto data = make_data(1024, false);
+
+    cache.save("a", data);
+    const auto entry_size = boost::filesystem::file_size(cache.entry_path("a"));
+    cache.max_size        = 2 * entry_size + entry_size / 2;
+
+    boost::filesystem::last_write_time(cache.entry_path("a"), 1000);
+    cache.save("b", data);
+    boost::filesystem::last_write_time(cache.entry_path("b"), 2000);
+
+    // Touching "a" makes "b" the least recently used entry.
+    std::vector<float> out;
+    EXPECT(cache.load("a", out));
+    cache.save("c", data);
+
+    EXPECT(cache.contains("a"));
+    EXPECT(!cache.contains("b"));
+    EXPECT(cache.contains("c"));
+
+    // No temporary files are left behind.
+    std::size_t files = 0;
+    for(boost::filesystem::directory_iterator it{tmp.path}, end; it != end; ++it)
+        files++;
+    EXPECT(files == 2);
+}
+
+int main()
+{
+    check_round_trip(false, false);
+    check_round_trip(true, false);
+    check_round_trip(true, true);
+    check_empty();
+    check_corrupt();
+    check_eviction();
+}
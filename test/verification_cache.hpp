@@ -0,0 +1,448 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef MIOPEN_GUARD_TEST_VERIFICATION_CACHE_HPP
+#define MIOPEN_GUARD_TEST_VERIFICATION_CACHE_HPP
+
+#include "serialize.hpp"
+
+#include <miopen/bz2.hpp>
+#include <miopen/par_for.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// On-disk layout of a verification cache entry:
+//
+//   verification_cache_header
+//   verification_cache_chunk[chunk_count]
+//   padding up to verification_cache_alignment
+//   chunk data, stored back-to-back
+//
+// The payload is the output of serialize(std::ostream&, x). Chunks that do not compress are
+// stored as is, so an entry written without compression is a single contiguous, aligned
+// region that is read straight out of the memory mapping.
+
+constexpr std::uint32_t verification_cache_format  = 1;
+constexpr std::size_t verification_cache_alignment = 64;
+
+struct verification_cache_header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t chunk_count;
+    std::uint64_t payload_size;
+    std::uint64_t chunk_size;
+};
+
+struct verification_cache_chunk
+{
+    std::uint64_t offset;
+    std::uint64_t stored_size;
+    std::uint64_t raw_size;
+    std::uint64_t compressed;
+};
+
+inline const char* verification_cache_magic() { return "MIOVCACH"; }
+
+// Read-only std::streambuf over a memory range, so that the mapped entry can be
+// deserialized without an intermediate copy.
+struct memory_streambuf : std::streambuf
+{
+    memory_streambuf(const char* begin, std::size_t size)
+    {
+        auto* p = const_cast<char*>(begin); // NOLINT
+        setg(p, p, p + size);
+    }
+};
+
+// Write-only std::streambuf that only counts the bytes put into it.
+struct counting_streambuf : std::streambuf
+{
+    std::uint64_t count = 0;
+
+    protected:
+    int_type overflow(int_type ch) override
+    {
+        if(!traits_type::eq_int_type(ch, traits_type::eof()))
+            count++;
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char*, std::streamsize n) override
+    {
+        count += n;
+        return n;
+    }
+};
+
+// Write-only std::streambuf that cuts the payload into chunks and writes every chunk to the
+// file, compressed if that helps, as soon as it is full. Only one chunk is held in memory.
+struct chunk_streambuf : std::streambuf
+{
+    std::vector<verification_cache_chunk> chunks;
+    std::uint64_t raw_size = 0;
+
+    chunk_streambuf(std::ostream& os_,
+                    std::size_t chunk_size_,
+                    bool compress_,
+                    std::uint64_t offset_)
+        : os(os_), chunk_size(chunk_size_), compress(compress_), offset(offset_)
+    {
+        buffer.reserve(chunk_size);
+    }
+
+    protected:
+    int_type overflow(int_type ch) override
+    {
+        if(traits_type::eq_int_type(ch, traits_type::eof()))
+            return traits_type::not_eof(ch);
+        const char c = traits_type::to_char_type(ch);
+        xsputn(&c, 1);
+        return ch;
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        auto left = static_cast<std::size_t>(n);
+        while(left > 0)
+        {
+            const auto take = std::min(left, chunk_size - buffer.size());
+            buffer.append(s, take);
+            s += take;
+            left -= take;
+            if(buffer.size() == chunk_size)
+                write_chunk();
+        }
+        return n;
+    }
+
+    int sync() override
+    {
+        if(!buffer.empty())
+            write_chunk();
+        return os.good() ? 0 : -1;
+    }
+
+    private:
+    std::ostream& os;
+    std::size_t chunk_size;
+    bool compress;
+    std::uint64_t offset;
+    std::string buffer;
+
+    void write_chunk()
+    {
+        verification_cache_chunk c{};
+        c.offset   = offset;
+        c.raw_size      = buffer.size();
+        std::string packed;
+        if(compress)
+        {
+            try
+            {
+                bool compressed = false;
+                packed          = miopen::compress(buffer, &compressed);
+                if(!compressed || packed.size() >= buffer.size())
+                    packed.clear();
+            }
+            catch(const std::exception&)
+            {
+                packed.clear();
+            }
+        }
+        const auto& stored = packed.empty() ? buffer : packed;
+        c.compressed       = packed.empty() ? 0 : 1;
+        c.stored_size      = stored.size();
+        os.write(stored.data(), stored.size());
+        chunks.push_back(c);
+        offset += c.stored_size;
+        raw_size += c.raw_size;
+        buffer.clear();
+    }
+};
+
+struct verification_cache
+{
+    boost::filesystem::path dir;
+    /// Size limit of the whole cache directory in bytes. 0 disables eviction.
+    std::uintmax_t max_size = 0;
+    /// Try to bz2-compress every chunk; incompressible chunks are still stored raw.
+    bool compress          = false;
+    std::size_t chunk_size = std::size_t{64} << 20;
+
+    boost::filesystem::path entry_path(const std::string& key) const { return dir / key; }
+
+    bool contains(const std::string& key) const
+    {
+        return boost::filesystem::exists(entry_path(key));
+    }
+
+    template <class T>
+    bool load(const std::string& key, T& x) const
+    {
+        const auto p = entry_path(key);
+        try
+        {
+            if(!boost::filesystem::exists(p) || boost::filesystem::file_size(p) == 0)
+                return false;
+
+            boost::interprocess::file_mapping file(p.string().c_str(),
+                                                   boost::interprocess::read_only);
+            boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+            const auto* base = static_cast<const char*>(region.get_address());
+            const auto size  = region.get_size();
+
+            std::vector<verification_cache_chunk> chunks;
+            if(!read_layout(base, size, chunks))
+                return false;
+
+            std::string unpacked;
+            const char* payload      = nullptr;
+            std::size_t payload_size = 0;
+            if(is_contiguous_raw(chunks))
+            {
+                payload = base + (chunks.empty() ? 0 : chunks.front().offset);
+                for(const auto& c : chunks)
+                    payload_size += c.raw_size;
+            }
+            else
+            {
+                std::vector<std::size_t> dst(chunks.size() + 1, 0);
+                for(std::size_t i = 0; i < chunks.size(); i++)
+                    dst[i + 1] = dst[i] + chunks[i].raw_size;
+                unpacked.resize(dst.back());
+                std::atomic<bool> ok{true};
+                miopen::par_for(chunks.size(), miopen::min_grain{1}, [&](std::size_t i) {
+                    const auto& c = chunks[i];
+                    try
+                    {
+                        std::string stored(base + c.offset, c.stored_size);
+                        if(c.compressed != 0)
+                            stored = miopen::decompress(stored, c.raw_size);
+                        if(stored.size() == c.raw_size)
+                            std::memcpy(&unpacked[dst[i]], stored.data(), stored.size());
+                        else
+                            ok = false;
+                    }
+                    catch(const std::exception&)
+                    {
+                        ok = false;
+                    }
+                });
+                if(!ok)
+                    return false;
+                payload      = unpacked.data();
+                payload_size = unpacked.size();
+            }
+
+            memory_streambuf buf{payload, payload_size};
+            std::istream is{&buf};
+            serialize(is, x);
+            if(is.fail())
+                return false;
+        }
+        catch(const std::exception&)
+        {
+            return false;
+        }
+
+        // Bump the modification time, the eviction is least-recently-used.
+        boost::system::error_code ec;
+        boost::filesystem::last_write_time(p, std::time(nullptr), ec);
+        return true;
+    }
+
+    /// Writes into a temporary file and renames it into place, so that concurrent
+    /// readers never observe a partially written entry. Failures are silently ignored:
+    /// the cache is an optimization only.
+    template <class T>
+    void save(const std::string& key, const T& x) const
+    {
+        // Counting pass first: the chunk table precedes the data, so its size must be known
+        // before the first chunk is written.
+        counting_streambuf counter;
+        {
+            std::ostream cs{&counter};
+            serialize(cs, x);
+        }
+        const std::uint64_t payload_size = counter.count;
+        const std::size_t chunk_count =
+            payload_size == 0 ? 0 : (payload_size + chunk_size - 1) / chunk_size;
+        const std::uint64_t data_begin = align(sizeof(verification_cache_header) +
+                                               chunk_count * sizeof(verification_cache_chunk));
+
+        verification_cache_header header{};
+        std::memcpy(header.magic, verification_cache_magic(), sizeof(header.magic));
+        header.version      = verification_cache_format;
+        header.chunk_count  = chunk_count;
+        header.payload_size = payload_size;
+        header.chunk_size   = chunk_size;
+
+        const auto p   = entry_path(key);
+        const auto tmp = dir / boost::filesystem::unique_path(key + ".tmp-%%%%-%%%%-%%%%");
+        boost::system::error_code ec;
+        {
+            std::ofstream os{tmp.string().c_str(), std::ios::binary};
+            os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            const std::string padding(data_begin - sizeof(header), 0);
+            os.write(padding.data(), padding.size());
+            chunk_streambuf writer{os, chunk_size, compress, data_begin};
+            {
+                std::ostream ws{&writer};
+                serialize(ws, x);
+                ws.flush();
+            }
+            // serialize() must produce the same bytes twice, anything else is a broken entry.
+            if(writer.chunks.size() != chunk_count || writer.raw_size != payload_size)
+                os.setstate(std::ios::failbit);
+            os.seekp(sizeof(header));
+            os.write(reinterpret_cast<const char*>(writer.chunks.data()),
+                     writer.chunks.size() * sizeof(verification_cache_chunk));
+            if(!os.good())
+            {
+                os.close();
+                boost::filesystem::remove(tmp, ec);
+                return;
+            }
+        }
+        boost::filesystem::rename(tmp, p, ec);
+        if(ec)
+        {
+            boost::filesystem::remove(tmp, ec);
+            return;
+        }
+        evict();
+    }
+
+    /// Removes the least recently used entries until the cache fits into max_size.
+    /// Entries may be removed concurrently by other processes, all errors are ignored.
+    void evict() const
+    {
+        if(max_size == 0)
+            return;
+
+        struct entry
+        {
+            boost::filesystem::path path;
+            std::time_t time;
+            std::uintmax_t size;
+        };
+        std::vector<entry> entries;
+        std::uintmax_t total = 0;
+        boost::system::error_code ec;
+        for(boost::filesystem::directory_iterator it{dir, ec}, end; !ec && it != end;
+            it.increment(ec))
+        {
+            const auto& path = it->path();
+            if(!boost::filesystem::is_regular_file(path, ec) ||
+               path.filename().string().find(".tmp-") != std::string::npos)
+                continue;
+            const auto size = boost::filesystem::file_size(path, ec);
+            const auto time = boost::filesystem::last_write_time(path, ec);
+            if(ec)
+                continue;
+            entries.push_back({path, time, size});
+            total += size;
+        }
+        if(total <= max_size)
+            return;
+
+        std::sort(entries.begin(), entries.end(), [](const entry& l, const entry& r) {
+            return l.time < r.time;
+        });
+        for(const auto& e : entries)
+        {
+            if(total <= max_size)
+                break;
+            boost::filesystem::remove(e.path, ec);
+            total -= e.size;
+        }
+    }
+
+    private:
+    static std::uint64_t align(std::uint64_t x)
+    {
+        return (x + verification_cache_alignment - 1) / verification_cache_alignment *
+               verification_cache_alignment;
+    }
+
+    static bool read_layout(const char* base,
+                            std::size_t size,
+                            std::vector<verification_cache_chunk>& chunks)
+    {
+        verification_cache_header header{};
+        if(size < sizeof(header))
+            return false;
+        std::memcpy(&header, base, sizeof(header));
+        if(std::memcmp(header.magic, verification_cache_magic(), sizeof(header.magic)) != 0 ||
+           header.version != verification_cache_format)
+            return false;
+        const auto table_end =
+            sizeof(header) + std::uint64_t{header.chunk_count} * sizeof(verification_cache_chunk);
+        if(table_end > size)
+            return false;
+        chunks.resize(header.chunk_count);
+        std::memcpy(chunks.data(), base + sizeof(header), chunks.size() * sizeof(chunks[0]));
+
+        std::uint64_t total = 0;
+        for(const auto& c : chunks)
+        {
+            if(c.offset < table_end || c.offset > size || c.stored_size > size - c.offset ||
+               (c.compressed == 0 && c.stored_size != c.raw_size))
+                return false;
+            total += c.raw_size;
+        }
+        return total == header.payload_size;
+    }
+
+    static bool is_contiguous_raw(const std::vector<verification_cache_chunk>& chunks)
+    {
+        for(std::size_t i = 0; i < chunks.size(); i++)
+        {
+            if(chunks[i].compressed != 0)
+                return false;
+            if(i > 0 && chunks[i].offset != chunks[i - 1].offset + chunks[i - 1].stored_size)
+                return false;
+        }
+        return true;
+    }
+};
+
+#endif
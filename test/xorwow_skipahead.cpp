@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#include "test.hpp"
+#include <miopen/xorwow_skipahead.hpp>
+
+// The tables the dropout kernels read, the host engine must reproduce them bit by bit.
+#define __constant
+#include "../src/kernels/precalc_xorwow_skipahead_matrices_kernel.h"
+#include "../src/kernels/precalc_xorwow_skipahead_sequence_matrices_kernel.h"
+#undef __constant
+
+static miopen::XorwowVector Next(miopen::XorwowVector s)
+{
+    const std::uint32_t t = s[0] ^ (s[0] >> 2);
+    return {s[1], s[2], s[3], s[4], (s[4] ^ (s[4] << 4)) ^ (t ^ (t << 1))};
+}
+
+static const miopen::XorwowVector start = {123456789, 362436069, 521288629, 88675123, 5783321};
+
+static void SkipMatchesStepping()
+{
+    const auto& offset = miopen::XorwowSkipAhead::Offset();
+    auto state         = start;
+    for(unsigned long long n = 0; n < 1000; n++)
+    {
+        EXPECT(offset.Apply(n, start) == state);
+        state = Next(state);
+    }
+}
+
+static void Composition()
+{
+    const auto& offset   = miopen::XorwowSkipAhead::Offset();
+    const auto& sequence = miopen::XorwowSkipAhead::Sequence();
+
+    const unsigned long long a = 0x123456789abcdefull;
+    const unsigned long long b = 0x0fedcba987654321ull;
+    EXPECT(offset.Apply(a + b, start) == offset.Apply(b, offset.Apply(a, start)));
+
+    // A subsequence is 2^67 = 16 * 2^63 steps.
+    auto state = start;
+    for(int i = 0; i < 16; i++)
+        state = offset.Apply(1ULL << 63, state);
+    EXPECT(sequence.Apply(1, start) == state);
+    EXPECT(sequence.Apply(5, start) == sequence.Apply(2, sequence.Apply(3, start)));
+}
+
+static void Matrices()
+{
+    const auto step = miopen::XorwowMatrix::Step();
+    const auto id   = miopen::XorwowMatrix::Identity();
+    EXPECT((step * id).rows == step.rows);
+    EXPECT(miopen::Pow(step, 0).rows == id.rows);
+    EXPECT(miopen::Pow(step, 12).rows == (miopen::Pow(step, 5) * miopen::Pow(step, 7)).rows);
+    EXPECT(miopen::XorwowSkipAhead::Offset().Matrix(3).rows == miopen::Pow(step, 8).rows);
+}
+
+static bool MatchesTable(const miopen::XorwowMatrix& m, const unsigned int* table)
+{
+    for(std::size_t r = 0; r < m.rows.size(); r++)
+    {
+        for(std::size_t w = 0; w < XORWOW_DIM; w++)
+        {
+            if(m.rows[r][w] != table[r * XORWOW_DIM + w])
+                return false;
+        }
+    }
+    return true;
+}
+
+static void KernelTables()
+{
+    const auto& offset   = miopen::XorwowSkipAhead::Offset();
+    const auto& sequence = miopen::XorwowSkipAhead::Sequence();
+    for(std::size_t k = 0; k < XORWOW_PRECALC_MATRICES_NUM; k++)
+    {
+        EXPECT(MatchesTable(offset.Matrix(k), precalc_xorwow_skipahead_matrices[k]));
+        EXPECT(MatchesTable(sequence.Matrix(k), precalc_xorwow_skipahead_sequence_matrices[k]));
+    }
+}
+
+int main()
+{
+    SkipMatchesStepping();
+    Composition();
+    Matrices();
+    KernelTables();
+}